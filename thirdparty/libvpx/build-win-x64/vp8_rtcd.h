@@ -28,16 +28,25 @@ extern "C" {
 #endif
 
 void vp8_bilinear_predict16x16_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_bilinear_predict16x16 vp8_bilinear_predict16x16_c
+void vp8_bilinear_predict16x16_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_bilinear_predict16x16_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_bilinear_predict16x16_avx2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_bilinear_predict16x16)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_bilinear_predict4x4_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_bilinear_predict4x4 vp8_bilinear_predict4x4_c
+void vp8_bilinear_predict4x4_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_bilinear_predict4x4_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_bilinear_predict4x4)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_bilinear_predict8x4_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_bilinear_predict8x4 vp8_bilinear_predict8x4_c
+void vp8_bilinear_predict8x4_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_bilinear_predict8x4_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_bilinear_predict8x4)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_bilinear_predict8x8_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_bilinear_predict8x8 vp8_bilinear_predict8x8_c
+void vp8_bilinear_predict8x8_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_bilinear_predict8x8_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_bilinear_predict8x8)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 int vp8_block_error_c(short *coeff, short *dqcoeff);
 #define vp8_block_error vp8_block_error_c
@@ -55,52 +64,74 @@ void vp8_copy_mem8x8_c(unsigned char *src, int src_stride, unsigned char *dst, i
 #define vp8_copy_mem8x8 vp8_copy_mem8x8_c
 
 void vp8_dc_only_idct_add_c(short input_dc, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
-#define vp8_dc_only_idct_add vp8_dc_only_idct_add_c
+void vp8_dc_only_idct_add_sse2(short input_dc, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
+RTCD_EXTERN void (*vp8_dc_only_idct_add)(short input_dc, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
 
 void vp8_dequant_idct_add_c(short *input, short *dq, unsigned char *dest, int stride);
-#define vp8_dequant_idct_add vp8_dequant_idct_add_c
+void vp8_dequant_idct_add_sse2(short *input, short *dq, unsigned char *dest, int stride);
+RTCD_EXTERN void (*vp8_dequant_idct_add)(short *input, short *dq, unsigned char *dest, int stride);
 
 void vp8_dequant_idct_add_uv_block_c(short *q, short *dq, unsigned char *dst_u, unsigned char *dst_v, int stride, char *eobs);
-#define vp8_dequant_idct_add_uv_block vp8_dequant_idct_add_uv_block_c
+void vp8_dequant_idct_add_uv_block_sse2(short *q, short *dq, unsigned char *dst_u, unsigned char *dst_v, int stride, char *eobs);
+void vp8_dequant_idct_add_uv_block_avx2(short *q, short *dq, unsigned char *dst_u, unsigned char *dst_v, int stride, char *eobs);
+RTCD_EXTERN void (*vp8_dequant_idct_add_uv_block)(short *q, short *dq, unsigned char *dst_u, unsigned char *dst_v, int stride, char *eobs);
 
 void vp8_dequant_idct_add_y_block_c(short *q, short *dq, unsigned char *dst, int stride, char *eobs);
-#define vp8_dequant_idct_add_y_block vp8_dequant_idct_add_y_block_c
+void vp8_dequant_idct_add_y_block_sse2(short *q, short *dq, unsigned char *dst, int stride, char *eobs);
+void vp8_dequant_idct_add_y_block_avx2(short *q, short *dq, unsigned char *dst, int stride, char *eobs);
+RTCD_EXTERN void (*vp8_dequant_idct_add_y_block)(short *q, short *dq, unsigned char *dst, int stride, char *eobs);
 
 void vp8_dequantize_b_c(struct blockd*, short *DQC);
-#define vp8_dequantize_b vp8_dequantize_b_c
+void vp8_dequantize_b_sse2(struct blockd*, short *DQC);
+RTCD_EXTERN void (*vp8_dequantize_b)(struct blockd*, short *DQC);
 
 int vp8_diamond_search_sad_c(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, union int_mv *best_mv, int search_param, int sad_per_bit, int *num00, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
-#define vp8_diamond_search_sad vp8_diamond_search_sad_c
+int vp8_diamond_search_sadx4(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, union int_mv *best_mv, int search_param, int sad_per_bit, int *num00, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
+RTCD_EXTERN int (*vp8_diamond_search_sad)(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, union int_mv *best_mv, int search_param, int sad_per_bit, int *num00, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
 
 void vp8_fast_quantize_b_c(struct block *, struct blockd *);
-#define vp8_fast_quantize_b vp8_fast_quantize_b_c
+void vp8_fast_quantize_b_sse2(struct block *, struct blockd *);
+RTCD_EXTERN void (*vp8_fast_quantize_b)(struct block *, struct blockd *);
 
 int vp8_full_search_sad_c(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int sad_per_bit, int distance, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
-#define vp8_full_search_sad vp8_full_search_sad_c
+int vp8_full_search_sadx8(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int sad_per_bit, int distance, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
+RTCD_EXTERN int (*vp8_full_search_sad)(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int sad_per_bit, int distance, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
 
 void vp8_loop_filter_bh_c(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
-#define vp8_loop_filter_bh vp8_loop_filter_bh_c
+void vp8_loop_filter_bh_sse2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+void vp8_loop_filter_bh_avx2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+RTCD_EXTERN void (*vp8_loop_filter_bh)(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
 
 void vp8_loop_filter_bv_c(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
-#define vp8_loop_filter_bv vp8_loop_filter_bv_c
+void vp8_loop_filter_bv_sse2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+void vp8_loop_filter_bv_avx2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+RTCD_EXTERN void (*vp8_loop_filter_bv)(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
 
 void vp8_loop_filter_mbh_c(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
-#define vp8_loop_filter_mbh vp8_loop_filter_mbh_c
+void vp8_loop_filter_mbh_sse2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+void vp8_loop_filter_mbh_avx2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+RTCD_EXTERN void (*vp8_loop_filter_mbh)(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
 
 void vp8_loop_filter_mbv_c(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
-#define vp8_loop_filter_mbv vp8_loop_filter_mbv_c
+void vp8_loop_filter_mbv_sse2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+void vp8_loop_filter_mbv_avx2(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
+RTCD_EXTERN void (*vp8_loop_filter_mbv)(unsigned char *y_ptr, unsigned char *u_ptr, unsigned char *v_ptr, int y_stride, int uv_stride, struct loop_filter_info *lfi);
 
 void vp8_loop_filter_bhs_c(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
-#define vp8_loop_filter_simple_bh vp8_loop_filter_bhs_c
+void vp8_loop_filter_bhs_sse2(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
+RTCD_EXTERN void (*vp8_loop_filter_simple_bh)(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
 
 void vp8_loop_filter_bvs_c(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
-#define vp8_loop_filter_simple_bv vp8_loop_filter_bvs_c
+void vp8_loop_filter_bvs_sse2(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
+RTCD_EXTERN void (*vp8_loop_filter_simple_bv)(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
 
 void vp8_loop_filter_simple_horizontal_edge_c(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
-#define vp8_loop_filter_simple_mbh vp8_loop_filter_simple_horizontal_edge_c
+void vp8_loop_filter_simple_horizontal_edge_sse2(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
+RTCD_EXTERN void (*vp8_loop_filter_simple_mbh)(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
 
 void vp8_loop_filter_simple_vertical_edge_c(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
-#define vp8_loop_filter_simple_mbv vp8_loop_filter_simple_vertical_edge_c
+void vp8_loop_filter_simple_vertical_edge_sse2(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
+RTCD_EXTERN void (*vp8_loop_filter_simple_mbv)(unsigned char *y_ptr, int y_stride, const unsigned char *blimit);
 
 int vp8_mbblock_error_c(struct macroblock *mb, int dc);
 #define vp8_mbblock_error vp8_mbblock_error_c
@@ -109,54 +140,276 @@ int vp8_mbuverror_c(struct macroblock *mb);
 #define vp8_mbuverror vp8_mbuverror_c
 
 int vp8_refining_search_sad_c(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int error_per_bit, int search_range, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
-#define vp8_refining_search_sad vp8_refining_search_sad_c
+int vp8_refining_search_sadx4(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int error_per_bit, int search_range, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
+RTCD_EXTERN int (*vp8_refining_search_sad)(struct macroblock *x, struct block *b, struct blockd *d, union int_mv *ref_mv, int error_per_bit, int search_range, struct variance_vtable *fn_ptr, int *mvcost[2], union int_mv *center_mv);
 
 void vp8_regular_quantize_b_c(struct block *, struct blockd *);
-#define vp8_regular_quantize_b vp8_regular_quantize_b_c
+void vp8_regular_quantize_b_sse2(struct block *, struct blockd *);
+RTCD_EXTERN void (*vp8_regular_quantize_b)(struct block *, struct blockd *);
 
 void vp8_short_fdct4x4_c(short *input, short *output, int pitch);
-#define vp8_short_fdct4x4 vp8_short_fdct4x4_c
+void vp8_short_fdct4x4_sse2(short *input, short *output, int pitch);
+RTCD_EXTERN void (*vp8_short_fdct4x4)(short *input, short *output, int pitch);
 
 void vp8_short_fdct8x4_c(short *input, short *output, int pitch);
-#define vp8_short_fdct8x4 vp8_short_fdct8x4_c
+void vp8_short_fdct8x4_sse2(short *input, short *output, int pitch);
+RTCD_EXTERN void (*vp8_short_fdct8x4)(short *input, short *output, int pitch);
 
 void vp8_short_idct4x4llm_c(short *input, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
-#define vp8_short_idct4x4llm vp8_short_idct4x4llm_c
+void vp8_short_idct4x4llm_sse2(short *input, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
+RTCD_EXTERN void (*vp8_short_idct4x4llm)(short *input, unsigned char *pred_ptr, int pred_stride, unsigned char *dst_ptr, int dst_stride);
 
 void vp8_short_inv_walsh4x4_c(short *input, short *mb_dqcoeff);
-#define vp8_short_inv_walsh4x4 vp8_short_inv_walsh4x4_c
+void vp8_short_inv_walsh4x4_sse2(short *input, short *mb_dqcoeff);
+RTCD_EXTERN void (*vp8_short_inv_walsh4x4)(short *input, short *mb_dqcoeff);
 
 void vp8_short_inv_walsh4x4_1_c(short *input, short *mb_dqcoeff);
 #define vp8_short_inv_walsh4x4_1 vp8_short_inv_walsh4x4_1_c
 
 void vp8_short_walsh4x4_c(short *input, short *output, int pitch);
-#define vp8_short_walsh4x4 vp8_short_walsh4x4_c
+void vp8_short_walsh4x4_sse2(short *input, short *output, int pitch);
+RTCD_EXTERN void (*vp8_short_walsh4x4)(short *input, short *output, int pitch);
 
 void vp8_sixtap_predict16x16_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_sixtap_predict16x16 vp8_sixtap_predict16x16_c
+void vp8_sixtap_predict16x16_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_sixtap_predict16x16_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_sixtap_predict16x16)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_sixtap_predict4x4_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_sixtap_predict4x4 vp8_sixtap_predict4x4_c
+void vp8_sixtap_predict4x4_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_sixtap_predict4x4_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_sixtap_predict4x4)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_sixtap_predict8x4_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_sixtap_predict8x4 vp8_sixtap_predict8x4_c
+void vp8_sixtap_predict8x4_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_sixtap_predict8x4_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_sixtap_predict8x4)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_sixtap_predict8x8_c(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
-#define vp8_sixtap_predict8x8 vp8_sixtap_predict8x8_c
+void vp8_sixtap_predict8x8_sse2(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+void vp8_sixtap_predict8x8_ssse3(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
+RTCD_EXTERN void (*vp8_sixtap_predict8x8)(unsigned char *src_ptr, int src_pixels_per_line, int xoffset, int yoffset, unsigned char *dst_ptr, int dst_pitch);
 
 void vp8_temporal_filter_apply_c(unsigned char *frame1, unsigned int stride, unsigned char *frame2, unsigned int block_size, int strength, int filter_weight, unsigned int *accumulator, unsigned short *count);
 #define vp8_temporal_filter_apply vp8_temporal_filter_apply_c
 
 void vp8_rtcd(void);
 
+struct vpx_rtcd_slot;
+int vp8_rtcd_slots(struct vpx_rtcd_slot *slots, int max_slots);
+
 #ifdef RTCD_C
 #include "vpx_ports/x86.h"
+#include "vpx_ports/rtcd_slots.h"
 static void setup_rtcd_internal(void)
 {
-    int flags = x86_simd_caps();
+    int flags = x86_rtcd_simd_caps();
 
     (void)flags;
 
+    vp8_bilinear_predict16x16 = vp8_bilinear_predict16x16_c;
+    if (flags & HAS_SSE2) vp8_bilinear_predict16x16 = vp8_bilinear_predict16x16_sse2;
+    if (flags & HAS_SSSE3) vp8_bilinear_predict16x16 = vp8_bilinear_predict16x16_ssse3;
+    if (flags & HAS_AVX2) vp8_bilinear_predict16x16 = vp8_bilinear_predict16x16_avx2;
+    vp8_bilinear_predict4x4 = vp8_bilinear_predict4x4_c;
+    if (flags & HAS_SSE2) vp8_bilinear_predict4x4 = vp8_bilinear_predict4x4_sse2;
+    if (flags & HAS_SSSE3) vp8_bilinear_predict4x4 = vp8_bilinear_predict4x4_ssse3;
+    vp8_bilinear_predict8x4 = vp8_bilinear_predict8x4_c;
+    if (flags & HAS_SSE2) vp8_bilinear_predict8x4 = vp8_bilinear_predict8x4_sse2;
+    if (flags & HAS_SSSE3) vp8_bilinear_predict8x4 = vp8_bilinear_predict8x4_ssse3;
+    vp8_bilinear_predict8x8 = vp8_bilinear_predict8x8_c;
+    if (flags & HAS_SSE2) vp8_bilinear_predict8x8 = vp8_bilinear_predict8x8_sse2;
+    if (flags & HAS_SSSE3) vp8_bilinear_predict8x8 = vp8_bilinear_predict8x8_ssse3;
+    vp8_dc_only_idct_add = vp8_dc_only_idct_add_c;
+    if (flags & HAS_SSE2) vp8_dc_only_idct_add = vp8_dc_only_idct_add_sse2;
+    vp8_dequant_idct_add = vp8_dequant_idct_add_c;
+    if (flags & HAS_SSE2) vp8_dequant_idct_add = vp8_dequant_idct_add_sse2;
+    vp8_dequant_idct_add_uv_block = vp8_dequant_idct_add_uv_block_c;
+    if (flags & HAS_SSE2) vp8_dequant_idct_add_uv_block = vp8_dequant_idct_add_uv_block_sse2;
+    if (flags & HAS_AVX2) vp8_dequant_idct_add_uv_block = vp8_dequant_idct_add_uv_block_avx2;
+    vp8_dequant_idct_add_y_block = vp8_dequant_idct_add_y_block_c;
+    if (flags & HAS_SSE2) vp8_dequant_idct_add_y_block = vp8_dequant_idct_add_y_block_sse2;
+    if (flags & HAS_AVX2) vp8_dequant_idct_add_y_block = vp8_dequant_idct_add_y_block_avx2;
+    vp8_dequantize_b = vp8_dequantize_b_c;
+    if (flags & HAS_SSE2) vp8_dequantize_b = vp8_dequantize_b_sse2;
+    vp8_diamond_search_sad = vp8_diamond_search_sad_c;
+    if (flags & HAS_SSE2) vp8_diamond_search_sad = vp8_diamond_search_sadx4;
+    vp8_fast_quantize_b = vp8_fast_quantize_b_c;
+    if (flags & HAS_SSE2) vp8_fast_quantize_b = vp8_fast_quantize_b_sse2;
+    vp8_full_search_sad = vp8_full_search_sad_c;
+    if (flags & HAS_SSE2) vp8_full_search_sad = vp8_full_search_sadx8;
+    vp8_loop_filter_bh = vp8_loop_filter_bh_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_bh = vp8_loop_filter_bh_sse2;
+    if (flags & HAS_AVX2) vp8_loop_filter_bh = vp8_loop_filter_bh_avx2;
+    vp8_loop_filter_bv = vp8_loop_filter_bv_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_bv = vp8_loop_filter_bv_sse2;
+    if (flags & HAS_AVX2) vp8_loop_filter_bv = vp8_loop_filter_bv_avx2;
+    vp8_loop_filter_mbh = vp8_loop_filter_mbh_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_mbh = vp8_loop_filter_mbh_sse2;
+    if (flags & HAS_AVX2) vp8_loop_filter_mbh = vp8_loop_filter_mbh_avx2;
+    vp8_loop_filter_mbv = vp8_loop_filter_mbv_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_mbv = vp8_loop_filter_mbv_sse2;
+    if (flags & HAS_AVX2) vp8_loop_filter_mbv = vp8_loop_filter_mbv_avx2;
+    vp8_loop_filter_simple_bh = vp8_loop_filter_bhs_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_simple_bh = vp8_loop_filter_bhs_sse2;
+    vp8_loop_filter_simple_bv = vp8_loop_filter_bvs_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_simple_bv = vp8_loop_filter_bvs_sse2;
+    vp8_loop_filter_simple_mbh = vp8_loop_filter_simple_horizontal_edge_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_simple_mbh = vp8_loop_filter_simple_horizontal_edge_sse2;
+    vp8_loop_filter_simple_mbv = vp8_loop_filter_simple_vertical_edge_c;
+    if (flags & HAS_SSE2) vp8_loop_filter_simple_mbv = vp8_loop_filter_simple_vertical_edge_sse2;
+    vp8_refining_search_sad = vp8_refining_search_sad_c;
+    if (flags & HAS_SSE2) vp8_refining_search_sad = vp8_refining_search_sadx4;
+    vp8_regular_quantize_b = vp8_regular_quantize_b_c;
+    if (flags & HAS_SSE2) vp8_regular_quantize_b = vp8_regular_quantize_b_sse2;
+    vp8_short_fdct4x4 = vp8_short_fdct4x4_c;
+    if (flags & HAS_SSE2) vp8_short_fdct4x4 = vp8_short_fdct4x4_sse2;
+    vp8_short_fdct8x4 = vp8_short_fdct8x4_c;
+    if (flags & HAS_SSE2) vp8_short_fdct8x4 = vp8_short_fdct8x4_sse2;
+    vp8_short_idct4x4llm = vp8_short_idct4x4llm_c;
+    if (flags & HAS_SSE2) vp8_short_idct4x4llm = vp8_short_idct4x4llm_sse2;
+    vp8_short_inv_walsh4x4 = vp8_short_inv_walsh4x4_c;
+    if (flags & HAS_SSE2) vp8_short_inv_walsh4x4 = vp8_short_inv_walsh4x4_sse2;
+    vp8_short_walsh4x4 = vp8_short_walsh4x4_c;
+    if (flags & HAS_SSE2) vp8_short_walsh4x4 = vp8_short_walsh4x4_sse2;
+    vp8_sixtap_predict16x16 = vp8_sixtap_predict16x16_c;
+    if (flags & HAS_SSE2) vp8_sixtap_predict16x16 = vp8_sixtap_predict16x16_sse2;
+    if (flags & HAS_SSSE3) vp8_sixtap_predict16x16 = vp8_sixtap_predict16x16_ssse3;
+    vp8_sixtap_predict4x4 = vp8_sixtap_predict4x4_c;
+    if (flags & HAS_SSE2) vp8_sixtap_predict4x4 = vp8_sixtap_predict4x4_sse2;
+    if (flags & HAS_SSSE3) vp8_sixtap_predict4x4 = vp8_sixtap_predict4x4_ssse3;
+    vp8_sixtap_predict8x4 = vp8_sixtap_predict8x4_c;
+    if (flags & HAS_SSE2) vp8_sixtap_predict8x4 = vp8_sixtap_predict8x4_sse2;
+    if (flags & HAS_SSSE3) vp8_sixtap_predict8x4 = vp8_sixtap_predict8x4_ssse3;
+    vp8_sixtap_predict8x8 = vp8_sixtap_predict8x8_c;
+    if (flags & HAS_SSE2) vp8_sixtap_predict8x8 = vp8_sixtap_predict8x8_sse2;
+    if (flags & HAS_SSSE3) vp8_sixtap_predict8x8 = vp8_sixtap_predict8x8_ssse3;
+
+}
+
+static int rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots)
+{
+    int n = 0;
+
+    RTCD_SLOT(vp8_bilinear_predict16x16, NULL);
+    RTCD_VARIANT(vp8_bilinear_predict16x16, vp8_bilinear_predict16x16_c, "c");
+    RTCD_VARIANT(vp8_bilinear_predict16x16, vp8_bilinear_predict16x16_sse2, "sse2");
+    RTCD_VARIANT(vp8_bilinear_predict16x16, vp8_bilinear_predict16x16_ssse3, "ssse3");
+    RTCD_VARIANT(vp8_bilinear_predict16x16, vp8_bilinear_predict16x16_avx2, "avx2");
+    RTCD_SLOT(vp8_bilinear_predict4x4, NULL);
+    RTCD_VARIANT(vp8_bilinear_predict4x4, vp8_bilinear_predict4x4_c, "c");
+    RTCD_VARIANT(vp8_bilinear_predict4x4, vp8_bilinear_predict4x4_sse2, "sse2");
+    RTCD_VARIANT(vp8_bilinear_predict4x4, vp8_bilinear_predict4x4_ssse3, "ssse3");
+    RTCD_SLOT(vp8_bilinear_predict8x4, NULL);
+    RTCD_VARIANT(vp8_bilinear_predict8x4, vp8_bilinear_predict8x4_c, "c");
+    RTCD_VARIANT(vp8_bilinear_predict8x4, vp8_bilinear_predict8x4_sse2, "sse2");
+    RTCD_VARIANT(vp8_bilinear_predict8x4, vp8_bilinear_predict8x4_ssse3, "ssse3");
+    RTCD_SLOT(vp8_bilinear_predict8x8, NULL);
+    RTCD_VARIANT(vp8_bilinear_predict8x8, vp8_bilinear_predict8x8_c, "c");
+    RTCD_VARIANT(vp8_bilinear_predict8x8, vp8_bilinear_predict8x8_sse2, "sse2");
+    RTCD_VARIANT(vp8_bilinear_predict8x8, vp8_bilinear_predict8x8_ssse3, "ssse3");
+    RTCD_SLOT(vp8_block_error, "c");
+    RTCD_SLOT(vp8_copy32xn, "c");
+    RTCD_SLOT(vp8_copy_mem16x16, "c");
+    RTCD_SLOT(vp8_copy_mem8x4, "c");
+    RTCD_SLOT(vp8_copy_mem8x8, "c");
+    RTCD_SLOT(vp8_dc_only_idct_add, NULL);
+    RTCD_VARIANT(vp8_dc_only_idct_add, vp8_dc_only_idct_add_c, "c");
+    RTCD_VARIANT(vp8_dc_only_idct_add, vp8_dc_only_idct_add_sse2, "sse2");
+    RTCD_SLOT(vp8_dequant_idct_add, NULL);
+    RTCD_VARIANT(vp8_dequant_idct_add, vp8_dequant_idct_add_c, "c");
+    RTCD_VARIANT(vp8_dequant_idct_add, vp8_dequant_idct_add_sse2, "sse2");
+    RTCD_SLOT(vp8_dequant_idct_add_uv_block, NULL);
+    RTCD_VARIANT(vp8_dequant_idct_add_uv_block, vp8_dequant_idct_add_uv_block_c, "c");
+    RTCD_VARIANT(vp8_dequant_idct_add_uv_block, vp8_dequant_idct_add_uv_block_sse2, "sse2");
+    RTCD_VARIANT(vp8_dequant_idct_add_uv_block, vp8_dequant_idct_add_uv_block_avx2, "avx2");
+    RTCD_SLOT(vp8_dequant_idct_add_y_block, NULL);
+    RTCD_VARIANT(vp8_dequant_idct_add_y_block, vp8_dequant_idct_add_y_block_c, "c");
+    RTCD_VARIANT(vp8_dequant_idct_add_y_block, vp8_dequant_idct_add_y_block_sse2, "sse2");
+    RTCD_VARIANT(vp8_dequant_idct_add_y_block, vp8_dequant_idct_add_y_block_avx2, "avx2");
+    RTCD_SLOT(vp8_dequantize_b, NULL);
+    RTCD_VARIANT(vp8_dequantize_b, vp8_dequantize_b_c, "c");
+    RTCD_VARIANT(vp8_dequantize_b, vp8_dequantize_b_sse2, "sse2");
+    RTCD_SLOT(vp8_diamond_search_sad, NULL);
+    RTCD_VARIANT(vp8_diamond_search_sad, vp8_diamond_search_sad_c, "c");
+    RTCD_VARIANT(vp8_diamond_search_sad, vp8_diamond_search_sadx4, "sse2");
+    RTCD_SLOT(vp8_fast_quantize_b, NULL);
+    RTCD_VARIANT(vp8_fast_quantize_b, vp8_fast_quantize_b_c, "c");
+    RTCD_VARIANT(vp8_fast_quantize_b, vp8_fast_quantize_b_sse2, "sse2");
+    RTCD_SLOT(vp8_full_search_sad, NULL);
+    RTCD_VARIANT(vp8_full_search_sad, vp8_full_search_sad_c, "c");
+    RTCD_VARIANT(vp8_full_search_sad, vp8_full_search_sadx8, "sse2");
+    RTCD_SLOT(vp8_loop_filter_bh, NULL);
+    RTCD_VARIANT(vp8_loop_filter_bh, vp8_loop_filter_bh_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_bh, vp8_loop_filter_bh_sse2, "sse2");
+    RTCD_VARIANT(vp8_loop_filter_bh, vp8_loop_filter_bh_avx2, "avx2");
+    RTCD_SLOT(vp8_loop_filter_bv, NULL);
+    RTCD_VARIANT(vp8_loop_filter_bv, vp8_loop_filter_bv_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_bv, vp8_loop_filter_bv_sse2, "sse2");
+    RTCD_VARIANT(vp8_loop_filter_bv, vp8_loop_filter_bv_avx2, "avx2");
+    RTCD_SLOT(vp8_loop_filter_mbh, NULL);
+    RTCD_VARIANT(vp8_loop_filter_mbh, vp8_loop_filter_mbh_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_mbh, vp8_loop_filter_mbh_sse2, "sse2");
+    RTCD_VARIANT(vp8_loop_filter_mbh, vp8_loop_filter_mbh_avx2, "avx2");
+    RTCD_SLOT(vp8_loop_filter_mbv, NULL);
+    RTCD_VARIANT(vp8_loop_filter_mbv, vp8_loop_filter_mbv_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_mbv, vp8_loop_filter_mbv_sse2, "sse2");
+    RTCD_VARIANT(vp8_loop_filter_mbv, vp8_loop_filter_mbv_avx2, "avx2");
+    RTCD_SLOT(vp8_loop_filter_simple_bh, NULL);
+    RTCD_VARIANT(vp8_loop_filter_simple_bh, vp8_loop_filter_bhs_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_simple_bh, vp8_loop_filter_bhs_sse2, "sse2");
+    RTCD_SLOT(vp8_loop_filter_simple_bv, NULL);
+    RTCD_VARIANT(vp8_loop_filter_simple_bv, vp8_loop_filter_bvs_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_simple_bv, vp8_loop_filter_bvs_sse2, "sse2");
+    RTCD_SLOT(vp8_loop_filter_simple_mbh, NULL);
+    RTCD_VARIANT(vp8_loop_filter_simple_mbh, vp8_loop_filter_simple_horizontal_edge_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_simple_mbh, vp8_loop_filter_simple_horizontal_edge_sse2, "sse2");
+    RTCD_SLOT(vp8_loop_filter_simple_mbv, NULL);
+    RTCD_VARIANT(vp8_loop_filter_simple_mbv, vp8_loop_filter_simple_vertical_edge_c, "c");
+    RTCD_VARIANT(vp8_loop_filter_simple_mbv, vp8_loop_filter_simple_vertical_edge_sse2, "sse2");
+    RTCD_SLOT(vp8_mbblock_error, "c");
+    RTCD_SLOT(vp8_mbuverror, "c");
+    RTCD_SLOT(vp8_refining_search_sad, NULL);
+    RTCD_VARIANT(vp8_refining_search_sad, vp8_refining_search_sad_c, "c");
+    RTCD_VARIANT(vp8_refining_search_sad, vp8_refining_search_sadx4, "sse2");
+    RTCD_SLOT(vp8_regular_quantize_b, NULL);
+    RTCD_VARIANT(vp8_regular_quantize_b, vp8_regular_quantize_b_c, "c");
+    RTCD_VARIANT(vp8_regular_quantize_b, vp8_regular_quantize_b_sse2, "sse2");
+    RTCD_SLOT(vp8_short_fdct4x4, NULL);
+    RTCD_VARIANT(vp8_short_fdct4x4, vp8_short_fdct4x4_c, "c");
+    RTCD_VARIANT(vp8_short_fdct4x4, vp8_short_fdct4x4_sse2, "sse2");
+    RTCD_SLOT(vp8_short_fdct8x4, NULL);
+    RTCD_VARIANT(vp8_short_fdct8x4, vp8_short_fdct8x4_c, "c");
+    RTCD_VARIANT(vp8_short_fdct8x4, vp8_short_fdct8x4_sse2, "sse2");
+    RTCD_SLOT(vp8_short_idct4x4llm, NULL);
+    RTCD_VARIANT(vp8_short_idct4x4llm, vp8_short_idct4x4llm_c, "c");
+    RTCD_VARIANT(vp8_short_idct4x4llm, vp8_short_idct4x4llm_sse2, "sse2");
+    RTCD_SLOT(vp8_short_inv_walsh4x4, NULL);
+    RTCD_VARIANT(vp8_short_inv_walsh4x4, vp8_short_inv_walsh4x4_c, "c");
+    RTCD_VARIANT(vp8_short_inv_walsh4x4, vp8_short_inv_walsh4x4_sse2, "sse2");
+    RTCD_SLOT(vp8_short_inv_walsh4x4_1, "c");
+    RTCD_SLOT(vp8_short_walsh4x4, NULL);
+    RTCD_VARIANT(vp8_short_walsh4x4, vp8_short_walsh4x4_c, "c");
+    RTCD_VARIANT(vp8_short_walsh4x4, vp8_short_walsh4x4_sse2, "sse2");
+    RTCD_SLOT(vp8_sixtap_predict16x16, NULL);
+    RTCD_VARIANT(vp8_sixtap_predict16x16, vp8_sixtap_predict16x16_c, "c");
+    RTCD_VARIANT(vp8_sixtap_predict16x16, vp8_sixtap_predict16x16_sse2, "sse2");
+    RTCD_VARIANT(vp8_sixtap_predict16x16, vp8_sixtap_predict16x16_ssse3, "ssse3");
+    RTCD_SLOT(vp8_sixtap_predict4x4, NULL);
+    RTCD_VARIANT(vp8_sixtap_predict4x4, vp8_sixtap_predict4x4_c, "c");
+    RTCD_VARIANT(vp8_sixtap_predict4x4, vp8_sixtap_predict4x4_sse2, "sse2");
+    RTCD_VARIANT(vp8_sixtap_predict4x4, vp8_sixtap_predict4x4_ssse3, "ssse3");
+    RTCD_SLOT(vp8_sixtap_predict8x4, NULL);
+    RTCD_VARIANT(vp8_sixtap_predict8x4, vp8_sixtap_predict8x4_c, "c");
+    RTCD_VARIANT(vp8_sixtap_predict8x4, vp8_sixtap_predict8x4_sse2, "sse2");
+    RTCD_VARIANT(vp8_sixtap_predict8x4, vp8_sixtap_predict8x4_ssse3, "ssse3");
+    RTCD_SLOT(vp8_sixtap_predict8x8, NULL);
+    RTCD_VARIANT(vp8_sixtap_predict8x8, vp8_sixtap_predict8x8_c, "c");
+    RTCD_VARIANT(vp8_sixtap_predict8x8, vp8_sixtap_predict8x8_sse2, "sse2");
+    RTCD_VARIANT(vp8_sixtap_predict8x8, vp8_sixtap_predict8x8_ssse3, "ssse3");
+    RTCD_SLOT(vp8_temporal_filter_apply, "c");
+
+    return n;
 }
 #endif
 
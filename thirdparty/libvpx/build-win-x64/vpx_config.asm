@@ -1,7 +1,7 @@
 VPX_ARCH_ARM equ 0
 VPX_ARCH_MIPS equ 0
 VPX_ARCH_X86 equ 0
-VPX_ARCH_X86_64 equ 0
+VPX_ARCH_X86_64 equ 1
 VPX_ARCH_PPC equ 0
 HAVE_NEON equ 0
 HAVE_NEON_ASM equ 0
@@ -11,12 +11,12 @@ HAVE_MSA equ 0
 HAVE_MIPS64 equ 0
 HAVE_MMX equ 0
 HAVE_SSE equ 0
-HAVE_SSE2 equ 0
+HAVE_SSE2 equ 1
 HAVE_SSE3 equ 0
-HAVE_SSSE3 equ 0
+HAVE_SSSE3 equ 1
 HAVE_SSE4_1 equ 0
 HAVE_AVX equ 0
-HAVE_AVX2 equ 0
+HAVE_AVX2 equ 1
 HAVE_AVX512 equ 0
 HAVE_VSX equ 0
 HAVE_MMI equ 0
@@ -41,10 +41,10 @@ CONFIG_CODEC_SRCS equ 0
 CONFIG_DEBUG_LIBS equ 0
 CONFIG_DEQUANT_TOKENS equ 0
 CONFIG_DC_RECON equ 0
-CONFIG_RUNTIME_CPU_DETECT equ 0
+CONFIG_RUNTIME_CPU_DETECT equ 1
 CONFIG_POSTPROC equ 0
 CONFIG_VP9_POSTPROC equ 0
-CONFIG_MULTITHREAD equ 0
+CONFIG_MULTITHREAD equ 1
 CONFIG_INTERNAL_STATS equ 0
 CONFIG_VP8_ENCODER equ 1
 CONFIG_VP8_DECODER equ 1
@@ -58,7 +58,7 @@ CONFIG_STATIC_MSVCRT equ 0
 CONFIG_SPATIAL_RESAMPLING equ 0
 CONFIG_REALTIME_ONLY equ 0
 CONFIG_ONTHEFLY_BITPACKING equ 0
-CONFIG_ERROR_CONCEALMENT equ 0
+CONFIG_ERROR_CONCEALMENT equ 1
 CONFIG_SHARED equ 0
 CONFIG_STATIC equ 0
 CONFIG_SMALL equ 0
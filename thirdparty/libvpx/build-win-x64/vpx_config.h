@@ -13,7 +13,7 @@
 #define VPX_ARCH_ARM 0
 #define VPX_ARCH_MIPS 0
 #define VPX_ARCH_X86 0
-#define VPX_ARCH_X86_64 0
+#define VPX_ARCH_X86_64 1
 #define VPX_ARCH_PPC 0
 #define HAVE_NEON 0
 #define HAVE_NEON_ASM 0
@@ -23,12 +23,12 @@
 #define HAVE_MIPS64 0
 #define HAVE_MMX 0
 #define HAVE_SSE 0
-#define HAVE_SSE2 0
+#define HAVE_SSE2 1
 #define HAVE_SSE3 0
-#define HAVE_SSSE3 0
+#define HAVE_SSSE3 1
 #define HAVE_SSE4_1 0
 #define HAVE_AVX 0
-#define HAVE_AVX2 0
+#define HAVE_AVX2 1
 #define HAVE_AVX512 0
 #define HAVE_VSX 0
 #define HAVE_MMI 0
@@ -53,10 +53,10 @@
 #define CONFIG_DEBUG_LIBS 0
 #define CONFIG_DEQUANT_TOKENS 0
 #define CONFIG_DC_RECON 0
-#define CONFIG_RUNTIME_CPU_DETECT 0
+#define CONFIG_RUNTIME_CPU_DETECT 1
 #define CONFIG_POSTPROC 0
 #define CONFIG_VP9_POSTPROC 0
-#define CONFIG_MULTITHREAD 0
+#define CONFIG_MULTITHREAD 1
 #define CONFIG_INTERNAL_STATS 0
 #define CONFIG_VP8_ENCODER 1
 #define CONFIG_VP8_DECODER 1
@@ -70,7 +70,7 @@
 #define CONFIG_SPATIAL_RESAMPLING 0
 #define CONFIG_REALTIME_ONLY 0
 #define CONFIG_ONTHEFLY_BITPACKING 0
-#define CONFIG_ERROR_CONCEALMENT 0
+#define CONFIG_ERROR_CONCEALMENT 1
 #define CONFIG_SHARED 0
 #define CONFIG_STATIC 0
 #define CONFIG_SMALL 0
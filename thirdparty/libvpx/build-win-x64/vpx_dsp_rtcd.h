@@ -31,7 +31,8 @@ void vpx_d117_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_d117_predictor_32x32 vpx_d117_predictor_32x32_c
 
 void vpx_d117_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d117_predictor_4x4 vpx_d117_predictor_4x4_c
+void vpx_d117_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d117_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_d117_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_d117_predictor_8x8 vpx_d117_predictor_8x8_c
@@ -43,7 +44,8 @@ void vpx_d135_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_d135_predictor_32x32 vpx_d135_predictor_32x32_c
 
 void vpx_d135_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d135_predictor_4x4 vpx_d135_predictor_4x4_c
+void vpx_d135_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d135_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_d135_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_d135_predictor_8x8 vpx_d135_predictor_8x8_c
@@ -55,7 +57,8 @@ void vpx_d153_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_d153_predictor_32x32 vpx_d153_predictor_32x32_c
 
 void vpx_d153_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d153_predictor_4x4 vpx_d153_predictor_4x4_c
+void vpx_d153_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d153_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_d153_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_d153_predictor_8x8 vpx_d153_predictor_8x8_c
@@ -67,7 +70,8 @@ void vpx_d207_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_d207_predictor_32x32 vpx_d207_predictor_32x32_c
 
 void vpx_d207_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d207_predictor_4x4 vpx_d207_predictor_4x4_c
+void vpx_d207_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d207_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_d207_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_d207_predictor_8x8 vpx_d207_predictor_8x8_c
@@ -85,7 +89,8 @@ void vpx_d45_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *abov
 #define vpx_d45_predictor_8x8 vpx_d45_predictor_8x8_c
 
 void vpx_d45e_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d45e_predictor_4x4 vpx_d45e_predictor_4x4_c
+void vpx_d45e_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d45e_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_d63_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_d63_predictor_16x16 vpx_d63_predictor_16x16_c
@@ -100,10 +105,12 @@ void vpx_d63_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *abov
 #define vpx_d63_predictor_8x8 vpx_d63_predictor_8x8_c
 
 void vpx_d63e_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_d63e_predictor_4x4 vpx_d63e_predictor_4x4_c
+void vpx_d63e_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_d63e_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_128_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_128_predictor_16x16 vpx_dc_128_predictor_16x16_c
+void vpx_dc_128_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_128_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_128_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_dc_128_predictor_32x32 vpx_dc_128_predictor_32x32_c
@@ -112,10 +119,12 @@ void vpx_dc_128_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_dc_128_predictor_4x4 vpx_dc_128_predictor_4x4_c
 
 void vpx_dc_128_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_128_predictor_8x8 vpx_dc_128_predictor_8x8_c
+void vpx_dc_128_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_128_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_left_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_left_predictor_16x16 vpx_dc_left_predictor_16x16_c
+void vpx_dc_left_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_left_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_left_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_dc_left_predictor_32x32 vpx_dc_left_predictor_32x32_c
@@ -124,22 +133,27 @@ void vpx_dc_left_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *
 #define vpx_dc_left_predictor_4x4 vpx_dc_left_predictor_4x4_c
 
 void vpx_dc_left_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_left_predictor_8x8 vpx_dc_left_predictor_8x8_c
+void vpx_dc_left_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_left_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_predictor_16x16 vpx_dc_predictor_16x16_c
+void vpx_dc_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_dc_predictor_32x32 vpx_dc_predictor_32x32_c
 
 void vpx_dc_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_predictor_4x4 vpx_dc_predictor_4x4_c
+void vpx_dc_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_predictor_8x8 vpx_dc_predictor_8x8_c
+void vpx_dc_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_top_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_top_predictor_16x16 vpx_dc_top_predictor_16x16_c
+void vpx_dc_top_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_top_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dc_top_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_dc_top_predictor_32x32 vpx_dc_top_predictor_32x32_c
@@ -148,13 +162,15 @@ void vpx_dc_top_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *a
 #define vpx_dc_top_predictor_4x4 vpx_dc_top_predictor_4x4_c
 
 void vpx_dc_top_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_dc_top_predictor_8x8 vpx_dc_top_predictor_8x8_c
+void vpx_dc_top_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_dc_top_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_get16x16var_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse, int *sum);
 #define vpx_get16x16var vpx_get16x16var_c
 
 unsigned int vpx_get4x4sse_cs_c(const unsigned char *src_ptr, int src_stride, const unsigned char *ref_ptr, int ref_stride);
-#define vpx_get4x4sse_cs vpx_get4x4sse_cs_c
+unsigned int vpx_get4x4sse_cs_sse2(const unsigned char *src_ptr, int src_stride, const unsigned char *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_get4x4sse_cs)(const unsigned char *src_ptr, int src_stride, const unsigned char *ref_ptr, int ref_stride);
 
 void vpx_get8x8var_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse, int *sum);
 #define vpx_get8x8var vpx_get8x8var_c
@@ -163,7 +179,8 @@ unsigned int vpx_get_mb_ss_c(const int16_t *);
 #define vpx_get_mb_ss vpx_get_mb_ss_c
 
 void vpx_h_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_h_predictor_16x16 vpx_h_predictor_16x16_c
+void vpx_h_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_h_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_h_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_h_predictor_32x32 vpx_h_predictor_32x32_c
@@ -172,37 +189,52 @@ void vpx_h_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
 #define vpx_h_predictor_4x4 vpx_h_predictor_4x4_c
 
 void vpx_h_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_h_predictor_8x8 vpx_h_predictor_8x8_c
+void vpx_h_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_h_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_he_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_he_predictor_4x4 vpx_he_predictor_4x4_c
+void vpx_he_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_he_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 unsigned int vpx_mse16x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_mse16x16 vpx_mse16x16_c
+unsigned int vpx_mse16x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int vpx_mse16x16_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_mse16x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_mse16x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_mse16x8 vpx_mse16x8_c
+unsigned int vpx_mse16x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_mse16x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_mse8x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_mse8x16 vpx_mse8x16_c
+unsigned int vpx_mse8x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_mse8x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_mse8x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_mse8x8 vpx_mse8x8_c
+unsigned int vpx_mse8x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_mse8x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_sad16x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
-#define vpx_sad16x16 vpx_sad16x16_c
+unsigned int vpx_sad16x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+unsigned int vpx_sad16x16_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_sad16x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
 unsigned int vpx_sad16x16_avg_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, const uint8_t *second_pred);
 #define vpx_sad16x16_avg vpx_sad16x16_avg_c
 
 void vpx_sad16x16x3_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x16x3 vpx_sad16x16x3_c
+void vpx_sad16x16x3_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+void vpx_sad16x16x3_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x16x3)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 void vpx_sad16x16x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x16x4d vpx_sad16x16x4d_c
+void vpx_sad16x16x4d_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+void vpx_sad16x16x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x16x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
 
 void vpx_sad16x16x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x16x8 vpx_sad16x16x8_c
+void vpx_sad16x16x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+void vpx_sad16x16x8_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x16x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 unsigned int vpx_sad16x32_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 #define vpx_sad16x32 vpx_sad16x32_c
@@ -214,19 +246,27 @@ void vpx_sad16x32x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * c
 #define vpx_sad16x32x4d vpx_sad16x32x4d_c
 
 unsigned int vpx_sad16x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
-#define vpx_sad16x8 vpx_sad16x8_c
+unsigned int vpx_sad16x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+unsigned int vpx_sad16x8_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_sad16x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
 unsigned int vpx_sad16x8_avg_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, const uint8_t *second_pred);
 #define vpx_sad16x8_avg vpx_sad16x8_avg_c
 
 void vpx_sad16x8x3_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x8x3 vpx_sad16x8x3_c
+void vpx_sad16x8x3_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+void vpx_sad16x8x3_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x8x3)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 void vpx_sad16x8x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x8x4d vpx_sad16x8x4d_c
+void vpx_sad16x8x4d_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+void vpx_sad16x8x4d_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x8x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
 
 void vpx_sad16x8x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad16x8x8 vpx_sad16x8x8_c
+void vpx_sad16x8x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+void vpx_sad16x8x8_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad16x8x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 unsigned int vpx_sad32x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 #define vpx_sad32x16 vpx_sad32x16_c
@@ -259,19 +299,23 @@ void vpx_sad32x64x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * c
 #define vpx_sad32x64x4d vpx_sad32x64x4d_c
 
 unsigned int vpx_sad4x4_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
-#define vpx_sad4x4 vpx_sad4x4_c
+unsigned int vpx_sad4x4_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_sad4x4)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
 unsigned int vpx_sad4x4_avg_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, const uint8_t *second_pred);
 #define vpx_sad4x4_avg vpx_sad4x4_avg_c
 
 void vpx_sad4x4x3_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad4x4x3 vpx_sad4x4x3_c
+void vpx_sad4x4x3_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad4x4x3)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 void vpx_sad4x4x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
-#define vpx_sad4x4x4d vpx_sad4x4x4d_c
+void vpx_sad4x4x4d_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad4x4x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
 
 void vpx_sad4x4x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad4x4x8 vpx_sad4x4x8_c
+void vpx_sad4x4x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad4x4x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 unsigned int vpx_sad4x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 #define vpx_sad4x8 vpx_sad4x8_c
@@ -301,19 +345,23 @@ void vpx_sad64x64x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * c
 #define vpx_sad64x64x4d vpx_sad64x64x4d_c
 
 unsigned int vpx_sad8x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
-#define vpx_sad8x16 vpx_sad8x16_c
+unsigned int vpx_sad8x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_sad8x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
 unsigned int vpx_sad8x16_avg_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, const uint8_t *second_pred);
 #define vpx_sad8x16_avg vpx_sad8x16_avg_c
 
 void vpx_sad8x16x3_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x16x3 vpx_sad8x16x3_c
+void vpx_sad8x16x3_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x16x3)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 void vpx_sad8x16x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x16x4d vpx_sad8x16x4d_c
+void vpx_sad8x16x4d_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x16x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
 
 void vpx_sad8x16x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x16x8 vpx_sad8x16x8_c
+void vpx_sad8x16x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x16x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 unsigned int vpx_sad8x4_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 #define vpx_sad8x4 vpx_sad8x4_c
@@ -325,19 +373,23 @@ void vpx_sad8x4x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * con
 #define vpx_sad8x4x4d vpx_sad8x4x4d_c
 
 unsigned int vpx_sad8x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
-#define vpx_sad8x8 vpx_sad8x8_c
+unsigned int vpx_sad8x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
+RTCD_EXTERN unsigned int (*vpx_sad8x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride);
 
 unsigned int vpx_sad8x8_avg_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, const uint8_t *second_pred);
 #define vpx_sad8x8_avg vpx_sad8x8_avg_c
 
 void vpx_sad8x8x3_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x8x3 vpx_sad8x8x3_c
+void vpx_sad8x8x3_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x8x3)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 void vpx_sad8x8x4d_c(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x8x4d vpx_sad8x8x4d_c
+void vpx_sad8x8x4d_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x8x4d)(const uint8_t *src_ptr, int src_stride, const uint8_t * const ref_array[], int ref_stride, uint32_t *sad_array);
 
 void vpx_sad8x8x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
-#define vpx_sad8x8x8 vpx_sad8x8x8_c
+void vpx_sad8x8x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
+RTCD_EXTERN void (*vpx_sad8x8x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, uint32_t *sad_array);
 
 uint32_t vpx_sub_pixel_avg_variance16x16_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse, const uint8_t *second_pred);
 #define vpx_sub_pixel_avg_variance16x16 vpx_sub_pixel_avg_variance16x16_c
@@ -379,13 +431,17 @@ uint32_t vpx_sub_pixel_avg_variance8x8_c(const uint8_t *src_ptr, int src_stride,
 #define vpx_sub_pixel_avg_variance8x8 vpx_sub_pixel_avg_variance8x8_c
 
 uint32_t vpx_sub_pixel_variance16x16_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
-#define vpx_sub_pixel_variance16x16 vpx_sub_pixel_variance16x16_c
+uint32_t vpx_sub_pixel_variance16x16_sse2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+uint32_t vpx_sub_pixel_variance16x16_avx2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+RTCD_EXTERN uint32_t (*vpx_sub_pixel_variance16x16)(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 
 uint32_t vpx_sub_pixel_variance16x32_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 #define vpx_sub_pixel_variance16x32 vpx_sub_pixel_variance16x32_c
 
 uint32_t vpx_sub_pixel_variance16x8_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
-#define vpx_sub_pixel_variance16x8 vpx_sub_pixel_variance16x8_c
+uint32_t vpx_sub_pixel_variance16x8_sse2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+uint32_t vpx_sub_pixel_variance16x8_avx2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+RTCD_EXTERN uint32_t (*vpx_sub_pixel_variance16x8)(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 
 uint32_t vpx_sub_pixel_variance32x16_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 #define vpx_sub_pixel_variance32x16 vpx_sub_pixel_variance32x16_c
@@ -397,7 +453,8 @@ uint32_t vpx_sub_pixel_variance32x64_c(const uint8_t *src_ptr, int src_stride, i
 #define vpx_sub_pixel_variance32x64 vpx_sub_pixel_variance32x64_c
 
 uint32_t vpx_sub_pixel_variance4x4_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
-#define vpx_sub_pixel_variance4x4 vpx_sub_pixel_variance4x4_c
+uint32_t vpx_sub_pixel_variance4x4_sse2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+RTCD_EXTERN uint32_t (*vpx_sub_pixel_variance4x4)(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 
 uint32_t vpx_sub_pixel_variance4x8_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 #define vpx_sub_pixel_variance4x8 vpx_sub_pixel_variance4x8_c
@@ -409,34 +466,41 @@ uint32_t vpx_sub_pixel_variance64x64_c(const uint8_t *src_ptr, int src_stride, i
 #define vpx_sub_pixel_variance64x64 vpx_sub_pixel_variance64x64_c
 
 uint32_t vpx_sub_pixel_variance8x16_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
-#define vpx_sub_pixel_variance8x16 vpx_sub_pixel_variance8x16_c
+uint32_t vpx_sub_pixel_variance8x16_sse2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+RTCD_EXTERN uint32_t (*vpx_sub_pixel_variance8x16)(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 
 uint32_t vpx_sub_pixel_variance8x4_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 #define vpx_sub_pixel_variance8x4 vpx_sub_pixel_variance8x4_c
 
 uint32_t vpx_sub_pixel_variance8x8_c(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
-#define vpx_sub_pixel_variance8x8 vpx_sub_pixel_variance8x8_c
+uint32_t vpx_sub_pixel_variance8x8_sse2(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
+RTCD_EXTERN uint32_t (*vpx_sub_pixel_variance8x8)(const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);
 
 void vpx_subtract_block_c(int rows, int cols, int16_t *diff_ptr, ptrdiff_t diff_stride, const uint8_t *src_ptr, ptrdiff_t src_stride, const uint8_t *pred_ptr, ptrdiff_t pred_stride);
-#define vpx_subtract_block vpx_subtract_block_c
+void vpx_subtract_block_sse2(int rows, int cols, int16_t *diff_ptr, ptrdiff_t diff_stride, const uint8_t *src_ptr, ptrdiff_t src_stride, const uint8_t *pred_ptr, ptrdiff_t pred_stride);
+RTCD_EXTERN void (*vpx_subtract_block)(int rows, int cols, int16_t *diff_ptr, ptrdiff_t diff_stride, const uint8_t *src_ptr, ptrdiff_t src_stride, const uint8_t *pred_ptr, ptrdiff_t pred_stride);
 
 uint64_t vpx_sum_squares_2d_i16_c(const int16_t *src, int stride, int size);
 #define vpx_sum_squares_2d_i16 vpx_sum_squares_2d_i16_c
 
 void vpx_tm_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_tm_predictor_16x16 vpx_tm_predictor_16x16_c
+void vpx_tm_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_tm_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_tm_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_tm_predictor_32x32 vpx_tm_predictor_32x32_c
 
 void vpx_tm_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_tm_predictor_4x4 vpx_tm_predictor_4x4_c
+void vpx_tm_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_tm_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_tm_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_tm_predictor_8x8 vpx_tm_predictor_8x8_c
+void vpx_tm_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_tm_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_v_predictor_16x16_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_v_predictor_16x16 vpx_v_predictor_16x16_c
+void vpx_v_predictor_16x16_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_v_predictor_16x16)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_v_predictor_32x32_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 #define vpx_v_predictor_32x32 vpx_v_predictor_32x32_c
@@ -445,16 +509,21 @@ void vpx_v_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
 #define vpx_v_predictor_4x4 vpx_v_predictor_4x4_c
 
 void vpx_v_predictor_8x8_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_v_predictor_8x8 vpx_v_predictor_8x8_c
+void vpx_v_predictor_8x8_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_v_predictor_8x8)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 unsigned int vpx_variance16x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_variance16x16 vpx_variance16x16_c
+unsigned int vpx_variance16x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int vpx_variance16x16_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_variance16x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_variance16x32_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 #define vpx_variance16x32 vpx_variance16x32_c
 
 unsigned int vpx_variance16x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_variance16x8 vpx_variance16x8_c
+unsigned int vpx_variance16x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int vpx_variance16x8_avx2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_variance16x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_variance32x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 #define vpx_variance32x16 vpx_variance32x16_c
@@ -466,7 +535,8 @@ unsigned int vpx_variance32x64_c(const uint8_t *src_ptr, int src_stride, const u
 #define vpx_variance32x64 vpx_variance32x64_c
 
 unsigned int vpx_variance4x4_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_variance4x4 vpx_variance4x4_c
+unsigned int vpx_variance4x4_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_variance4x4)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_variance4x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 #define vpx_variance4x8 vpx_variance4x8_c
@@ -478,27 +548,465 @@ unsigned int vpx_variance64x64_c(const uint8_t *src_ptr, int src_stride, const u
 #define vpx_variance64x64 vpx_variance64x64_c
 
 unsigned int vpx_variance8x16_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_variance8x16 vpx_variance8x16_c
+unsigned int vpx_variance8x16_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_variance8x16)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 unsigned int vpx_variance8x4_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 #define vpx_variance8x4 vpx_variance8x4_c
 
 unsigned int vpx_variance8x8_c(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
-#define vpx_variance8x8 vpx_variance8x8_c
+unsigned int vpx_variance8x8_sse2(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+RTCD_EXTERN unsigned int (*vpx_variance8x8)(const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
 void vpx_ve_predictor_4x4_c(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
-#define vpx_ve_predictor_4x4 vpx_ve_predictor_4x4_c
+void vpx_ve_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
+RTCD_EXTERN void (*vpx_ve_predictor_4x4)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left);
 
 void vpx_dsp_rtcd(void);
 
+struct vpx_rtcd_slot;
+int vpx_dsp_rtcd_slots(struct vpx_rtcd_slot *slots, int max_slots);
+
 #ifdef RTCD_C
 #include "vpx_ports/x86.h"
+#include "vpx_ports/rtcd_slots.h"
 static void setup_rtcd_internal(void)
 {
-    int flags = x86_simd_caps();
+    int flags = x86_rtcd_simd_caps();
 
     (void)flags;
 
+    vpx_d117_predictor_4x4 = vpx_d117_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d117_predictor_4x4 = vpx_d117_predictor_4x4_sse2;
+    vpx_d135_predictor_4x4 = vpx_d135_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d135_predictor_4x4 = vpx_d135_predictor_4x4_sse2;
+    vpx_d153_predictor_4x4 = vpx_d153_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d153_predictor_4x4 = vpx_d153_predictor_4x4_sse2;
+    vpx_d207_predictor_4x4 = vpx_d207_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d207_predictor_4x4 = vpx_d207_predictor_4x4_sse2;
+    vpx_d45e_predictor_4x4 = vpx_d45e_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d45e_predictor_4x4 = vpx_d45e_predictor_4x4_sse2;
+    vpx_d63e_predictor_4x4 = vpx_d63e_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_d63e_predictor_4x4 = vpx_d63e_predictor_4x4_sse2;
+    vpx_dc_128_predictor_16x16 = vpx_dc_128_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_dc_128_predictor_16x16 = vpx_dc_128_predictor_16x16_sse2;
+    vpx_dc_128_predictor_8x8 = vpx_dc_128_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_dc_128_predictor_8x8 = vpx_dc_128_predictor_8x8_sse2;
+    vpx_dc_left_predictor_16x16 = vpx_dc_left_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_dc_left_predictor_16x16 = vpx_dc_left_predictor_16x16_sse2;
+    vpx_dc_left_predictor_8x8 = vpx_dc_left_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_dc_left_predictor_8x8 = vpx_dc_left_predictor_8x8_sse2;
+    vpx_dc_predictor_16x16 = vpx_dc_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_dc_predictor_16x16 = vpx_dc_predictor_16x16_sse2;
+    vpx_dc_predictor_4x4 = vpx_dc_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_dc_predictor_4x4 = vpx_dc_predictor_4x4_sse2;
+    vpx_dc_predictor_8x8 = vpx_dc_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_dc_predictor_8x8 = vpx_dc_predictor_8x8_sse2;
+    vpx_dc_top_predictor_16x16 = vpx_dc_top_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_dc_top_predictor_16x16 = vpx_dc_top_predictor_16x16_sse2;
+    vpx_dc_top_predictor_8x8 = vpx_dc_top_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_dc_top_predictor_8x8 = vpx_dc_top_predictor_8x8_sse2;
+    vpx_get4x4sse_cs = vpx_get4x4sse_cs_c;
+    if (flags & HAS_SSE2) vpx_get4x4sse_cs = vpx_get4x4sse_cs_sse2;
+    vpx_h_predictor_16x16 = vpx_h_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_h_predictor_16x16 = vpx_h_predictor_16x16_sse2;
+    vpx_h_predictor_8x8 = vpx_h_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_h_predictor_8x8 = vpx_h_predictor_8x8_sse2;
+    vpx_he_predictor_4x4 = vpx_he_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_he_predictor_4x4 = vpx_he_predictor_4x4_sse2;
+    vpx_mse16x16 = vpx_mse16x16_c;
+    if (flags & HAS_SSE2) vpx_mse16x16 = vpx_mse16x16_sse2;
+    if (flags & HAS_AVX2) vpx_mse16x16 = vpx_mse16x16_avx2;
+    vpx_mse16x8 = vpx_mse16x8_c;
+    if (flags & HAS_SSE2) vpx_mse16x8 = vpx_mse16x8_sse2;
+    vpx_mse8x16 = vpx_mse8x16_c;
+    if (flags & HAS_SSE2) vpx_mse8x16 = vpx_mse8x16_sse2;
+    vpx_mse8x8 = vpx_mse8x8_c;
+    if (flags & HAS_SSE2) vpx_mse8x8 = vpx_mse8x8_sse2;
+    vpx_sad16x16 = vpx_sad16x16_c;
+    if (flags & HAS_SSE2) vpx_sad16x16 = vpx_sad16x16_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x16 = vpx_sad16x16_avx2;
+    vpx_sad16x16x3 = vpx_sad16x16x3_c;
+    if (flags & HAS_SSE2) vpx_sad16x16x3 = vpx_sad16x16x3_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x16x3 = vpx_sad16x16x3_avx2;
+    vpx_sad16x16x4d = vpx_sad16x16x4d_c;
+    if (flags & HAS_SSE2) vpx_sad16x16x4d = vpx_sad16x16x4d_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x16x4d = vpx_sad16x16x4d_avx2;
+    vpx_sad16x16x8 = vpx_sad16x16x8_c;
+    if (flags & HAS_SSE2) vpx_sad16x16x8 = vpx_sad16x16x8_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x16x8 = vpx_sad16x16x8_avx2;
+    vpx_sad16x8 = vpx_sad16x8_c;
+    if (flags & HAS_SSE2) vpx_sad16x8 = vpx_sad16x8_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x8 = vpx_sad16x8_avx2;
+    vpx_sad16x8x3 = vpx_sad16x8x3_c;
+    if (flags & HAS_SSE2) vpx_sad16x8x3 = vpx_sad16x8x3_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x8x3 = vpx_sad16x8x3_avx2;
+    vpx_sad16x8x4d = vpx_sad16x8x4d_c;
+    if (flags & HAS_SSE2) vpx_sad16x8x4d = vpx_sad16x8x4d_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x8x4d = vpx_sad16x8x4d_avx2;
+    vpx_sad16x8x8 = vpx_sad16x8x8_c;
+    if (flags & HAS_SSE2) vpx_sad16x8x8 = vpx_sad16x8x8_sse2;
+    if (flags & HAS_AVX2) vpx_sad16x8x8 = vpx_sad16x8x8_avx2;
+    vpx_sad4x4 = vpx_sad4x4_c;
+    if (flags & HAS_SSE2) vpx_sad4x4 = vpx_sad4x4_sse2;
+    vpx_sad4x4x3 = vpx_sad4x4x3_c;
+    if (flags & HAS_SSE2) vpx_sad4x4x3 = vpx_sad4x4x3_sse2;
+    vpx_sad4x4x4d = vpx_sad4x4x4d_c;
+    if (flags & HAS_SSE2) vpx_sad4x4x4d = vpx_sad4x4x4d_sse2;
+    vpx_sad4x4x8 = vpx_sad4x4x8_c;
+    if (flags & HAS_SSE2) vpx_sad4x4x8 = vpx_sad4x4x8_sse2;
+    vpx_sad8x16 = vpx_sad8x16_c;
+    if (flags & HAS_SSE2) vpx_sad8x16 = vpx_sad8x16_sse2;
+    vpx_sad8x16x3 = vpx_sad8x16x3_c;
+    if (flags & HAS_SSE2) vpx_sad8x16x3 = vpx_sad8x16x3_sse2;
+    vpx_sad8x16x4d = vpx_sad8x16x4d_c;
+    if (flags & HAS_SSE2) vpx_sad8x16x4d = vpx_sad8x16x4d_sse2;
+    vpx_sad8x16x8 = vpx_sad8x16x8_c;
+    if (flags & HAS_SSE2) vpx_sad8x16x8 = vpx_sad8x16x8_sse2;
+    vpx_sad8x8 = vpx_sad8x8_c;
+    if (flags & HAS_SSE2) vpx_sad8x8 = vpx_sad8x8_sse2;
+    vpx_sad8x8x3 = vpx_sad8x8x3_c;
+    if (flags & HAS_SSE2) vpx_sad8x8x3 = vpx_sad8x8x3_sse2;
+    vpx_sad8x8x4d = vpx_sad8x8x4d_c;
+    if (flags & HAS_SSE2) vpx_sad8x8x4d = vpx_sad8x8x4d_sse2;
+    vpx_sad8x8x8 = vpx_sad8x8x8_c;
+    if (flags & HAS_SSE2) vpx_sad8x8x8 = vpx_sad8x8x8_sse2;
+    vpx_sub_pixel_variance16x16 = vpx_sub_pixel_variance16x16_c;
+    if (flags & HAS_SSE2) vpx_sub_pixel_variance16x16 = vpx_sub_pixel_variance16x16_sse2;
+    if (flags & HAS_AVX2) vpx_sub_pixel_variance16x16 = vpx_sub_pixel_variance16x16_avx2;
+    vpx_sub_pixel_variance16x8 = vpx_sub_pixel_variance16x8_c;
+    if (flags & HAS_SSE2) vpx_sub_pixel_variance16x8 = vpx_sub_pixel_variance16x8_sse2;
+    if (flags & HAS_AVX2) vpx_sub_pixel_variance16x8 = vpx_sub_pixel_variance16x8_avx2;
+    vpx_sub_pixel_variance4x4 = vpx_sub_pixel_variance4x4_c;
+    if (flags & HAS_SSE2) vpx_sub_pixel_variance4x4 = vpx_sub_pixel_variance4x4_sse2;
+    vpx_sub_pixel_variance8x16 = vpx_sub_pixel_variance8x16_c;
+    if (flags & HAS_SSE2) vpx_sub_pixel_variance8x16 = vpx_sub_pixel_variance8x16_sse2;
+    vpx_sub_pixel_variance8x8 = vpx_sub_pixel_variance8x8_c;
+    if (flags & HAS_SSE2) vpx_sub_pixel_variance8x8 = vpx_sub_pixel_variance8x8_sse2;
+    vpx_subtract_block = vpx_subtract_block_c;
+    if (flags & HAS_SSE2) vpx_subtract_block = vpx_subtract_block_sse2;
+    vpx_tm_predictor_16x16 = vpx_tm_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_tm_predictor_16x16 = vpx_tm_predictor_16x16_sse2;
+    vpx_tm_predictor_4x4 = vpx_tm_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_tm_predictor_4x4 = vpx_tm_predictor_4x4_sse2;
+    vpx_tm_predictor_8x8 = vpx_tm_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_tm_predictor_8x8 = vpx_tm_predictor_8x8_sse2;
+    vpx_v_predictor_16x16 = vpx_v_predictor_16x16_c;
+    if (flags & HAS_SSE2) vpx_v_predictor_16x16 = vpx_v_predictor_16x16_sse2;
+    vpx_v_predictor_8x8 = vpx_v_predictor_8x8_c;
+    if (flags & HAS_SSE2) vpx_v_predictor_8x8 = vpx_v_predictor_8x8_sse2;
+    vpx_variance16x16 = vpx_variance16x16_c;
+    if (flags & HAS_SSE2) vpx_variance16x16 = vpx_variance16x16_sse2;
+    if (flags & HAS_AVX2) vpx_variance16x16 = vpx_variance16x16_avx2;
+    vpx_variance16x8 = vpx_variance16x8_c;
+    if (flags & HAS_SSE2) vpx_variance16x8 = vpx_variance16x8_sse2;
+    if (flags & HAS_AVX2) vpx_variance16x8 = vpx_variance16x8_avx2;
+    vpx_variance4x4 = vpx_variance4x4_c;
+    if (flags & HAS_SSE2) vpx_variance4x4 = vpx_variance4x4_sse2;
+    vpx_variance8x16 = vpx_variance8x16_c;
+    if (flags & HAS_SSE2) vpx_variance8x16 = vpx_variance8x16_sse2;
+    vpx_variance8x8 = vpx_variance8x8_c;
+    if (flags & HAS_SSE2) vpx_variance8x8 = vpx_variance8x8_sse2;
+    vpx_ve_predictor_4x4 = vpx_ve_predictor_4x4_c;
+    if (flags & HAS_SSE2) vpx_ve_predictor_4x4 = vpx_ve_predictor_4x4_sse2;
+
+}
+
+static int rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots)
+{
+    int n = 0;
+
+    RTCD_SLOT(vpx_comp_avg_pred, "c");
+    RTCD_SLOT(vpx_d117_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d117_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d117_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d117_predictor_4x4, vpx_d117_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d117_predictor_4x4, vpx_d117_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_d117_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d135_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d135_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d135_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d135_predictor_4x4, vpx_d135_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d135_predictor_4x4, vpx_d135_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_d135_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d153_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d153_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d153_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d153_predictor_4x4, vpx_d153_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d153_predictor_4x4, vpx_d153_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_d153_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d207_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d207_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d207_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d207_predictor_4x4, vpx_d207_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d207_predictor_4x4, vpx_d207_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_d207_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d45_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d45_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d45_predictor_4x4, "c");
+    RTCD_SLOT(vpx_d45_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d45e_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d45e_predictor_4x4, vpx_d45e_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d45e_predictor_4x4, vpx_d45e_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_d63_predictor_16x16, "c");
+    RTCD_SLOT(vpx_d63_predictor_32x32, "c");
+    RTCD_SLOT(vpx_d63_predictor_4x4, "c");
+    RTCD_SLOT(vpx_d63_predictor_8x8, "c");
+    RTCD_SLOT(vpx_d63e_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_d63e_predictor_4x4, vpx_d63e_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_d63e_predictor_4x4, vpx_d63e_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_128_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_dc_128_predictor_16x16, vpx_dc_128_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_dc_128_predictor_16x16, vpx_dc_128_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_128_predictor_32x32, "c");
+    RTCD_SLOT(vpx_dc_128_predictor_4x4, "c");
+    RTCD_SLOT(vpx_dc_128_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_dc_128_predictor_8x8, vpx_dc_128_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_dc_128_predictor_8x8, vpx_dc_128_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_left_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_dc_left_predictor_16x16, vpx_dc_left_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_dc_left_predictor_16x16, vpx_dc_left_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_left_predictor_32x32, "c");
+    RTCD_SLOT(vpx_dc_left_predictor_4x4, "c");
+    RTCD_SLOT(vpx_dc_left_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_dc_left_predictor_8x8, vpx_dc_left_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_dc_left_predictor_8x8, vpx_dc_left_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_dc_predictor_16x16, vpx_dc_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_dc_predictor_16x16, vpx_dc_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_predictor_32x32, "c");
+    RTCD_SLOT(vpx_dc_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_dc_predictor_4x4, vpx_dc_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_dc_predictor_4x4, vpx_dc_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_dc_predictor_8x8, vpx_dc_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_dc_predictor_8x8, vpx_dc_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_top_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_dc_top_predictor_16x16, vpx_dc_top_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_dc_top_predictor_16x16, vpx_dc_top_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_dc_top_predictor_32x32, "c");
+    RTCD_SLOT(vpx_dc_top_predictor_4x4, "c");
+    RTCD_SLOT(vpx_dc_top_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_dc_top_predictor_8x8, vpx_dc_top_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_dc_top_predictor_8x8, vpx_dc_top_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_get16x16var, "c");
+    RTCD_SLOT(vpx_get4x4sse_cs, NULL);
+    RTCD_VARIANT(vpx_get4x4sse_cs, vpx_get4x4sse_cs_c, "c");
+    RTCD_VARIANT(vpx_get4x4sse_cs, vpx_get4x4sse_cs_sse2, "sse2");
+    RTCD_SLOT(vpx_get8x8var, "c");
+    RTCD_SLOT(vpx_get_mb_ss, "c");
+    RTCD_SLOT(vpx_h_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_h_predictor_16x16, vpx_h_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_h_predictor_16x16, vpx_h_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_h_predictor_32x32, "c");
+    RTCD_SLOT(vpx_h_predictor_4x4, "c");
+    RTCD_SLOT(vpx_h_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_h_predictor_8x8, vpx_h_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_h_predictor_8x8, vpx_h_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_he_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_he_predictor_4x4, vpx_he_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_he_predictor_4x4, vpx_he_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_mse16x16, NULL);
+    RTCD_VARIANT(vpx_mse16x16, vpx_mse16x16_c, "c");
+    RTCD_VARIANT(vpx_mse16x16, vpx_mse16x16_sse2, "sse2");
+    RTCD_VARIANT(vpx_mse16x16, vpx_mse16x16_avx2, "avx2");
+    RTCD_SLOT(vpx_mse16x8, NULL);
+    RTCD_VARIANT(vpx_mse16x8, vpx_mse16x8_c, "c");
+    RTCD_VARIANT(vpx_mse16x8, vpx_mse16x8_sse2, "sse2");
+    RTCD_SLOT(vpx_mse8x16, NULL);
+    RTCD_VARIANT(vpx_mse8x16, vpx_mse8x16_c, "c");
+    RTCD_VARIANT(vpx_mse8x16, vpx_mse8x16_sse2, "sse2");
+    RTCD_SLOT(vpx_mse8x8, NULL);
+    RTCD_VARIANT(vpx_mse8x8, vpx_mse8x8_c, "c");
+    RTCD_VARIANT(vpx_mse8x8, vpx_mse8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_sad16x16, NULL);
+    RTCD_VARIANT(vpx_sad16x16, vpx_sad16x16_c, "c");
+    RTCD_VARIANT(vpx_sad16x16, vpx_sad16x16_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x16, vpx_sad16x16_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x16_avg, "c");
+    RTCD_SLOT(vpx_sad16x16x3, NULL);
+    RTCD_VARIANT(vpx_sad16x16x3, vpx_sad16x16x3_c, "c");
+    RTCD_VARIANT(vpx_sad16x16x3, vpx_sad16x16x3_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x16x3, vpx_sad16x16x3_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x16x4d, NULL);
+    RTCD_VARIANT(vpx_sad16x16x4d, vpx_sad16x16x4d_c, "c");
+    RTCD_VARIANT(vpx_sad16x16x4d, vpx_sad16x16x4d_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x16x4d, vpx_sad16x16x4d_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x16x8, NULL);
+    RTCD_VARIANT(vpx_sad16x16x8, vpx_sad16x16x8_c, "c");
+    RTCD_VARIANT(vpx_sad16x16x8, vpx_sad16x16x8_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x16x8, vpx_sad16x16x8_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x32, "c");
+    RTCD_SLOT(vpx_sad16x32_avg, "c");
+    RTCD_SLOT(vpx_sad16x32x4d, "c");
+    RTCD_SLOT(vpx_sad16x8, NULL);
+    RTCD_VARIANT(vpx_sad16x8, vpx_sad16x8_c, "c");
+    RTCD_VARIANT(vpx_sad16x8, vpx_sad16x8_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x8, vpx_sad16x8_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x8_avg, "c");
+    RTCD_SLOT(vpx_sad16x8x3, NULL);
+    RTCD_VARIANT(vpx_sad16x8x3, vpx_sad16x8x3_c, "c");
+    RTCD_VARIANT(vpx_sad16x8x3, vpx_sad16x8x3_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x8x3, vpx_sad16x8x3_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x8x4d, NULL);
+    RTCD_VARIANT(vpx_sad16x8x4d, vpx_sad16x8x4d_c, "c");
+    RTCD_VARIANT(vpx_sad16x8x4d, vpx_sad16x8x4d_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x8x4d, vpx_sad16x8x4d_avx2, "avx2");
+    RTCD_SLOT(vpx_sad16x8x8, NULL);
+    RTCD_VARIANT(vpx_sad16x8x8, vpx_sad16x8x8_c, "c");
+    RTCD_VARIANT(vpx_sad16x8x8, vpx_sad16x8x8_sse2, "sse2");
+    RTCD_VARIANT(vpx_sad16x8x8, vpx_sad16x8x8_avx2, "avx2");
+    RTCD_SLOT(vpx_sad32x16, "c");
+    RTCD_SLOT(vpx_sad32x16_avg, "c");
+    RTCD_SLOT(vpx_sad32x16x4d, "c");
+    RTCD_SLOT(vpx_sad32x32, "c");
+    RTCD_SLOT(vpx_sad32x32_avg, "c");
+    RTCD_SLOT(vpx_sad32x32x4d, "c");
+    RTCD_SLOT(vpx_sad32x32x8, "c");
+    RTCD_SLOT(vpx_sad32x64, "c");
+    RTCD_SLOT(vpx_sad32x64_avg, "c");
+    RTCD_SLOT(vpx_sad32x64x4d, "c");
+    RTCD_SLOT(vpx_sad4x4, NULL);
+    RTCD_VARIANT(vpx_sad4x4, vpx_sad4x4_c, "c");
+    RTCD_VARIANT(vpx_sad4x4, vpx_sad4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_sad4x4_avg, "c");
+    RTCD_SLOT(vpx_sad4x4x3, NULL);
+    RTCD_VARIANT(vpx_sad4x4x3, vpx_sad4x4x3_c, "c");
+    RTCD_VARIANT(vpx_sad4x4x3, vpx_sad4x4x3_sse2, "sse2");
+    RTCD_SLOT(vpx_sad4x4x4d, NULL);
+    RTCD_VARIANT(vpx_sad4x4x4d, vpx_sad4x4x4d_c, "c");
+    RTCD_VARIANT(vpx_sad4x4x4d, vpx_sad4x4x4d_sse2, "sse2");
+    RTCD_SLOT(vpx_sad4x4x8, NULL);
+    RTCD_VARIANT(vpx_sad4x4x8, vpx_sad4x4x8_c, "c");
+    RTCD_VARIANT(vpx_sad4x4x8, vpx_sad4x4x8_sse2, "sse2");
+    RTCD_SLOT(vpx_sad4x8, "c");
+    RTCD_SLOT(vpx_sad4x8_avg, "c");
+    RTCD_SLOT(vpx_sad4x8x4d, "c");
+    RTCD_SLOT(vpx_sad64x32, "c");
+    RTCD_SLOT(vpx_sad64x32_avg, "c");
+    RTCD_SLOT(vpx_sad64x32x4d, "c");
+    RTCD_SLOT(vpx_sad64x64, "c");
+    RTCD_SLOT(vpx_sad64x64_avg, "c");
+    RTCD_SLOT(vpx_sad64x64x4d, "c");
+    RTCD_SLOT(vpx_sad8x16, NULL);
+    RTCD_VARIANT(vpx_sad8x16, vpx_sad8x16_c, "c");
+    RTCD_VARIANT(vpx_sad8x16, vpx_sad8x16_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x16_avg, "c");
+    RTCD_SLOT(vpx_sad8x16x3, NULL);
+    RTCD_VARIANT(vpx_sad8x16x3, vpx_sad8x16x3_c, "c");
+    RTCD_VARIANT(vpx_sad8x16x3, vpx_sad8x16x3_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x16x4d, NULL);
+    RTCD_VARIANT(vpx_sad8x16x4d, vpx_sad8x16x4d_c, "c");
+    RTCD_VARIANT(vpx_sad8x16x4d, vpx_sad8x16x4d_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x16x8, NULL);
+    RTCD_VARIANT(vpx_sad8x16x8, vpx_sad8x16x8_c, "c");
+    RTCD_VARIANT(vpx_sad8x16x8, vpx_sad8x16x8_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x4, "c");
+    RTCD_SLOT(vpx_sad8x4_avg, "c");
+    RTCD_SLOT(vpx_sad8x4x4d, "c");
+    RTCD_SLOT(vpx_sad8x8, NULL);
+    RTCD_VARIANT(vpx_sad8x8, vpx_sad8x8_c, "c");
+    RTCD_VARIANT(vpx_sad8x8, vpx_sad8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x8_avg, "c");
+    RTCD_SLOT(vpx_sad8x8x3, NULL);
+    RTCD_VARIANT(vpx_sad8x8x3, vpx_sad8x8x3_c, "c");
+    RTCD_VARIANT(vpx_sad8x8x3, vpx_sad8x8x3_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x8x4d, NULL);
+    RTCD_VARIANT(vpx_sad8x8x4d, vpx_sad8x8x4d_c, "c");
+    RTCD_VARIANT(vpx_sad8x8x4d, vpx_sad8x8x4d_sse2, "sse2");
+    RTCD_SLOT(vpx_sad8x8x8, NULL);
+    RTCD_VARIANT(vpx_sad8x8x8, vpx_sad8x8x8_c, "c");
+    RTCD_VARIANT(vpx_sad8x8x8, vpx_sad8x8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance16x16, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance16x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance16x8, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance32x16, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance32x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance32x64, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance4x4, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance4x8, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance64x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance64x64, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance8x16, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance8x4, "c");
+    RTCD_SLOT(vpx_sub_pixel_avg_variance8x8, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance16x16, NULL);
+    RTCD_VARIANT(vpx_sub_pixel_variance16x16, vpx_sub_pixel_variance16x16_c, "c");
+    RTCD_VARIANT(vpx_sub_pixel_variance16x16, vpx_sub_pixel_variance16x16_sse2, "sse2");
+    RTCD_VARIANT(vpx_sub_pixel_variance16x16, vpx_sub_pixel_variance16x16_avx2, "avx2");
+    RTCD_SLOT(vpx_sub_pixel_variance16x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance16x8, NULL);
+    RTCD_VARIANT(vpx_sub_pixel_variance16x8, vpx_sub_pixel_variance16x8_c, "c");
+    RTCD_VARIANT(vpx_sub_pixel_variance16x8, vpx_sub_pixel_variance16x8_sse2, "sse2");
+    RTCD_VARIANT(vpx_sub_pixel_variance16x8, vpx_sub_pixel_variance16x8_avx2, "avx2");
+    RTCD_SLOT(vpx_sub_pixel_variance32x16, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance32x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance32x64, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance4x4, NULL);
+    RTCD_VARIANT(vpx_sub_pixel_variance4x4, vpx_sub_pixel_variance4x4_c, "c");
+    RTCD_VARIANT(vpx_sub_pixel_variance4x4, vpx_sub_pixel_variance4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_sub_pixel_variance4x8, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance64x32, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance64x64, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance8x16, NULL);
+    RTCD_VARIANT(vpx_sub_pixel_variance8x16, vpx_sub_pixel_variance8x16_c, "c");
+    RTCD_VARIANT(vpx_sub_pixel_variance8x16, vpx_sub_pixel_variance8x16_sse2, "sse2");
+    RTCD_SLOT(vpx_sub_pixel_variance8x4, "c");
+    RTCD_SLOT(vpx_sub_pixel_variance8x8, NULL);
+    RTCD_VARIANT(vpx_sub_pixel_variance8x8, vpx_sub_pixel_variance8x8_c, "c");
+    RTCD_VARIANT(vpx_sub_pixel_variance8x8, vpx_sub_pixel_variance8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_subtract_block, NULL);
+    RTCD_VARIANT(vpx_subtract_block, vpx_subtract_block_c, "c");
+    RTCD_VARIANT(vpx_subtract_block, vpx_subtract_block_sse2, "sse2");
+    RTCD_SLOT(vpx_sum_squares_2d_i16, "c");
+    RTCD_SLOT(vpx_tm_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_tm_predictor_16x16, vpx_tm_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_tm_predictor_16x16, vpx_tm_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_tm_predictor_32x32, "c");
+    RTCD_SLOT(vpx_tm_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_tm_predictor_4x4, vpx_tm_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_tm_predictor_4x4, vpx_tm_predictor_4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_tm_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_tm_predictor_8x8, vpx_tm_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_tm_predictor_8x8, vpx_tm_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_v_predictor_16x16, NULL);
+    RTCD_VARIANT(vpx_v_predictor_16x16, vpx_v_predictor_16x16_c, "c");
+    RTCD_VARIANT(vpx_v_predictor_16x16, vpx_v_predictor_16x16_sse2, "sse2");
+    RTCD_SLOT(vpx_v_predictor_32x32, "c");
+    RTCD_SLOT(vpx_v_predictor_4x4, "c");
+    RTCD_SLOT(vpx_v_predictor_8x8, NULL);
+    RTCD_VARIANT(vpx_v_predictor_8x8, vpx_v_predictor_8x8_c, "c");
+    RTCD_VARIANT(vpx_v_predictor_8x8, vpx_v_predictor_8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_variance16x16, NULL);
+    RTCD_VARIANT(vpx_variance16x16, vpx_variance16x16_c, "c");
+    RTCD_VARIANT(vpx_variance16x16, vpx_variance16x16_sse2, "sse2");
+    RTCD_VARIANT(vpx_variance16x16, vpx_variance16x16_avx2, "avx2");
+    RTCD_SLOT(vpx_variance16x32, "c");
+    RTCD_SLOT(vpx_variance16x8, NULL);
+    RTCD_VARIANT(vpx_variance16x8, vpx_variance16x8_c, "c");
+    RTCD_VARIANT(vpx_variance16x8, vpx_variance16x8_sse2, "sse2");
+    RTCD_VARIANT(vpx_variance16x8, vpx_variance16x8_avx2, "avx2");
+    RTCD_SLOT(vpx_variance32x16, "c");
+    RTCD_SLOT(vpx_variance32x32, "c");
+    RTCD_SLOT(vpx_variance32x64, "c");
+    RTCD_SLOT(vpx_variance4x4, NULL);
+    RTCD_VARIANT(vpx_variance4x4, vpx_variance4x4_c, "c");
+    RTCD_VARIANT(vpx_variance4x4, vpx_variance4x4_sse2, "sse2");
+    RTCD_SLOT(vpx_variance4x8, "c");
+    RTCD_SLOT(vpx_variance64x32, "c");
+    RTCD_SLOT(vpx_variance64x64, "c");
+    RTCD_SLOT(vpx_variance8x16, NULL);
+    RTCD_VARIANT(vpx_variance8x16, vpx_variance8x16_c, "c");
+    RTCD_VARIANT(vpx_variance8x16, vpx_variance8x16_sse2, "sse2");
+    RTCD_SLOT(vpx_variance8x4, "c");
+    RTCD_SLOT(vpx_variance8x8, NULL);
+    RTCD_VARIANT(vpx_variance8x8, vpx_variance8x8_c, "c");
+    RTCD_VARIANT(vpx_variance8x8, vpx_variance8x8_sse2, "sse2");
+    RTCD_SLOT(vpx_ve_predictor_4x4, NULL);
+    RTCD_VARIANT(vpx_ve_predictor_4x4, vpx_ve_predictor_4x4_c, "c");
+    RTCD_VARIANT(vpx_ve_predictor_4x4, vpx_ve_predictor_4x4_sse2, "sse2");
+
+    return n;
 }
 #endif
 
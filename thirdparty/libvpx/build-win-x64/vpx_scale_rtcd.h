@@ -25,15 +25,30 @@ void vpx_yv12_copy_y_c(const struct yv12_buffer_config *src_ybc, struct yv12_buf
 
 void vpx_scale_rtcd(void);
 
+struct vpx_rtcd_slot;
+int vpx_scale_rtcd_slots(struct vpx_rtcd_slot *slots, int max_slots);
+
 #ifdef RTCD_C
 #include "vpx_ports/x86.h"
+#include "vpx_ports/rtcd_slots.h"
 static void setup_rtcd_internal(void)
 {
-    int flags = x86_simd_caps();
+    int flags = x86_rtcd_simd_caps();
 
     (void)flags;
 
 }
+
+static int rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots)
+{
+    int n = 0;
+
+    RTCD_SLOT(vp8_yv12_copy_frame, "c");
+    RTCD_SLOT(vp8_yv12_extend_frame_borders, "c");
+    RTCD_SLOT(vpx_yv12_copy_y, "c");
+
+    return n;
+}
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+// Filename: VpxBenchmark.cpp
+//
+// Description: Command line performance benchmarks for the libvpx VP8 codec.
+// Each suite prints a table of results, or CSV with --csv.
+//
+// Usage:
+//   VpxBenchmark <suite> [--csv] [--iterations N] [--simd-mask N]
+//                [suite arguments]
+//
+// --simd-mask caps the instruction sets the codec dispatches to, the same as
+// the VPX_SIMD_CAPS_MASK environment variable, e.g. 0x7 for SSE2 and below
+// or 0 for the C kernels only. It applies to the whole run.
+//
+// As well as the Visual Studio project there is a CMakeLists.txt to build
+// on Linux, from the libvpx directory:
+//   cmake -S test/VpxBenchmark -B build-bench -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build-bench -j
+//   build-bench/VpxBenchmark decode --csv
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace VpxBenchmark;
+
+static int RunRtcdReport(const Options& options)
+{
+  int count = vpx_codec_get_rtcd_slots(nullptr, 0);
+  std::vector<vpx_rtcd_slot_t> slots(count);
+  vpx_codec_get_rtcd_slots(slots.data(), count);
+
+  Table table({ "slot", "variant" });
+  for (auto& slot : slots) {
+    table.AddRow({ slot.name, slot.variant });
+  }
+  table.Print(options.csv);
+  return 0;
+}
+
+struct Suite
+{
+  const char* name;
+  const char* description;
+  int (*run)(const Options& options);
+};
+
+static const Suite _suites[] = {
+  { "rtcd", "Lists the kernel variant each dispatch slot resolved to.", RunRtcdReport },
+  { "subpixel", "Six-tap and bilinear sub-pixel predictors, cycles per block.", RunSubpixelBenchmark },
+  { "idct", "Inverse transform and dequantisation kernels, cycles per call.", RunIdctBenchmark },
+  { "loopfilter", "Normal and simple loop filters, cycles per call.", RunLoopFilterBenchmark },
+  { "sad", "Motion search SAD and variance kernels, cycles per call.", RunSadBenchmark },
+  { "residual", "Subtraction, forward transforms and quantizers, cycles per call.", RunResidualBenchmark },
+  { "intrapred", "16x16, 8x8 and 4x4 intra predictors, cycles per call.", RunIntraPredBenchmark },
+  { "keyframe", "Key frame only encode and decode time, 1080p by default.", RunKeyframeBenchmark },
+  { "boolcoder", "Bool decoder ns per symbol and decode fps of high bitrate clips.", RunBoolCoderBenchmark },
+  { "decode", "Decode fps, per-stage time and peak RSS for generated clips or IVF files.", RunDecodeBenchmark },
+  { "decode_threads", "Multithreaded decode fps for 1 to 16 threads, checked bit-exact.", RunDecodeThreadsBenchmark },
+  { "decode_modes", "Decode fps skipping non-reference frames or all but key frames.", RunDecodeModesBenchmark },
+  { "streaming", "Decode latency once a frame's last packet arrives, streamed against whole.", RunStreamingBenchmark },
+  { "concealment", "Decode time and PSNR under packet loss with and without error concealment.", RunConcealmentBenchmark },
+  { "memory", "Decoder memory at 180p, 360p and 720p with and without compact frame buffers.", RunMemoryBenchmark },
+  { "mem_pool", "Allocation churn of short lived decoders and resolution switches, malloc against the pool.", RunMemPoolBenchmark },
+  { "resolution_switch", "Decoder switch latency between 180p, 360p and 720p layers, checked bit-exact.", RunResolutionSwitchBenchmark },
+  { "encode_threads", "Multithreaded encode fps for 1 to 8 threads with a BD-rate check.", RunEncodeThreadsBenchmark },
+  { "encode", "Encode fps with the per-stage time and MB mode mix of generated clips.", RunEncodeBenchmark },
+  { "encode_quality", "Encode fps, PSNR, SSIM and BD-rate over rc modes, deadlines and cpu_used.", RunEncodeQualityBenchmark },
+  { "rtp_packetizer", "RFC 7741 packetizer throughput in packets/sec, checked against the frames.", RunRtpPacketizerBenchmark },
+};
+
+static void PrintUsage()
+{
+  std::cout << "Usage: VpxBenchmark <suite> [--csv] [--iterations N] [--simd-mask N] [suite arguments]" << std::endl;
+  std::cout << "Suites:" << std::endl;
+  for (auto& suite : _suites) {
+    std::cout << "  " << suite.name << ": " << suite.description << std::endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    PrintUsage();
+    return 1;
+  }
+
+  Options options;
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "--csv") == 0) {
+      options.csv = true;
+    }
+    else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      options.iterations = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--simd-mask") == 0 && i + 1 < argc) {
+      if (vpx_codec_set_simd_caps_mask((unsigned int)strtoul(argv[++i], nullptr, 0)) < 0) {
+        std::cerr << "The SIMD caps mask can only be set once." << std::endl;
+        return 1;
+      }
+    }
+    else {
+      options.args.push_back(argv[i]);
+    }
+  }
+
+  for (auto& suite : _suites) {
+    if (strcmp(argv[1], suite.name) == 0) {
+      return suite.run(options);
+    }
+  }
+
+  std::cerr << "Unknown suite " << argv[1] << "." << std::endl;
+  PrintUsage();
+  return 1;
+}
@@ -0,0 +1,240 @@
+//-----------------------------------------------------------------------------
+// Filename: bench_common.h
+//
+// Description: Timing and reporting helpers shared by the VpxBenchmark suites.
+// Kept free of platform headers so the benchmarks build with MSVC on Windows
+// and with gcc/clang on Linux.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+#include "vpx/vpx_image.h"
+#include "vpx_ports/x86.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace VpxBenchmark
+{
+  struct Options
+  {
+    bool csv = false;
+    int iterations = 0;                 // 0 means use the suite's default.
+    std::vector<std::string> args;      // Suite specific positional arguments.
+  };
+
+  /**
+  * Returns true if the CPU supports all of the HAS_* flags in caps.
+  */
+  inline bool CpuHas(int caps)
+  {
+    return (x86_simd_caps() & caps) == caps;
+  }
+
+  /**
+  * Runs fn a number of times and returns the average number of time stamp
+  * counter cycles per call.
+  */
+  template <typename F>
+  double MeasureCycles(F&& fn, int iterations)
+  {
+    for (int i = 0; i < iterations / 10 + 1; i++) fn();
+
+    uint64_t start = x86_readtsc64();
+    for (int i = 0; i < iterations; i++) fn();
+    return (double)(x86_readtsc64() - start) / iterations;
+  }
+
+  /**
+  * Runs fn once and returns the elapsed wall clock time in microseconds.
+  */
+  template <typename F>
+  double MeasureMicroseconds(F&& fn)
+  {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /**
+  * A results table printed either aligned for reading or as CSV for
+  * regression tracking.
+  */
+  class Table
+  {
+  public:
+    explicit Table(std::vector<std::string> columns) : _columns(std::move(columns)) {}
+
+    void AddRow(std::vector<std::string> row) { _rows.push_back(std::move(row)); }
+
+    void Print(bool csv) const
+    {
+      if (csv) {
+        PrintCsvRow(_columns);
+        for (auto& row : _rows) PrintCsvRow(row);
+        return;
+      }
+
+      std::vector<size_t> widths;
+      for (auto& c : _columns) widths.push_back(c.size());
+      for (auto& row : _rows) {
+        for (size_t i = 0; i < row.size() && i < widths.size(); i++) {
+          if (row[i].size() > widths[i]) widths[i] = row[i].size();
+        }
+      }
+
+      PrintAlignedRow(_columns, widths);
+      for (auto& row : _rows) PrintAlignedRow(row, widths);
+    }
+
+  private:
+    static void PrintCsvRow(const std::vector<std::string>& row)
+    {
+      for (size_t i = 0; i < row.size(); i++) printf("%s%s", i ? "," : "", row[i].c_str());
+      printf("\n");
+    }
+
+    static void PrintAlignedRow(const std::vector<std::string>& row, const std::vector<size_t>& widths)
+    {
+      for (size_t i = 0; i < row.size(); i++) printf("%-*s  ", (int)widths[i], row[i].c_str());
+      printf("\n");
+    }
+
+    std::vector<std::string> _columns;
+    std::vector<std::vector<std::string>> _rows;
+  };
+
+  inline std::string Format(double value, int decimals = 1)
+  {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    return buf;
+  }
+
+  /**
+  * Fills img with source frame number frame.
+  */
+  typedef std::function<void(vpx_image_t* img, int frame)> FrameSource;
+
+  void FillTestFrame(vpx_image_t* img, int frame);
+
+  /**
+  * Settings for the clip encoded by EncodeTestClip.
+  */
+  struct ClipSettings
+  {
+    int width = 640;
+    int height = 480;
+    int frames = 60;
+    int bitrateKbps = 1500;
+    int quantizer = -1;               // 0 to 63 fixes the quantizer instead of endUsage.
+    vpx_rc_mode endUsage = VPX_CBR;
+    int cqLevel = 10;                 // Only used with VPX_CQ.
+    unsigned long deadline = VPX_DL_REALTIME;
+    int cpuUsed = -6;
+    int tokenPartitions = 0;          // log2 of the number of token partitions.
+    int threads = 1;
+    int keyframeInterval = 9999;
+    bool outputPartitions = false;    // Record the partition sizes of every frame.
+    bool nonReferenceFrames = false;  // Odd frames update no reference buffer.
+    bool errorResilient = false;      // No probabilities carried between frames, independent partitions.
+    FrameSource source = FillTestFrame;
+  };
+
+  struct EncodedClip
+  {
+    int width = 0;
+    int height = 0;
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<std::vector<size_t>> partitions; // Per frame, with outputPartitions.
+    double encodeUs = 0;              // Time spent in vpx_codec_encode only.
+    vp8e_perf_stats perf = {};        // VP8E_GET_PERF_STATS once the clip is done.
+  };
+
+  /**
+  * One point on a rate/distortion curve.
+  */
+  struct RatePoint
+  {
+    double kbps;
+    double psnr;
+  };
+
+  bool EncodeTestClip(const ClipSettings& settings, EncodedClip& clip);
+
+  /**
+  * Folds the visible pixels of img into a 64 bit FNV-1a hash.
+  */
+  uint64_t HashImage(const vpx_image_t* img, uint64_t hash);
+
+  const uint64_t HashSeed = 14695981039346656037ULL;
+
+  struct ClipQuality
+  {
+    double psnr;                      // Over all the planes and frames.
+    double ssim;                      // Mean of the frames' SSIM.
+  };
+
+  /**
+  * Decodes clip single threaded and compares it to the frames source
+  * generated it from.
+  */
+  ClipQuality MeasureClipQuality(const EncodedClip& clip, const FrameSource& source);
+
+  /**
+  * The PSNR of a clip encoded from the FillTestFrame frames.
+  */
+  double ClipPsnr(const EncodedClip& clip);
+
+  /**
+  * The PSNR over all the planes of a decoded image against its source.
+  */
+  double ImagePsnr(const vpx_image_t* source, const vpx_image_t* decoded);
+  double ClipBitrateKbps(const EncodedClip& clip, double fps);
+
+  /**
+  * Bjontegaard delta rate of test against reference as a percentage,
+  * negative meaning test needs fewer bits for the same quality. Returns NAN
+  * when either curve has fewer than four points or they do not overlap.
+  */
+  double BdRate(const std::vector<RatePoint>& reference, const std::vector<RatePoint>& test);
+
+  int RunSubpixelBenchmark(const Options& options);
+  int RunIdctBenchmark(const Options& options);
+  int RunLoopFilterBenchmark(const Options& options);
+  int RunSadBenchmark(const Options& options);
+  int RunResidualBenchmark(const Options& options);
+  int RunIntraPredBenchmark(const Options& options);
+  int RunKeyframeBenchmark(const Options& options);
+  int RunBoolCoderBenchmark(const Options& options);
+  int RunDecodeBenchmark(const Options& options);
+  int RunDecodeThreadsBenchmark(const Options& options);
+  int RunDecodeModesBenchmark(const Options& options);
+  int RunStreamingBenchmark(const Options& options);
+  int RunConcealmentBenchmark(const Options& options);
+  int RunMemoryBenchmark(const Options& options);
+  int RunMemPoolBenchmark(const Options& options);
+  int RunResolutionSwitchBenchmark(const Options& options);
+  int RunEncodeThreadsBenchmark(const Options& options);
+  int RunEncodeQualityBenchmark(const Options& options);
+  int RunEncodeBenchmark(const Options& options);
+  int RunRtpPacketizerBenchmark(const Options& options);
+}
+
+#endif
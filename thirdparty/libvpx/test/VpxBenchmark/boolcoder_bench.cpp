@@ -0,0 +1,214 @@
+//-----------------------------------------------------------------------------
+// Filename: boolcoder_bench.cpp
+//
+// Description: Throughput of the VP8 boolean entropy decoder. The first rows
+// read synthetic streams written with the encoder's bool coder: single bools
+// at skewed probabilities, 8 bit literals and the 4x4 intra mode tree. The
+// last rows decode high bitrate clips, where the token partitions and so the
+// bool decoder make up most of the decode time.
+//
+// Suite arguments: [width height frames], default 1280 720 30.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vp8/common/entropymode.h"
+#include "vp8/decoder/treereader.h"
+#include "vp8/encoder/treewriter.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int SymbolCount = 1 << 20;
+
+  enum class SymbolKind { Bool, Literal, Tree };
+
+  /**
+  * A stream of SymbolCount symbols of one kind with the probabilities it
+  * was written at, so the read loop makes the same calls the decoder does.
+  */
+  struct BoolStream
+  {
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> probs;
+  };
+
+  // Random probabilities for the 9 nodes of the B_PRED tree, one set per
+  // symbol position modulo 16.
+  static uint8_t _treeProbs[16][VP8_BINTRAMODES - 1];
+
+  static BoolStream WriteStream(SymbolKind kind)
+  {
+    BoolStream stream;
+    BOOL_CODER bc;
+
+    stream.data.resize(SymbolCount * 4 + 64);
+    stream.probs.resize(SymbolCount);
+    vp8_start_encode(&bc, stream.data.data(), stream.data.data() + stream.data.size());
+
+    srand(1);
+    for (int i = 0; i < SymbolCount; i++) {
+      switch (kind) {
+      case SymbolKind::Bool: {
+        // Mostly confident probabilities, as the token probabilities are.
+        const int p = (rand() & 3) ? 192 + (rand() & 63) : 1 + (rand() & 0xfe);
+        stream.probs[i] = (uint8_t)p;
+        vp8_encode_bool(&bc, (rand() & 0xff) >= p, p);
+        break;
+      }
+      case SymbolKind::Literal:
+        vp8_encode_value(&bc, rand() & 0xff, 8);
+        break;
+      case SymbolKind::Tree:
+        vp8_write_token(&bc, vp8_bmode_tree, _treeProbs[i & 15], &vp8_bmode_encodings[rand() % VP8_BINTRAMODES]);
+        break;
+      }
+    }
+
+    vp8_stop_encode(&bc);
+    stream.data.resize(bc.pos);
+    return stream;
+  }
+
+  /**
+  * Reads the whole stream and returns the nanoseconds per symbol. The sum
+  * keeps the reads from being optimised away.
+  */
+  static double ReadStream(SymbolKind kind, const BoolStream& stream, int& sum)
+  {
+    BOOL_DECODER br;
+
+    vp8dx_start_decode(&br, stream.data.data(), (unsigned int)stream.data.size(), nullptr, nullptr);
+    sum = 0;
+
+    double us = MeasureMicroseconds([&]() {
+      for (int i = 0; i < SymbolCount; i++) {
+        switch (kind) {
+        case SymbolKind::Bool: sum += vp8dx_decode_bool(&br, stream.probs[i]); break;
+        case SymbolKind::Literal: sum += vp8_decode_value(&br, 8); break;
+        case SymbolKind::Tree: sum += vp8_treed_read(&br, vp8_bmode_tree, _treeProbs[i & 15]); break;
+        }
+      }
+    });
+
+    return us * 1000.0 / SymbolCount;
+  }
+
+  /**
+  * Decodes the clip single threaded and returns the time in microseconds,
+  * or a negative value on a decoder error.
+  */
+  static double DecodeStream(const EncodedClip& clip)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+    bool ok = true;
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return -1;
+
+    double us = MeasureMicroseconds([&]() {
+      for (auto& frame : clip.frames) {
+        if (vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0)) {
+          ok = false;
+          break;
+        }
+
+        vpx_codec_iter_t iter = nullptr;
+        while (vpx_codec_get_frame(&decoder, &iter) != nullptr) {
+        }
+      }
+    });
+
+    vpx_codec_destroy(&decoder);
+    return ok ? us : -1;
+  }
+
+  int RunBoolCoderBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 5;
+    static const struct { SymbolKind kind; const char* name; } symbols[] = {
+      { SymbolKind::Bool, "bool" }, { SymbolKind::Literal, "literal8" }, { SymbolKind::Tree, "bmode_tree" },
+    };
+
+    srand(2);
+    for (auto& probs : _treeProbs) {
+      for (auto& p : probs) p = (uint8_t)(1 + rand() % 255);
+    }
+
+    Table symbolTable({ "symbol", "count", "ns_per_symbol" });
+
+    for (auto& s : symbols) {
+      const BoolStream stream = WriteStream(s.kind);
+      double best = 0;
+      int sum;
+
+      for (int i = 0; i < iterations; i++) {
+        const double ns = ReadStream(s.kind, stream, sum);
+        if (i == 0 || ns < best) best = ns;
+      }
+
+      symbolTable.AddRow({ s.name, std::to_string(SymbolCount), Format(best, 2) });
+    }
+
+    symbolTable.Print(options.csv);
+    printf("\n");
+
+    ClipSettings settings;
+    settings.width = 1280;
+    settings.height = 720;
+    settings.frames = 30;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    // Fixed low quantizers give the entropy heavy streams, the key frame
+    // interval adding intra frames to the mix.
+    static const int quantizers[] = { 4, 12, 24 };
+    Table decodeTable({ "quantizer", "resolution", "kbytes_per_frame", "fps", "mbit_per_sec" });
+
+    for (int q : quantizers) {
+      EncodedClip clip;
+      size_t bytes = 0;
+      double best = 0;
+
+      settings.quantizer = q;
+      settings.keyframeInterval = 10;
+      if (!EncodeTestClip(settings, clip)) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+      for (auto& frame : clip.frames) bytes += frame.size();
+
+      for (int i = 0; i < iterations; i++) {
+        const double us = DecodeStream(clip);
+        if (us < 0) {
+          std::cerr << "Decode failed at quantizer " << q << "." << std::endl;
+          return 1;
+        }
+        if (i == 0 || us < best) best = us;
+      }
+
+      const double frames = (double)clip.frames.size();
+      decodeTable.AddRow({ std::to_string(q), std::to_string(clip.width) + "x" + std::to_string(clip.height),
+        Format(bytes / 1024.0 / frames), Format(frames * 1e6 / best), Format(bytes * 8.0 / best) });
+    }
+
+    decodeTable.Print(options.csv);
+    return 0;
+  }
+}
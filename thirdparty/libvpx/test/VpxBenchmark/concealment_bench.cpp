@@ -0,0 +1,202 @@
+//-----------------------------------------------------------------------------
+// Filename: concealment_bench.cpp
+//
+// Description: Decoding over a lossy network with and without error
+// concealment (VPX_CODEC_USE_ERROR_CONCEALMENT). Each frame is split into
+// RTP payload sized packets and packets are dropped at random. A frame is
+// passed to the decoder up to its first lost packet and a frame whose first
+// packet is lost is not passed at all, as a receiver without
+// retransmissions would.
+//
+// Every frame that is due is scored against its source, using the last
+// image output when the decoder has none, as a player would show. Without
+// concealment a damaged frame fails to decode and its successors predict
+// from a stale reference until the next key frame. With concealment the
+// missing MBs are estimated and decoding carries on.
+//
+// Suite arguments: [width height frames], default 640 480 150. The clip is
+// error resilient with 8 token partitions and a key frame every 50 frames.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const size_t PacketSize = 1200;
+  static const double _lossPercents[] = { 0, 1, 2, 5, 10 };
+
+  // A frame this far below the lossless decode of it counts as damaged.
+  static const double DamagedDb = 3.0;
+
+  struct LossRun
+  {
+    std::vector<double> psnrs;        // Per frame.
+    double decodeUs = 0;
+    int lostPackets = 0;
+    int errors = 0;                   // Frames the decoder rejected.
+  };
+
+  /**
+  * The number of bytes of each frame that arrive, from a fixed seed so
+  * every run loses the same packets.
+  */
+  static std::vector<size_t> ReceivedBytes(const EncodedClip& clip, double lossPercent, int& lostPackets)
+  {
+    std::vector<size_t> received;
+    uint32_t seed = 12345;
+
+    lostPackets = 0;
+    for (auto& frame : clip.frames) {
+      // Key frames are assumed to be protected, as they would be resent.
+      const bool keyFrame = !(frame[0] & 1);
+      size_t bytes = frame.size();
+
+      for (size_t pos = 0; pos < frame.size(); pos += PacketSize) {
+        seed = seed * 1103515245 + 12345;
+        if (!keyFrame && (seed >> 8) % 10000 < lossPercent * 100) {
+          lostPackets++;
+          bytes = std::min(bytes, pos);
+        }
+      }
+      received.push_back(bytes);
+    }
+    return received;
+  }
+
+  static void CopyImage(const vpx_image_t* src, vpx_image_t* dst)
+  {
+    for (int plane = 0; plane < 3; plane++) {
+      const unsigned int w = plane ? (src->d_w + 1) / 2 : src->d_w;
+      const unsigned int h = plane ? (src->d_h + 1) / 2 : src->d_h;
+
+      for (unsigned int y = 0; y < h; y++) {
+        memcpy(dst->planes[plane] + y * dst->stride[plane], src->planes[plane] + y * src->stride[plane], w);
+      }
+    }
+  }
+
+  /**
+  * Decodes the frames that arrive and scores every frame. Returns false if
+  * the decoder cannot be set up.
+  */
+  static bool DecodeClip(const EncodedClip& clip, const std::vector<size_t>& received, bool concealment,
+    LossRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, concealment ? VPX_CODEC_USE_ERROR_CONCEALMENT : 0)) {
+      return false;
+    }
+
+    vpx_image_t* source = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, clip.width, clip.height, 1);
+    vpx_image_t* shown = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, clip.width, clip.height, 1);
+    memset(shown->img_data, 0, (size_t)shown->stride[VPX_PLANE_Y] * clip.height * 3 / 2);
+
+    for (size_t i = 0; i < clip.frames.size(); i++) {
+      if (received[i] > 0) {
+        vpx_codec_err_t err = VPX_CODEC_OK;
+
+        run.decodeUs += MeasureMicroseconds([&]() {
+          err = vpx_codec_decode(&decoder, clip.frames[i].data(), (unsigned int)received[i], nullptr, 0);
+        });
+        if (err) run.errors++;
+
+        vpx_codec_iter_t iter = nullptr;
+        vpx_image_t* img;
+        while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) CopyImage(img, shown);
+      }
+
+      FillTestFrame(source, (int)i);
+      run.psnrs.push_back(ImagePsnr(source, shown));
+    }
+
+    vpx_img_free(shown);
+    vpx_img_free(source);
+    vpx_codec_destroy(&decoder);
+    return true;
+  }
+
+  int RunConcealmentBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    ClipSettings settings;
+    EncodedClip clip;
+
+    settings.width = 640;
+    settings.height = 480;
+    settings.frames = 150;
+    settings.bitrateKbps = 1500;
+    settings.keyframeInterval = 50;
+    settings.tokenPartitions = 3;
+    settings.errorResilient = true;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    if (!EncodeTestClip(settings, clip)) {
+      std::cerr << "Failed to encode the test clip." << std::endl;
+      return 1;
+    }
+
+    Table table({ "loss_pct", "concealment", "lost_packets", "rejected_frames", "ms_per_frame", "psnr_db",
+      "min_psnr_db", "damaged_frames" });
+    LossRun lossless;
+
+    for (double lossPercent : _lossPercents) {
+      int lostPackets = 0;
+      const std::vector<size_t> received = ReceivedBytes(clip, lossPercent, lostPackets);
+
+      for (bool concealment : { false, true }) {
+        LossRun best;
+
+        for (int i = 0; i < iterations; i++) {
+          LossRun run;
+
+          if (!DecodeClip(clip, received, concealment, run)) {
+            std::cerr << "Failed to initialise the decoder." << std::endl;
+            return 1;
+          }
+          if (i == 0 || run.decodeUs < best.decodeUs) best = run;
+        }
+
+        if (lossPercent == 0 && !concealment) lossless = best;
+
+        double sum = 0, minimum = best.psnrs.empty() ? 0 : best.psnrs[0];
+        int damaged = 0;
+        for (size_t i = 0; i < best.psnrs.size(); i++) {
+          sum += best.psnrs[i];
+          minimum = std::min(minimum, best.psnrs[i]);
+          if (best.psnrs[i] < lossless.psnrs[i] - DamagedDb) damaged++;
+        }
+
+        const double frames = (double)clip.frames.size();
+        table.AddRow({ Format(lossPercent, 0), concealment ? "on" : "off", std::to_string(lostPackets),
+          std::to_string(best.errors), Format(best.decodeUs / 1000.0 / frames, 3), Format(sum / frames, 2),
+          Format(minimum, 2), std::to_string(damaged) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
@@ -0,0 +1,225 @@
+//-----------------------------------------------------------------------------
+// Filename: decode_bench.cpp
+//
+// Description: VP8 decode throughput with the time split over the decoder
+// stages reported by VP8D_GET_PERF_STATS: mode and motion vector decoding,
+// token decoding, reconstruction, loop filter and border extension. Each row
+// also shows the share of skipped, intra, split MV and DC only MBs and the
+// peak resident set size of the process so far.
+//
+// Suite arguments: [file.ivf ...]. With no files a matrix of generated clips
+// is decoded: 360p, 720p and 1080p with 1, 4 and 8 token partitions, each
+// with 1, 2 and 4 threads. IVF files are decoded with each thread count.
+//
+// Stage times are summed over the decoding threads so with more than one
+// thread they add up to more than ms_per_frame. The decoder uses no more
+// threads than there are cores.
+//
+// The peak RSS is the only platform specific part, from getrusage on POSIX
+// systems and GetProcessMemoryInfo on Windows.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace VpxBenchmark
+{
+  static const int _threadCounts[] = { 1, 2, 4 };
+
+  /**
+  * The process's peak resident set size in megabytes.
+  */
+  static double PeakRssMb()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage)) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+  }
+
+  static uint32_t ReadLe32(const uint8_t* p)
+  {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+
+  /**
+  * Loads the frames of an IVF file: a 32 byte file header then each frame
+  * prefixed with a 4 byte size and an 8 byte timestamp.
+  */
+  static bool ReadIvf(const std::string& path, EncodedClip& clip)
+  {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (data.size() < 32 || memcmp(data.data(), "DKIF", 4) != 0 || memcmp(data.data() + 8, "VP80", 4) != 0) {
+      return false;
+    }
+
+    clip.width = data[12] | (data[13] << 8);
+    clip.height = data[14] | (data[15] << 8);
+    clip.frames.clear();
+
+    size_t pos = data[6] | (data[7] << 8);
+    while (pos + 12 <= data.size()) {
+      const size_t size = ReadLe32(&data[pos]);
+      pos += 12;
+      if (size > data.size() - pos) return false;
+      clip.frames.emplace_back(data.begin() + pos, data.begin() + pos + size);
+      pos += size;
+    }
+
+    return !clip.frames.empty();
+  }
+
+  /**
+  * Decodes the whole clip and collects the decoder's stage times. Returns
+  * false on any decoder error.
+  */
+  static bool DecodeClip(const EncodedClip& clip, int threads, double& us, vp8d_perf_stats& stats)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { (unsigned int)threads, (unsigned int)clip.width, (unsigned int)clip.height };
+    bool ok = true;
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return false;
+
+    us = MeasureMicroseconds([&]() {
+      for (auto& frame : clip.frames) {
+        if (vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0)) {
+          ok = false;
+          break;
+        }
+
+        vpx_codec_iter_t iter = nullptr;
+        while (vpx_codec_get_frame(&decoder, &iter) != nullptr) {
+        }
+      }
+    });
+
+    if (vpx_codec_control(&decoder, VP8D_GET_PERF_STATS, &stats)) ok = false;
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  /**
+  * Adds a row per thread count, keeping the stage times of the fastest of
+  * the iterations.
+  */
+  static bool AddClipRows(Table& table, const std::string& source, const std::string& partitions,
+    const EncodedClip& clip, int iterations)
+  {
+    for (int threads : _threadCounts) {
+      vp8d_perf_stats best = {};
+      double bestUs = 0;
+
+      for (int i = 0; i < iterations; i++) {
+        vp8d_perf_stats stats;
+        double us;
+
+        if (!DecodeClip(clip, threads, us, stats)) {
+          std::cerr << "Decode of " << source << " failed with " << threads << " threads." << std::endl;
+          return false;
+        }
+        if (i == 0 || us < bestUs) {
+          bestUs = us;
+          best = stats;
+        }
+      }
+
+      const double frames = best.frames ? (double)best.frames : 1.0;
+      const double mbs = best.total_mbs.mbs ? (double)best.total_mbs.mbs : 1.0;
+      const vp8d_stage_times& t = best.total;
+
+      table.AddRow({ source, std::to_string(clip.width) + "x" + std::to_string(clip.height), partitions,
+        std::to_string(threads), Format(clip.frames.size() * 1e6 / bestUs), Format(t.decode_us / 1000.0 / frames, 3),
+        Format(t.mode_mvs_us / 1000.0 / frames, 3), Format(t.tokens_us / 1000.0 / frames, 3),
+        Format(t.recon_us / 1000.0 / frames, 3), Format(t.loop_filter_us / 1000.0 / frames, 3),
+        Format(t.extend_us / 1000.0 / frames, 3), Format(best.total_mbs.skipped * 100.0 / mbs),
+        Format(best.total_mbs.intra * 100.0 / mbs), Format(best.total_mbs.split_mv * 100.0 / mbs),
+        Format(best.total_mbs.dc_only * 100.0 / mbs), Format(PeakRssMb()) });
+    }
+
+    return true;
+  }
+
+  int RunDecodeBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    Table table({ "source", "resolution", "partitions", "threads", "fps", "ms_per_frame", "mode_mvs_ms", "tokens_ms",
+      "recon_ms", "loop_filter_ms", "extend_ms", "skip_pct", "intra_pct", "split_pct", "dc_only_pct", "peak_rss_mb" });
+
+    if (!options.args.empty()) {
+      for (auto& path : options.args) {
+        EncodedClip clip;
+
+        if (!ReadIvf(path, clip)) {
+          std::cerr << "Failed to read VP8 IVF file " << path << "." << std::endl;
+          return 1;
+        }
+        if (!AddClipRows(table, path, "-", clip, iterations)) return 1;
+      }
+    }
+    else {
+      static const struct { int width, height, bitrateKbps; } sizes[] = {
+        { 640, 360, 800 }, { 1280, 720, 2500 }, { 1920, 1080, 5000 },
+      };
+
+      // Smallest first so the peak RSS column grows with the resolution.
+      for (auto& size : sizes) {
+        for (int tokenPartitions : { 0, 2, 3 }) {
+          ClipSettings settings;
+          EncodedClip clip;
+
+          settings.width = size.width;
+          settings.height = size.height;
+          settings.frames = 30;
+          settings.bitrateKbps = size.bitrateKbps;
+          settings.tokenPartitions = tokenPartitions;
+
+          if (!EncodeTestClip(settings, clip)) {
+            std::cerr << "Failed to encode the test clip." << std::endl;
+            return 1;
+          }
+          if (!AddClipRows(table, "generated", std::to_string(1 << tokenPartitions), clip, iterations)) return 1;
+        }
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
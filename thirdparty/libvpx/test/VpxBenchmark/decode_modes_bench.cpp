@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+// Filename: decode_modes_bench.cpp
+//
+// Description: Decode cost of the VP8D_SET_DECODE_MODE modes used for
+// previews and monitoring. The same clip is decoded in full, skipping the
+// frames that update no reference buffer, and with key frames only. Every
+// image a skipping mode outputs is checked to be bit-exact with the same
+// frame of the full decode.
+//
+// Suite arguments: [width height frames], default 1280 720 90. The clip has
+// a key frame every 30 frames and every odd frame updates no reference
+// buffer, as the upper layer of a two layer temporal scalable stream would.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const struct { const char* name; int mode; } _modes[] = {
+    { "all", 0 }, { "reference", 1 }, { "key", 2 },
+  };
+
+  struct ModeRun
+  {
+    std::vector<uint64_t> hashes;     // Per input frame, 0 where no image was output.
+    vp8d_perf_stats stats = {};
+  };
+
+  /**
+  * Decodes the whole clip in one mode and returns false on any decoder error.
+  */
+  static bool DecodeClip(const EncodedClip& clip, int mode, ModeRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return false;
+
+    bool ok = vpx_codec_control(&decoder, VP8D_SET_DECODE_MODE, mode) == VPX_CODEC_OK;
+    run.hashes.assign(clip.frames.size(), 0);
+
+    for (size_t i = 0; ok && i < clip.frames.size(); i++) {
+      if (vpx_codec_decode(&decoder, clip.frames[i].data(), (unsigned int)clip.frames[i].size(), nullptr, 0)) {
+        ok = false;
+        break;
+      }
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) {
+        run.hashes[i] = HashImage(img, HashSeed);
+      }
+    }
+
+    if (ok && vpx_codec_control(&decoder, VP8D_GET_PERF_STATS, &run.stats)) ok = false;
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  int RunDecodeModesBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    ClipSettings settings;
+    EncodedClip clip;
+
+    settings.width = 1280;
+    settings.height = 720;
+    settings.frames = 90;
+    settings.bitrateKbps = 2500;
+    settings.keyframeInterval = 30;
+    settings.nonReferenceFrames = true;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    if (!EncodeTestClip(settings, clip)) {
+      std::cerr << "Failed to encode the test clip." << std::endl;
+      return 1;
+    }
+
+    Table table({ "mode", "fps", "ms_per_frame", "decoded", "skipped", "images", "speedup", "bit_exact" });
+    ModeRun full;
+    double fullUs = 0;
+    int mismatches = 0;
+
+    for (auto& mode : _modes) {
+      ModeRun run;
+      double bestUs = 0;
+      bool ok = true;
+
+      for (int i = 0; i < iterations && ok; i++) {
+        double us = MeasureMicroseconds([&]() { ok = DecodeClip(clip, mode.mode, run); });
+        if (i == 0 || us < bestUs) bestUs = us;
+      }
+
+      if (!ok) {
+        std::cerr << "Decode failed in " << mode.name << " mode." << std::endl;
+        return 1;
+      }
+
+      if (mode.mode == 0) {
+        full = run;
+        fullUs = bestUs;
+      }
+
+      // Every image output has to match the full decode of the same frame.
+      bool exact = true;
+      int images = 0;
+      for (size_t i = 0; i < run.hashes.size(); i++) {
+        if (run.hashes[i] == 0) continue;
+        images++;
+        if (run.hashes[i] != full.hashes[i]) exact = false;
+      }
+      if (!exact) mismatches++;
+
+      const double frames = (double)clip.frames.size();
+      table.AddRow({ mode.name, Format(frames * 1e6 / bestUs), Format(bestUs / 1000.0 / frames, 3),
+        std::to_string(run.stats.frames), std::to_string(run.stats.skipped_frames), std::to_string(images),
+        Format(fullUs / bestUs, 2), exact ? "yes" : "NO" });
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// Filename: decode_threads_bench.cpp
+//
+// Description: Scaling of the row based multithreaded VP8 decoder. A clip
+// with eight token partitions is decoded with 1 to 16 threads and each run is
+// checked to be bit-exact with the single threaded decode. Every thread count
+// above one is run twice, once as plain rows and once with the token
+// partitions parsed on their own workers (VP8D_SET_PARTITION_MT).
+//
+// Suite arguments: [width height frames], default 1280 720 60.
+//
+// The decoder uses at most 8 threads and no more than the number of cores.
+// Requests above that show as no further speedup rather than an error.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int _threadCounts[] = { 1, 2, 3, 4, 6, 8, 12, 16 };
+
+  /**
+  * Decodes the whole clip and returns false on any decoder error. The hash
+  * covers every output frame.
+  */
+  static bool DecodeClip(const EncodedClip& clip, int threads, bool partitionMt, uint64_t& hash)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { (unsigned int)threads, (unsigned int)clip.width, (unsigned int)clip.height };
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return false;
+    vpx_codec_control(&decoder, VP8D_SET_PARTITION_MT, partitionMt ? 1 : 0);
+
+    bool ok = true;
+    hash = HashSeed;
+
+    for (auto& frame : clip.frames) {
+      if (vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0)) {
+        ok = false;
+        break;
+      }
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) {
+        hash = HashImage(img, hash);
+      }
+    }
+
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  int RunDecodeThreadsBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    ClipSettings settings;
+    EncodedClip clip;
+
+    settings.width = 1280;
+    settings.height = 720;
+    settings.bitrateKbps = 4000;
+    settings.tokenPartitions = 3;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    if (!EncodeTestClip(settings, clip)) {
+      std::cerr << "Failed to encode the test clip." << std::endl;
+      return 1;
+    }
+
+    Table table({ "threads", "mode", "fps", "ms_per_frame", "speedup", "bit_exact" });
+    uint64_t referenceHash = 0;
+    double referenceUs = 0;
+    int mismatches = 0;
+
+    for (int threads : _threadCounts) {
+      for (bool partitionMt : { false, true }) {
+        if (partitionMt && threads == 1) continue;
+
+        double bestUs = 0;
+        uint64_t hash = 0;
+        bool ok = true;
+
+        // Best of N to keep scheduler noise out of the scaling figures.
+        for (int i = 0; i < iterations && ok; i++) {
+          double us = MeasureMicroseconds([&]() { ok = DecodeClip(clip, threads, partitionMt, hash); });
+          if (i == 0 || us < bestUs) bestUs = us;
+        }
+
+        if (!ok) {
+          std::cerr << "Decode failed with " << threads << " threads." << std::endl;
+          return 1;
+        }
+
+        if (threads == 1) {
+          referenceHash = hash;
+          referenceUs = bestUs;
+        }
+
+        const bool exact = hash == referenceHash;
+        if (!exact) mismatches++;
+
+        const double frames = (double)clip.frames.size();
+        table.AddRow({ std::to_string(threads), partitionMt ? "partitions" : "rows", Format(frames * 1e6 / bestUs),
+          Format(bestUs / 1000.0 / frames, 3), Format(referenceUs / bestUs, 2), exact ? "yes" : "NO" });
+      }
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
@@ -0,0 +1,106 @@
+//-----------------------------------------------------------------------------
+// Filename: encode_bench.cpp
+//
+// Description: VP8 encode throughput with the time split over the encoder
+// stages reported by VP8E_GET_PERF_STATS: lookahead, motion search,
+// transform/quant, tokenize, bitstream packing and loop filter picking and
+// filtering. A second table shows the share of MBs coded with each mode.
+//
+// Suite arguments: none. Generated 360p, 720p and 1080p clips are encoded
+// single threaded at the realtime deadline with cpu_used -4, -8 and -16 and
+// at the good quality deadline with cpu_used 3.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const struct { const char* name; unsigned long deadline; int cpuUsed; } _speeds[] = {
+    { "realtime", VPX_DL_REALTIME, -4 }, { "realtime", VPX_DL_REALTIME, -8 },
+    { "realtime", VPX_DL_REALTIME, -16 }, { "good", VPX_DL_GOOD_QUALITY, 3 },
+  };
+
+  // In the order of VP8E_MB_MODES.
+  static const char* _modeNames[VP8E_MB_MODES] = {
+    "dc", "v", "h", "tm", "b", "nearest", "near", "zero", "new", "split",
+  };
+
+  static std::string StageMs(int64_t us, unsigned int frames)
+  {
+    return Format(us / 1000.0 / (frames ? frames : 1), 3);
+  }
+
+  int RunEncodeBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    static const struct { int width, height, bitrateKbps; } sizes[] = {
+      { 640, 360, 800 }, { 1280, 720, 2500 }, { 1920, 1080, 5000 },
+    };
+
+    std::vector<std::string> modeColumns = { "resolution", "deadline", "cpu_used" };
+    for (auto name : _modeNames) modeColumns.push_back(std::string(name) + "_pct");
+
+    Table table({ "resolution", "deadline", "cpu_used", "fps", "ms_per_frame", "lookahead_ms", "motion_search_ms",
+      "transform_quant_ms", "tokenize_ms", "pack_ms", "lf_pick_ms", "lf_filter_ms" });
+    Table modes(modeColumns);
+
+    for (auto& size : sizes) {
+      for (auto& speed : _speeds) {
+        const std::string resolution = std::to_string(size.width) + "x" + std::to_string(size.height);
+        ClipSettings settings;
+        EncodedClip best;
+
+        settings.width = size.width;
+        settings.height = size.height;
+        settings.frames = 30;
+        settings.bitrateKbps = size.bitrateKbps;
+        settings.deadline = speed.deadline;
+        settings.cpuUsed = speed.cpuUsed;
+
+        // Keep the stage times of the fastest run.
+        for (int i = 0; i < iterations; i++) {
+          EncodedClip clip;
+
+          if (!EncodeTestClip(settings, clip)) {
+            std::cerr << "Encode failed for " << resolution << " " << speed.name << " " << speed.cpuUsed << "."
+              << std::endl;
+            return 1;
+          }
+          if (i == 0 || clip.encodeUs < best.encodeUs) best = std::move(clip);
+        }
+
+        const vp8e_stage_times& t = best.perf.total;
+        const unsigned int frames = best.perf.frames;
+
+        table.AddRow({ resolution, speed.name, std::to_string(speed.cpuUsed),
+          Format(best.frames.size() * 1e6 / best.encodeUs), StageMs(t.encode_us, frames),
+          StageMs(t.lookahead_us, frames), StageMs(t.motion_search_us, frames), StageMs(t.transform_quant_us, frames),
+          StageMs(t.tokenize_us, frames), StageMs(t.pack_bitstream_us, frames), StageMs(t.lf_pick_us, frames),
+          StageMs(t.lf_filter_us, frames) });
+
+        uint64_t mbs = 0;
+        for (auto count : best.perf.total_mb_modes) mbs += count;
+
+        std::vector<std::string> row = { resolution, speed.name, std::to_string(speed.cpuUsed) };
+        for (auto count : best.perf.total_mb_modes) row.push_back(Format(mbs ? count * 100.0 / mbs : 0));
+        modes.AddRow(row);
+      }
+    }
+
+    table.Print(options.csv);
+    printf("\n");
+    modes.Print(options.csv);
+    return 0;
+  }
+}
@@ -0,0 +1,288 @@
+//-----------------------------------------------------------------------------
+// Filename: encode_quality_bench.cpp
+//
+// Description: Encoder speed against quality over a matrix of rate control
+// modes (rc_end_usage), deadlines and cpu_used values. Each setting encodes
+// the clip at four target bitrates and reports the encode fps, the mean
+// bitrate, PSNR and SSIM, and the BD-rate of its rate/PSNR curve.
+//
+// Suite arguments: [source] [baseline.csv]
+//
+// The source is a Y4M file, or a raw I420 file followed by its size, e.g.
+// testpattern.i420 640x480. The first 30 frames are encoded, looping the
+// file if it is shorter, so a single image such as testpattern.i420 gives a
+// still clip. That reaches the lowest quantizer at every target, so its
+// curves seldom span enough for a BD-rate. Without a source the
+// synthetic FillTestFrame clip is used.
+//
+// With a baseline file the BD-rates are against the curves stored in it for
+// the same settings. The file is written from this run if it does not exist
+// yet. Without one each BD-rate is against the first setting of the same
+// rate control mode, good quality at cpu_used 0.
+//
+// Frames are encoded one at a time with no lag, as for real time use, so
+// the good quality deadline runs without alt-ref frames.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace VpxBenchmark
+{
+  static const int ClipFrames = 30;
+
+  static const struct { const char* name; vpx_rc_mode mode; } _rcModes[] = {
+    { "vbr", VPX_VBR }, { "cbr", VPX_CBR }, { "cq", VPX_CQ },
+  };
+
+  static const struct { const char* name; unsigned long deadline; int cpuUsed; } _speeds[] = {
+    { "good", VPX_DL_GOOD_QUALITY, 0 }, { "good", VPX_DL_GOOD_QUALITY, 3 },
+    { "realtime", VPX_DL_REALTIME, -4 }, { "realtime", VPX_DL_REALTIME, -8 }, { "realtime", VPX_DL_REALTIME, -16 },
+  };
+
+  // Targets for 640x480, scaled by the source's area.
+  static const int _bitratesKbps[] = { 1000, 2000, 4000, 8000 };
+
+  // The cubic fit behind the BD-rate is meaningless over a narrower range.
+  static const double MinPsnrSpan = 0.5;
+
+  /**
+  * The frames of a Y4M or raw I420 file, packed as I420.
+  */
+  struct FileClip
+  {
+    int width = 0;
+    int height = 0;
+    std::vector<std::vector<uint8_t>> frames;
+
+    void Fill(vpx_image_t* img, int frame) const
+    {
+      const uint8_t* src = frames[frame % frames.size()].data();
+
+      for (int plane = 0; plane < 3; plane++) {
+        const int w = plane ? (width + 1) / 2 : width;
+        const int h = plane ? (height + 1) / 2 : height;
+
+        for (int y = 0; y < h; y++, src += w) memcpy(img->planes[plane] + y * img->stride[plane], src, w);
+      }
+    }
+  };
+
+  static size_t I420FrameSize(int width, int height)
+  {
+    return (size_t)width * height + 2 * (size_t)((width + 1) / 2) * ((height + 1) / 2);
+  }
+
+  /**
+  * Reads up to ClipFrames frames. Y4M files must be 8 bit 4:2:0.
+  */
+  static bool ReadSource(const std::string& path, const std::string& size, FileClip& clip)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    const bool y4m = path.size() > 4 && path.compare(path.size() - 4, 4, ".y4m") == 0;
+    if (y4m) {
+      std::string header;
+      if (!std::getline(file, header) || header.compare(0, 10, "YUV4MPEG2 ") != 0) return false;
+
+      std::istringstream tokens(header.substr(10));
+      std::string token;
+      while (tokens >> token) {
+        if (token[0] == 'W') clip.width = atoi(token.c_str() + 1);
+        else if (token[0] == 'H') clip.height = atoi(token.c_str() + 1);
+        else if (token[0] == 'C' && token.compare(1, 3, "420") != 0) return false;
+      }
+    }
+    else if (sscanf(size.c_str(), "%dx%d", &clip.width, &clip.height) != 2) {
+      return false;
+    }
+
+    if (clip.width <= 0 || clip.height <= 0) return false;
+
+    const size_t frameSize = I420FrameSize(clip.width, clip.height);
+    while ((int)clip.frames.size() < ClipFrames) {
+      std::string frameHeader;
+      if (y4m && (!std::getline(file, frameHeader) || frameHeader.compare(0, 5, "FRAME") != 0)) break;
+
+      std::vector<uint8_t> frame(frameSize);
+      if (!file.read((char*)frame.data(), frameSize)) break;
+      clip.frames.push_back(std::move(frame));
+    }
+
+    return !clip.frames.empty();
+  }
+
+  static double PsnrSpan(const std::vector<RatePoint>& curve)
+  {
+    double low = curve.empty() ? 0 : curve[0].psnr, high = low;
+
+    for (auto& point : curve) {
+      low = std::min(low, point.psnr);
+      high = std::max(high, point.psnr);
+    }
+    return high - low;
+  }
+
+  static std::string SettingKey(const char* rc, const char* deadline, int cpuUsed)
+  {
+    return std::string(rc) + "," + deadline + "," + std::to_string(cpuUsed);
+  }
+
+  /**
+  * Baseline files hold one line per rate point: rc,deadline,cpu_used,kbps,psnr.
+  */
+  static bool ReadBaseline(const std::string& path, std::map<std::string, std::vector<RatePoint>>& curves)
+  {
+    std::ifstream file(path);
+    std::string line;
+
+    if (!file || !std::getline(file, line)) return false;
+
+    while (std::getline(file, line)) {
+      const size_t split = line.find(',', line.find(',', line.find(',') + 1) + 1);
+      RatePoint point;
+
+      if (split == std::string::npos || sscanf(line.c_str() + split + 1, "%lf,%lf", &point.kbps, &point.psnr) != 2) {
+        continue;
+      }
+      curves[line.substr(0, split)].push_back(point);
+    }
+
+    return true;
+  }
+
+  static bool WriteBaseline(const std::string& path, const std::map<std::string, std::vector<RatePoint>>& curves)
+  {
+    std::ofstream file(path);
+
+    if (!file) return false;
+
+    file << "rc,deadline,cpu_used,kbps,psnr\n";
+    for (auto& curve : curves) {
+      for (auto& point : curve.second) file << curve.first << "," << Format(point.kbps, 6) << "," << Format(point.psnr, 6) << "\n";
+    }
+    return (bool)file;
+  }
+
+  int RunEncodeQualityBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 1;
+    std::string sourcePath, sourceSize, baselinePath;
+    FileClip fileClip;
+    ClipSettings settings;
+
+    for (size_t i = 0; i < options.args.size(); i++) {
+      const std::string& arg = options.args[i];
+
+      if (arg.size() > 4 && arg.compare(arg.size() - 4, 4, ".csv") == 0) {
+        baselinePath = arg;
+      }
+      else if (sourcePath.empty()) {
+        sourcePath = arg;
+        int w, h;
+        if (i + 1 < options.args.size() && sscanf(options.args[i + 1].c_str(), "%dx%d", &w, &h) == 2) {
+          sourceSize = options.args[++i];
+        }
+      }
+    }
+
+    settings.frames = ClipFrames;
+    if (!sourcePath.empty()) {
+      if (!ReadSource(sourcePath, sourceSize, fileClip)) {
+        std::cerr << "Failed to read " << sourcePath << ", expected a 4:2:0 Y4M file or an I420 file and WIDTHxHEIGHT."
+          << std::endl;
+        return 1;
+      }
+      settings.width = fileClip.width;
+      settings.height = fileClip.height;
+      settings.source = [&fileClip](vpx_image_t* img, int frame) { fileClip.Fill(img, frame); };
+    }
+
+    std::map<std::string, std::vector<RatePoint>> baseline, curves;
+    const bool haveBaseline = !baselinePath.empty() && ReadBaseline(baselinePath, baseline);
+    const double scale = (double)settings.width * settings.height / (640 * 480);
+
+    Table table({ "rc", "deadline", "cpu_used", "fps", "kbps", "psnr", "ssim", haveBaseline ? "bdrate_vs_baseline_pct" : "bdrate_pct" });
+
+    for (auto& rc : _rcModes) {
+      std::vector<RatePoint> firstCurve;
+
+      for (auto& speed : _speeds) {
+        const std::string key = SettingKey(rc.name, speed.name, speed.cpuUsed);
+        std::vector<RatePoint>& curve = curves[key];
+        double totalUs = 0, kbps = 0, psnr = 0, ssim = 0;
+        int frames = 0;
+
+        settings.endUsage = rc.mode;
+        settings.deadline = speed.deadline;
+        settings.cpuUsed = speed.cpuUsed;
+
+        for (int target : _bitratesKbps) {
+          EncodedClip clip;
+          double bestUs = 0;
+
+          settings.bitrateKbps = (int)(target * scale + 0.5);
+
+          for (int i = 0; i < iterations; i++) {
+            if (!EncodeTestClip(settings, clip)) {
+              std::cerr << "Encode failed for " << key << " at " << settings.bitrateKbps << " kbps." << std::endl;
+              return 1;
+            }
+            if (i == 0 || clip.encodeUs < bestUs) bestUs = clip.encodeUs;
+          }
+
+          const ClipQuality quality = MeasureClipQuality(clip, settings.source);
+          const RatePoint point = { ClipBitrateKbps(clip, 30.0), quality.psnr };
+
+          curve.push_back(point);
+          totalUs += bestUs;
+          frames += (int)clip.frames.size();
+          kbps += point.kbps;
+          psnr += quality.psnr;
+          ssim += quality.ssim;
+        }
+
+        if (firstCurve.empty()) firstCurve = curve;
+
+        const int points = (int)curve.size();
+        const std::vector<RatePoint>& reference = haveBaseline ? baseline[key] : firstCurve;
+        const double bdRate = PsnrSpan(reference) < MinPsnrSpan || PsnrSpan(curve) < MinPsnrSpan ? NAN
+          : BdRate(reference, curve);
+
+        table.AddRow({ rc.name, speed.name, std::to_string(speed.cpuUsed), Format(frames * 1e6 / totalUs),
+          Format(kbps / points), Format(psnr / points, 2), Format(ssim / points, 4),
+          std::isnan(bdRate) ? "-" : Format(bdRate, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+
+    if (!baselinePath.empty() && !haveBaseline) {
+      if (!WriteBaseline(baselinePath, curves)) {
+        std::cerr << "Failed to write the baseline " << baselinePath << "." << std::endl;
+        return 1;
+      }
+      std::cerr << "Wrote the baseline " << baselinePath << "." << std::endl;
+    }
+
+    return 0;
+  }
+}
@@ -0,0 +1,103 @@
+//-----------------------------------------------------------------------------
+// Filename: encode_threads_bench.cpp
+//
+// Description: Scaling of the row based multithreaded VP8 encoder. The
+// synthetic clip is encoded at four fixed quantizers with 1 to 8 threads and
+// each thread count's rate/distortion curve is compared to the single
+// threaded one with a BD-rate, so a speedup that costs quality shows up next
+// to it. Fixed quantizers rather than CBR targets keep the curve points
+// spread out whatever the content.
+//
+// Suite arguments: [width height frames], default 1280 720 60.
+//
+// The clip uses eight token partitions since g_threads may not exceed the
+// partition count. Threads are also capped at the number of cores.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int _threadCounts[] = { 1, 2, 4, 8 };
+  static const int _quantizers[] = { 8, 20, 36, 52 };
+
+  // Worker rows only differ from single threaded encoding in how the adaptive
+  // mode thresholds evolve, so anything beyond noise in the BD-rate is a bug.
+  static const double MaxBdRatePercent = 0.5;
+
+  int RunEncodeThreadsBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 2;
+    ClipSettings settings;
+
+    settings.width = 1280;
+    settings.height = 720;
+    settings.tokenPartitions = 3;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    Table table({ "threads", "fps", "ms_per_frame", "speedup", "bdrate_pct" });
+    std::vector<RatePoint> referenceCurve;
+    double referenceUs = 0;
+    int regressions = 0;
+
+    for (int threads : _threadCounts) {
+      std::vector<RatePoint> curve;
+      double totalUs = 0;
+      int frames = 0;
+
+      settings.threads = threads;
+
+      for (int quantizer : _quantizers) {
+        EncodedClip clip;
+        double bestUs = 0;
+
+        settings.quantizer = quantizer;
+
+        // Best of N to keep scheduler noise out of the scaling figures.
+        for (int i = 0; i < iterations; i++) {
+          if (!EncodeTestClip(settings, clip)) {
+            std::cerr << "Encode failed with " << threads << " threads at q " << quantizer << "." << std::endl;
+            return 1;
+          }
+          if (i == 0 || clip.encodeUs < bestUs) bestUs = clip.encodeUs;
+        }
+
+        totalUs += bestUs;
+        frames += (int)clip.frames.size();
+        curve.push_back({ ClipBitrateKbps(clip, 30.0), ClipPsnr(clip) });
+      }
+
+      if (threads == 1) {
+        referenceCurve = curve;
+        referenceUs = totalUs;
+      }
+
+      const double bdRate = BdRate(referenceCurve, curve);
+      if (std::isnan(bdRate) || bdRate > MaxBdRatePercent) regressions++;
+
+      table.AddRow({ std::to_string(threads), Format(frames * 1e6 / totalUs), Format(totalUs / 1000.0 / frames, 3),
+        Format(referenceUs / totalUs, 2), Format(bdRate, 2) });
+    }
+
+    table.Print(options.csv);
+    return regressions ? 1 : 0;
+  }
+}
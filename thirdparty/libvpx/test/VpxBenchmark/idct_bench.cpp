@@ -0,0 +1,135 @@
+//-----------------------------------------------------------------------------
+// Filename: idct_bench.cpp
+//
+// Description: Cycles per call for the VP8 inverse transform and
+// dequantisation kernels, for each instruction set the CPU supports. The
+// macroblock kernels are timed with all blocks DC only, all blocks full and
+// a mix typical of real content, since the eobs pick the path per block.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/blockd.h"
+
+#include <cstdlib>
+
+namespace VpxBenchmark
+{
+  static const int Stride = 64;
+
+  static short _q[25 * 16];
+  static short _dq[16];
+  static short _dqcoeff[16 * 16];
+  static unsigned char _dst[16 * Stride];
+  static unsigned char _pred[4 * 16];
+  static char _eobs[25];
+  static BLOCKD _block;
+
+  // The kernels clear the coefficients they consume, which does not change
+  // the path taken so the buffers are not refilled between calls.
+  template <void (*F)(short*, unsigned char*, int, unsigned char*, int)>
+  static void CallIdct() { F(_q, _pred, 16, _dst, Stride); }
+
+  template <void (*F)(short, unsigned char*, int, unsigned char*, int)>
+  static void CallDcOnly() { F(_q[0], _pred, 16, _dst, Stride); }
+
+  template <void (*F)(short*, short*, unsigned char*, int)>
+  static void CallDequantIdct() { F(_q, _dq, _dst, Stride); }
+
+  template <void (*F)(BLOCKD*, short*)>
+  static void CallDequantize() { F(&_block, _dq); }
+
+  template <void (*F)(short*, short*)>
+  static void CallWalsh() { F(_q, _dqcoeff); }
+
+  template <void (*F)(short*, short*, unsigned char*, int, char*)>
+  static void CallYBlock() { F(_q, _dq, _dst, Stride, _eobs); }
+
+  template <void (*F)(short*, short*, unsigned char*, unsigned char*, int, char*)>
+  static void CallUvBlock() { F(_q, _dq, _dst, _dst + 8, Stride, _eobs); }
+
+  enum class Eobs { None, DcOnly, Full, Mixed };
+
+  struct IdctKernel
+  {
+    const char* name;
+    Eobs eobs;
+    void (*fns[3])();   // C, SSE2, AVX2.
+  };
+
+  static const IdctKernel _idctKernels[] = {
+    { "idct4x4llm", Eobs::None, { CallIdct<vp8_short_idct4x4llm_c>, CallIdct<vp8_short_idct4x4llm_sse2>, nullptr } },
+    { "dc_only_idct_add", Eobs::None, { CallDcOnly<vp8_dc_only_idct_add_c>, CallDcOnly<vp8_dc_only_idct_add_sse2>, nullptr } },
+    { "dequant_idct_add", Eobs::None, { CallDequantIdct<vp8_dequant_idct_add_c>, CallDequantIdct<vp8_dequant_idct_add_sse2>, nullptr } },
+    { "dequantize_b", Eobs::None, { CallDequantize<vp8_dequantize_b_c>, CallDequantize<vp8_dequantize_b_sse2>, nullptr } },
+    { "inv_walsh4x4", Eobs::None, { CallWalsh<vp8_short_inv_walsh4x4_c>, CallWalsh<vp8_short_inv_walsh4x4_sse2>, nullptr } },
+    { "y_block", Eobs::DcOnly, { CallYBlock<vp8_dequant_idct_add_y_block_c>, CallYBlock<vp8_dequant_idct_add_y_block_sse2>, CallYBlock<vp8_dequant_idct_add_y_block_avx2> } },
+    { "y_block", Eobs::Full, { CallYBlock<vp8_dequant_idct_add_y_block_c>, CallYBlock<vp8_dequant_idct_add_y_block_sse2>, CallYBlock<vp8_dequant_idct_add_y_block_avx2> } },
+    { "y_block", Eobs::Mixed, { CallYBlock<vp8_dequant_idct_add_y_block_c>, CallYBlock<vp8_dequant_idct_add_y_block_sse2>, CallYBlock<vp8_dequant_idct_add_y_block_avx2> } },
+    { "uv_block", Eobs::DcOnly, { CallUvBlock<vp8_dequant_idct_add_uv_block_c>, CallUvBlock<vp8_dequant_idct_add_uv_block_sse2>, CallUvBlock<vp8_dequant_idct_add_uv_block_avx2> } },
+    { "uv_block", Eobs::Full, { CallUvBlock<vp8_dequant_idct_add_uv_block_c>, CallUvBlock<vp8_dequant_idct_add_uv_block_sse2>, CallUvBlock<vp8_dequant_idct_add_uv_block_avx2> } },
+    { "uv_block", Eobs::Mixed, { CallUvBlock<vp8_dequant_idct_add_uv_block_c>, CallUvBlock<vp8_dequant_idct_add_uv_block_sse2>, CallUvBlock<vp8_dequant_idct_add_uv_block_avx2> } },
+  };
+
+  static const char* _idctIsaNames[3] = { "c", "sse2", "avx2" };
+  static const int _idctIsaCaps[3] = { 0, HAS_SSE2, HAS_AVX2 };
+
+  /**
+  * The mixed pattern has about a third of the blocks carrying AC
+  * coefficients, roughly what an inter frame at a moderate rate produces.
+  */
+  static void SetEobs(Eobs eobs)
+  {
+    srand(1);
+    for (int i = 0; i < 25; i++) {
+      _eobs[i] = eobs == Eobs::Full ? 16 : eobs == Eobs::DcOnly ? (char)(rand() & 1) :
+        (rand() % 3) == 0 ? (char)(2 + rand() % 15) : (char)(rand() & 1);
+    }
+  }
+
+  static const char* EobsName(Eobs eobs)
+  {
+    return eobs == Eobs::DcOnly ? "dc_only" : eobs == Eobs::Full ? "full" : eobs == Eobs::Mixed ? "mixed" : "-";
+  }
+
+  int RunIdctBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 200000;
+
+    for (int i = 0; i < 25 * 16; i++) _q[i] = (short)((rand() & 255) - 128);
+    for (int i = 0; i < 16; i++) _dq[i] = (short)(4 + rand() % 154);
+    for (int i = 0; i < (int)sizeof(_dst); i++) _dst[i] = (unsigned char)rand();
+    for (int i = 0; i < (int)sizeof(_pred); i++) _pred[i] = (unsigned char)rand();
+    _block.qcoeff = _q;
+    _block.dqcoeff = _dqcoeff;
+
+    Table table({ "kernel", "eobs", "isa", "cycles_per_call", "speedup" });
+
+    for (auto& kernel : _idctKernels) {
+      double cCycles = 0;
+
+      SetEobs(kernel.eobs);
+
+      for (int isa = 0; isa < 3; isa++) {
+        if (!kernel.fns[isa] || !CpuHas(_idctIsaCaps[isa])) continue;
+
+        double cycles = MeasureCycles(kernel.fns[isa], iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, EobsName(kernel.eobs), _idctIsaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
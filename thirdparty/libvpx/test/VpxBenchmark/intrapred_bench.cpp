@@ -0,0 +1,177 @@
+//-----------------------------------------------------------------------------
+// Filename: intrapred_bench.cpp
+//
+// Description: Two suites for the intra predictors. "intrapred" gives cycles
+// per call for the 16x16, 8x8 and 4x4 predictors VP8 uses, C against SSE2.
+// "keyframe" times a clip made only of key frames, where intra prediction
+// is on every macroblock, through the encoder and then the decoder.
+//
+// keyframe suite arguments: [width height frames], default 1920 1080 20.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int Stride = 64;
+
+  static uint8_t _edge[2 * Stride];
+  static uint8_t _dst[16 * Stride];
+  static const uint8_t* const _above = _edge + 16;
+  static const uint8_t* const _left = _edge + Stride;
+
+  template <void (*F)(uint8_t*, ptrdiff_t, const uint8_t*, const uint8_t*)>
+  static void CallPredictor() { F(_dst, Stride, _above, _left); }
+
+  struct IntraPredKernel
+  {
+    const char* name;
+    void (*fns[2])();   // C, SSE2.
+  };
+
+#define INTRA_PRED_KERNEL(type, size) \
+  { #type "_" #size, { CallPredictor<vpx_##type##_predictor_##size##_c>, CallPredictor<vpx_##type##_predictor_##size##_sse2> } }
+
+  static const IntraPredKernel _intraPredKernels[] = {
+    INTRA_PRED_KERNEL(dc, 16x16), INTRA_PRED_KERNEL(dc_top, 16x16), INTRA_PRED_KERNEL(dc_left, 16x16),
+    INTRA_PRED_KERNEL(dc_128, 16x16), INTRA_PRED_KERNEL(v, 16x16), INTRA_PRED_KERNEL(h, 16x16),
+    INTRA_PRED_KERNEL(tm, 16x16),
+    INTRA_PRED_KERNEL(dc, 8x8), INTRA_PRED_KERNEL(dc_top, 8x8), INTRA_PRED_KERNEL(dc_left, 8x8),
+    INTRA_PRED_KERNEL(dc_128, 8x8), INTRA_PRED_KERNEL(v, 8x8), INTRA_PRED_KERNEL(h, 8x8),
+    INTRA_PRED_KERNEL(tm, 8x8),
+    INTRA_PRED_KERNEL(dc, 4x4), INTRA_PRED_KERNEL(tm, 4x4), INTRA_PRED_KERNEL(ve, 4x4),
+    INTRA_PRED_KERNEL(he, 4x4), INTRA_PRED_KERNEL(d45e, 4x4), INTRA_PRED_KERNEL(d63e, 4x4),
+    INTRA_PRED_KERNEL(d135, 4x4), INTRA_PRED_KERNEL(d117, 4x4), INTRA_PRED_KERNEL(d153, 4x4),
+    INTRA_PRED_KERNEL(d207, 4x4),
+  };
+
+  static const char* _intraPredIsaNames[2] = { "c", "sse2" };
+  static const int _intraPredIsaCaps[2] = { 0, HAS_SSE2 };
+
+  int RunIntraPredBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 1000000;
+
+    srand(1);
+    for (int i = 0; i < (int)sizeof(_edge); i++) _edge[i] = (uint8_t)(rand() & 0xff);
+
+    Table table({ "kernel", "isa", "cycles_per_call", "speedup" });
+
+    for (auto& kernel : _intraPredKernels) {
+      double cCycles = 0;
+
+      for (int isa = 0; isa < 2; isa++) {
+        if (!CpuHas(_intraPredIsaCaps[isa])) continue;
+
+        double cycles = MeasureCycles(kernel.fns[isa], iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, _intraPredIsaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+
+  /**
+  * Decodes every frame of clip and returns the time taken in microseconds,
+  * or a negative value on a decoder error.
+  */
+  static double DecodeKeyframes(const EncodedClip& clip)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+    bool ok = true;
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return -1;
+
+    double us = MeasureMicroseconds([&]() {
+      for (auto& frame : clip.frames) {
+        if (vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0)) {
+          ok = false;
+          break;
+        }
+
+        vpx_codec_iter_t iter = nullptr;
+        while (vpx_codec_get_frame(&decoder, &iter) != nullptr) {
+        }
+      }
+    });
+
+    vpx_codec_destroy(&decoder);
+    return ok ? us : -1;
+  }
+
+  int RunKeyframeBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    ClipSettings settings;
+
+    settings.width = 1920;
+    settings.height = 1080;
+    settings.frames = 20;
+    settings.bitrateKbps = 8000;
+    settings.keyframeInterval = 1;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    double bestEncodeUs = 0, bestDecodeUs = 0;
+    EncodedClip clip;
+
+    // Best of N for both, the encode being re-run each time.
+    for (int i = 0; i < iterations; i++) {
+      clip = EncodedClip();
+      if (!EncodeTestClip(settings, clip)) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+
+      double decodeUs = DecodeKeyframes(clip);
+      if (decodeUs < 0) {
+        std::cerr << "Key frame decode failed." << std::endl;
+        return 1;
+      }
+
+      if (i == 0 || clip.encodeUs < bestEncodeUs) bestEncodeUs = clip.encodeUs;
+      if (i == 0 || decodeUs < bestDecodeUs) bestDecodeUs = decodeUs;
+    }
+
+    // Bit 0 of the frame tag is clear on a key frame.
+    int keyframes = 0;
+    for (auto& frame : clip.frames) {
+      if (!frame.empty() && (frame[0] & 1) == 0) keyframes++;
+    }
+
+    const double frames = (double)clip.frames.size();
+    Table table({ "stage", "resolution", "frames", "key_frames", "fps", "ms_per_frame" });
+    const std::string resolution = std::to_string(clip.width) + "x" + std::to_string(clip.height);
+
+    table.AddRow({ "encode", resolution, std::to_string(clip.frames.size()), std::to_string(keyframes),
+      Format(frames * 1e6 / bestEncodeUs), Format(bestEncodeUs / 1000.0 / frames, 3) });
+    table.AddRow({ "decode", resolution, std::to_string(clip.frames.size()), std::to_string(keyframes),
+      Format(frames * 1e6 / bestDecodeUs), Format(bestDecodeUs / 1000.0 / frames, 3) });
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
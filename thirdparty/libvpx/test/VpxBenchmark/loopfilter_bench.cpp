@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Filename: loopfilter_bench.cpp
+//
+// Description: Cycles per call for the VP8 loop filters, for each
+// instruction set the CPU supports. The normal filters are timed on a luma
+// macroblock with its chroma, the simple filters on luma alone, at a mid
+// filter level where most pixels pass the filter masks.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/loopfilter.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace VpxBenchmark
+{
+  static const int Stride = 64;
+  static const int Level = 32;
+
+  static unsigned char _frame[32 * Stride];
+  static unsigned char* const _y = _frame + 8 * Stride + 8;
+  static unsigned char* const _u = _frame + 8 * Stride + 32;
+  static unsigned char* const _v = _frame + 8 * Stride + 48;
+  static loop_filter_info_n _lfiN;
+  static loop_filter_info _lfi;
+
+  // The filters smooth the block a little more on each call, but on the
+  // low amplitude content used the masks keep passing so the work done per
+  // call stays the same.
+  template <void (*F)(unsigned char*, unsigned char*, unsigned char*, int, int, loop_filter_info*)>
+  static void CallNormal() { F(_y, _u, _v, Stride, Stride, &_lfi); }
+
+  template <void (*F)(unsigned char*, int, const unsigned char*)>
+  static void CallSimple() { F(_y, Stride, _lfiN.blim[Level]); }
+
+  struct LoopFilterKernel
+  {
+    const char* name;
+    void (*fns[3])();   // C, SSE2, AVX2.
+  };
+
+  static const LoopFilterKernel _loopFilterKernels[] = {
+    { "mbh", { CallNormal<vp8_loop_filter_mbh_c>, CallNormal<vp8_loop_filter_mbh_sse2>, CallNormal<vp8_loop_filter_mbh_avx2> } },
+    { "mbv", { CallNormal<vp8_loop_filter_mbv_c>, CallNormal<vp8_loop_filter_mbv_sse2>, CallNormal<vp8_loop_filter_mbv_avx2> } },
+    { "bh", { CallNormal<vp8_loop_filter_bh_c>, CallNormal<vp8_loop_filter_bh_sse2>, CallNormal<vp8_loop_filter_bh_avx2> } },
+    { "bv", { CallNormal<vp8_loop_filter_bv_c>, CallNormal<vp8_loop_filter_bv_sse2>, CallNormal<vp8_loop_filter_bv_avx2> } },
+    { "simple_mbh", { CallSimple<vp8_loop_filter_simple_horizontal_edge_c>, CallSimple<vp8_loop_filter_simple_horizontal_edge_sse2>, nullptr } },
+    { "simple_mbv", { CallSimple<vp8_loop_filter_simple_vertical_edge_c>, CallSimple<vp8_loop_filter_simple_vertical_edge_sse2>, nullptr } },
+    { "simple_bh", { CallSimple<vp8_loop_filter_bhs_c>, CallSimple<vp8_loop_filter_bhs_sse2>, nullptr } },
+    { "simple_bv", { CallSimple<vp8_loop_filter_bvs_c>, CallSimple<vp8_loop_filter_bvs_sse2>, nullptr } },
+  };
+
+  static const char* _loopFilterIsaNames[3] = { "c", "sse2", "avx2" };
+  static const int _loopFilterIsaCaps[3] = { 0, HAS_SSE2, HAS_AVX2 };
+
+  static void FillFrame()
+  {
+    srand(1);
+    for (int i = 0; i < (int)sizeof(_frame); i++) _frame[i] = (unsigned char)(120 + rand() % 8);
+  }
+
+  int RunLoopFilterBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 200000;
+
+    memset(&_lfiN, 0, sizeof(_lfiN));
+    vp8_loop_filter_update_sharpness(&_lfiN, 0);
+    memset(_lfiN.hev_thr[1], 1, SIMD_WIDTH);
+    _lfi.mblim = _lfiN.mblim[Level];
+    _lfi.blim = _lfiN.blim[Level];
+    _lfi.lim = _lfiN.lim[Level];
+    _lfi.hev_thr = _lfiN.hev_thr[1];
+
+    Table table({ "kernel", "isa", "cycles_per_call", "speedup" });
+
+    for (auto& kernel : _loopFilterKernels) {
+      double cCycles = 0;
+
+      for (int isa = 0; isa < 3; isa++) {
+        if (!kernel.fns[isa] || !CpuHas(_loopFilterIsaCaps[isa])) continue;
+
+        FillFrame();
+        double cycles = MeasureCycles(kernel.fns[isa], iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, _loopFilterIsaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
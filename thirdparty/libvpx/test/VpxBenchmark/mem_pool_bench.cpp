@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Filename: mem_pool_bench.cpp
+//
+// Description: Allocation churn of short lived decoders, as calls come and
+// go, with malloc() and with the built-in pool allocator from
+// vpx_mem_pool_allocator() set on each decoder. Each session creates a
+// decoder, decodes the start of a clip and destroys it. The resolution
+// switch rows decode the start of a 640x360 and a 1280x720 clip in turn
+// with one decoder, which only allocates at the first switch up in size.
+//
+// heap_allocs counts the allocations that went to malloc(), every
+// allocation for malloc() and only the pool's misses for the pool. Every
+// image is checked to be bit-exact with the malloc() decode.
+//
+// Suite arguments: [sessions frames], default 200 10.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  struct ChurnRun
+  {
+    uint64_t hash = 0;
+    double us = 0;
+    vpx_mem_stats_t before = {};
+    vpx_mem_stats_t after = {};
+  };
+
+  /**
+  * Decodes the first frames of a clip and returns false on any decoder error.
+  */
+  static bool DecodeStart(vpx_codec_ctx_t* decoder, const EncodedClip& clip, int frames, uint64_t& hash)
+  {
+    for (int i = 0; i < frames && i < (int)clip.frames.size(); i++) {
+      if (vpx_codec_decode(decoder, clip.frames[i].data(), (unsigned int)clip.frames[i].size(), nullptr, 0)) {
+        return false;
+      }
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(decoder, &iter)) != nullptr) hash = HashImage(img, hash);
+    }
+    return true;
+  }
+
+  /**
+  * Runs sessions decoders one after the other, each decoding the start of
+  * clip.
+  */
+  static bool RunSessions(const EncodedClip& clip, int sessions, int frames, const vpx_mem_allocator_t* allocator,
+    ChurnRun& run)
+  {
+    bool ok = true;
+
+    vpx_mem_get_stats(&run.before);
+    run.us = MeasureMicroseconds([&]() {
+      for (int s = 0; ok && s < sessions; s++) {
+        vpx_codec_ctx_t decoder;
+        vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+
+        if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) {
+          ok = false;
+          break;
+        }
+        ok = vpx_codec_set_mem_allocator(&decoder, allocator) == VPX_CODEC_OK &&
+          DecodeStart(&decoder, clip, frames, run.hash);
+        vpx_codec_destroy(&decoder);
+      }
+    });
+    vpx_mem_get_stats(&run.after);
+    return ok;
+  }
+
+  /**
+  * Decodes the start of each clip in turn with one decoder, switches times.
+  */
+  static bool RunSwitches(const EncodedClip& low, const EncodedClip& high, int switches, int frames,
+    const vpx_mem_allocator_t* allocator, ChurnRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    bool ok;
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), nullptr, 0)) return false;
+    ok = vpx_codec_set_mem_allocator(&decoder, allocator) == VPX_CODEC_OK;
+
+    vpx_mem_get_stats(&run.before);
+    run.us = MeasureMicroseconds([&]() {
+      for (int s = 0; ok && s < switches; s++) ok = DecodeStart(&decoder, (s & 1) ? high : low, frames, run.hash);
+    });
+    vpx_mem_get_stats(&run.after);
+
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  int RunMemPoolBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    int sessions = 200;
+    int frames = 10;
+
+    if (options.args.size() >= 1) sessions = atoi(options.args[0].c_str());
+    if (options.args.size() >= 2) frames = atoi(options.args[1].c_str());
+
+    EncodedClip clips[2];
+    for (int i = 0; i < 2; i++) {
+      ClipSettings settings;
+
+      settings.width = i ? 1280 : 640;
+      settings.height = i ? 720 : 360;
+      settings.frames = frames;
+      settings.bitrateKbps = i ? 2500 : 800;
+      if (!EncodeTestClip(settings, clips[i])) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+    }
+
+    Table table({ "scenario", "allocator", "us_per_session", "allocs_per_session", "heap_allocs_per_session",
+      "pool_hit_pct", "speedup", "bit_exact" });
+    int mismatches = 0;
+
+    for (int scenario = 0; scenario < 3; scenario++) {
+      static const char* const names[] = { "640x360", "1280x720", "switch" };
+      ChurnRun system;
+
+      for (bool pool : { false, true }) {
+        const vpx_mem_allocator_t* allocator = pool ? vpx_mem_pool_allocator() : nullptr;
+        ChurnRun best;
+
+        for (int i = 0; i < iterations; i++) {
+          ChurnRun run;
+          const bool ok = scenario < 2 ? RunSessions(clips[scenario], sessions, frames, allocator, run)
+            : RunSwitches(clips[0], clips[1], sessions, frames, allocator, run);
+
+          if (!ok) {
+            std::cerr << "Decode failed in the " << names[scenario] << " scenario." << std::endl;
+            return 1;
+          }
+          if (i == 0 || run.us < best.us) best = run;
+        }
+
+        // Start the next scenario with an empty pool.
+        vpx_mem_pool_set_limit(0);
+        vpx_mem_pool_set_limit(128 << 20);
+
+        if (!pool) system = best;
+        if (best.hash != system.hash) mismatches++;
+
+        const uint64_t allocs = best.after.allocs - best.before.allocs;
+        const uint64_t hits = best.after.pool_hits - best.before.pool_hits;
+        const uint64_t misses = best.after.pool_misses - best.before.pool_misses;
+        table.AddRow({ names[scenario], pool ? "pool" : "malloc", Format(best.us / sessions, 1),
+          Format((double)allocs / sessions, 1), Format((double)(allocs - hits) / sessions, 2),
+          Format(hits + misses ? 100.0 * hits / (hits + misses) : 0, 1), Format(system.us / best.us, 2),
+          best.hash == system.hash ? "yes" : "NO" });
+      }
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+// Filename: memory_bench.cpp
+//
+// Description: Memory held by a VP8 decoder with and without
+// VP8D_SET_COMPACT_BUFFERS, for hosts that run many decoders at once. The
+// sizes are from VP8D_GET_MEMORY_USAGE once the clip has been decoded. Every
+// image of the compact decode is checked to be bit-exact with the normal
+// decode and the streams per GB column is how many decoders would fit in
+// 1 GB of memory.
+//
+// Suite arguments: [frames threads], default 90 1. Clips of 320x180, 640x360
+// and 1280x720 are decoded.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int _sizes[][2] = { { 320, 180 }, { 640, 360 }, { 1280, 720 } };
+
+  struct MemoryRun
+  {
+    std::vector<uint64_t> hashes;     // Per output image.
+    vp8d_memory_usage usage = {};
+    double decodeUs = 0;
+  };
+
+  /**
+  * Decodes the whole clip and returns false on any decoder error.
+  */
+  static bool DecodeClip(const EncodedClip& clip, int threads, bool compact, MemoryRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { (unsigned int)threads, (unsigned int)clip.width, (unsigned int)clip.height };
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return false;
+
+    bool ok = vpx_codec_control(&decoder, VP8D_SET_COMPACT_BUFFERS, compact ? 1 : 0) == VPX_CODEC_OK;
+
+    for (size_t i = 0; ok && i < clip.frames.size(); i++) {
+      run.decodeUs += MeasureMicroseconds([&]() {
+        ok = !vpx_codec_decode(&decoder, clip.frames[i].data(), (unsigned int)clip.frames[i].size(), nullptr, 0);
+      });
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) run.hashes.push_back(HashImage(img, 0));
+    }
+
+    ok = ok && vpx_codec_control(&decoder, VP8D_GET_MEMORY_USAGE, &run.usage) == VPX_CODEC_OK;
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  static std::string Kb(size_t bytes)
+  {
+    return Format(bytes / 1024.0, 1);
+  }
+
+  int RunMemoryBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    int frames = 90;
+    int threads = 1;
+
+    if (options.args.size() >= 1) frames = atoi(options.args[0].c_str());
+    if (options.args.size() >= 2) threads = atoi(options.args[1].c_str());
+
+    Table table({ "size", "compact", "total_kb", "frame_buffers_kb", "buffers", "mb_info_kb", "threads_kb",
+      "other_kb", "saved_pct", "streams_per_gb", "ms_per_frame", "bit_exact" });
+
+    for (auto& size : _sizes) {
+      ClipSettings settings;
+      EncodedClip clip;
+
+      settings.width = size[0];
+      settings.height = size[1];
+      settings.frames = frames;
+      settings.bitrateKbps = size[0] * size[1] / 300;
+
+      if (!EncodeTestClip(settings, clip)) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+
+      MemoryRun normal;
+
+      for (bool compact : { false, true }) {
+        MemoryRun best;
+
+        for (int i = 0; i < iterations; i++) {
+          MemoryRun run;
+
+          if (!DecodeClip(clip, threads, compact, run)) {
+            std::cerr << "Failed to decode the test clip." << std::endl;
+            return 1;
+          }
+          if (i == 0 || run.decodeUs < best.decodeUs) best = run;
+        }
+
+        if (!compact) normal = best;
+
+        const vp8d_memory_usage& usage = best.usage;
+        const double saved = 100.0 * (1.0 - (double)usage.total / normal.usage.total);
+        table.AddRow({ std::to_string(size[0]) + "x" + std::to_string(size[1]), compact ? "on" : "off",
+          Kb(usage.total), Kb(usage.frame_buffers), std::to_string(usage.frame_buffer_count), Kb(usage.mb_info),
+          Kb(usage.threads), Kb(usage.other), Format(saved, 1), std::to_string((1 << 30) / usage.total),
+          Format(best.decodeUs / 1000.0 / clip.frames.size(), 3), best.hashes == normal.hashes ? "yes" : "no" });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
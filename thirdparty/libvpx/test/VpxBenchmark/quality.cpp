@@ -0,0 +1,181 @@
+//-----------------------------------------------------------------------------
+// Filename: quality.cpp
+//
+// Description: Objective quality measures for the encoder suites: PSNR and
+// SSIM of a decoded clip against its source, from vpx_dsp/psnr.c and
+// vpx_dsp/ssim.c, and the Bjontegaard delta rate between two
+// rate/distortion curves.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+#include "vpx_dsp/psnr.h"
+#include "vpx_dsp/ssim.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace VpxBenchmark
+{
+  /**
+  * Wraps the planes of img for the vpx_dsp metrics, which only read the
+  * buffers, strides and cropped sizes.
+  */
+  static YV12_BUFFER_CONFIG WrapImage(const vpx_image_t* img)
+  {
+    YV12_BUFFER_CONFIG yv12 = {};
+
+    yv12.y_buffer = img->planes[VPX_PLANE_Y];
+    yv12.u_buffer = img->planes[VPX_PLANE_U];
+    yv12.v_buffer = img->planes[VPX_PLANE_V];
+    yv12.y_stride = img->stride[VPX_PLANE_Y];
+    yv12.uv_stride = img->stride[VPX_PLANE_U];
+    yv12.y_crop_width = img->d_w;
+    yv12.y_crop_height = img->d_h;
+    yv12.uv_crop_width = (img->d_w + 1) / 2;
+    yv12.uv_crop_height = (img->d_h + 1) / 2;
+    return yv12;
+  }
+
+  ClipQuality MeasureClipQuality(const EncodedClip& clip, const FrameSource& source)
+  {
+    ClipQuality quality = {};
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0)) return quality;
+
+    vpx_image_t* sourceImg = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, clip.width, clip.height, 1);
+    const YV12_BUFFER_CONFIG sourceYv12 = WrapImage(sourceImg);
+    double sse = 0;
+    double samples = 0;
+    double ssim = 0;
+    int frame = 0;
+
+    for (auto& data : clip.frames) {
+      if (vpx_codec_decode(&decoder, data.data(), (unsigned int)data.size(), nullptr, 0)) break;
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) {
+        const YV12_BUFFER_CONFIG decoded = WrapImage(img);
+        vpx_codec_cx_pkt_t pkt;
+        double weight;
+
+        // PSNR_STATS is the psnr member of the packet, which C++ scopes to
+        // the packet, so psnr.h only has it declared.
+        source(sourceImg, frame++);
+        vpx_calc_psnr(&sourceYv12, &decoded, reinterpret_cast<PSNR_STATS*>(&pkt.data.psnr));
+        sse += (double)pkt.data.psnr.sse[0];
+        samples += pkt.data.psnr.samples[0];
+        ssim += vpx_calc_ssim(&sourceYv12, &decoded, &weight);
+      }
+    }
+
+    vpx_img_free(sourceImg);
+    vpx_codec_destroy(&decoder);
+
+    if (frame > 0) {
+      quality.psnr = vpx_sse_to_psnr(samples, 255.0, sse);
+      quality.ssim = ssim / frame;
+    }
+    return quality;
+  }
+
+  double ImagePsnr(const vpx_image_t* source, const vpx_image_t* decoded)
+  {
+    const YV12_BUFFER_CONFIG sourceYv12 = WrapImage(source);
+    const YV12_BUFFER_CONFIG decodedYv12 = WrapImage(decoded);
+    vpx_codec_cx_pkt_t pkt;
+
+    vpx_calc_psnr(&sourceYv12, &decodedYv12, reinterpret_cast<PSNR_STATS*>(&pkt.data.psnr));
+    return pkt.data.psnr.psnr[0];
+  }
+
+  double ClipPsnr(const EncodedClip& clip)
+  {
+    return MeasureClipQuality(clip, FillTestFrame).psnr;
+  }
+
+  double ClipBitrateKbps(const EncodedClip& clip, double fps)
+  {
+    size_t bytes = 0;
+    for (auto& frame : clip.frames) bytes += frame.size();
+    return clip.frames.empty() ? 0 : bytes * 8.0 * fps / clip.frames.size() / 1000.0;
+  }
+
+  /**
+  * Least squares fit of log(rate) as a cubic in (PSNR - centre), returning
+  * the coefficients lowest order first. Centring keeps the normal equations
+  * well conditioned.
+  */
+  static void FitCubic(const std::vector<RatePoint>& points, double centre, double coeffs[4])
+  {
+    double m[4][5] = {};
+
+    for (auto& p : points) {
+      double powers[7] = { 1 };
+      for (int i = 1; i < 7; i++) powers[i] = powers[i - 1] * (p.psnr - centre);
+      for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) m[r][c] += powers[r + c];
+        m[r][4] += powers[r] * log(p.kbps);
+      }
+    }
+
+    // Gaussian elimination with partial pivoting.
+    for (int c = 0; c < 4; c++) {
+      int pivot = c;
+      for (int r = c + 1; r < 4; r++) {
+        if (fabs(m[r][c]) > fabs(m[pivot][c])) pivot = r;
+      }
+      for (int k = 0; k < 5; k++) std::swap(m[c][k], m[pivot][k]);
+      for (int r = 0; r < 4; r++) {
+        if (r == c || m[c][c] == 0) continue;
+        const double f = m[r][c] / m[c][c];
+        for (int k = c; k < 5; k++) m[r][k] -= f * m[c][k];
+      }
+    }
+
+    for (int i = 0; i < 4; i++) coeffs[i] = m[i][i] != 0 ? m[i][4] / m[i][i] : 0;
+  }
+
+  static double IntegrateCubic(const double coeffs[4], double from, double to)
+  {
+    double sum = 0;
+    for (int i = 0; i < 4; i++) sum += coeffs[i] * (pow(to, i + 1) - pow(from, i + 1)) / (i + 1);
+    return sum;
+  }
+
+  double BdRate(const std::vector<RatePoint>& reference, const std::vector<RatePoint>& test)
+  {
+    if (reference.size() < 4 || test.size() < 4) return NAN;
+
+    auto psnrLess = [](const RatePoint& a, const RatePoint& b) { return a.psnr < b.psnr; };
+    const double low = std::max(std::min_element(reference.begin(), reference.end(), psnrLess)->psnr,
+      std::min_element(test.begin(), test.end(), psnrLess)->psnr);
+    const double high = std::min(std::max_element(reference.begin(), reference.end(), psnrLess)->psnr,
+      std::max_element(test.begin(), test.end(), psnrLess)->psnr);
+
+    if (high <= low) return NAN;
+
+    const double centre = (low + high) / 2;
+    const double from = low - centre;
+    const double to = high - centre;
+    double refCoeffs[4], testCoeffs[4];
+    FitCubic(reference, centre, refCoeffs);
+    FitCubic(test, centre, testCoeffs);
+
+    const double avgDiff = (IntegrateCubic(testCoeffs, from, to) - IntegrateCubic(refCoeffs, from, to)) / (high - low);
+    return (exp(avgDiff) - 1.0) * 100.0;
+  }
+}
@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+// Filename: residual_bench.cpp
+//
+// Description: Cycles per call for the encoder's residual kernels: block
+// subtraction, the forward DCT and Walsh transforms and the two quantizers,
+// for each instruction set the CPU supports. The quantizers use the tables
+// vp8cx_init_quantizer() builds at a mid Q index.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vp8_rtcd.h"
+#include "vpx_dsp_rtcd.h"
+#include "vp8/encoder/onyx_int.h"
+#include "vp8/encoder/quantize.h"
+#include "vpx_mem/vpx_mem.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace VpxBenchmark
+{
+  static const int Stride = 64;
+  static const int Q = 60;
+
+  static unsigned char _src[16 * Stride];
+  static unsigned char _pred[16 * Stride];
+  DECLARE_ALIGNED(16, static short, _diff[16 * 16]);
+  DECLARE_ALIGNED(16, static short, _coeff[32]);
+  DECLARE_ALIGNED(16, static short, _qcoeff[16]);
+  DECLARE_ALIGNED(16, static short, _dqcoeff[16]);
+  DECLARE_ALIGNED(16, static short, _dequant[16]);
+  static char _eob;
+  static BLOCK _block;
+  static BLOCKD _blockd;
+
+  template <void (*F)(int, int, int16_t*, ptrdiff_t, const uint8_t*, ptrdiff_t, const uint8_t*, ptrdiff_t)>
+  static void CallSubtract() { F(16, 16, _diff, 16, _src, Stride, _pred, Stride); }
+
+  template <void (*F)(short*, short*, int)>
+  static void CallTransform() { F(_diff, _coeff, 32); }
+
+  template <void (*F)(BLOCK*, BLOCKD*)>
+  static void CallQuantize() { F(&_block, &_blockd); }
+
+  struct ResidualKernel
+  {
+    const char* name;
+    void (*fns[2])();   // C, SSE2.
+  };
+
+  static const ResidualKernel _residualKernels[] = {
+    { "subtract16x16", { CallSubtract<vpx_subtract_block_c>, CallSubtract<vpx_subtract_block_sse2> } },
+    { "fdct4x4", { CallTransform<vp8_short_fdct4x4_c>, CallTransform<vp8_short_fdct4x4_sse2> } },
+    { "fdct8x4", { CallTransform<vp8_short_fdct8x4_c>, CallTransform<vp8_short_fdct8x4_sse2> } },
+    { "walsh4x4", { CallTransform<vp8_short_walsh4x4_c>, CallTransform<vp8_short_walsh4x4_sse2> } },
+    { "regular_quantize_b", { CallQuantize<vp8_regular_quantize_b_c>, CallQuantize<vp8_regular_quantize_b_sse2> } },
+    { "fast_quantize_b", { CallQuantize<vp8_fast_quantize_b_c>, CallQuantize<vp8_fast_quantize_b_sse2> } },
+  };
+
+  static const char* _residualIsaNames[2] = { "c", "sse2" };
+  static const int _residualIsaCaps[2] = { 0, HAS_SSE2 };
+
+  int RunResidualBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 200000;
+    VP8_COMP* cpi = (VP8_COMP*)vpx_calloc(1, sizeof(VP8_COMP));
+
+    if (!cpi) return 1;
+
+    srand(1);
+    for (int i = 0; i < (int)sizeof(_src); i++) {
+      _src[i] = (unsigned char)(rand() & 0xff);
+      _pred[i] = (unsigned char)(_src[i] + rand() % 32 - 16);
+    }
+
+    // The luma AC tables, quantizing the coefficients of a typical residual.
+    cpi->sf.improved_quant = 1;
+    vp8cx_init_quantizer(cpi);
+    vpx_subtract_block_c(16, 16, _diff, 16, _src, Stride, _pred, Stride);
+    vp8_short_fdct4x4_c(_diff, _coeff, 32);
+    memcpy(_dequant, cpi->common.Y1dequant[Q], sizeof(_dequant));
+    _block.coeff = _coeff;
+    _block.quant = cpi->Y1quant[Q];
+    _block.quant_fast = cpi->Y1quant_fast[Q];
+    _block.quant_shift = cpi->Y1quant_shift[Q];
+    _block.zbin = cpi->Y1zbin[Q];
+    _block.round = cpi->Y1round[Q];
+    _block.zrun_zbin_boost = cpi->zrun_zbin_boost_y1[Q];
+    _blockd.qcoeff = _qcoeff;
+    _blockd.dqcoeff = _dqcoeff;
+    _blockd.dequant = _dequant;
+    _blockd.eob = &_eob;
+
+    Table table({ "kernel", "isa", "cycles_per_call", "speedup" });
+
+    for (auto& kernel : _residualKernels) {
+      double cCycles = 0;
+
+      for (int isa = 0; isa < 2; isa++) {
+        if (!CpuHas(_residualIsaCaps[isa])) continue;
+
+        double cycles = MeasureCycles(kernel.fns[isa], iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, _residualIsaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    vpx_free(cpi);
+    return 0;
+  }
+}
@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// Filename: resolution_switch_bench.cpp
+//
+// Description: Latency of a VP8 decoder switching between simulcast layers of
+// 320x180, 640x360 and 1280x720, as when a subscriber is moved between
+// layers. Each switch decodes the start of one layer and then the start of
+// the other with the same decoder, and switch_us is the time to decode the
+// key frame at the new size. same_size_us is that key frame decoded by a
+// decoder already at the size and new_decoder_us is destroying the decoder
+// and creating another for it instead.
+//
+// allocs_per_switch counts the allocations made decoding the new layer,
+// after the first switch has sized the decoder for both layers. Every image
+// after a switch is checked to be bit-exact with a new decoder.
+//
+// Suite arguments: [frames threads], default 5 1. Iterations is the number
+// of switches timed for each pair of sizes, default 50.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const int _sizes[][2] = { { 320, 180 }, { 640, 360 }, { 1280, 720 } };
+
+  struct SwitchRun
+  {
+    double switchUs = 0;
+    double sameSizeUs = 0;
+    double newDecoderUs = 0;
+    uint64_t allocs = 0;
+    bool bitExact = true;
+  };
+
+  static bool InitDecoder(vpx_codec_ctx_t* decoder, int threads)
+  {
+    vpx_codec_dec_cfg_t cfg = { (unsigned int)threads, 0, 0 };
+    return vpx_codec_dec_init(decoder, vpx_codec_vp8_dx(), &cfg, 0) == VPX_CODEC_OK;
+  }
+
+  /**
+  * Decodes the first frames of a clip, timing the key frame that starts it,
+  * and returns false on any decoder error.
+  */
+  static bool DecodeStart(vpx_codec_ctx_t* decoder, const EncodedClip& clip, int frames, uint64_t& hash,
+    double* keyFrameUs = nullptr)
+  {
+    bool ok = true;
+
+    for (int i = 0; ok && i < frames && i < (int)clip.frames.size(); i++) {
+      const double us = MeasureMicroseconds([&]() {
+        ok = !vpx_codec_decode(decoder, clip.frames[i].data(), (unsigned int)clip.frames[i].size(), nullptr, 0);
+      });
+      if (i == 0 && keyFrameUs) *keyFrameUs = us;
+
+      vpx_codec_iter_t iter = nullptr;
+      vpx_image_t* img;
+      while ((img = vpx_codec_get_frame(decoder, &iter)) != nullptr) hash = HashImage(img, hash);
+    }
+    return ok;
+  }
+
+  /**
+  * Switches one decoder from the start of clip from to the start of clip to
+  * switches times, keeping the fastest of each timing.
+  */
+  static bool RunSwitches(const EncodedClip& from, const EncodedClip& to, uint64_t toHash, int switches, int frames,
+    int threads, SwitchRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    uint64_t hash = 0;
+    bool ok;
+
+    if (!InitDecoder(&decoder, threads)) return false;
+
+    // The first switch sizes the decoder for both layers.
+    ok = DecodeStart(&decoder, from, frames, hash) && DecodeStart(&decoder, to, frames, hash);
+
+    for (int s = 0; ok && s < switches; s++) {
+      vpx_mem_stats_t before, after;
+      double us = 0;
+
+      hash = 0;
+      ok = DecodeStart(&decoder, from, frames, hash);
+
+      hash = 0;
+      vpx_mem_get_stats(&before);
+      ok = ok && DecodeStart(&decoder, to, frames, hash, &us);
+      vpx_mem_get_stats(&after);
+
+      run.allocs += after.allocs - before.allocs;
+      if (hash != toHash) run.bitExact = false;
+      if (s == 0 || us < run.switchUs) run.switchUs = us;
+
+      // The same key frame again needs no switch.
+      hash = 0;
+      ok = ok && DecodeStart(&decoder, to, 1, hash, &us);
+      if (s == 0 || us < run.sameSizeUs) run.sameSizeUs = us;
+    }
+    vpx_codec_destroy(&decoder);
+
+    for (int s = 0; ok && s < switches; s++) {
+      double us;
+
+      ok = InitDecoder(&decoder, threads) && DecodeStart(&decoder, from, frames, hash);
+      if (!ok) break;
+
+      us = MeasureMicroseconds([&]() {
+        vpx_codec_destroy(&decoder);
+        ok = InitDecoder(&decoder, threads) &&
+          !vpx_codec_decode(&decoder, to.frames[0].data(), (unsigned int)to.frames[0].size(), nullptr, 0);
+      });
+      if (s == 0 || us < run.newDecoderUs) run.newDecoderUs = us;
+      vpx_codec_destroy(&decoder);
+    }
+    return ok;
+  }
+
+  int RunResolutionSwitchBenchmark(const Options& options)
+  {
+    const int switches = options.iterations > 0 ? options.iterations : 50;
+    int frames = 5;
+    int threads = 1;
+
+    if (options.args.size() >= 1) frames = atoi(options.args[0].c_str());
+    if (options.args.size() >= 2) threads = atoi(options.args[1].c_str());
+
+    EncodedClip clips[3];
+    uint64_t hashes[3];
+    for (int i = 0; i < 3; i++) {
+      ClipSettings settings;
+      vpx_codec_ctx_t decoder;
+
+      settings.width = _sizes[i][0];
+      settings.height = _sizes[i][1];
+      settings.frames = frames;
+      settings.bitrateKbps = _sizes[i][0] * _sizes[i][1] / 300;
+      if (!EncodeTestClip(settings, clips[i])) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+
+      hashes[i] = 0;
+      if (!InitDecoder(&decoder, threads) || !DecodeStart(&decoder, clips[i], frames, hashes[i])) {
+        std::cerr << "Failed to decode the test clip." << std::endl;
+        return 1;
+      }
+      vpx_codec_destroy(&decoder);
+    }
+
+    Table table({ "from", "to", "switch_us", "same_size_us", "overhead_us", "new_decoder_us", "allocs_per_switch",
+      "bit_exact" });
+    int mismatches = 0;
+
+    for (int from = 0; from < 3; from++) {
+      for (int to = 0; to < 3; to++) {
+        if (from == to) continue;
+
+        SwitchRun run;
+        if (!RunSwitches(clips[from], clips[to], hashes[to], switches, frames, threads, run)) {
+          std::cerr << "Failed to decode the test clip." << std::endl;
+          return 1;
+        }
+        if (!run.bitExact) mismatches++;
+
+        table.AddRow({ std::to_string(_sizes[from][1]) + "p", std::to_string(_sizes[to][1]) + "p",
+          Format(run.switchUs, 1), Format(run.sameSizeUs, 1), Format(run.switchUs - run.sameSizeUs, 1),
+          Format(run.newDecoderUs, 1), Format((double)run.allocs / switches, 2), run.bitExact ? "yes" : "NO" });
+      }
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
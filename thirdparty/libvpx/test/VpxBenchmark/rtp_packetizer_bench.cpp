@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------------
+// Filename: rtp_packetizer_bench.cpp
+//
+// Description: Throughput of the RFC 7741 RTP packetizer in packets per
+// second. A clip encoded with output partitions is packetized at a few MTUs
+// in three ways:
+//   packetizer       payloads referencing the encoder output, no copy.
+//   packetizer_copy  the same payloads copied into a datagram buffer, for
+//                    transports that cannot gather.
+//   fixed_split      the frame cut into MTU sized chunks and copied, the way
+//                    consumers re-fragmented frames before the packetizer.
+// Every run reassembles the payloads and checks them against the frames.
+//
+// Suite arguments: [width height frames], default 1280 720 60.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8rtp.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const unsigned int _mtus[] = { 1200, 500 };
+
+  enum class Mode { Packetizer, PacketizerCopy, FixedSplit };
+
+  struct RunResult
+  {
+    size_t packets = 0;
+    size_t bytes = 0;
+    size_t partitionStarts = 0;     // Payloads starting on a partition boundary.
+    uint64_t hash = HashSeed;
+  };
+
+  static uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t hash)
+  {
+    for (size_t i = 0; i < size; i++) hash = (hash ^ data[i]) * 1099511628211ULL;
+    return hash;
+  }
+
+  /**
+  * Packetizes every frame of the clip once. Only the first pass hashes the
+  * reassembled data so the check stays out of the timed runs.
+  */
+  static bool PacketizeClip(const EncodedClip& clip, unsigned int mtu, Mode mode, bool check, RunResult& result)
+  {
+    static uint8_t datagram[2048];
+    vpx_vp8_rtp_packetizer_t packetizer;
+
+    if (vpx_vp8_rtp_init(&packetizer, mtu, VPX_VP8_RTP_PICTURE_ID | VPX_VP8_RTP_TL0PICIDX)) return false;
+
+    for (size_t f = 0; f < clip.frames.size(); f++) {
+      const std::vector<uint8_t>& frame = clip.frames[f];
+
+      if (mode == Mode::FixedSplit) {
+        for (size_t offset = 0; offset < frame.size(); offset += mtu - 1) {
+          const size_t size = frame.size() - offset < mtu - 1 ? frame.size() - offset : mtu - 1;
+          datagram[0] = offset == 0 ? 0x10 : 0;
+          memcpy(datagram + 1, frame.data() + offset, size);
+          result.packets++;
+          result.bytes += size + 1;
+          if (check) result.hash = HashBytes(datagram + 1, size, result.hash);
+        }
+        continue;
+      }
+
+      const std::vector<size_t>& partitions = clip.partitions[f];
+      const uint8_t* buf = frame.data();
+
+      for (size_t i = 0; i < partitions.size(); i++) {
+        vpx_codec_cx_pkt_t pkt = {};
+        pkt.kind = VPX_CODEC_CX_FRAME_PKT;
+        pkt.data.frame.buf = (void*)buf;
+        pkt.data.frame.sz = partitions[i];
+        pkt.data.frame.partition_id = (int)i;
+        pkt.data.frame.flags = i + 1 < partitions.size() ? VPX_FRAME_IS_FRAGMENT : 0;
+        if (vpx_vp8_rtp_add_packet(&packetizer, &pkt)) return false;
+        buf += partitions[i];
+      }
+
+      const vpx_vp8_rtp_payload_t* payload;
+      while ((payload = vpx_vp8_rtp_get_payload(&packetizer)) != nullptr) {
+        const uint8_t* data = payload->data;
+
+        if (mode == Mode::PacketizerCopy) {
+          memcpy(datagram, payload->descriptor, payload->descriptor_sz);
+          memcpy(datagram + payload->descriptor_sz, payload->data, payload->data_sz);
+          data = datagram + payload->descriptor_sz;
+        }
+
+        result.packets++;
+        result.bytes += payload->descriptor_sz + payload->data_sz;
+        if (payload->descriptor[0] & 0x10) result.partitionStarts++;
+        if (check) result.hash = HashBytes(data, payload->data_sz, result.hash);
+      }
+    }
+
+    return true;
+  }
+
+  int RunRtpPacketizerBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 200;
+    ClipSettings settings;
+    EncodedClip clip;
+
+    settings.width = 1280;
+    settings.height = 720;
+    settings.bitrateKbps = 2500;
+    settings.tokenPartitions = 2;
+    settings.outputPartitions = true;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    if (!EncodeTestClip(settings, clip)) {
+      std::cerr << "Failed to encode the test clip." << std::endl;
+      return 1;
+    }
+
+    uint64_t clipHash = HashSeed;
+    for (auto& frame : clip.frames) clipHash = HashBytes(frame.data(), frame.size(), clipHash);
+
+    Table table({ "mtu", "mode", "packets_per_frame", "partition_starts_pct", "mpackets_per_sec", "ns_per_packet", "gbit_per_sec" });
+    int mismatches = 0;
+
+    for (unsigned int mtu : _mtus) {
+      for (Mode mode : { Mode::Packetizer, Mode::PacketizerCopy, Mode::FixedSplit }) {
+        RunResult checked;
+
+        if (!PacketizeClip(clip, mtu, mode, true, checked)) {
+          std::cerr << "Packetizing failed with an MTU of " << mtu << "." << std::endl;
+          return 1;
+        }
+        if (checked.hash != clipHash) mismatches++;
+
+        // The packetizer is far quicker than the clock, so time many passes.
+        bool ok = true;
+        const double us = MeasureMicroseconds([&]() {
+          for (int i = 0; i < iterations && ok; i++) {
+            RunResult result;
+            ok = PacketizeClip(clip, mtu, mode, false, result);
+          }
+        });
+
+        const double packets = (double)checked.packets * iterations;
+        const char* name = mode == Mode::Packetizer ? "packetizer" : mode == Mode::PacketizerCopy ? "packetizer_copy" : "fixed_split";
+        const std::string starts = mode == Mode::FixedSplit ? "-" : Format(100.0 * checked.partitionStarts / checked.packets);
+
+        table.AddRow({ std::to_string(mtu), checked.hash == clipHash ? name : std::string(name) + " MISMATCH",
+          Format((double)checked.packets / clip.frames.size(), 2), starts, Format(packets / us, 2),
+          Format(us * 1000.0 / packets, 1), Format((double)checked.bytes * iterations * 8 / (us * 1000.0), 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Filename: sad_bench.cpp
+//
+// Description: Cycles per call for the motion search SAD and variance
+// kernels, for each instruction set the CPU supports. The multi-candidate
+// SAD forms are timed per call, so an x8 call covers eight candidates.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx_dsp_rtcd.h"
+
+#include <cstdlib>
+
+namespace VpxBenchmark
+{
+  static const int Stride = 64;
+
+  static unsigned char _src[32 * Stride];
+  static unsigned char _ref[32 * Stride];
+  static const unsigned char* const _s = _src + 4 * Stride + 4;
+  static const unsigned char* const _r = _ref + 4 * Stride + 5;
+  static const unsigned char* const _refs[4] = { _r, _r + 3, _r + Stride, _r + 2 * Stride + 1 };
+  static uint32_t _sads[8];
+  static unsigned int _sse;
+  static volatile unsigned int _sink;
+
+  template <unsigned int (*F)(const uint8_t*, int, const uint8_t*, int)>
+  static void CallSad() { _sink = F(_s, Stride, _r, Stride); }
+
+  template <void (*F)(const uint8_t*, int, const uint8_t*, int, uint32_t*)>
+  static void CallSadMulti() { F(_s, Stride, _r, Stride, _sads); }
+
+  template <void (*F)(const uint8_t*, int, const uint8_t* const[], int, uint32_t*)>
+  static void CallSad4d() { F(_s, Stride, _refs, Stride, _sads); }
+
+  template <unsigned int (*F)(const uint8_t*, int, const uint8_t*, int, unsigned int*)>
+  static void CallVariance() { _sink = F(_s, Stride, _r, Stride, &_sse); }
+
+  // A half and a quarter pel offset, so both filter passes run.
+  template <unsigned int (*F)(const uint8_t*, int, int, int, const uint8_t*, int, unsigned int*)>
+  static void CallSubpix() { _sink = F(_s, Stride, 4, 2, _r, Stride, &_sse); }
+
+  struct SadKernel
+  {
+    const char* name;
+    void (*fns[3])();   // C, SSE2, AVX2.
+  };
+
+#define SAD_BENCH_KERNELS(w, h, sad_avx2, x3_avx2, x8_avx2, x4d_avx2, var_avx2, subpix_avx2)            \
+  { "sad" #w "x" #h, { CallSad<vpx_sad##w##x##h##_c>, CallSad<vpx_sad##w##x##h##_sse2>, sad_avx2 } },          \
+  { "sad" #w "x" #h "x3", { CallSadMulti<vpx_sad##w##x##h##x3_c>, CallSadMulti<vpx_sad##w##x##h##x3_sse2>, x3_avx2 } }, \
+  { "sad" #w "x" #h "x8", { CallSadMulti<vpx_sad##w##x##h##x8_c>, CallSadMulti<vpx_sad##w##x##h##x8_sse2>, x8_avx2 } }, \
+  { "sad" #w "x" #h "x4d", { CallSad4d<vpx_sad##w##x##h##x4d_c>, CallSad4d<vpx_sad##w##x##h##x4d_sse2>, x4d_avx2 } },  \
+  { "variance" #w "x" #h, { CallVariance<vpx_variance##w##x##h##_c>, CallVariance<vpx_variance##w##x##h##_sse2>, var_avx2 } }, \
+  { "subpix_variance" #w "x" #h, { CallSubpix<vpx_sub_pixel_variance##w##x##h##_c>, CallSubpix<vpx_sub_pixel_variance##w##x##h##_sse2>, subpix_avx2 } }
+
+  static const SadKernel _sadKernels[] = {
+    SAD_BENCH_KERNELS(16, 16, CallSad<vpx_sad16x16_avx2>, CallSadMulti<vpx_sad16x16x3_avx2>, CallSadMulti<vpx_sad16x16x8_avx2>,
+      CallSad4d<vpx_sad16x16x4d_avx2>, CallVariance<vpx_variance16x16_avx2>, CallSubpix<vpx_sub_pixel_variance16x16_avx2>),
+    SAD_BENCH_KERNELS(16, 8, CallSad<vpx_sad16x8_avx2>, CallSadMulti<vpx_sad16x8x3_avx2>, CallSadMulti<vpx_sad16x8x8_avx2>,
+      CallSad4d<vpx_sad16x8x4d_avx2>, CallVariance<vpx_variance16x8_avx2>, CallSubpix<vpx_sub_pixel_variance16x8_avx2>),
+    SAD_BENCH_KERNELS(8, 16, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+    SAD_BENCH_KERNELS(8, 8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+    SAD_BENCH_KERNELS(4, 4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+    { "mse16x16", { CallVariance<vpx_mse16x16_c>, CallVariance<vpx_mse16x16_sse2>, CallVariance<vpx_mse16x16_avx2> } },
+  };
+
+  static const char* _sadIsaNames[3] = { "c", "sse2", "avx2" };
+  static const int _sadIsaCaps[3] = { 0, HAS_SSE2, HAS_AVX2 };
+
+  int RunSadBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 200000;
+
+    srand(1);
+    for (int i = 0; i < (int)sizeof(_src); i++) {
+      _src[i] = (unsigned char)(rand() & 0xff);
+      _ref[i] = (unsigned char)(rand() & 0xff);
+    }
+
+    Table table({ "kernel", "isa", "cycles_per_call", "speedup" });
+
+    for (auto& kernel : _sadKernels) {
+      double cCycles = 0;
+
+      for (int isa = 0; isa < 3; isa++) {
+        if (!kernel.fns[isa] || !CpuHas(_sadIsaCaps[isa])) continue;
+
+        double cycles = MeasureCycles(kernel.fns[isa], iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, _sadIsaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
@@ -0,0 +1,22 @@
+//-----------------------------------------------------------------------------
+// Filename: ssim_c.c
+//
+// Description: Builds vpx_dsp/ssim.c into the benchmark for the SSIM in
+// quality.cpp. The codec library only has it with CONFIG_INTERNAL_STATS,
+// which is also what generates the vpx_ssim_parms RTCD entries, so they are
+// mapped to the C versions here.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#define vpx_ssim_parms_8x8 vpx_ssim_parms_8x8_c
+#define vpx_ssim_parms_16x16 vpx_ssim_parms_16x16_c
+
+#include "vpx_dsp/ssim.c"
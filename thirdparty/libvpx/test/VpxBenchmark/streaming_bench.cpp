@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Filename: streaming_bench.cpp
+//
+// Description: Latency of VP8D_SET_STREAMING, where a frame is decoded as
+// its bytes arrive instead of once it is complete. Each frame is fed in
+// RTP payload sized runs and the time of the call that ends the frame is
+// what is left to do once its last packet has come. The same clip decoded
+// whole gives the latency without streaming.
+//
+// The rows column is the share of MB rows handed to the put_slice callback
+// before the frame ended. Every streamed frame is checked to be bit-exact
+// with the whole frame decode.
+//
+// Suite arguments: [width height frames], default 1280 720 60. The clip is
+// encoded with 1 and with 4 token partitions and fed in 1200 byte runs.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace VpxBenchmark
+{
+  static const size_t ChunkSize = 1200;
+
+  struct StreamRun
+  {
+    std::vector<uint64_t> hashes;     // Per frame.
+    double us = 0;                    // All of the decode calls.
+    double tailUs = 0;                // The calls that ended each frame.
+    uint64_t rows = 0;                // Passed to put_slice in all.
+    uint64_t earlyRows = 0;           // Passed to put_slice before the frame ended.
+    bool ended = false;
+  };
+
+  static void PutSlice(void* priv, const vpx_image_t*, const vpx_image_rect_t* valid, const vpx_image_rect_t* update)
+  {
+    StreamRun* run = (StreamRun*)priv;
+    const unsigned int rows = (update->h + 15) / 16;
+
+    (void)valid;
+    run->rows += rows;
+    if (!run->ended) run->earlyRows += rows;
+  }
+
+  static bool OutputFrame(vpx_codec_ctx_t* decoder, StreamRun& run, size_t frame)
+  {
+    vpx_codec_iter_t iter = nullptr;
+    vpx_image_t* img;
+
+    while ((img = vpx_codec_get_frame(decoder, &iter)) != nullptr) run.hashes[frame] = HashImage(img, HashSeed);
+    return true;
+  }
+
+  /**
+  * Decodes the clip a frame at a time, or streamed in ChunkSize runs.
+  * Returns false on any decoder error.
+  */
+  static bool DecodeClip(const EncodedClip& clip, bool streaming, StreamRun& run)
+  {
+    vpx_codec_ctx_t decoder;
+    vpx_codec_dec_cfg_t cfg = { 1, (unsigned int)clip.width, (unsigned int)clip.height };
+    bool ok = true;
+
+    if (vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, streaming ? VPX_CODEC_USE_INPUT_FRAGMENTS : 0)) {
+      return false;
+    }
+    if (streaming && (vpx_codec_control(&decoder, VP8D_SET_STREAMING, 1) ||
+      vpx_codec_register_put_slice_cb(&decoder, PutSlice, &run))) {
+      vpx_codec_destroy(&decoder);
+      return false;
+    }
+
+    run.hashes.assign(clip.frames.size(), 0);
+
+    for (size_t i = 0; ok && i < clip.frames.size(); i++) {
+      const std::vector<uint8_t>& frame = clip.frames[i];
+
+      if (streaming) {
+        run.ended = false;
+        for (size_t pos = 0; ok && pos < frame.size(); pos += ChunkSize) {
+          const unsigned int size = (unsigned int)std::min(ChunkSize, frame.size() - pos);
+          run.us += MeasureMicroseconds([&]() { ok = !vpx_codec_decode(&decoder, frame.data() + pos, size, nullptr, 0); });
+        }
+        run.ended = true;
+
+        const double us = MeasureMicroseconds([&]() { ok = ok && !vpx_codec_decode(&decoder, nullptr, 0, nullptr, 0); });
+        run.us += us;
+        run.tailUs += us;
+      }
+      else {
+        const double us = MeasureMicroseconds([&]() {
+          ok = !vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0);
+        });
+        run.us += us;
+        run.tailUs += us;
+      }
+
+      if (ok) OutputFrame(&decoder, run, i);
+    }
+
+    vpx_codec_destroy(&decoder);
+    return ok;
+  }
+
+  int RunStreamingBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 3;
+    ClipSettings settings;
+
+    settings.width = 1280;
+    settings.height = 720;
+    settings.frames = 60;
+    settings.bitrateKbps = 2500;
+
+    if (options.args.size() >= 3) {
+      settings.width = atoi(options.args[0].c_str());
+      settings.height = atoi(options.args[1].c_str());
+      settings.frames = atoi(options.args[2].c_str());
+    }
+
+    Table table({ "partitions", "mode", "ms_per_frame", "tail_ms", "rows_before_end_pct", "bit_exact" });
+    int mismatches = 0;
+
+    for (int tokenPartitions : { 0, 2 }) {
+      EncodedClip clip;
+      StreamRun whole;
+
+      settings.tokenPartitions = tokenPartitions;
+      if (!EncodeTestClip(settings, clip)) {
+        std::cerr << "Failed to encode the test clip." << std::endl;
+        return 1;
+      }
+
+      for (bool streaming : { false, true }) {
+        StreamRun best;
+
+        for (int i = 0; i < iterations; i++) {
+          StreamRun run;
+
+          if (!DecodeClip(clip, streaming, run)) {
+            std::cerr << "Decode failed " << (streaming ? "streaming." : "whole.") << std::endl;
+            return 1;
+          }
+          if (i == 0 || run.tailUs < best.tailUs) best = run;
+        }
+
+        if (!streaming) whole = best;
+
+        const bool exact = best.hashes == whole.hashes;
+        if (!exact) mismatches++;
+
+        const double frames = (double)clip.frames.size();
+        table.AddRow({ std::to_string(1 << tokenPartitions), streaming ? "streaming" : "whole",
+          Format(best.us / 1000.0 / frames, 3), Format(best.tailUs / 1000.0 / frames, 3),
+          streaming ? Format(best.rows ? best.earlyRows * 100.0 / best.rows : 0) : "-", exact ? "yes" : "NO" });
+      }
+    }
+
+    table.Print(options.csv);
+    return mismatches ? 1 : 0;
+  }
+}
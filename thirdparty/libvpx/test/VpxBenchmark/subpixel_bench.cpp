@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------------
+// Filename: subpixel_bench.cpp
+//
+// Description: Cycles per block for the VP8 six-tap and bilinear sub-pixel
+// predictors, for each block size and each instruction set the CPU supports.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vp8_rtcd.h"
+
+#include <cstdlib>
+
+namespace VpxBenchmark
+{
+  typedef void (*subpixel_fn_t)(unsigned char* src, int src_stride, int xoffset, int yoffset,
+    unsigned char* dst, int dst_pitch);
+
+  struct SubpixelKernel
+  {
+    const char* name;
+    subpixel_fn_t fns[4];   // C, SSE2, SSSE3, AVX2 or nullptr.
+  };
+
+  static const SubpixelKernel _subpixelKernels[] = {
+    { "sixtap16x16", { vp8_sixtap_predict16x16_c, vp8_sixtap_predict16x16_sse2, vp8_sixtap_predict16x16_ssse3, nullptr } },
+    { "sixtap8x8", { vp8_sixtap_predict8x8_c, vp8_sixtap_predict8x8_sse2, vp8_sixtap_predict8x8_ssse3, nullptr } },
+    { "sixtap8x4", { vp8_sixtap_predict8x4_c, vp8_sixtap_predict8x4_sse2, vp8_sixtap_predict8x4_ssse3, nullptr } },
+    { "sixtap4x4", { vp8_sixtap_predict4x4_c, vp8_sixtap_predict4x4_sse2, vp8_sixtap_predict4x4_ssse3, nullptr } },
+    { "bilinear16x16", { vp8_bilinear_predict16x16_c, vp8_bilinear_predict16x16_sse2, vp8_bilinear_predict16x16_ssse3, vp8_bilinear_predict16x16_avx2 } },
+    { "bilinear8x8", { vp8_bilinear_predict8x8_c, vp8_bilinear_predict8x8_sse2, vp8_bilinear_predict8x8_ssse3, nullptr } },
+    { "bilinear8x4", { vp8_bilinear_predict8x4_c, vp8_bilinear_predict8x4_sse2, vp8_bilinear_predict8x4_ssse3, nullptr } },
+    { "bilinear4x4", { vp8_bilinear_predict4x4_c, vp8_bilinear_predict4x4_sse2, vp8_bilinear_predict4x4_ssse3, nullptr } },
+  };
+
+  static const char* _isaNames[4] = { "c", "sse2", "ssse3", "avx2" };
+  static const int _isaCaps[4] = { 0, HAS_SSE2, HAS_SSSE3, HAS_AVX2 };
+
+  /**
+  * Each call cycles through all 63 non-zero offset pairs so the figure is the
+  * mix of one and two pass blocks seen in real motion compensation.
+  */
+  int RunSubpixelBenchmark(const Options& options)
+  {
+    const int iterations = options.iterations > 0 ? options.iterations : 20000;
+    const int srcStride = 64;
+    static unsigned char src[srcStride * 48];
+    static unsigned char dst[32 * 16];
+
+    for (int i = 0; i < (int)sizeof(src); i++) src[i] = (unsigned char)rand();
+
+    Table table({ "kernel", "isa", "cycles_per_block", "speedup" });
+
+    for (auto& kernel : _subpixelKernels) {
+      double cCycles = 0;
+
+      for (int isa = 0; isa < 4; isa++) {
+        if (!kernel.fns[isa] || !CpuHas(_isaCaps[isa])) continue;
+
+        subpixel_fn_t fn = kernel.fns[isa];
+        int offset = 1;
+        double cycles = MeasureCycles([&]() {
+          fn(src + 8 * srcStride + 8, srcStride, offset & 7, offset >> 3, dst, 32);
+          offset = offset == 63 ? 1 : offset + 1;
+          }, iterations);
+
+        if (isa == 0) cCycles = cycles;
+        table.AddRow({ kernel.name, _isaNames[isa], Format(cycles), Format(cCycles / cycles, 2) });
+      }
+    }
+
+    table.Print(options.csv);
+    return 0;
+  }
+}
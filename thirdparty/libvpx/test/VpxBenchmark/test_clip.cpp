@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Filename: test_clip.cpp
+//
+// Description: Builds the VP8 clip the codec level suites run on. The frames
+// are generated by default rather than read from disk so every suite is
+// self-contained and repeatable.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#include "bench_common.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+namespace VpxBenchmark
+{
+  /**
+  * A moving gradient with a panning block pattern and some noise so that the
+  * encoder produces a mix of intra, inter and split macroblocks.
+  */
+  void FillTestFrame(vpx_image_t* img, int frame)
+  {
+    uint32_t seed = 1 + frame;
+    const int w = img->d_w;
+    const int h = img->d_h;
+
+    for (int y = 0; y < h; y++) {
+      unsigned char* row = img->planes[VPX_PLANE_Y] + y * img->stride[VPX_PLANE_Y];
+      for (int x = 0; x < w; x++) {
+        int v = ((x * 3 + frame * 5) ^ (y * 2 - frame * 3)) & 255;
+        v = (v + ((x + frame * 2) / 16 + (y + frame) / 8) * 17) & 255;
+        if (((x / 32 + y / 32 + frame / 10) & 1) != 0) {
+          seed = seed * 1103515245 + 12345;
+          v = (v * 3 / 4 + ((seed >> 16) & 31)) & 255;
+        }
+        row[x] = (unsigned char)v;
+      }
+    }
+
+    for (int y = 0; y < (h + 1) / 2; y++) {
+      unsigned char* u = img->planes[VPX_PLANE_U] + y * img->stride[VPX_PLANE_U];
+      unsigned char* v = img->planes[VPX_PLANE_V] + y * img->stride[VPX_PLANE_V];
+      for (int x = 0; x < (w + 1) / 2; x++) {
+        u[x] = (unsigned char)(x * 4 + frame * 2);
+        v[x] = (unsigned char)(y * 4 - frame * 3 + x);
+      }
+    }
+  }
+
+  bool EncodeTestClip(const ClipSettings& settings, EncodedClip& clip)
+  {
+    vpx_codec_ctx_t encoder;
+    vpx_codec_enc_cfg_t cfg;
+
+    if (vpx_codec_enc_config_default(vpx_codec_vp8_cx(), &cfg, 0)) return false;
+
+    cfg.g_w = settings.width;
+    cfg.g_h = settings.height;
+    cfg.g_timebase.num = 1;
+    cfg.g_timebase.den = 30;
+    cfg.g_threads = settings.threads;
+    cfg.g_lag_in_frames = 0;
+    cfg.rc_end_usage = settings.endUsage;
+    cfg.rc_target_bitrate = settings.bitrateKbps;
+    cfg.kf_max_dist = settings.keyframeInterval;
+    if (settings.errorResilient) cfg.g_error_resilient = VPX_ERROR_RESILIENT_DEFAULT | VPX_ERROR_RESILIENT_PARTITIONS;
+
+    if (settings.quantizer >= 0) {
+      cfg.rc_end_usage = VPX_VBR;
+      cfg.rc_min_quantizer = settings.quantizer;
+      cfg.rc_max_quantizer = settings.quantizer;
+    }
+
+    const vpx_codec_flags_t flags = settings.outputPartitions ? VPX_CODEC_USE_OUTPUT_PARTITION : 0;
+    if (vpx_codec_enc_init(&encoder, vpx_codec_vp8_cx(), &cfg, flags)) return false;
+
+    vpx_codec_control(&encoder, VP8E_SET_CPUUSED, settings.cpuUsed);
+    vpx_codec_control(&encoder, VP8E_SET_TOKEN_PARTITIONS, settings.tokenPartitions);
+    if (settings.endUsage == VPX_CQ) vpx_codec_control(&encoder, VP8E_SET_CQ_LEVEL, settings.cqLevel);
+
+    vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, settings.width, settings.height, 1);
+    bool ok = img != nullptr;
+
+    clip.width = settings.width;
+    clip.height = settings.height;
+    clip.frames.clear();
+    clip.partitions.clear();
+    clip.encodeUs = 0;
+
+    for (int frame = 0; ok && frame <= settings.frames; frame++) {
+      if (frame < settings.frames) settings.source(img, frame);
+
+      // The final pass flushes the encoder.
+      const vpx_enc_frame_flags_t frameFlags = settings.nonReferenceFrames && (frame & 1) ?
+        VP8_EFLAG_NO_UPD_LAST | VP8_EFLAG_NO_UPD_GF | VP8_EFLAG_NO_UPD_ARF : 0;
+      vpx_codec_err_t err = VPX_CODEC_OK;
+      clip.encodeUs += MeasureMicroseconds([&]() {
+        err = vpx_codec_encode(&encoder, frame < settings.frames ? img : nullptr, frame, 1, frameFlags,
+          settings.deadline);
+      });
+
+      if (err) {
+        ok = false;
+        break;
+      }
+
+      vpx_codec_iter_t iter = nullptr;
+      const vpx_codec_cx_pkt_t* pkt;
+      while ((pkt = vpx_codec_get_cx_data(&encoder, &iter)) != nullptr) {
+        if (pkt->kind == VPX_CODEC_CX_FRAME_PKT) {
+          const uint8_t* buf = (const uint8_t*)pkt->data.frame.buf;
+
+          // Partitions after the first are appended to their frame.
+          if (pkt->data.frame.partition_id > 0) {
+            clip.frames.back().insert(clip.frames.back().end(), buf, buf + pkt->data.frame.sz);
+          }
+          else {
+            clip.frames.emplace_back(buf, buf + pkt->data.frame.sz);
+            if (settings.outputPartitions) clip.partitions.emplace_back();
+          }
+
+          if (settings.outputPartitions) clip.partitions.back().push_back(pkt->data.frame.sz);
+        }
+      }
+    }
+
+    if (ok && vpx_codec_control(&encoder, VP8E_GET_PERF_STATS, &clip.perf)) ok = false;
+
+    vpx_img_free(img);
+    vpx_codec_destroy(&encoder);
+    return ok;
+  }
+
+  uint64_t HashImage(const vpx_image_t* img, uint64_t hash)
+  {
+    for (int plane = 0; plane < 3; plane++) {
+      const int w = plane ? (int)(img->d_w + 1) / 2 : (int)img->d_w;
+      const int h = plane ? (int)(img->d_h + 1) / 2 : (int)img->d_h;
+
+      for (int y = 0; y < h; y++) {
+        const unsigned char* row = img->planes[plane] + y * img->stride[plane];
+        for (int x = 0; x < w; x++) {
+          hash = (hash ^ row[x]) * 1099511628211ULL;
+        }
+      }
+    }
+    return hash;
+  }
+}
@@ -21,6 +21,9 @@
 #include "vp8/encoder/boolhuff.h"
 #include "vp8/decoder/dboolhuff.h"
 
+#include <cstdlib>
+#include <vector>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace VpxUnitTests
@@ -159,5 +162,82 @@ namespace VpxUnitTests
         }
       }
     }
+
+    /// <summary>
+    /// Tests that literals of every width read back through the batched
+    /// literal reader, interleaved with skewed bools so the literals start
+    /// at every decoder state and straddle the refills.
+    /// </summary>
+    TEST_METHOD(ReadLiteralTest)
+    {
+      const int kLiterals = 20000;
+      std::vector<uint8_t> buffer(kLiterals * 4);
+      BOOL_CODER bw;
+
+      srand(1);
+      vp8_start_encode(&bw, buffer.data(), buffer.data() + buffer.size());
+      for (int i = 0; i < kLiterals; ++i) {
+        const int bits = 1 + i % 16;
+        vp8_encode_value(&bw, rand() & ((1 << bits) - 1), bits);
+        vp8_encode_bool(&bw, rand() % 5 == 0, 240);
+      }
+      vp8_stop_encode(&bw);
+
+      BOOL_DECODER br;
+      vp8dx_start_decode(&br, buffer.data(), bw.pos, NULL, NULL);
+
+      srand(1);
+      for (int i = 0; i < kLiterals; ++i) {
+        const int bits = 1 + i % 16;
+        const int expected = rand() & ((1 << bits) - 1);
+        Assert::AreEqual(expected, vp8_decode_value(&br, bits));
+        Assert::AreEqual((int)(rand() % 5 == 0), vp8dx_decode_bool(&br, 240));
+      }
+
+      Assert::AreEqual(0, vp8dx_bool_error(&br));
+    }
+
+    static void XorDecrypt(void* state, const unsigned char* input, unsigned char* output, int count)
+    {
+      for (int i = 0; i < count; i++) output[i] = input[i] ^ *(const unsigned char*)state;
+    }
+
+    /// <summary>
+    /// Tests that a stream read through a decryptor, which refills a byte at
+    /// a time, decodes the same as the plain stream, which refills a word at
+    /// a time, right through to the end of the buffer.
+    /// </summary>
+    TEST_METHOD(DecryptMatchesPlainTest)
+    {
+      const int kBits = 50000;
+      const unsigned char key = 0x5a;
+      std::vector<uint8_t> plain(kBits), encrypted;
+      std::vector<uint8_t> probas(kBits);
+      BOOL_CODER bw;
+
+      srand(2);
+      vp8_start_encode(&bw, plain.data(), plain.data() + plain.size());
+      for (int i = 0; i < kBits; ++i) {
+        probas[i] = (uint8_t)(1 + rand() % 255);
+        vp8_encode_bool(&bw, (rand() & 0xff) >= probas[i], probas[i]);
+      }
+      vp8_stop_encode(&bw);
+      plain.resize(bw.pos);
+
+      for (auto b : plain) encrypted.push_back(b ^ key);
+
+      BOOL_DECODER plainReader, decryptReader;
+      vp8dx_start_decode(&plainReader, plain.data(), (unsigned int)plain.size(), NULL, NULL);
+      vp8dx_start_decode(&decryptReader, encrypted.data(), (unsigned int)encrypted.size(), XorDecrypt, (void*)&key);
+
+      // Past the end of the data both read zeros until the error is flagged.
+      for (int i = 0; i < kBits + 256; ++i) {
+        const int p = probas[i % kBits];
+        Assert::AreEqual(vp8dx_decode_bool(&plainReader, p), vp8dx_decode_bool(&decryptReader, p));
+        Assert::AreEqual(vp8dx_bool_error(&plainReader), vp8dx_bool_error(&decryptReader));
+      }
+
+      Assert::AreEqual(1, vp8dx_bool_error(&plainReader));
+    }
   };
 }
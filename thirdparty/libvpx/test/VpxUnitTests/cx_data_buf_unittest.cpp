@@ -0,0 +1,184 @@
+/******************************************************************************
+* Filename: cx_data_buf_unittest.cpp
+*
+* Description:
+* Unit tests for encoding into an application output buffer in:
+*  - vp8_cx_iface.c (vpx_codec_set_cx_data_buf)
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "encodeutils.h"
+#include "CppUnitTest.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+#include "vpx/vpx_encoder.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  TEST_CLASS(cx_data_buf_unittest)
+  {
+  public:
+
+    static const int Width = 64;
+    static const int Height = 48;
+    static const unsigned int PadBefore = 12;
+    static const unsigned int PadAfter = 4;
+    static constexpr uint8_t PadByte = 0xa5;
+
+    /**
+    * Encodes the clip into an application buffer that is reset for every
+    * frame and returns the compressed frames without padding.
+    */
+    static std::vector<std::vector<uint8_t>> EncodeIntoBuffer(int frames)
+    {
+      std::vector<std::vector<uint8_t>> clip;
+      std::vector<uint8_t> buffer(64 * 1024);
+      vpx_codec_ctx_t encoder;
+
+      InitEncoder(&encoder, Width, Height);
+      vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, Width, Height, 1);
+
+      for (int frame = 0; frame < frames; frame++) {
+        vpx_fixed_buf_t fixed = { buffer.data(), buffer.size() };
+        memset(buffer.data(), PadByte, buffer.size());
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_cx_data_buf(&encoder, &fixed, PadBefore, PadAfter));
+
+        FillFrame(img, frame);
+        EncodeFrame(&encoder, img, frame, 0, clip);
+
+        // The frame has to have been packed at the start of the buffer.
+        std::vector<uint8_t>& packed = clip.back();
+        const size_t sz = packed.size();
+        Assert::IsTrue(memcmp(packed.data(), buffer.data(), sz) == 0);
+        for (unsigned int i = 0; i < PadBefore; i++) Assert::AreEqual(PadByte, packed[i]);
+        for (unsigned int i = 0; i < PadAfter; i++) Assert::AreEqual(PadByte, packed[sz - PadAfter + i]);
+        packed.erase(packed.end() - PadAfter, packed.end());
+        packed.erase(packed.begin(), packed.begin() + PadBefore);
+      }
+
+      vpx_img_free(img);
+      vpx_codec_destroy(&encoder);
+      return clip;
+    }
+
+    /// <summary>
+    /// Checks frames packed into the application buffer match the internal
+    /// buffer byte for byte and keep the requested padding.
+    /// </summary>
+    TEST_METHOD(EncodeIntoBufferTest)
+    {
+      std::vector<std::vector<uint8_t>> internal = EncodeClip(EncoderConfig(Width, Height), 8);
+      std::vector<std::vector<uint8_t>> external = EncodeIntoBuffer(8);
+
+      Assert::AreEqual(internal.size(), external.size());
+      for (size_t i = 0; i < internal.size(); i++) {
+        Assert::IsTrue(internal[i] == external[i]);
+      }
+    }
+
+    /// <summary>
+    /// With partitioned output the padding goes before the first and after
+    /// the last partition and the packets follow each other in the buffer.
+    /// </summary>
+    TEST_METHOD(EncodePartitionsIntoBufferTest)
+    {
+      std::vector<uint8_t> buffer(64 * 1024, PadByte);
+      vpx_fixed_buf_t fixed = { buffer.data(), buffer.size() };
+      vpx_codec_ctx_t encoder;
+
+      InitEncoder(&encoder, Width, Height, 0, VPX_CODEC_USE_OUTPUT_PARTITION);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_control(&encoder, VP8E_SET_TOKEN_PARTITIONS, VP8_FOUR_TOKENPARTITION));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_cx_data_buf(&encoder, &fixed, PadBefore, PadAfter));
+
+      vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, Width, Height, 1);
+      FillFrame(img, 0);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_encode(&encoder, img, 0, 1, 0, VPX_DL_REALTIME));
+
+      vpx_codec_iter_t iter = nullptr;
+      const vpx_codec_cx_pkt_t* pkt;
+      const uint8_t* next = buffer.data();
+      int partitions = 0;
+
+      while ((pkt = vpx_codec_get_cx_data(&encoder, &iter)) != nullptr) {
+        Assert::IsTrue(pkt->data.frame.buf == next);
+        Assert::AreEqual(partitions, pkt->data.frame.partition_id);
+        next += pkt->data.frame.sz;
+        partitions++;
+      }
+
+      Assert::AreEqual(5, partitions);
+      for (unsigned int i = 0; i < PadBefore; i++) Assert::AreEqual(PadByte, buffer[i]);
+      for (unsigned int i = 1; i <= PadAfter; i++) Assert::AreEqual(PadByte, next[-(int)i]);
+
+      vpx_img_free(img);
+      vpx_codec_destroy(&encoder);
+    }
+
+    /// <summary>
+    /// A frame that does not fit fails with a memory error and the encoder
+    /// recovers with a key frame once there is room again.
+    /// </summary>
+    TEST_METHOD(BufferTooSmallTest)
+    {
+      std::vector<uint8_t> small(48);
+      std::vector<uint8_t> large(64 * 1024);
+      vpx_fixed_buf_t fixed = { small.data(), small.size() };
+      vpx_codec_ctx_t encoder;
+      vpx_codec_ctx_t decoder;
+
+      InitEncoder(&encoder, Width, Height);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+      vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, Width, Height, 1);
+
+      // Padding alone can fill the buffer.
+      FillFrame(img, 0);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_cx_data_buf(&encoder, &fixed, 32, 16));
+      Assert::AreEqual((int)VPX_CODEC_MEM_ERROR, (int)vpx_codec_encode(&encoder, img, 0, 1, 0, VPX_DL_REALTIME));
+
+      for (int frame = 1; frame < 6; frame++) {
+        FillFrame(img, frame);
+
+        // The third frame is an inter frame that cannot fit.
+        const bool tooSmall = frame == 3;
+        fixed = tooSmall ? vpx_fixed_buf_t{ small.data(), 8 } : vpx_fixed_buf_t{ large.data(), large.size() };
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_cx_data_buf(&encoder, &fixed, 0, 0));
+
+        vpx_codec_err_t res = vpx_codec_encode(&encoder, img, frame, 1, 0, VPX_DL_REALTIME);
+
+        if (tooSmall) {
+          Assert::AreEqual((int)VPX_CODEC_MEM_ERROR, (int)res);
+          Assert::AreEqual(std::string("Compressed data buffer too small"), std::string(vpx_codec_error_detail(&encoder)));
+          continue;
+        }
+
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)res);
+
+        vpx_codec_iter_t iter = nullptr;
+        const vpx_codec_cx_pkt_t* pkt;
+        while ((pkt = vpx_codec_get_cx_data(&encoder, &iter)) != nullptr) {
+          if (frame == 4) Assert::IsTrue((pkt->data.frame.flags & VPX_FRAME_IS_KEY) != 0);
+          Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, (const uint8_t*)pkt->data.frame.buf, (unsigned int)pkt->data.frame.sz, nullptr, 0));
+        }
+      }
+
+      vpx_img_free(img);
+      vpx_codec_destroy(&decoder);
+      vpx_codec_destroy(&encoder);
+    }
+  };
+}
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// Filename: encodeutils.h
+//
+// Description: Helpers shared by the tests that need a VP8 encoder or a short
+// encoded clip.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#ifndef ENCODEUTILS_H
+#define ENCODEUTILS_H
+
+#include "CppUnitTest.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  /**
+  * Fills the visible area of an I420 image with a pattern that moves from
+  * frame to frame so the encoder produces real inter frames.
+  * @param[in,out] img: the image to fill.
+  * @param[in] frame: the frame number the pattern is drawn for.
+  */
+  void FillFrame(vpx_image_t* img, int frame)
+  {
+    for (int plane = 0; plane < 3; plane++) {
+      const int w = plane ? (int)(img->d_w + 1) / 2 : (int)img->d_w;
+      const int h = plane ? (int)(img->d_h + 1) / 2 : (int)img->d_h;
+      for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+          img->planes[plane][y * img->stride[plane] + x] = (uint8_t)((x + frame * 3) ^ (y * 2 + plane * 40));
+        }
+      }
+    }
+  }
+
+  /**
+  * Gets the default VP8 encoder configuration for a frame size.
+  * @param[in] width: the frame width.
+  * @param[in] height: the frame height.
+  * @param[in] lag: the number of frames the encoder may look ahead.
+  * @return the configuration, ready for any test specific settings.
+  */
+  vpx_codec_enc_cfg_t EncoderConfig(int width, int height, unsigned int lag = 0)
+  {
+    vpx_codec_enc_cfg_t cfg;
+
+    Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreEqual((int)VPX_CODEC_OK,
+      (int)vpx_codec_enc_config_default(vpx_codec_vp8_cx(), &cfg, 0));
+    cfg.g_w = width;
+    cfg.g_h = height;
+    cfg.g_lag_in_frames = lag;
+    return cfg;
+  }
+
+  void InitEncoder(vpx_codec_ctx_t* encoder, const vpx_codec_enc_cfg_t& cfg, vpx_codec_flags_t flags = 0)
+  {
+    Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreEqual((int)VPX_CODEC_OK,
+      (int)vpx_codec_enc_init(encoder, vpx_codec_vp8_cx(), &cfg, flags));
+  }
+
+  void InitEncoder(vpx_codec_ctx_t* encoder, int width, int height, unsigned int lag = 0, vpx_codec_flags_t flags = 0)
+  {
+    InitEncoder(encoder, EncoderConfig(width, height, lag), flags);
+  }
+
+  /**
+  * Encodes one frame and appends each compressed frame packet to the clip.
+  * With output partitions every partition is appended on its own.
+  * @param[in] encoder: the initialised encoder.
+  * @param[in] img: the raw frame, nullptr to flush.
+  * @param[in] frame: the frame's presentation time stamp.
+  * @param[in] flags: the frame flags, e.g. VP8_EFLAG_FORCE_GF.
+  * @param[in,out] clip: the compressed packets so far.
+  * @param[in] deadline: the encode deadline.
+  */
+  void EncodeFrame(vpx_codec_ctx_t* encoder, const vpx_image_t* img, int frame, vpx_enc_frame_flags_t flags,
+    std::vector<std::vector<uint8_t>>& clip, unsigned long deadline = VPX_DL_REALTIME)
+  {
+    Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreEqual((int)VPX_CODEC_OK,
+      (int)vpx_codec_encode(encoder, img, frame, 1, flags, deadline));
+
+    vpx_codec_iter_t iter = nullptr;
+    const vpx_codec_cx_pkt_t* pkt;
+    while ((pkt = vpx_codec_get_cx_data(encoder, &iter)) != nullptr) {
+      if (pkt->kind == VPX_CODEC_CX_FRAME_PKT) {
+        const uint8_t* buf = (const uint8_t*)pkt->data.frame.buf;
+        clip.emplace_back(buf, buf + pkt->data.frame.sz);
+      }
+    }
+  }
+
+  /**
+  * Encodes a clip of the FillFrame pattern.
+  * @param[in] cfg: the encoder configuration, g_w and g_h give the frame size.
+  * @param[in] frames: the number of frames to encode.
+  * @param[in] frameFlags: optional, gives the flags for each frame number.
+  * @return the compressed frames.
+  */
+  std::vector<std::vector<uint8_t>> EncodeClip(const vpx_codec_enc_cfg_t& cfg, int frames,
+    vpx_enc_frame_flags_t (*frameFlags)(int frame) = nullptr)
+  {
+    std::vector<std::vector<uint8_t>> clip;
+    vpx_codec_ctx_t encoder;
+
+    InitEncoder(&encoder, cfg);
+    vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, cfg.g_w, cfg.g_h, 1);
+
+    for (int frame = 0; frame < frames; frame++) {
+      FillFrame(img, frame);
+      EncodeFrame(&encoder, img, frame, frameFlags ? frameFlags(frame) : 0, clip);
+    }
+
+    vpx_img_free(img);
+    vpx_codec_destroy(&encoder);
+    return clip;
+  }
+}
+
+#endif // ENCODEUTILS_H
@@ -0,0 +1,164 @@
+/******************************************************************************
+* Filename: fdct_unittest.cpp
+*
+* Description:
+* Unit tests for the encoder residual kernels in:
+*  - vp8/encoder/dct.c & vpx_dsp/subtract.c
+*  - vp8/encoder/x86/dct_sse2.c & vpx_dsp/x86/subtract_sse2.c
+*
+* The forward DCT and Walsh transforms are checked bit-exact against the C
+* for residuals over the full 9 bit range, and for the DC blocks the DCT of
+* such residuals produces. The subtraction is checked for every block size
+* the encoder uses.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*fdct_fn_t)(short* input, short* output, int pitch);
+
+  TEST_CLASS(fdct_unittest)
+  {
+  public:
+
+    static const int Iterations = 5000;
+
+    /**
+    * Random residual, mostly small with a share at the extremes of what
+    * the difference of two 8 bit pixels can be.
+    */
+    static short RandomResidual()
+    {
+      switch (rand() & 7) {
+      case 0: return (rand() & 1) ? 255 : -255;
+      case 1: return 0;
+      case 2: return (short)((rand() % 511) - 255);
+      default: return (short)((rand() & 31) - 16);
+      }
+    }
+
+    /**
+    * Runs a forward DCT over a residual block with the given pitch in bytes,
+    * as vp8_transform_mb() does for luma (32) and chroma (16).
+    */
+    static void CheckFdct(fdct_fn_t ref, fdct_fn_t test, int outputs, const char* name)
+    {
+      short input[4 * 16];
+      short expected[32], actual[32];
+
+      srand(outputs);
+
+      for (int pitch = 16; pitch <= 32; pitch += 16) {
+        for (int it = 0; it < Iterations; it++) {
+          for (int i = 0; i < 4 * 16; i++) input[i] = RandomResidual();
+
+          memset(expected, 0, sizeof(expected));
+          memset(actual, 0, sizeof(actual));
+          ref(input, expected, pitch);
+          test(input, actual, pitch);
+          Check(memcmp(expected, actual, outputs * sizeof(short)) == 0, name, it);
+        }
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 forward DCT of a single 4x4 block.
+    /// </summary>
+    TEST_METHOD(Fdct4x4Sse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckFdct(vp8_short_fdct4x4_c, vp8_short_fdct4x4_sse2, 16, "fdct4x4");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 forward DCT of two horizontally adjacent 4x4 blocks.
+    /// </summary>
+    TEST_METHOD(Fdct8x4Sse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckFdct(vp8_short_fdct8x4_c, vp8_short_fdct8x4_sse2, 32, "fdct8x4");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 Walsh-Hadamard transform on second order blocks built
+    /// from the DC of forward DCTs, as build_dcblock() does.
+    /// </summary>
+    TEST_METHOD(Walsh4x4Sse2Test)
+    {
+      short residual[16], coeffs[16], input[16];
+      short expected[16], actual[16];
+
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(3);
+
+      for (int it = 0; it < Iterations; it++) {
+        for (int b = 0; b < 16; b++) {
+          for (int i = 0; i < 16; i++) residual[i] = RandomResidual();
+          vp8_short_fdct4x4_c(residual, coeffs, 8);
+          input[b] = coeffs[0];
+        }
+
+        vp8_short_walsh4x4_c(input, expected, 8);
+        vp8_short_walsh4x4_sse2(input, actual, 8);
+        Check(memcmp(expected, actual, sizeof(expected)) == 0, "walsh4x4", it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 block subtraction for the 16x16 luma, 8x8 chroma and
+    /// 4x4 sub-block sizes plus a wider block, from unaligned pointers.
+    /// </summary>
+    TEST_METHOD(SubtractBlockSse2Test)
+    {
+      static const int sizes[][2] = { { 16, 16 }, { 8, 8 }, { 4, 4 }, { 8, 32 }, { 3, 5 } };
+      static const int Stride = 80;
+      static uint8_t src[40 * Stride], pred[40 * Stride];
+      static int16_t expected[32 * 64], actual[32 * 64];
+
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(4);
+
+      for (auto& size : sizes) {
+        const int rows = size[0], cols = size[1];
+
+        for (int it = 0; it < Iterations / 10; it++) {
+          const int offset = rand() % 16 + (rand() % 4) * Stride;
+
+          for (int i = 0; i < (int)sizeof(src); i++) {
+            src[i] = (uint8_t)rand();
+            pred[i] = (it & 1) ? (uint8_t)rand() : (uint8_t)(255 - src[i]);
+          }
+          memset(expected, 0, sizeof(expected));
+          memset(actual, 0, sizeof(actual));
+
+          vpx_subtract_block_c(rows, cols, expected, 64, src + offset, Stride, pred + offset + 1, Stride);
+          vpx_subtract_block_sse2(rows, cols, actual, 64, src + offset, Stride, pred + offset + 1, Stride);
+          Check(memcmp(expected, actual, sizeof(expected)) == 0, "subtract_block", it);
+        }
+      }
+    }
+
+  };
+}
@@ -0,0 +1,253 @@
+/******************************************************************************
+* Filename: frame_buffer_unittest.cpp
+*
+* Description:
+* Unit tests for decoding into application frame buffers in:
+*  - vp8_dx_iface.c (vpx_codec_set_frame_buffer_functions)
+*  - onyxd_if.c
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "encodeutils.h"
+#include "strutils.h"
+#include "CppUnitTest.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+#include "vpx/vpx_encoder.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  /**
+  * A fixed pool of frame buffers handed to the decoder through the external
+  * frame buffer callbacks. The decoder may hold at most four at a time.
+  */
+  struct FramePool
+  {
+    static const int Size = 8;
+
+    std::vector<uint8_t> buffers[Size];
+    bool inUse[Size] = {};
+    int gets = 0;
+    int releases = 0;
+    int maxInUse = 0;
+    size_t limit = SIZE_MAX;
+
+    int InUse() const
+    {
+      int count = 0;
+      for (int i = 0; i < Size; i++) count += inUse[i] ? 1 : 0;
+      return count;
+    }
+
+    bool Owns(const uint8_t* p) const
+    {
+      for (int i = 0; i < Size; i++) {
+        if (inUse[i] && p >= buffers[i].data() && p < buffers[i].data() + buffers[i].size()) return true;
+      }
+      return false;
+    }
+
+    static int Get(void* priv, size_t minSize, vpx_codec_frame_buffer_t* fb)
+    {
+      FramePool* pool = (FramePool*)priv;
+
+      for (int i = 0; i < Size; i++) {
+        if (!pool->inUse[i]) {
+          pool->buffers[i].resize(minSize < pool->limit ? minSize : pool->limit);
+          pool->inUse[i] = true;
+          pool->gets++;
+          if (pool->InUse() > pool->maxInUse) pool->maxInUse = pool->InUse();
+          fb->data = pool->buffers[i].data();
+          fb->size = pool->buffers[i].size();
+          fb->priv = &pool->inUse[i];
+          return 0;
+        }
+      }
+      return -1;
+    }
+
+    static int Release(void* priv, vpx_codec_frame_buffer_t* fb)
+    {
+      FramePool* pool = (FramePool*)priv;
+      bool* inUse = (bool*)fb->priv;
+
+      Assert::IsTrue(*inUse);
+      *inUse = false;
+      pool->releases++;
+      return 0;
+    }
+  };
+
+  TEST_CLASS(frame_buffer_unittest)
+  {
+  public:
+
+    static uint64_t HashImage(const vpx_image_t* img, uint64_t hash)
+    {
+      for (int plane = 0; plane < 3; plane++) {
+        const int w = plane ? (int)(img->d_w + 1) / 2 : (int)img->d_w;
+        const int h = plane ? (int)(img->d_h + 1) / 2 : (int)img->d_h;
+
+        for (int y = 0; y < h; y++) {
+          const uint8_t* row = img->planes[plane] + y * img->stride[plane];
+          for (int x = 0; x < w; x++) hash = (hash ^ row[x]) * 1099511628211ULL;
+        }
+      }
+      return hash;
+    }
+
+    /**
+    * Every fourth frame also refreshes the golden buffer.
+    */
+    static vpx_enc_frame_flags_t GoldenFrameFlags(int frame)
+    {
+      return (frame % 4 == 2) ? VP8_EFLAG_FORCE_GF : 0;
+    }
+
+    /**
+    * Encodes a short moving pattern so the decoder sees inter frames that
+    * refresh the golden and alt-ref buffers as well as the last frame.
+    */
+    static std::vector<std::vector<uint8_t>> EncodeRefreshClip(int width, int height, int frames)
+    {
+      vpx_codec_enc_cfg_t cfg = EncoderConfig(width, height);
+
+      cfg.kf_max_dist = 12;
+      return EncodeClip(cfg, frames, GoldenFrameFlags);
+    }
+
+    /**
+    * Decodes the clip and returns the hash of every output frame. With a pool
+    * each output frame is checked to live in a buffer the pool handed out and
+    * the decoder is checked to hold no frame buffer memory of its own.
+    */
+    static uint64_t DecodeClip(const std::vector<std::vector<uint8_t>>& clip, FramePool* pool)
+    {
+      vpx_codec_ctx_t decoder;
+      uint64_t hash = 14695981039346656037ULL;
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+
+      if (pool) {
+        vpx_codec_err_t res = vpx_codec_set_frame_buffer_functions(&decoder, FramePool::Get, FramePool::Release, pool);
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)res);
+      }
+
+      for (auto& frame : clip) {
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, frame.data(), (unsigned int)frame.size(), nullptr, 0));
+
+        if (pool) {
+          vp8d_memory_usage usage;
+          Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_control(&decoder, VP8D_GET_MEMORY_USAGE, &usage));
+          Assert::AreEqual((size_t)0, usage.frame_buffers);
+        }
+
+        vpx_codec_iter_t iter = nullptr;
+        vpx_image_t* img;
+        while ((img = vpx_codec_get_frame(&decoder, &iter)) != nullptr) {
+          if (pool) {
+            Assert::IsTrue(pool->Owns(img->planes[VPX_PLANE_Y]));
+            Assert::IsTrue(pool->Owns(img->planes[VPX_PLANE_V]));
+            Assert::IsNotNull(img->fb_priv);
+            Assert::IsTrue(*(bool*)img->fb_priv);
+          }
+          hash = HashImage(img, hash);
+        }
+      }
+
+      vpx_codec_destroy(&decoder);
+      return hash;
+    }
+
+    /// <summary>
+    /// Checks the key frame decoded into an application buffer matches the
+    /// internally allocated decode and that the buffer is returned on destroy.
+    /// </summary>
+    TEST_METHOD(DecodeKeyFrameExternalBufferTest)
+    {
+      std::ifstream keyFrameStm("testpattern_keyframe.vp8");
+      std::string kfHex((std::istreambuf_iterator<char>(keyFrameStm)), std::istreambuf_iterator<char>());
+      std::vector<std::vector<uint8_t>> clip = { ParseHex(kfHex) };
+
+      FramePool pool;
+      uint64_t internalHash = DecodeClip(clip, nullptr);
+      uint64_t externalHash = DecodeClip(clip, &pool);
+
+      Assert::AreEqual(internalHash, externalHash);
+      Assert::AreEqual(1, pool.gets);
+      Assert::AreEqual(1, pool.releases);
+      Assert::AreEqual(0, pool.InUse());
+    }
+
+    /// <summary>
+    /// Checks a clip with inter frames decodes identically into pooled
+    /// buffers, that the decoder never holds more than its four reference
+    /// slots and that every buffer comes back.
+    /// </summary>
+    TEST_METHOD(DecodeClipExternalBufferTest)
+    {
+      std::vector<std::vector<uint8_t>> clip = EncodeRefreshClip(96, 64, 30);
+
+      FramePool pool;
+      uint64_t internalHash = DecodeClip(clip, nullptr);
+      uint64_t externalHash = DecodeClip(clip, &pool);
+
+      Assert::AreEqual(internalHash, externalHash);
+      Assert::AreEqual((int)clip.size(), pool.gets);
+      Assert::AreEqual(pool.gets, pool.releases);
+      Assert::IsTrue(pool.maxInUse <= 4);
+      Assert::AreEqual(0, pool.InUse());
+    }
+
+    TEST_METHOD(SetFunctionsAfterDecodeTest)
+    {
+      std::vector<std::vector<uint8_t>> clip = EncodeRefreshClip(32, 32, 1);
+      FramePool pool;
+      vpx_codec_ctx_t decoder;
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+      Assert::AreEqual((int)VPX_CODEC_INVALID_PARAM, (int)vpx_codec_set_frame_buffer_functions(&decoder, nullptr, FramePool::Release, &pool));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, clip[0].data(), (unsigned int)clip[0].size(), nullptr, 0));
+      Assert::AreEqual((int)VPX_CODEC_ERROR, (int)vpx_codec_set_frame_buffer_functions(&decoder, FramePool::Get, FramePool::Release, &pool));
+
+      vpx_codec_destroy(&decoder);
+      Assert::AreEqual(0, pool.gets);
+    }
+
+    /// <summary>
+    /// A buffer smaller than requested fails the decode and goes straight
+    /// back to the pool.
+    /// </summary>
+    TEST_METHOD(ExternalBufferTooSmallTest)
+    {
+      std::vector<std::vector<uint8_t>> clip = EncodeRefreshClip(32, 32, 1);
+      FramePool pool;
+      vpx_codec_ctx_t decoder;
+
+      pool.limit = 1024;
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_frame_buffer_functions(&decoder, FramePool::Get, FramePool::Release, &pool));
+      Assert::AreEqual((int)VPX_CODEC_MEM_ERROR, (int)vpx_codec_decode(&decoder, clip[0].data(), (unsigned int)clip[0].size(), nullptr, 0));
+      Assert::AreEqual(0, pool.InUse());
+
+      vpx_codec_destroy(&decoder);
+      Assert::AreEqual(pool.gets, pool.releases);
+    }
+  };
+}
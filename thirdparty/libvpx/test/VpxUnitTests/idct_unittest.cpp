@@ -0,0 +1,316 @@
+/******************************************************************************
+* Filename: idct_unittest.cpp
+*
+* Description:
+* Unit tests for the inverse transform and dequantisation kernels in:
+*  - idctllm.c, idct_blk.c & dequantize.c
+*  - x86/idctllm_sse2.c, x86/idct_blk_sse2.c & x86/idct_blk_avx2.c
+*
+* Each SIMD variant is checked for bit-exact output against the C reference,
+* including coefficients at the limits of the 16 bit range and blocks whose
+* eob selects the DC only path.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/blockd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*y_block_fn_t)(short* q, short* dq, unsigned char* dst, int stride, char* eobs);
+  typedef void (*uv_block_fn_t)(short* q, short* dq, unsigned char* dst_u, unsigned char* dst_v, int stride, char* eobs);
+
+  TEST_CLASS(idct_unittest)
+  {
+  public:
+
+    static const int Iterations = 2000;
+    static const int Stride = 40;
+
+    /**
+    * Random coefficient, mostly small with a share at or near the limits so
+    * every intermediate overflow case is reached.
+    */
+    static short RandomCoeff()
+    {
+      switch (rand() & 7) {
+      case 0: return (rand() & 1) ? 32767 : -32768;
+      case 1: return (short)((rand() << 1) ^ rand());
+      case 2: return 0;
+      default: return (short)((rand() & 511) - 256);
+      }
+    }
+
+    static void Fill(short* coeffs, int count)
+    {
+      for (int i = 0; i < count; i++) coeffs[i] = RandomCoeff();
+    }
+
+    static void Fill(unsigned char* pixels, int count)
+    {
+      for (int i = 0; i < count; i++) {
+        pixels[i] = (rand() & 3) == 0 ? ((rand() & 1) ? 255 : 0) : (unsigned char)(rand() & 0xff);
+      }
+    }
+
+    /**
+    * Dequantisation factors in the ranges the quantiser tables produce, with
+    * some iterations using arbitrary values to exercise the 16 bit wrap.
+    */
+    static void FillDequant(short* dq, int iteration)
+    {
+      for (int i = 0; i < 16; i++) {
+        dq[i] = (iteration & 3) == 0 ? RandomCoeff() : (short)(4 + rand() % 154);
+      }
+    }
+
+    /**
+    * Eobs for a run of blocks, a mix of DC only (0 or 1) and full blocks.
+    * DC only blocks get junk past their DC, which the C ignores.
+    */
+    static void FillEobs(char* eobs, int blocks, int iteration)
+    {
+      for (int i = 0; i < blocks; i++) {
+        switch (iteration & 3) {
+        case 0: eobs[i] = (char)(rand() % 17); break;
+        case 1: eobs[i] = (char)(rand() & 1); break;
+        case 2: eobs[i] = (char)(2 + rand() % 15); break;
+        default: eobs[i] = (char)((rand() & 1) ? 1 : 16); break;
+        }
+      }
+    }
+
+    static void CheckYBlock(y_block_fn_t fn, const char* name)
+    {
+      srand(1);
+
+      for (int it = 0; it < Iterations; it++) {
+        short q[16 * 16], refQ[16 * 16], dq[16];
+        unsigned char dst[16 * Stride], refDst[16 * Stride];
+        char eobs[16];
+
+        Fill(q, 16 * 16);
+        Fill(dst, 16 * Stride);
+        FillDequant(dq, it);
+        FillEobs(eobs, 16, it);
+        memcpy(refQ, q, sizeof(q));
+        memcpy(refDst, dst, sizeof(dst));
+
+        vp8_dequant_idct_add_y_block_c(refQ, dq, refDst, Stride, eobs);
+        fn(q, dq, dst, Stride, eobs);
+
+        Check(memcmp(refDst, dst, sizeof(dst)) == 0, name, it);
+        Check(memcmp(refQ, q, sizeof(q)) == 0, name, it);
+      }
+    }
+
+    static void CheckUvBlock(uv_block_fn_t fn, const char* name)
+    {
+      srand(2);
+
+      for (int it = 0; it < Iterations; it++) {
+        short q[8 * 16], refQ[8 * 16], dq[16];
+        unsigned char dst[16 * Stride], refDst[16 * Stride];
+        char eobs[8];
+
+        Fill(q, 8 * 16);
+        Fill(dst, 16 * Stride);
+        FillDequant(dq, it);
+        FillEobs(eobs, 8, it);
+        memcpy(refQ, q, sizeof(q));
+        memcpy(refDst, dst, sizeof(dst));
+
+        // U and V interleaved in the same buffer to catch writes outside a plane.
+        vp8_dequant_idct_add_uv_block_c(refQ, dq, refDst, refDst + 8 * Stride + 16, Stride, eobs);
+        fn(q, dq, dst, dst + 8 * Stride + 16, Stride, eobs);
+
+        Check(memcmp(refDst, dst, sizeof(dst)) == 0, name, it);
+        Check(memcmp(refQ, q, sizeof(q)) == 0, name, it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 inverse DCT with a separate predictor and destination.
+    /// </summary>
+    TEST_METHOD(Idct4x4llmSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(3);
+
+      for (int it = 0; it < Iterations; it++) {
+        short input[16], refInput[16];
+        unsigned char pred[4 * 16], dst[4 * Stride], refDst[4 * Stride];
+
+        Fill(input, 16);
+        Fill(pred, 4 * 16);
+        Fill(dst, 4 * Stride);
+        memcpy(refInput, input, sizeof(input));
+        memcpy(refDst, dst, sizeof(dst));
+
+        vp8_short_idct4x4llm_c(refInput, pred, 16, refDst, Stride);
+        vp8_short_idct4x4llm_sse2(input, pred, 16, dst, Stride);
+
+        Check(memcmp(refDst, dst, sizeof(dst)) == 0, "idct4x4llm", it);
+        Check(memcmp(refInput, input, sizeof(input)) == 0, "idct4x4llm input", it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 DC only add for every DC value.
+    /// </summary>
+    TEST_METHOD(DcOnlyIdctAddSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      unsigned char pred[4 * 16], dst[4 * Stride], refDst[4 * Stride];
+
+      srand(4);
+
+      for (int dc = -32768; dc <= 32767; dc++) {
+        Fill(pred, 4 * 16);
+        memset(dst, 0x55, sizeof(dst));
+        memset(refDst, 0x55, sizeof(refDst));
+
+        vp8_dc_only_idct_add_c((short)dc, pred, 16, refDst, Stride);
+        vp8_dc_only_idct_add_sse2((short)dc, pred, 16, dst, Stride);
+
+        Check(memcmp(refDst, dst, sizeof(dst)) == 0, "dc_only_idct_add", dc);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 single block dequantise and inverse DCT, including the
+    /// cleared coefficients.
+    /// </summary>
+    TEST_METHOD(DequantIdctAddSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(5);
+
+      for (int it = 0; it < Iterations; it++) {
+        short input[16], refInput[16], dq[16];
+        unsigned char dst[4 * Stride], refDst[4 * Stride];
+
+        Fill(input, 16);
+        Fill(dst, 4 * Stride);
+        FillDequant(dq, it);
+        memcpy(refInput, input, sizeof(input));
+        memcpy(refDst, dst, sizeof(dst));
+
+        vp8_dequant_idct_add_c(refInput, dq, refDst, Stride);
+        vp8_dequant_idct_add_sse2(input, dq, dst, Stride);
+
+        Check(memcmp(refDst, dst, sizeof(dst)) == 0, "dequant_idct_add", it);
+        Check(memcmp(refInput, input, sizeof(input)) == 0, "dequant_idct_add input", it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 block dequantisation.
+    /// </summary>
+    TEST_METHOD(DequantizeBSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      short qcoeff[16], dqcoeff[16], refDqcoeff[16], dq[16];
+      BLOCKD block;
+
+      srand(6);
+      memset(&block, 0, sizeof(block));
+      block.qcoeff = qcoeff;
+
+      for (int it = 0; it < Iterations; it++) {
+        Fill(qcoeff, 16);
+        FillDequant(dq, it);
+
+        block.dqcoeff = refDqcoeff;
+        vp8_dequantize_b_c(&block, dq);
+        block.dqcoeff = dqcoeff;
+        vp8_dequantize_b_sse2(&block, dq);
+
+        Check(memcmp(refDqcoeff, dqcoeff, sizeof(dqcoeff)) == 0, "dequantize_b", it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 inverse Walsh-Hadamard transform writes the same DCs and
+    /// leaves the rest of the macroblock's coefficients alone.
+    /// </summary>
+    TEST_METHOD(InvWalsh4x4Sse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(7);
+
+      for (int it = 0; it < Iterations; it++) {
+        short input[16], refInput[16], out[256], refOut[256];
+
+        Fill(input, 16);
+        Fill(out, 256);
+        memcpy(refInput, input, sizeof(input));
+        memcpy(refOut, out, sizeof(out));
+
+        vp8_short_inv_walsh4x4_c(refInput, refOut);
+        vp8_short_inv_walsh4x4_sse2(input, out);
+
+        Check(memcmp(refOut, out, sizeof(out)) == 0, "inv_walsh4x4", it);
+        Check(memcmp(refInput, input, sizeof(input)) == 0, "inv_walsh4x4 input", it);
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 luma block kernel over mixed DC only and full blocks.
+    /// </summary>
+    TEST_METHOD(YBlockSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckYBlock(vp8_dequant_idct_add_y_block_sse2, "y_block_sse2");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 chroma block kernel over mixed DC only and full blocks.
+    /// </summary>
+    TEST_METHOD(UvBlockSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckUvBlock(vp8_dequant_idct_add_uv_block_sse2, "uv_block_sse2");
+    }
+
+    /// <summary>
+    /// Tests the AVX2 luma block kernel over mixed DC only and full blocks.
+    /// </summary>
+    TEST_METHOD(YBlockAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckYBlock(vp8_dequant_idct_add_y_block_avx2, "y_block_avx2");
+    }
+
+    /// <summary>
+    /// Tests the AVX2 chroma block kernel over mixed DC only and full blocks.
+    /// </summary>
+    TEST_METHOD(UvBlockAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckUvBlock(vp8_dequant_idct_add_uv_block_avx2, "uv_block_avx2");
+    }
+  };
+}
@@ -0,0 +1,112 @@
+/******************************************************************************
+* Filename: intrapred_unittest.cpp
+*
+* Description:
+* Unit tests for the intra predictors in:
+*  - vpx_dsp/intrapred.c
+*  - vpx_dsp/x86/intrapred_sse2.c
+*
+* Each SSE2 predictor for the 16x16, 8x8 and 4x4 sizes VP8 uses is checked
+* against the C reference with random edges, including the above-left pixel
+* and the above-right pixels the 4x4 diagonal modes read.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*intra_pred_fn_t)(uint8_t* dst, ptrdiff_t stride, const uint8_t* above, const uint8_t* left);
+
+  struct IntraPredKernels
+  {
+    const char* name;
+    int size;
+    intra_pred_fn_t fns[2];   // C, SSE2.
+  };
+
+#define INTRA_PRED_KERNELS(type, bs) \
+  { #type, bs, { vpx_##type##_predictor_##bs##x##bs##_c, vpx_##type##_predictor_##bs##x##bs##_sse2 } }
+
+  static const IntraPredKernels _intraPredKernels[] = {
+    INTRA_PRED_KERNELS(dc, 16), INTRA_PRED_KERNELS(dc_top, 16), INTRA_PRED_KERNELS(dc_left, 16),
+    INTRA_PRED_KERNELS(dc_128, 16), INTRA_PRED_KERNELS(v, 16), INTRA_PRED_KERNELS(h, 16),
+    INTRA_PRED_KERNELS(tm, 16),
+    INTRA_PRED_KERNELS(dc, 8), INTRA_PRED_KERNELS(dc_top, 8), INTRA_PRED_KERNELS(dc_left, 8),
+    INTRA_PRED_KERNELS(dc_128, 8), INTRA_PRED_KERNELS(v, 8), INTRA_PRED_KERNELS(h, 8),
+    INTRA_PRED_KERNELS(tm, 8),
+    INTRA_PRED_KERNELS(dc, 4), INTRA_PRED_KERNELS(tm, 4), INTRA_PRED_KERNELS(ve, 4),
+    INTRA_PRED_KERNELS(he, 4), INTRA_PRED_KERNELS(d45e, 4), INTRA_PRED_KERNELS(d63e, 4),
+    INTRA_PRED_KERNELS(d135, 4), INTRA_PRED_KERNELS(d117, 4), INTRA_PRED_KERNELS(d153, 4),
+    INTRA_PRED_KERNELS(d207, 4),
+  };
+
+  TEST_CLASS(intrapred_unittest)
+  {
+  public:
+
+    static const int Iterations = 1000;
+    static const int Stride = 32;
+
+    static void Fill(uint8_t* pixels, int count, int iteration)
+    {
+      for (int i = 0; i < count; i++) {
+        switch (iteration & 3) {
+        case 0: pixels[i] = (uint8_t)(rand() & 0xff); break;
+        case 1: pixels[i] = (rand() & 1) ? 255 : 0; break;
+        case 2: pixels[i] = (uint8_t)(128 + (rand() & 7)); break;
+        default: pixels[i] = (uint8_t)(iteration & 4 ? 255 : 0); break;
+        }
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 intra predictors for every VP8 block size. The whole
+    /// destination is compared so a write outside the block is caught too.
+    /// </summary>
+    TEST_METHOD(IntraPredSse2Test)
+    {
+      // The above row has the above-left pixel before it and 16 pixels after.
+      static uint8_t above[1 + 32], left[16];
+      static uint8_t expected[16 * Stride], actual[16 * Stride];
+
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(1);
+
+      for (auto& k : _intraPredKernels) {
+        std::string name = std::string(k.name) + " " + std::to_string(k.size) + "x" + std::to_string(k.size);
+
+        for (int it = 0; it < Iterations; it++) {
+          Fill(above, sizeof(above), it);
+          Fill(left, sizeof(left), it + (it & 8 ? 4 : 0));
+          memset(expected, 0xa5, sizeof(expected));
+          memset(actual, 0xa5, sizeof(actual));
+
+          k.fns[0](expected, Stride, above + 1, left);
+          k.fns[1](actual, Stride, above + 1, left);
+
+          Check(memcmp(expected, actual, sizeof(expected)) == 0, name, it);
+        }
+      }
+    }
+
+  };
+}
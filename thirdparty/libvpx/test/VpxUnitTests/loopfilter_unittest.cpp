@@ -0,0 +1,218 @@
+/******************************************************************************
+* Filename: loopfilter_unittest.cpp
+*
+* Description:
+* Unit tests for the loop filters in:
+*  - loopfilter_filters.c
+*  - x86/loopfilter_sse2.c & x86/loopfilter_avx2.c
+*
+* Each SIMD variant is checked for bit-exact output against the C reference
+* for every filter level, sharpness and high edge variance threshold, on
+* smooth, stepped and noisy content so the filter masks take every path.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vp8/common/loopfilter.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*normal_fn_t)(unsigned char* y_ptr, unsigned char* u_ptr, unsigned char* v_ptr, int y_stride, int uv_stride, loop_filter_info* lfi);
+  typedef void (*simple_fn_t)(unsigned char* y_ptr, int y_stride, const unsigned char* blimit);
+
+  TEST_CLASS(loopfilter_unittest)
+  {
+  public:
+
+    static const int Stride = 48;
+    static const int Rows = 28;
+    static const int Patterns = 6;
+
+    // The luma block and the U and V blocks, in one buffer so a write to the
+    // wrong plane or outside the edge shows up in the comparison.
+    static const int YOffset = 6 * Stride + 8;
+    static const int UOffset = 6 * Stride + 28;
+    static const int VOffset = 16 * Stride + 40;
+
+    /**
+    * Fills the buffer with content close enough to an edge for the masks to
+    * pass at the given level. Patterns cover flat areas, steps across the
+    * block edges, noise and values pinned at 0 and 255.
+    */
+    static void Fill(unsigned char* buf, int pattern, int level)
+    {
+      const int amp = 1 + (level >> 2);
+
+      for (int r = 0; r < Rows; r++) {
+        for (int c = 0; c < Stride; c++) {
+          int v;
+
+          switch (pattern) {
+          case 0: v = 128 + rand() % (2 * amp + 1) - amp; break;
+          case 1: v = ((c & 7) < 4 ? 100 : 100 + level) + rand() % 3 - 1; break;
+          case 2: v = ((r & 3) < 2 ? 60 : 60 + 2 * level) + rand() % (amp + 1); break;
+          case 3: v = (rand() & 1) ? rand() % (amp + 1) : 255 - rand() % (amp + 1); break;
+          case 4: v = 16 * ((r + c) & 15) + rand() % (amp + 1); break;
+          default: v = rand() & 0xff; break;
+          }
+          buf[r * Stride + c] = (unsigned char)(v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+      }
+    }
+
+    static std::string Where(int sharpness, int level, int hev, int pattern)
+    {
+      return "sharpness " + std::to_string(sharpness) + ", level " + std::to_string(level) +
+        ", hev " + std::to_string(hev) + ", pattern " + std::to_string(pattern);
+    }
+
+    /**
+    * Runs a normal filter against the C one for every sharpness, level and
+    * threshold, with both chroma planes, one of them or neither.
+    */
+    static void CheckNormal(normal_fn_t ref, normal_fn_t fn, const char* name)
+    {
+      loop_filter_info_n lfi_n;
+      unsigned char buf[Rows * Stride], refBuf[Rows * Stride];
+
+      memset(&lfi_n, 0, sizeof(lfi_n));
+      for (int i = 0; i < 4; i++) memset(lfi_n.hev_thr[i], i, SIMD_WIDTH);
+
+      srand(1);
+
+      for (int sharpness = 0; sharpness < 8; sharpness++) {
+        vp8_loop_filter_update_sharpness(&lfi_n, sharpness);
+
+        for (int level = 0; level <= MAX_LOOP_FILTER; level++) {
+          for (int hev = 0; hev < 4; hev++) {
+            loop_filter_info lfi;
+
+            lfi.mblim = lfi_n.mblim[level];
+            lfi.blim = lfi_n.blim[level];
+            lfi.lim = lfi_n.lim[level];
+            lfi.hev_thr = lfi_n.hev_thr[hev];
+
+            for (int pattern = 0; pattern < Patterns; pattern++) {
+              const int planes = (level + hev + pattern) & 3;
+              unsigned char* u = planes & 1 ? buf + UOffset : NULL;
+              unsigned char* v = planes & 2 ? buf + VOffset : NULL;
+
+              // Mostly both planes, as the decoder calls it.
+              if (pattern < 3) {
+                u = buf + UOffset;
+                v = buf + VOffset;
+              }
+
+              Fill(buf, pattern, level);
+              memcpy(refBuf, buf, sizeof(buf));
+
+              ref(refBuf + YOffset, u ? refBuf + UOffset : NULL, v ? refBuf + VOffset : NULL, Stride, Stride, &lfi);
+              fn(buf + YOffset, u, v, Stride, Stride, &lfi);
+
+              Check(memcmp(refBuf, buf, sizeof(buf)) == 0, name, Where(sharpness, level, hev, pattern));
+            }
+          }
+        }
+      }
+    }
+
+    static void CheckSimple(simple_fn_t ref, simple_fn_t fn, const char* name)
+    {
+      loop_filter_info_n lfi_n;
+      unsigned char buf[Rows * Stride], refBuf[Rows * Stride];
+
+      memset(&lfi_n, 0, sizeof(lfi_n));
+
+      srand(2);
+
+      for (int sharpness = 0; sharpness < 8; sharpness++) {
+        vp8_loop_filter_update_sharpness(&lfi_n, sharpness);
+
+        for (int level = 0; level <= MAX_LOOP_FILTER; level++) {
+          for (int limit = 0; limit < 2; limit++) {
+            const unsigned char* blimit = limit ? lfi_n.mblim[level] : lfi_n.blim[level];
+
+            for (int pattern = 0; pattern < Patterns; pattern++) {
+              Fill(buf, pattern, level);
+              memcpy(refBuf, buf, sizeof(buf));
+
+              ref(refBuf + YOffset, Stride, blimit);
+              fn(buf + YOffset, Stride, blimit);
+
+              Check(memcmp(refBuf, buf, sizeof(buf)) == 0, name, Where(sharpness, level, limit, pattern));
+            }
+          }
+        }
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 macroblock edge filters.
+    /// </summary>
+    TEST_METHOD(MacroblockEdgeSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckNormal(vp8_loop_filter_mbh_c, vp8_loop_filter_mbh_sse2, "mbh_sse2");
+      CheckNormal(vp8_loop_filter_mbv_c, vp8_loop_filter_mbv_sse2, "mbv_sse2");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 inner block edge filters.
+    /// </summary>
+    TEST_METHOD(BlockEdgeSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckNormal(vp8_loop_filter_bh_c, vp8_loop_filter_bh_sse2, "bh_sse2");
+      CheckNormal(vp8_loop_filter_bv_c, vp8_loop_filter_bv_sse2, "bv_sse2");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 simple filters on macroblock and inner block edges.
+    /// </summary>
+    TEST_METHOD(SimpleSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckSimple(vp8_loop_filter_simple_horizontal_edge_c, vp8_loop_filter_simple_horizontal_edge_sse2, "simple_mbh_sse2");
+      CheckSimple(vp8_loop_filter_simple_vertical_edge_c, vp8_loop_filter_simple_vertical_edge_sse2, "simple_mbv_sse2");
+      CheckSimple(vp8_loop_filter_bhs_c, vp8_loop_filter_bhs_sse2, "simple_bh_sse2");
+      CheckSimple(vp8_loop_filter_bvs_c, vp8_loop_filter_bvs_sse2, "simple_bv_sse2");
+    }
+
+    /// <summary>
+    /// Tests the AVX2 macroblock edge filters.
+    /// </summary>
+    TEST_METHOD(MacroblockEdgeAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckNormal(vp8_loop_filter_mbh_c, vp8_loop_filter_mbh_avx2, "mbh_avx2");
+      CheckNormal(vp8_loop_filter_mbv_c, vp8_loop_filter_mbv_avx2, "mbv_avx2");
+    }
+
+    /// <summary>
+    /// Tests the AVX2 inner block edge filters.
+    /// </summary>
+    TEST_METHOD(BlockEdgeAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckNormal(vp8_loop_filter_bh_c, vp8_loop_filter_bh_avx2, "bh_avx2");
+      CheckNormal(vp8_loop_filter_bv_c, vp8_loop_filter_bv_avx2, "bv_avx2");
+    }
+  };
+}
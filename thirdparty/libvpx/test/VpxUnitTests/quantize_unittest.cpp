@@ -0,0 +1,161 @@
+/******************************************************************************
+* Filename: quantize_unittest.cpp
+*
+* Description:
+* Unit tests for the quantizers in:
+*  - vp8/encoder/vp8_quantize.c
+*  - vp8/encoder/x86/vp8_quantize_sse2.c
+*
+* The tables are the ones vp8cx_init_quantizer() builds, for every Q index,
+* the Y1, Y2 and UV planes and both settings of improved_quant. The
+* coefficients come from the forward transforms so they span the range the
+* encoder quantizes.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vp8/encoder/onyx_int.h"
+#include "vp8/encoder/quantize.h"
+#include "vpx_mem/vpx_mem.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*quantize_fn_t)(BLOCK* b, BLOCKD* d);
+
+  TEST_CLASS(quantize_unittest)
+  {
+  public:
+
+    static const int BlocksPerQ = 40;
+
+    /**
+    * Fills coeff with the transform of a random residual: a 4x4 DCT, or for
+    * the Y2 plane the Walsh transform of 16 DCT DC values.
+    */
+    static void RandomCoeffs(short* coeff, bool y2, int iteration)
+    {
+      const int range = (iteration & 3) == 0 ? 511 : (iteration & 1) ? 64 : 16;
+      short residual[16], dct[16], dc[16];
+
+      for (int b = 0; b < (y2 ? 16 : 1); b++) {
+        for (int i = 0; i < 16; i++) residual[i] = (short)(rand() % range - range / 2);
+        vp8_short_fdct4x4_c(residual, dct, 8);
+        dc[b] = dct[0];
+      }
+
+      if (y2) {
+        vp8_short_walsh4x4_c(dc, coeff, 8);
+      }
+      else {
+        memcpy(coeff, dct, sizeof(dct));
+      }
+    }
+
+    static std::string Where(int q, int plane, int iteration)
+    {
+      return "Q " + std::to_string(q) + " plane " + std::to_string(plane) + " iteration " + std::to_string(iteration);
+    }
+
+    /**
+    * Quantizes the same coefficients with ref and test for every Q index and
+    * plane. The regular quantizer is also run with a range of zbin_extra
+    * values, as the mode and activity based zero bin adjustments give.
+    */
+    static void CheckQuantizer(quantize_fn_t ref, quantize_fn_t test, const char* name)
+    {
+      VP8_COMP* cpi = (VP8_COMP*)vpx_calloc(1, sizeof(VP8_COMP));
+      DECLARE_ALIGNED(16, short, coeff[16]);
+      DECLARE_ALIGNED(16, short, dequant[16]);
+      DECLARE_ALIGNED(16, short, qcoeff[2][16]);
+      DECLARE_ALIGNED(16, short, dqcoeff[2][16]);
+      char eob[2];
+
+      srand(1);
+
+      for (int improved = 0; improved < 2; improved++) {
+        cpi->sf.improved_quant = improved;
+        vp8cx_init_quantizer(cpi);
+
+        for (int q = 0; q < QINDEX_RANGE; q++) {
+          for (int plane = 0; plane < 3; plane++) {
+            BLOCK b;
+            BLOCKD d[2];
+
+            memset(&b, 0, sizeof(b));
+            b.coeff = coeff;
+            b.quant = plane == 0 ? cpi->Y1quant[q] : plane == 1 ? cpi->Y2quant[q] : cpi->UVquant[q];
+            b.quant_fast = plane == 0 ? cpi->Y1quant_fast[q] : plane == 1 ? cpi->Y2quant_fast[q] : cpi->UVquant_fast[q];
+            b.quant_shift = plane == 0 ? cpi->Y1quant_shift[q] : plane == 1 ? cpi->Y2quant_shift[q] : cpi->UVquant_shift[q];
+            b.zbin = plane == 0 ? cpi->Y1zbin[q] : plane == 1 ? cpi->Y2zbin[q] : cpi->UVzbin[q];
+            b.round = plane == 0 ? cpi->Y1round[q] : plane == 1 ? cpi->Y2round[q] : cpi->UVround[q];
+            b.zrun_zbin_boost = plane == 0 ? cpi->zrun_zbin_boost_y1[q] : plane == 1 ? cpi->zrun_zbin_boost_y2[q] : cpi->zrun_zbin_boost_uv[q];
+            memcpy(dequant, plane == 0 ? cpi->common.Y1dequant[q] : plane == 1 ? cpi->common.Y2dequant[q] : cpi->common.UVdequant[q],
+              sizeof(dequant));
+
+            for (int k = 0; k < 2; k++) {
+              memset(&d[k], 0, sizeof(d[k]));
+              d[k].qcoeff = qcoeff[k];
+              d[k].dqcoeff = dqcoeff[k];
+              d[k].dequant = dequant;
+              d[k].eob = &eob[k];
+            }
+
+            for (int it = 0; it < BlocksPerQ; it++) {
+              RandomCoeffs(coeff, plane == 1, it);
+              b.zbin_extra = (short)((it & 7) * dequant[1] / 8);
+
+              memset(qcoeff, 0x55, sizeof(qcoeff));
+              memset(dqcoeff, 0x55, sizeof(dqcoeff));
+              eob[0] = eob[1] = -1;
+              ref(&b, &d[0]);
+              test(&b, &d[1]);
+
+              Check(memcmp(qcoeff[0], qcoeff[1], sizeof(qcoeff[0])) == 0, name, Where(q, plane, it));
+              Check(memcmp(dqcoeff[0], dqcoeff[1], sizeof(dqcoeff[0])) == 0, name, Where(q, plane, it));
+              Check(eob[0] == eob[1], name, Where(q, plane, it));
+            }
+          }
+        }
+      }
+
+      vpx_free(cpi);
+    }
+
+    /// <summary>
+    /// Tests the SSE2 regular quantizer, including its zero bin and zero run
+    /// boost handling and the eob it returns.
+    /// </summary>
+    TEST_METHOD(RegularQuantizeSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckQuantizer(vp8_regular_quantize_b_c, vp8_regular_quantize_b_sse2, "regular_quantize_b");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 fast quantizer and the eob it finds without a scan.
+    /// </summary>
+    TEST_METHOD(FastQuantizeSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckQuantizer(vp8_fast_quantize_b_c, vp8_fast_quantize_b_sse2, "fast_quantize_b");
+    }
+
+  };
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+* Filename: raw_frame_release_unittest.cpp
+*
+* Description:
+* Unit tests for encoding from the caller's raw frame planes in:
+*  - vp8_cx_iface.c (VP8E_SET_RAW_FRAME_RELEASE)
+*  - lookahead.c (vp8_lookahead_push_ref)
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "encodeutils.h"
+#include "CppUnitTest.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  /**
+  * Counts the images handed back by the encoder and checks each one was
+  * outstanding.
+  */
+  struct ReleaseTracker
+  {
+    int released = 0;
+    int pending = 0;
+    void* lastUserPriv = nullptr;
+
+    static void Release(void* priv, const vpx_image_t* img)
+    {
+      ReleaseTracker* tracker = (ReleaseTracker*)priv;
+
+      Assert::IsTrue(tracker->pending > 0);
+      Assert::IsNotNull(img->planes[VPX_PLANE_Y]);
+      tracker->pending--;
+      tracker->released++;
+      tracker->lastUserPriv = img->user_priv;
+    }
+  };
+
+  TEST_CLASS(raw_frame_release_unittest)
+  {
+  public:
+
+    /**
+    * Encodes a short clip and returns the compressed frames. With a tracker
+    * the encoder may reference the image planes and every frame has to be
+    * released before vpx_codec_encode returns.
+    */
+    static std::vector<std::vector<uint8_t>> EncodeTracked(int width, int height, unsigned int lag, int frames, ReleaseTracker* tracker)
+    {
+      std::vector<std::vector<uint8_t>> clip;
+      vpx_codec_ctx_t encoder;
+
+      InitEncoder(&encoder, width, height, lag);
+
+      if (tracker) {
+        vpx_raw_frame_release_t release = { ReleaseTracker::Release, tracker };
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_control(&encoder, VP8E_SET_RAW_FRAME_RELEASE, &release));
+        Assert::AreEqual((int)VPX_CODEC_INVALID_PARAM, (int)vpx_codec_control(&encoder, VP8E_SET_RAW_FRAME_RELEASE, (vpx_raw_frame_release_t*)nullptr));
+      }
+
+      // A stride wider than the frame checks the planes are read in place.
+      vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, width + 32, height, 1);
+      vpx_img_set_rect(img, 0, 0, width, height);
+
+      for (int frame = 0; frame < frames; frame++) {
+        FillFrame(img, frame);
+        img->user_priv = (void*)(intptr_t)(frame + 1);
+        if (tracker) tracker->pending++;
+
+        EncodeFrame(&encoder, img, frame, 0, clip, lag ? VPX_DL_GOOD_QUALITY : VPX_DL_REALTIME);
+
+        if (tracker) {
+          Assert::AreEqual(0, tracker->pending);
+          Assert::IsTrue(tracker->lastUserPriv == img->user_priv);
+        }
+      }
+
+      vpx_img_free(img);
+      vpx_codec_destroy(&encoder);
+      return clip;
+    }
+
+    /// <summary>
+    /// Checks encoding from the referenced planes gives the same bitstream
+    /// as encoding from the lookahead copy.
+    /// </summary>
+    TEST_METHOD(ReferencedFrameBitExactTest)
+    {
+      ReleaseTracker tracker;
+
+      std::vector<std::vector<uint8_t>> copied = EncodeTracked(64, 48, 0, 10, nullptr);
+      std::vector<std::vector<uint8_t>> referenced = EncodeTracked(64, 48, 0, 10, &tracker);
+
+      Assert::IsTrue(copied == referenced);
+      Assert::AreEqual(10, tracker.released);
+    }
+
+    /// <summary>
+    /// A size that is not a multiple of 16 is copied and released straight
+    /// away.
+    /// </summary>
+    TEST_METHOD(UnalignedFrameCopiedTest)
+    {
+      ReleaseTracker tracker;
+
+      std::vector<std::vector<uint8_t>> copied = EncodeTracked(50, 40, 0, 6, nullptr);
+      std::vector<std::vector<uint8_t>> referenced = EncodeTracked(50, 40, 0, 6, &tracker);
+
+      Assert::IsTrue(copied == referenced);
+      Assert::AreEqual(6, tracker.released);
+    }
+
+    /// <summary>
+    /// With lag in frames the images are copied, so each is still released
+    /// exactly once inside the encode call.
+    /// </summary>
+    TEST_METHOD(LaggedFramesCopiedTest)
+    {
+      ReleaseTracker tracker;
+
+      EncodeTracked(64, 48, 4, 6, &tracker);
+      Assert::AreEqual(6, tracker.released);
+    }
+  };
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+* Filename: rtcd_unittest.cpp
+*
+* Description:
+* Unit tests for the run time CPU dispatch in:
+*  - rtcd.c, vpx_dsp_rtcd.c & vpx_scale_rtcd.c
+*  - generic/systemdependent.c
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vpx/vp8.h"
+#include "vpx_ports/x86.h"
+
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  TEST_CLASS(rtcd_unittest)
+  {
+  public:
+
+    static std::vector<vpx_rtcd_slot_t> GetSlots()
+    {
+      int count = vpx_codec_get_rtcd_slots(NULL, 0);
+      std::vector<vpx_rtcd_slot_t> slots(count);
+      Assert::AreEqual(count, vpx_codec_get_rtcd_slots(slots.data(), count));
+      return slots;
+    }
+
+    static std::string GetVariant(const char* name)
+    {
+      for (auto& slot : GetSlots()) {
+        if (strcmp(slot.name, name) == 0) {
+          return slot.variant;
+        }
+      }
+      return "";
+    }
+
+    /// <summary>
+    /// Tests every slot is reported once with a resolved variant.
+    /// </summary>
+    TEST_METHOD(ListSlotsTest)
+    {
+      auto slots = GetSlots();
+      std::set<std::string> names;
+
+      Assert::IsTrue(slots.size() > 0);
+
+      for (auto& slot : slots) {
+        Assert::IsNotNull(slot.name);
+        Assert::IsNotNull(slot.variant);
+        Assert::IsTrue(names.insert(slot.name).second);
+      }
+
+      Assert::IsTrue(names.count("vp8_sixtap_predict16x16") == 1);
+      Assert::IsTrue(names.count("vpx_sad16x16") == 1);
+      Assert::IsTrue(names.count("vp8_yv12_copy_frame") == 1);
+    }
+
+    /// <summary>
+    /// Tests a short output array is filled without overrunning it.
+    /// </summary>
+    TEST_METHOD(ShortSlotArrayTest)
+    {
+      vpx_rtcd_slot_t slots[3];
+      memset(slots, 0, sizeof(slots));
+
+      int count = vpx_codec_get_rtcd_slots(slots, 2);
+
+      Assert::IsTrue(count > 2);
+      Assert::IsNotNull(slots[1].variant);
+      Assert::IsNull(slots[2].name);
+    }
+
+    /// <summary>
+    /// Tests the instruction sets can't be capped once the shared tables have
+    /// been filled in, and that a refused cap leaves the slots unchanged.
+    /// </summary>
+    TEST_METHOD(SimdCapsMaskFrozenTest)
+    {
+      std::string variant = GetVariant("vp8_sixtap_predict16x16");
+      auto predict = vp8_sixtap_predict16x16;
+
+      Assert::AreEqual(-1, vpx_codec_set_simd_caps_mask(0));
+      Assert::AreEqual(variant.c_str(), GetVariant("vp8_sixtap_predict16x16").c_str());
+      Assert::IsTrue(vp8_sixtap_predict16x16 == predict);
+      Assert::AreEqual(x86_simd_caps(), x86_rtcd_simd_caps());
+
+      if (x86_simd_caps() & HAS_SSSE3) {
+        Assert::AreEqual("ssse3", variant.c_str());
+        Assert::IsTrue(vp8_sixtap_predict16x16 == vp8_sixtap_predict16x16_ssse3);
+      }
+    }
+  };
+}
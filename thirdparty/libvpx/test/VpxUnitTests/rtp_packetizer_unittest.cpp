@@ -0,0 +1,272 @@
+/******************************************************************************
+* Filename: rtp_packetizer_unittest.cpp
+*
+* Description:
+* Unit tests for the RFC 7741 RTP packetizer in:
+*  - vp8_rtp_packetizer.c
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "encodeutils.h"
+#include "CppUnitTest.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vp8rtp.h"
+#include "vpx/vpx_decoder.h"
+#include "vpx/vpx_encoder.h"
+
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  TEST_CLASS(rtp_packetizer_unittest)
+  {
+  public:
+
+    static vpx_codec_cx_pkt_t FramePacket(const uint8_t* buf, size_t sz, int partitionId, bool last)
+    {
+      vpx_codec_cx_pkt_t pkt = {};
+      pkt.kind = VPX_CODEC_CX_FRAME_PKT;
+      pkt.data.frame.buf = (void*)buf;
+      pkt.data.frame.sz = sz;
+      pkt.data.frame.partition_id = partitionId;
+      pkt.data.frame.flags = last ? 0 : VPX_FRAME_IS_FRAGMENT;
+      return pkt;
+    }
+
+    /**
+    * Adds the partitions, which follow each other in buf, and returns the
+    * payloads of the frame.
+    */
+    static std::vector<vpx_vp8_rtp_payload_t> Packetize(vpx_vp8_rtp_packetizer_t* packetizer, const uint8_t* buf, const std::vector<size_t>& sizes)
+    {
+      std::vector<vpx_vp8_rtp_payload_t> payloads;
+
+      for (size_t i = 0; i < sizes.size(); i++) {
+        vpx_codec_cx_pkt_t pkt = FramePacket(buf, sizes[i], (int)i, i + 1 == sizes.size());
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_add_packet(packetizer, &pkt));
+        buf += sizes[i];
+      }
+
+      const vpx_vp8_rtp_payload_t* payload;
+      while ((payload = vpx_vp8_rtp_get_payload(packetizer)) != nullptr) {
+        Assert::IsTrue(payload->descriptor_sz + payload->data_sz <= packetizer->mtu);
+        payloads.push_back(*payload);
+      }
+      return payloads;
+    }
+
+    /**
+    * Returns the VP8 data of a payload, skipping its descriptor as a receiver
+    * would.
+    */
+    static size_t ParseDescriptor(const uint8_t* payload)
+    {
+      size_t sz = 1;
+
+      if (payload[0] & 0x80) {
+        const uint8_t ext = payload[1];
+        sz++;
+        if (ext & 0x80) sz += (payload[sz] & 0x80) ? 2 : 1;
+        if (ext & 0x40) sz++;
+        if (ext & 0x30) sz++;
+      }
+      return sz;
+    }
+
+    TEST_METHOD(DescriptorFieldsTest)
+    {
+      std::vector<uint8_t> frame(100, 0x5a);
+      vpx_vp8_rtp_packetizer_t packetizer;
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 1200, VPX_VP8_RTP_PICTURE_ID | VPX_VP8_RTP_TL0PICIDX));
+      packetizer.picture_id = 0x7fff;
+      packetizer.tl0picidx = 9;
+
+      std::vector<vpx_vp8_rtp_payload_t> payloads = Packetize(&packetizer, frame.data(), { frame.size() });
+
+      Assert::AreEqual((size_t)1, payloads.size());
+      Assert::AreEqual(6U, payloads[0].descriptor_sz);
+      Assert::AreEqual((uint8_t)0x90, payloads[0].descriptor[0]);
+      Assert::AreEqual((uint8_t)0xe0, payloads[0].descriptor[1]);
+      Assert::AreEqual((uint8_t)0xff, payloads[0].descriptor[2]);
+      Assert::AreEqual((uint8_t)0xff, payloads[0].descriptor[3]);
+      Assert::AreEqual((uint8_t)9, payloads[0].descriptor[4]);
+      Assert::AreEqual((uint8_t)0, payloads[0].descriptor[5]);
+      Assert::IsTrue(payloads[0].data == frame.data());
+      Assert::AreEqual(frame.size(), payloads[0].data_sz);
+      Assert::IsTrue(payloads[0].marker != 0);
+
+      // The PictureID wraps at 15 bits.
+      payloads = Packetize(&packetizer, frame.data(), { frame.size() });
+      Assert::AreEqual((uint8_t)0x80, payloads[0].descriptor[2]);
+      Assert::AreEqual((uint8_t)0x00, payloads[0].descriptor[3]);
+    }
+
+    /// <summary>
+    /// Higher temporal layers carry the TL0PICIDX of the last base layer
+    /// frame.
+    /// </summary>
+    TEST_METHOD(TemporalLayersTest)
+    {
+      std::vector<uint8_t> frame(10);
+      vpx_vp8_rtp_packetizer_t packetizer;
+      const int temporalIds[] = { 0, 2, 1, 2, 0, 1 };
+      const uint8_t tl0picidx[] = { 0, 0, 0, 0, 1, 1 };
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 1200, VPX_VP8_RTP_TL0PICIDX));
+
+      for (int i = 0; i < 6; i++) {
+        packetizer.temporal_id = temporalIds[i];
+        packetizer.layer_sync = i == 2;
+
+        std::vector<vpx_vp8_rtp_payload_t> payloads = Packetize(&packetizer, frame.data(), { frame.size() });
+        Assert::AreEqual(4U, payloads[0].descriptor_sz);
+        Assert::AreEqual((uint8_t)0x60, payloads[0].descriptor[1]);
+        Assert::AreEqual(tl0picidx[i], payloads[0].descriptor[2]);
+        Assert::AreEqual((uint8_t)((temporalIds[i] << 6) | (i == 2 ? 0x20 : 0)), payloads[0].descriptor[3]);
+      }
+    }
+
+    /// <summary>
+    /// Small partitions share a payload and a large one is split into equal
+    /// fragments ending on its boundary.
+    /// </summary>
+    TEST_METHOD(PartitionBoundariesTest)
+    {
+      std::vector<uint8_t> frame(300 + 50 + 40 + 2000 + 450);
+      vpx_vp8_rtp_packetizer_t packetizer;
+
+      for (size_t i = 0; i < frame.size(); i++) frame[i] = (uint8_t)(i * 7);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 500, 0));
+
+      std::vector<vpx_vp8_rtp_payload_t> payloads = Packetize(&packetizer, frame.data(), { 300, 50, 40, 2000, 450 });
+
+      // 300 + 50 + 40, five fragments of 400 and then the last partition.
+      const size_t sizes[] = { 390, 400, 400, 400, 400, 400, 450 };
+      const uint8_t first[] = { 0x10, 0x13, 0x03, 0x03, 0x03, 0x03, 0x14 };
+      std::vector<uint8_t> reassembled;
+
+      Assert::AreEqual((size_t)7, payloads.size());
+      for (size_t i = 0; i < payloads.size(); i++) {
+        Assert::AreEqual(1U, payloads[i].descriptor_sz);
+        Assert::AreEqual(sizes[i], payloads[i].data_sz);
+        Assert::AreEqual(first[i], payloads[i].descriptor[0]);
+        Assert::AreEqual(i == payloads.size() - 1, payloads[i].marker != 0);
+        reassembled.insert(reassembled.end(), payloads[i].data, payloads[i].data + payloads[i].data_sz);
+      }
+      Assert::IsTrue(reassembled == frame);
+    }
+
+    /// <summary>
+    /// PID stops at 7 and only the payload starting partition 7 sets S.
+    /// </summary>
+    TEST_METHOD(PartitionIndexLimitTest)
+    {
+      std::vector<uint8_t> buffers[9];
+      vpx_vp8_rtp_packetizer_t packetizer;
+
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 1200, 0));
+
+      // Separate buffers so no partitions share a payload.
+      for (int i = 0; i < 9; i++) {
+        buffers[i].assign(20, (uint8_t)i);
+        vpx_codec_cx_pkt_t pkt = FramePacket(buffers[i].data(), buffers[i].size(), i, i == 8);
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_add_packet(&packetizer, &pkt));
+      }
+
+      for (int i = 0; i < 9; i++) {
+        const vpx_vp8_rtp_payload_t* payload = vpx_vp8_rtp_get_payload(&packetizer);
+        Assert::IsNotNull(payload);
+        Assert::IsTrue(payload->data == buffers[i].data());
+        Assert::AreEqual((uint8_t)(i < 8 ? 0x10 | i : 7), payload->descriptor[0]);
+      }
+      Assert::IsNull(vpx_vp8_rtp_get_payload(&packetizer));
+    }
+
+    TEST_METHOD(InvalidParametersTest)
+    {
+      uint8_t data[16] = {};
+      vpx_vp8_rtp_packetizer_t packetizer;
+
+      Assert::AreEqual((int)VPX_CODEC_INVALID_PARAM, (int)vpx_vp8_rtp_init(&packetizer, 6, VPX_VP8_RTP_PICTURE_ID | VPX_VP8_RTP_TL0PICIDX));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 7, VPX_VP8_RTP_PICTURE_ID | VPX_VP8_RTP_TL0PICIDX));
+
+      vpx_codec_cx_pkt_t pkt = FramePacket(data, sizeof(data), 1, true);
+      Assert::AreEqual((int)VPX_CODEC_INVALID_PARAM, (int)vpx_vp8_rtp_add_packet(&packetizer, &pkt));
+      Assert::IsNull(vpx_vp8_rtp_get_payload(&packetizer));
+
+      pkt.kind = VPX_CODEC_STATS_PKT;
+      Assert::AreEqual((int)VPX_CODEC_INVALID_PARAM, (int)vpx_vp8_rtp_add_packet(&packetizer, &pkt));
+    }
+
+    /// <summary>
+    /// Encodes with output partitions, packetizes at a small MTU and checks
+    /// the frames reassembled from the payloads decode.
+    /// </summary>
+    TEST_METHOD(EncodePacketizeDecodeTest)
+    {
+      vpx_codec_enc_cfg_t cfg = EncoderConfig(176, 144);
+      vpx_codec_ctx_t encoder;
+      vpx_codec_ctx_t decoder;
+      vpx_vp8_rtp_packetizer_t packetizer;
+
+      cfg.rc_target_bitrate = 800;
+      InitEncoder(&encoder, cfg, VPX_CODEC_USE_OUTPUT_PARTITION);
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_control(&encoder, VP8E_SET_TOKEN_PARTITIONS, VP8_FOUR_TOKENPARTITION));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+      Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_init(&packetizer, 300, VPX_VP8_RTP_PICTURE_ID));
+
+      vpx_image_t* img = vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, cfg.g_w, cfg.g_h, 1);
+      int decoded = 0;
+
+      for (int frame = 0; frame < 10; frame++) {
+        FillFrame(img, frame);
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_encode(&encoder, img, frame, 1, 0, VPX_DL_REALTIME));
+
+        vpx_codec_iter_t iter = nullptr;
+        const vpx_codec_cx_pkt_t* pkt;
+        std::vector<uint8_t> received;
+        int starts = 0;
+
+        while ((pkt = vpx_codec_get_cx_data(&encoder, &iter)) != nullptr) {
+          Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_vp8_rtp_add_packet(&packetizer, pkt));
+        }
+
+        const vpx_vp8_rtp_payload_t* payload;
+        while ((payload = vpx_vp8_rtp_get_payload(&packetizer)) != nullptr) {
+          // Build the datagram and strip it again as the receiver would.
+          std::vector<uint8_t> datagram(payload->descriptor, payload->descriptor + payload->descriptor_sz);
+          datagram.insert(datagram.end(), payload->data, payload->data + payload->data_sz);
+          Assert::AreEqual((size_t)payload->descriptor_sz, ParseDescriptor(datagram.data()));
+          Assert::IsTrue(datagram.size() <= 300);
+
+          if (datagram[0] & 0x10) starts++;
+          received.insert(received.end(), datagram.begin() + payload->descriptor_sz, datagram.end());
+        }
+
+        Assert::IsTrue(starts >= 1);
+        Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, received.data(), (unsigned int)received.size(), nullptr, 0));
+
+        vpx_codec_iter_t diter = nullptr;
+        while (vpx_codec_get_frame(&decoder, &diter) != nullptr) decoded++;
+      }
+
+      Assert::AreEqual(10, decoded);
+
+      vpx_img_free(img);
+      vpx_codec_destroy(&decoder);
+      vpx_codec_destroy(&encoder);
+    }
+  };
+}
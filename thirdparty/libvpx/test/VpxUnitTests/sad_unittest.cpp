@@ -0,0 +1,145 @@
+/******************************************************************************
+* Filename: sad_unittest.cpp
+*
+* Description:
+* Unit tests for the sum of absolute differences kernels in:
+*  - vpx_dsp/sad.c
+*  - vpx_dsp/x86/sad_sse2.c & vpx_dsp/x86/sad_avx2.c
+*
+* Each SIMD variant of the single, x3, x8 and x4d forms is checked against
+* the C reference for the VP8 block sizes, with unaligned pointers and
+* blocks at the extremes of the pixel range.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef unsigned int (*sad_fn_t)(const uint8_t* src_ptr, int src_stride, const uint8_t* ref_ptr, int ref_stride);
+  typedef void (*sad_multi_fn_t)(const uint8_t* src_ptr, int src_stride, const uint8_t* ref_ptr, int ref_stride, uint32_t* sad_array);
+  typedef void (*sad_4d_fn_t)(const uint8_t* src_ptr, int src_stride, const uint8_t* const ref_array[], int ref_stride, uint32_t* sad_array);
+
+  struct SadKernels
+  {
+    const char* name;
+    sad_fn_t sad[3];          // C, SSE2, AVX2.
+    sad_multi_fn_t x3[3];
+    sad_multi_fn_t x8[3];
+    sad_4d_fn_t x4d[3];
+  };
+
+#define SAD_KERNELS(w, h, sad, x3, x8, x4d)                                                   \
+  { #w "x" #h,                                                                                 \
+    { vpx_sad##w##x##h##_c, vpx_sad##w##x##h##_sse2, sad },                                    \
+    { vpx_sad##w##x##h##x3_c, vpx_sad##w##x##h##x3_sse2, x3 },                                 \
+    { vpx_sad##w##x##h##x8_c, vpx_sad##w##x##h##x8_sse2, x8 },                                 \
+    { vpx_sad##w##x##h##x4d_c, vpx_sad##w##x##h##x4d_sse2, x4d } }
+
+  // Only the 16 wide sizes have AVX2 kernels.
+  static const SadKernels _sadKernels[] = {
+    SAD_KERNELS(16, 16, vpx_sad16x16_avx2, vpx_sad16x16x3_avx2, vpx_sad16x16x8_avx2, vpx_sad16x16x4d_avx2),
+    SAD_KERNELS(16, 8, vpx_sad16x8_avx2, vpx_sad16x8x3_avx2, vpx_sad16x8x8_avx2, vpx_sad16x8x4d_avx2),
+    SAD_KERNELS(8, 16, nullptr, nullptr, nullptr, nullptr),
+    SAD_KERNELS(8, 8, nullptr, nullptr, nullptr, nullptr),
+    SAD_KERNELS(4, 4, nullptr, nullptr, nullptr, nullptr),
+  };
+
+  TEST_CLASS(sad_unittest)
+  {
+  public:
+
+    static const int Iterations = 1000;
+    static const int Stride = 64;
+    static const int Size = 40 * Stride;
+
+    static void Fill(uint8_t* pixels, int count, int iteration)
+    {
+      for (int i = 0; i < count; i++) {
+        switch (iteration & 3) {
+        case 0: pixels[i] = (uint8_t)(rand() & 0xff); break;
+        case 1: pixels[i] = (rand() & 1) ? 255 : 0; break;
+        case 2: pixels[i] = (uint8_t)(128 + (rand() & 7)); break;
+        default: pixels[i] = (uint8_t)(iteration & 4 ? 255 : 0); break;
+        }
+      }
+    }
+
+    /**
+    * Runs every kernel of one instruction set against C. The source and
+    * reference start at arbitrary offsets, as motion search uses them.
+    */
+    static void CheckIsa(int isa)
+    {
+      static uint8_t src[Size], ref[Size];
+
+      srand(isa);
+
+      for (auto& k : _sadKernels) {
+        if (!k.sad[isa]) continue;
+
+        for (int it = 0; it < Iterations; it++) {
+          const int srcOffset = rand() % 32 + (rand() % 8) * Stride;
+          const int refOffset = rand() % 32 + (rand() % 8) * Stride;
+          const uint8_t* s = src + srcOffset;
+          const uint8_t* r = ref + refOffset;
+          const uint8_t* const refs[4] = { r, r + 1 + rand() % 9, r + Stride * (1 + rand() % 3), r + 3 };
+          uint32_t expected[8], actual[8];
+
+          Fill(src, Size, it);
+          Fill(ref, Size, it + (it & 8 ? 4 : 0));
+
+          Check(k.sad[0](s, Stride, r, Stride) == k.sad[isa](s, Stride, r, Stride), std::string("sad ") + k.name, it);
+
+          k.x3[0](s, Stride, r, Stride, expected);
+          k.x3[isa](s, Stride, r, Stride, actual);
+          Check(memcmp(expected, actual, 3 * sizeof(uint32_t)) == 0, std::string("sadx3 ") + k.name, it);
+
+          k.x8[0](s, Stride, r, Stride, expected);
+          k.x8[isa](s, Stride, r, Stride, actual);
+          Check(memcmp(expected, actual, 8 * sizeof(uint32_t)) == 0, std::string("sadx8 ") + k.name, it);
+
+          k.x4d[0](s, Stride, refs, Stride, expected);
+          k.x4d[isa](s, Stride, refs, Stride, actual);
+          Check(memcmp(expected, actual, 4 * sizeof(uint32_t)) == 0, std::string("sadx4d ") + k.name, it);
+        }
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 SAD kernels for every VP8 block size.
+    /// </summary>
+    TEST_METHOD(SadSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckIsa(1);
+    }
+
+    /// <summary>
+    /// Tests the AVX2 SAD kernels for the 16 wide block sizes.
+    /// </summary>
+    TEST_METHOD(SadAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckIsa(2);
+    }
+
+  };
+}
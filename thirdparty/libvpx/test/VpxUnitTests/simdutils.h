@@ -0,0 +1,60 @@
+//-----------------------------------------------------------------------------
+// Filename: simdutils.h
+//
+// Description: Helpers shared by the tests that check the SIMD kernels
+// against their C reference.
+//
+// Author(s):
+// Aaron Clauson (aaron@sipsorcery.com)
+//
+// History:
+// 16 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+//
+// License:
+// BSD 3-Clause "New" or "Revised" License, see included LICENSE.md file.
+//-----------------------------------------------------------------------------
+
+#ifndef SIMDUTILS_H
+#define SIMDUTILS_H
+
+#include "CppUnitTest.h"
+
+#include <string>
+
+namespace
+{
+  /**
+  * Logs that a test is being skipped when the CPU lacks an instruction set.
+  * @param[in] hasIsa: whether the CPU supports the instruction set.
+  * @param[in] isa: the instruction set name for the log message.
+  * @return true if the test should be skipped.
+  */
+  bool Skip(bool hasIsa, const char* isa)
+  {
+    if (!hasIsa) {
+      Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(
+        (std::string(isa) + " not supported by this CPU, skipping.").c_str());
+    }
+    return !hasIsa;
+  }
+
+  /**
+  * Asserts a SIMD kernel's output matched the C reference.
+  * @param[in] ok: whether the outputs matched.
+  * @param[in] name: the kernel being checked.
+  * @param[in] where: the inputs that gave the mismatch, e.g. "iteration 3".
+  */
+  void Check(bool ok, const std::string& name, const std::string& where)
+  {
+    std::string msg = name + " mismatch at " + where;
+    std::wstring wmsg(msg.begin(), msg.end());
+    Microsoft::VisualStudio::CppUnitTestFramework::Assert::IsTrue(ok, wmsg.c_str());
+  }
+
+  void Check(bool ok, const std::string& name, int iteration)
+  {
+    Check(ok, name, "iteration " + std::to_string(iteration));
+  }
+}
+
+#endif // SIMDUTILS_H
@@ -0,0 +1,134 @@
+/******************************************************************************
+* Filename: subpixel_unittest.cpp
+*
+* Description:
+* Unit tests for the sub-pixel predictors in:
+*  - filter.c
+*  - x86/subpixel_sse2.c, x86/subpixel_ssse3.c & x86/subpixel_avx2.c
+*
+* Each SIMD variant is checked for bit-exact output against the C reference
+* for every sub-pixel offset.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vp8_rtcd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef void (*subpixel_fn_t)(unsigned char* src, int src_stride, int xoffset, int yoffset,
+    unsigned char* dst, int dst_pitch);
+
+  TEST_CLASS(subpixel_unittest)
+  {
+  public:
+
+    /// <summary>
+    /// Runs a predictor against its C reference for all 64 offset pairs over
+    /// random, saturated and gradient source blocks.
+    /// </summary>
+    static void CheckPredictor(subpixel_fn_t ref, subpixel_fn_t fn, int width, int height, bool isBilinear, const char* name)
+    {
+      const int srcStride = 64;
+      const int dstStride = 32;
+      unsigned char src[srcStride * 48];
+      unsigned char refDst[dstStride * 16];
+      unsigned char dst[dstStride * 16];
+
+      srand(1);
+
+      for (int pattern = 0; pattern < 3; pattern++)
+      {
+        for (int i = 0; i < (int)sizeof(src); i++)
+        {
+          src[i] = (pattern == 0) ? (unsigned char)(rand() & 0xff) :
+            (pattern == 1) ? ((rand() & 1) ? 255 : 0) : (unsigned char)(i * 7);
+        }
+
+        for (int xoffset = 0; xoffset < 8; xoffset++)
+        {
+          for (int yoffset = 0; yoffset < 8; yoffset++)
+          {
+            // A zero offset pair is a copy and not valid for the bilinear C functions.
+            if (isBilinear && xoffset == 0 && yoffset == 0) continue;
+
+            unsigned char* srcPtr = src + 8 * srcStride + 8;
+
+            memset(refDst, 0xaa, sizeof(refDst));
+            memset(dst, 0xaa, sizeof(dst));
+
+            ref(srcPtr, srcStride, xoffset, yoffset, refDst, dstStride);
+            fn(srcPtr, srcStride, xoffset, yoffset, dst, dstStride);
+
+            Check(memcmp(refDst, dst, sizeof(dst)) == 0, name, "offset " + std::to_string(xoffset) + "," + std::to_string(yoffset));
+          }
+        }
+      }
+    }
+
+    static void CheckAllSizes(subpixel_fn_t fns[8], bool hasIsa, const char* isa)
+    {
+      if (Skip(hasIsa, isa)) return;
+
+      CheckPredictor(vp8_sixtap_predict16x16_c, fns[0], 16, 16, false, "sixtap16x16");
+      CheckPredictor(vp8_sixtap_predict8x8_c, fns[1], 8, 8, false, "sixtap8x8");
+      CheckPredictor(vp8_sixtap_predict8x4_c, fns[2], 8, 4, false, "sixtap8x4");
+      CheckPredictor(vp8_sixtap_predict4x4_c, fns[3], 4, 4, false, "sixtap4x4");
+      CheckPredictor(vp8_bilinear_predict16x16_c, fns[4], 16, 16, true, "bilinear16x16");
+      CheckPredictor(vp8_bilinear_predict8x8_c, fns[5], 8, 8, true, "bilinear8x8");
+      CheckPredictor(vp8_bilinear_predict8x4_c, fns[6], 8, 4, true, "bilinear8x4");
+      CheckPredictor(vp8_bilinear_predict4x4_c, fns[7], 4, 4, true, "bilinear4x4");
+    }
+
+    /// <summary>
+    /// Tests the SSE2 predictors are bit-exact with the C versions.
+    /// </summary>
+    TEST_METHOD(SubpixelSse2Test)
+    {
+      subpixel_fn_t fns[8] = {
+        vp8_sixtap_predict16x16_sse2, vp8_sixtap_predict8x8_sse2, vp8_sixtap_predict8x4_sse2, vp8_sixtap_predict4x4_sse2,
+        vp8_bilinear_predict16x16_sse2, vp8_bilinear_predict8x8_sse2, vp8_bilinear_predict8x4_sse2, vp8_bilinear_predict4x4_sse2 };
+
+      CheckAllSizes(fns, (x86_simd_caps() & HAS_SSE2) != 0, "SSE2");
+    }
+
+    /// <summary>
+    /// Tests the SSSE3 predictors are bit-exact with the C versions.
+    /// </summary>
+    TEST_METHOD(SubpixelSsse3Test)
+    {
+      subpixel_fn_t fns[8] = {
+        vp8_sixtap_predict16x16_ssse3, vp8_sixtap_predict8x8_ssse3, vp8_sixtap_predict8x4_ssse3, vp8_sixtap_predict4x4_ssse3,
+        vp8_bilinear_predict16x16_ssse3, vp8_bilinear_predict8x8_ssse3, vp8_bilinear_predict8x4_ssse3, vp8_bilinear_predict4x4_ssse3 };
+
+      CheckAllSizes(fns, (x86_simd_caps() & HAS_SSSE3) != 0, "SSSE3");
+    }
+
+    /// <summary>
+    /// Tests the AVX2 predictor, only 16x16 bilinear has one, is bit-exact
+    /// with the C version.
+    /// </summary>
+    TEST_METHOD(SubpixelAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+
+      CheckPredictor(vp8_bilinear_predict16x16_c, vp8_bilinear_predict16x16_avx2, 16, 16, true, "bilinear16x16");
+    }
+  };
+}
@@ -18,6 +18,11 @@
 #include "CppUnitTest.h"
 #include "vp8/decoder/onyxd_int.h"
 #include "vp8/decoder/treereader.h"
+#include "vp8/common/entropymode.h"
+#include "vp8/encoder/treewriter.h"
+
+#include <cstdlib>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -39,5 +44,37 @@ namespace VpxUnitTests
 
 			Assert::AreEqual(1, bit);
 		}
+
+		/// <summary>
+		/// Tests that every leaf of the 4x4 intra mode tree written with the
+		/// encoder's tree writer reads back, at random node probabilities.
+		/// </summary>
+		TEST_METHOD(TreedReadTest)
+		{
+			const int kSymbols = 20000;
+			std::vector<uint8_t> buffer(kSymbols * 4);
+			vp8_prob probs[16][VP8_BINTRAMODES - 1];
+			vp8_writer bw;
+
+			srand(1);
+			for (auto& set : probs) {
+				for (auto& p : set) p = (vp8_prob)(1 + rand() % 255);
+			}
+
+			vp8_start_encode(&bw, buffer.data(), buffer.data() + buffer.size());
+			for (int i = 0; i < kSymbols; ++i) {
+				vp8_write_token(&bw, vp8_bmode_tree, probs[i & 15], &vp8_bmode_encodings[i % VP8_BINTRAMODES]);
+			}
+			vp8_stop_encode(&bw);
+
+			vp8_reader br;
+			vp8dx_start_decode(&br, buffer.data(), bw.pos, NULL, NULL);
+
+			for (int i = 0; i < kSymbols; ++i) {
+				Assert::AreEqual(i % VP8_BINTRAMODES, vp8_treed_read(&br, vp8_bmode_tree, probs[i & 15]));
+			}
+
+			Assert::AreEqual(0, vp8dx_bool_error(&br));
+		}
 	};
 }
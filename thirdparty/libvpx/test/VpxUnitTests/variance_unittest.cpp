@@ -0,0 +1,166 @@
+/******************************************************************************
+* Filename: variance_unittest.cpp
+*
+* Description:
+* Unit tests for the variance kernels in:
+*  - vpx_dsp/variance.c
+*  - vpx_dsp/x86/variance_sse2.c & vpx_dsp/x86/variance_avx2.c
+*
+* The variance, MSE and sub-pixel variance of each SIMD variant are checked
+* against the C reference for the VP8 block sizes, including every sub-pixel
+* offset pair.
+*
+* Author:
+* Aaron Clauson (aaron@sipsorcery.com)
+*
+* History:
+* 15 Oct 2026	Aaron Clauson	Created, Dublin, Ireland.
+*
+* License: Public Domain (no warranty, use at own risk)
+/******************************************************************************/
+
+#include "pch.h"
+#include "simdutils.h"
+#include "CppUnitTest.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx_ports/x86.h"
+
+#include <cstdlib>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VpxUnitTests
+{
+  typedef unsigned int (*variance_fn_t)(const uint8_t* src_ptr, int src_stride, const uint8_t* ref_ptr, int ref_stride, unsigned int* sse);
+  typedef unsigned int (*subpix_variance_fn_t)(const uint8_t* src_ptr, int src_stride, int x_offset, int y_offset, const uint8_t* ref_ptr, int ref_stride, unsigned int* sse);
+
+  struct VarianceKernels
+  {
+    const char* name;
+    variance_fn_t variance[3];    // C, SSE2, AVX2.
+    variance_fn_t mse[3];
+    subpix_variance_fn_t subpix[3];
+  };
+
+#define VARIANCE_KERNELS(w, h, mse_c, mse_sse2, var_avx2, mse_avx2, subpix_avx2)                 \
+  { #w "x" #h,                                                                                 \
+    { vpx_variance##w##x##h##_c, vpx_variance##w##x##h##_sse2, var_avx2 },                     \
+    { mse_c, mse_sse2, mse_avx2 },                                                             \
+    { vpx_sub_pixel_variance##w##x##h##_c, vpx_sub_pixel_variance##w##x##h##_sse2, subpix_avx2 } }
+
+  // There is no 4x4 MSE and only the 16 wide sizes have AVX2 kernels.
+  static const VarianceKernels _varianceKernels[] = {
+    VARIANCE_KERNELS(16, 16, vpx_mse16x16_c, vpx_mse16x16_sse2, vpx_variance16x16_avx2, vpx_mse16x16_avx2, vpx_sub_pixel_variance16x16_avx2),
+    VARIANCE_KERNELS(16, 8, vpx_mse16x8_c, vpx_mse16x8_sse2, vpx_variance16x8_avx2, nullptr, vpx_sub_pixel_variance16x8_avx2),
+    VARIANCE_KERNELS(8, 16, vpx_mse8x16_c, vpx_mse8x16_sse2, nullptr, nullptr, nullptr),
+    VARIANCE_KERNELS(8, 8, vpx_mse8x8_c, vpx_mse8x8_sse2, nullptr, nullptr, nullptr),
+    VARIANCE_KERNELS(4, 4, nullptr, nullptr, nullptr, nullptr, nullptr),
+  };
+
+  TEST_CLASS(variance_unittest)
+  {
+  public:
+
+    static const int Iterations = 200;
+    static const int Stride = 64;
+    static const int Size = 40 * Stride;
+
+    static void Fill(uint8_t* pixels, int count, int iteration)
+    {
+      for (int i = 0; i < count; i++) {
+        switch (iteration & 3) {
+        case 0: pixels[i] = (uint8_t)(rand() & 0xff); break;
+        case 1: pixels[i] = (rand() & 1) ? 255 : 0; break;
+        case 2: pixels[i] = (uint8_t)(128 + (rand() & 7)); break;
+        default: pixels[i] = (uint8_t)(iteration & 4 ? 255 : 0); break;
+        }
+      }
+    }
+
+    /**
+    * Runs every kernel of one instruction set against C. Both the returned
+    * value and the sse written out must match.
+    */
+    static void CheckIsa(int isa)
+    {
+      static uint8_t src[Size], ref[Size];
+
+      srand(isa);
+
+      for (auto& k : _varianceKernels) {
+        for (int it = 0; it < Iterations; it++) {
+          const uint8_t* s = src + rand() % 32 + (rand() % 8) * Stride;
+          const uint8_t* r = ref + rand() % 32 + (rand() % 8) * Stride;
+          unsigned int expectedSse, actualSse;
+
+          Fill(src, Size, it);
+          Fill(ref, Size, it + (it & 8 ? 4 : 0));
+
+          if (k.variance[isa]) {
+            const unsigned int expected = k.variance[0](s, Stride, r, Stride, &expectedSse);
+            const unsigned int actual = k.variance[isa](s, Stride, r, Stride, &actualSse);
+            Check(expected == actual && expectedSse == actualSse, std::string("variance ") + k.name, it);
+          }
+
+          if (k.mse[isa]) {
+            const unsigned int expected = k.mse[0](s, Stride, r, Stride, &expectedSse);
+            const unsigned int actual = k.mse[isa](s, Stride, r, Stride, &actualSse);
+            Check(expected == actual && expectedSse == actualSse, std::string("mse ") + k.name, it);
+          }
+
+          if (k.subpix[isa]) {
+            for (int xoffset = 0; xoffset < 8; xoffset++) {
+              for (int yoffset = 0; yoffset < 8; yoffset++) {
+                const unsigned int expected = k.subpix[0](s, Stride, xoffset, yoffset, r, Stride, &expectedSse);
+                const unsigned int actual = k.subpix[isa](s, Stride, xoffset, yoffset, r, Stride, &actualSse);
+                Check(expected == actual && expectedSse == actualSse, std::string("sub_pixel_variance ") + k.name, it);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /// <summary>
+    /// Tests the SSE2 variance kernels for every VP8 block size.
+    /// </summary>
+    TEST_METHOD(VarianceSse2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+      CheckIsa(1);
+    }
+
+    /// <summary>
+    /// Tests the AVX2 variance kernels for the 16 wide block sizes.
+    /// </summary>
+    TEST_METHOD(VarianceAvx2Test)
+    {
+      if (Skip((x86_simd_caps() & HAS_AVX2) != 0, "AVX2")) return;
+      CheckIsa(2);
+    }
+
+    /// <summary>
+    /// Tests the SSE2 4x4 sum of squared errors used by the split MV search.
+    /// </summary>
+    TEST_METHOD(Get4x4SseSse2Test)
+    {
+      static uint8_t src[Size], ref[Size];
+
+      if (Skip((x86_simd_caps() & HAS_SSE2) != 0, "SSE2")) return;
+
+      srand(3);
+
+      for (int it = 0; it < Iterations; it++) {
+        const uint8_t* s = src + rand() % 32 + (rand() % 8) * Stride;
+        const uint8_t* r = ref + rand() % 32 + (rand() % 8) * Stride;
+
+        Fill(src, Size, it);
+        Fill(ref, Size, it + (it & 8 ? 4 : 0));
+
+        Check(vpx_get4x4sse_cs_c(s, Stride, r, Stride) == vpx_get4x4sse_cs_sse2(s, Stride, r, Stride), "get4x4sse_cs 4x4", it);
+      }
+    }
+
+  };
+}
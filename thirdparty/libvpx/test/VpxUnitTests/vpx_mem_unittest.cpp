@@ -5,6 +5,7 @@
 * Unit tests for the logic in:
 *  - vpx_mem.c
 *  - vpx_mem.h
+*  - vpx_codec.c (vpx_codec_set_mem_allocator)
 *
 * Author:
 * Aaron Clauson (aaron@sipsorcery.com)
@@ -17,12 +18,68 @@
 
 #include "pch.h"
 #include "CppUnitTest.h"
+#include "strutils.h"
 #include "vpx_mem/vpx_mem.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace VpxUnitTests
 {
+	/// <summary>
+	/// An allocator that counts the blocks it hands out and gets back.
+	/// </summary>
+	struct CountingAllocator
+	{
+		vpx_mem_allocator_t allocator = { Alloc, Free, this };
+		int allocs = 0;
+		int frees = 0;
+		size_t bytes = 0;
+
+		static void* Alloc(void* priv, size_t size)
+		{
+			CountingAllocator* counter = (CountingAllocator*)priv;
+			counter->allocs++;
+			counter->bytes += size;
+			return malloc(size);
+		}
+
+		static void Free(void* priv, void* mem, size_t size)
+		{
+			CountingAllocator* counter = (CountingAllocator*)priv;
+			counter->frees++;
+			counter->bytes -= size;
+			free(mem);
+		}
+	};
+
+	/// <summary>
+	/// An allocator that fails one allocation, numbered from zero, and serves
+	/// the rest from malloc().
+	/// </summary>
+	struct FailingAllocator
+	{
+		vpx_mem_allocator_t allocator = { Alloc, Free, this };
+		int failAt = -1;
+		int allocs = 0;
+
+		static void* Alloc(void* priv, size_t size)
+		{
+			FailingAllocator* failing = (FailingAllocator*)priv;
+			return failing->allocs++ == failing->failAt ? nullptr : malloc(size);
+		}
+
+		static void Free(void* priv, void* mem, size_t size)
+		{
+			free(mem);
+		}
+	};
+
 	TEST_CLASS(vpx_mem_unittest)
 	{
 	public:
@@ -50,5 +107,131 @@ namespace VpxUnitTests
 
 			vpx_free(mem);
 		}
+
+		/// <summary>
+		/// Tests that the allocation counters track an allocation and its free.
+		/// </summary>
+		TEST_METHOD(VpxMemStatsTest)
+		{
+			vpx_mem_stats_t before, during, after;
+
+			vpx_mem_get_stats(&before);
+			void* mem = vpx_malloc(1000);
+			vpx_mem_get_stats(&during);
+			vpx_free(mem);
+			vpx_mem_get_stats(&after);
+
+			Assert::IsNotNull(mem);
+			Assert::AreEqual(before.allocs + 1, during.allocs);
+			Assert::IsTrue(during.bytes_in_use >= before.bytes_in_use + 1000);
+			Assert::IsTrue(during.peak_bytes_in_use >= during.bytes_in_use);
+			Assert::AreEqual(during.frees + 1, after.frees);
+			Assert::AreEqual(before.bytes_in_use, after.bytes_in_use);
+		}
+
+		/// <summary>
+		/// Tests that the pool hands a freed block to the next allocation of the
+		/// same size class and gives its blocks back to the heap once its limit
+		/// is lowered to zero.
+		/// </summary>
+		TEST_METHOD(VpxMemPoolReuseTest)
+		{
+			vpx_mem_stats_t before, after;
+
+			Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_mem_allocator(nullptr, vpx_mem_pool_allocator()));
+
+			void* first = vpx_malloc(100000);
+			vpx_free(first);
+			vpx_mem_get_stats(&before);
+			void* second = vpx_malloc(99000);
+			vpx_mem_get_stats(&after);
+			vpx_free(second);
+
+			Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_mem_allocator(nullptr, nullptr));
+
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(before.pool_hits + 1, after.pool_hits);
+			Assert::IsTrue(after.pool_cached_bytes < before.pool_cached_bytes);
+
+			vpx_mem_pool_set_limit(0);
+			vpx_mem_get_stats(&after);
+			vpx_mem_pool_set_limit(128 << 20);
+
+			Assert::AreEqual((size_t)0, after.pool_cached_bytes);
+		}
+
+		/// <summary>
+		/// Tests that a decoder allocates its frame buffers from the allocator set
+		/// on it and frees every block back to it when destroyed.
+		/// </summary>
+		TEST_METHOD(VpxMemInstanceAllocatorTest)
+		{
+			CountingAllocator counter;
+			vpx_codec_ctx_t decoder;
+
+			std::ifstream keyFrameStm("testpattern_keyframe.vp8");
+			std::string kfHex((std::istreambuf_iterator<char>(keyFrameStm)), std::istreambuf_iterator<char>());
+			std::vector<uint8_t> kfData = ParseHex(kfHex);
+
+			Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), NULL, 0));
+			Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_mem_allocator(&decoder, &counter.allocator));
+			Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, kfData.data(), (unsigned int)kfData.size(), nullptr, 0));
+
+			// Four 640x480 frame buffers at least.
+			Assert::IsTrue(counter.allocs > 0);
+			Assert::IsTrue(counter.bytes > 4 * 640 * 480 * 3 / 2);
+
+			vpx_codec_destroy(&decoder);
+
+			Assert::AreEqual(counter.allocs, counter.frees);
+			Assert::AreEqual((size_t)0, counter.bytes);
+		}
+
+		/// <summary>
+		/// Tests that a multithreaded decoder that runs out of memory part way
+		/// through its first frame decodes the frame when it is sent again, for
+		/// each allocation in turn failing.
+		/// </summary>
+		TEST_METHOD(VpxMemAllocFailureRetryTest)
+		{
+			vpx_codec_dec_cfg_t cfg = { 4, 0, 0 };
+			bool failed = true;
+
+			std::ifstream keyFrameStm("testpattern_keyframe.vp8");
+			std::string kfHex((std::istreambuf_iterator<char>(keyFrameStm)), std::istreambuf_iterator<char>());
+			std::vector<uint8_t> kfData = ParseHex(kfHex);
+
+			for (int failAt = 0; failed && failAt < 10000; failAt++) {
+				FailingAllocator failing;
+				vpx_codec_ctx_t decoder;
+
+				failing.failAt = failAt;
+
+				Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_dec_init(&decoder, vpx_codec_vp8_dx(), &cfg, 0));
+				Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_mem_allocator(&decoder, &failing.allocator));
+				failed = vpx_codec_decode(&decoder, kfData.data(), (unsigned int)kfData.size(), nullptr, 0) != VPX_CODEC_OK;
+
+				Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_set_mem_allocator(&decoder, nullptr));
+				Assert::AreEqual((int)VPX_CODEC_OK, (int)vpx_codec_decode(&decoder, kfData.data(), (unsigned int)kfData.size(), nullptr, 0));
+
+				vpx_codec_iter_t iter = nullptr;
+				Assert::IsNotNull(vpx_codec_get_frame(&decoder, &iter));
+
+				vpx_codec_destroy(&decoder);
+			}
+
+			Assert::IsFalse(failed);
+		}
+
+		/// <summary>
+		/// Tests that an allocator can't be set on an instance that isn't initialised.
+		/// </summary>
+		TEST_METHOD(VpxMemInstanceAllocatorUninitialisedTest)
+		{
+			CountingAllocator counter;
+			vpx_codec_ctx_t decoder = {};
+
+			Assert::AreEqual((int)VPX_CODEC_ERROR, (int)vpx_codec_set_mem_allocator(&decoder, &counter.allocator));
+		}
 	};
 }
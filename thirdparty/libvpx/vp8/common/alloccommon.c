@@ -46,9 +46,13 @@ void vp8_de_alloc_frame_buffers(VP8_COMMON *oci) {
 
   oci->above_context = NULL;
   oci->mip = NULL;
+  oci->mip_alloc_size = 0;
+  oci->above_context_alloc_cols = 0;
 }
 
 int vp8_alloc_frame_buffers(VP8_COMMON *oci, int width, int height) {
+  const int border =
+      oci->compact_buffers ? VP8_COMPACT_BORDER_IN_PIXELS : VP8BORDERINPIXELS;
   int i;
 
   vp8_de_alloc_frame_buffers(oci);
@@ -61,8 +65,27 @@ int vp8_alloc_frame_buffers(VP8_COMMON *oci, int width, int height) {
   for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
     oci->fb_idx_ref_cnt[i] = 0;
     oci->yv12_fb[i].flags = 0;
+    if (oci->external_buffers) {
+      /* Memory is attached per frame from the application's buffers. */
+      if (vp8_yv12_set_frame_geometry(&oci->yv12_fb[i], width, height,
+                                      border) < 0) {
+        goto allocation_fail;
+      }
+      continue;
+    }
+    if (i > 0 && oci->compact_buffers) {
+      /* Same geometry as the first buffer, but no memory yet. */
+      YV12_BUFFER_CONFIG *const ybf = &oci->yv12_fb[i];
+      *ybf = oci->yv12_fb[0];
+      ybf->buffer_alloc = NULL;
+      ybf->buffer_alloc_sz = 0;
+      ybf->y_buffer = NULL;
+      ybf->u_buffer = NULL;
+      ybf->v_buffer = NULL;
+      continue;
+    }
     if (vp8_yv12_alloc_frame_buffer(&oci->yv12_fb[i], width, height,
-                                    VP8BORDERINPIXELS) < 0) {
+                                    border) < 0) {
       goto allocation_fail;
     }
   }
@@ -77,7 +100,8 @@ int vp8_alloc_frame_buffers(VP8_COMMON *oci, int width, int height) {
   oci->fb_idx_ref_cnt[2] = 1;
   oci->fb_idx_ref_cnt[3] = 1;
 
-  if (vp8_yv12_alloc_frame_buffer(&oci->temp_scale_frame, width, 16,
+  if (!oci->compact_buffers && !oci->external_buffers &&
+      vp8_yv12_alloc_frame_buffer(&oci->temp_scale_frame, width, 16,
                                   VP8BORDERINPIXELS) < 0) {
     goto allocation_fail;
   }
@@ -91,6 +115,7 @@ int vp8_alloc_frame_buffers(VP8_COMMON *oci, int width, int height) {
 
   if (!oci->mip) goto allocation_fail;
 
+  oci->mip_alloc_size = (oci->mb_cols + 1) * (oci->mb_rows + 1);
   oci->mi = oci->mip + oci->mode_info_stride + 1;
 
   /* Allocation of previous mode info will be done in vp8_decode_frame()
@@ -101,6 +126,8 @@ int vp8_alloc_frame_buffers(VP8_COMMON *oci, int width, int height) {
 
   if (!oci->above_context) goto allocation_fail;
 
+  oci->above_context_alloc_cols = oci->mb_cols;
+
 #if CONFIG_POSTPROC
   if (vp8_yv12_alloc_frame_buffer(&oci->post_proc_buffer, width, height,
                                   VP8BORDERINPIXELS) < 0) {
@@ -127,6 +154,156 @@ allocation_fail:
   return 1;
 }
 
+/* Re-carves a frame buffer for the new size in its own memory, allocating
+ * it again only if the memory is too small.
+ */
+static int resize_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width, int height,
+                               int border) {
+  if (vp8_yv12_realloc_frame_buffer(ybf, width, height, border) == 0) {
+    return 0;
+  }
+  return vp8_yv12_alloc_frame_buffer(ybf, width, height, border);
+}
+
+/* Decoder only. Like vp8_alloc_frame_buffers(), but keeps the memory of the
+ * frame buffers and MODE_INFO and context arrays when the new size fits in
+ * it, so switching between sizes already seen does not touch the heap. The
+ * MODE_INFO arrays are cleared as if newly allocated, the frame buffers are
+ * not.
+ */
+int vp8_resize_frame_buffers(VP8_COMMON *oci, int width, int height) {
+  const int border =
+      oci->compact_buffers ? VP8_COMPACT_BORDER_IN_PIXELS : VP8BORDERINPIXELS;
+  int mip_size;
+  int first = -1;
+  int i;
+
+  /* Only buffers with memory of their own can be kept. Application frame
+   * buffers are attached per frame, so none is needed with those.
+   */
+  for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
+    if (oci->yv12_fb[i].buffer_alloc_sz > 0) {
+      first = i;
+      break;
+    }
+  }
+  if (!oci->mip || !oci->above_context ||
+      (first < 0 && !oci->external_buffers)) {
+    return vp8_alloc_frame_buffers(oci, width, height);
+  }
+
+  /* our internal buffers are always multiples of 16 */
+  if ((width & 0xf) != 0) width += 16 - (width & 0xf);
+
+  if ((height & 0xf) != 0) height += 16 - (height & 0xf);
+
+  for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
+    oci->fb_idx_ref_cnt[i] = 0;
+    oci->yv12_fb[i].flags = 0;
+    if (oci->external_buffers) {
+      if (vp8_yv12_set_frame_geometry(&oci->yv12_fb[i], width, height,
+                                      border) < 0) {
+        goto allocation_fail;
+      }
+    } else if (oci->yv12_fb[i].buffer_alloc_sz > 0 &&
+               resize_frame_buffer(&oci->yv12_fb[i], width, height, border) <
+                   0) {
+      goto allocation_fail;
+    }
+  }
+
+  /* Compact buffers not yet decoded into take the geometry of the first. */
+  for (i = 0; first >= 0 && i < NUM_YV12_BUFFERS; ++i) {
+    YV12_BUFFER_CONFIG *const ybf = &oci->yv12_fb[i];
+    if (ybf->buffer_alloc_sz == 0) {
+      *ybf = oci->yv12_fb[first];
+      ybf->buffer_alloc = NULL;
+      ybf->buffer_alloc_sz = 0;
+      ybf->y_buffer = NULL;
+      ybf->u_buffer = NULL;
+      ybf->v_buffer = NULL;
+    }
+  }
+
+  oci->new_fb_idx = 0;
+  oci->lst_fb_idx = 1;
+  oci->gld_fb_idx = 2;
+  oci->alt_fb_idx = 3;
+
+  oci->fb_idx_ref_cnt[0] = 1;
+  oci->fb_idx_ref_cnt[1] = 1;
+  oci->fb_idx_ref_cnt[2] = 1;
+  oci->fb_idx_ref_cnt[3] = 1;
+
+  if (!oci->compact_buffers && !oci->external_buffers &&
+      resize_frame_buffer(&oci->temp_scale_frame, width, 16,
+                          VP8BORDERINPIXELS) < 0) {
+    goto allocation_fail;
+  }
+
+  oci->mb_rows = height >> 4;
+  oci->mb_cols = width >> 4;
+  oci->MBs = oci->mb_rows * oci->mb_cols;
+  oci->mode_info_stride = oci->mb_cols + 1;
+  mip_size = (oci->mb_cols + 1) * (oci->mb_rows + 1);
+
+  if (mip_size > oci->mip_alloc_size) {
+    vpx_free(oci->mip);
+    oci->mip_alloc_size = 0;
+    oci->mip = vpx_calloc(mip_size, sizeof(MODE_INFO));
+    if (!oci->mip) goto allocation_fail;
+    oci->mip_alloc_size = mip_size;
+#if CONFIG_ERROR_CONCEALMENT
+    /* Allocated again at the new size by the decoder. */
+    vpx_free(oci->prev_mip);
+    oci->prev_mip = NULL;
+#endif
+  } else {
+    memset(oci->mip, 0, sizeof(MODE_INFO) * mip_size);
+  }
+
+  oci->mi = oci->mip + oci->mode_info_stride + 1;
+
+  if (oci->mb_cols > oci->above_context_alloc_cols) {
+    vpx_free(oci->above_context);
+    oci->above_context_alloc_cols = 0;
+    oci->above_context =
+        vpx_calloc(sizeof(ENTROPY_CONTEXT_PLANES) * oci->mb_cols, 1);
+    if (!oci->above_context) goto allocation_fail;
+    oci->above_context_alloc_cols = oci->mb_cols;
+#if CONFIG_POSTPROC
+    vpx_free(oci->pp_limits_buffer);
+    oci->pp_limits_buffer = vpx_memalign(16, 24 * ((oci->mb_cols + 1) & ~1));
+    if (!oci->pp_limits_buffer) goto allocation_fail;
+#endif
+  } else {
+    memset(oci->above_context, 0,
+           sizeof(ENTROPY_CONTEXT_PLANES) * oci->mb_cols);
+  }
+
+#if CONFIG_POSTPROC
+  if (resize_frame_buffer(&oci->post_proc_buffer, width, height,
+                          VP8BORDERINPIXELS) < 0) {
+    goto allocation_fail;
+  }
+
+  if (oci->post_proc_buffer_int_used) {
+    vp8_yv12_de_alloc_frame_buffer(&oci->post_proc_buffer_int);
+  }
+  oci->post_proc_buffer_int_used = 0;
+  vpx_free(oci->postproc_state.generated_noise);
+  memset(&oci->postproc_state, 0, sizeof(oci->postproc_state));
+  memset(oci->post_proc_buffer.buffer_alloc, 128,
+         oci->post_proc_buffer.frame_size);
+#endif
+
+  return 0;
+
+allocation_fail:
+  vp8_de_alloc_frame_buffers(oci);
+  return 1;
+}
+
 void vp8_setup_version(VP8_COMMON *cm) {
   switch (cm->version) {
     case 0:
@@ -10,6 +10,9 @@
 
 #include "vpx_config.h"
 #include "vp8_rtcd.h"
+#include "vpx_dsp_rtcd.h"
+#include "vpx_scale_rtcd.h"
+#include "vpx/vp8.h"
 #if VPX_ARCH_ARM
 #include "vpx_ports/arm.h"
 #elif VPX_ARCH_X86 || VPX_ARCH_X86_64
@@ -93,7 +96,7 @@ void vp8_machine_specific_config(VP8_COMMON *ctx) {
 #if VPX_ARCH_ARM
   ctx->cpu_caps = arm_cpu_caps();
 #elif VPX_ARCH_X86 || VPX_ARCH_X86_64
-  ctx->cpu_caps = x86_simd_caps();
+  ctx->cpu_caps = x86_rtcd_simd_caps();
 #elif VPX_ARCH_PPC
   ctx->cpu_caps = ppc_simd_caps();
 #else
@@ -101,3 +104,35 @@ void vp8_machine_specific_config(VP8_COMMON *ctx) {
   ctx->cpu_caps = 0;
 #endif
 }
+
+int vp8_set_simd_caps_mask(unsigned int mask) {
+#if VPX_ARCH_X86 || VPX_ARCH_X86_64
+  if (x86_set_simd_caps_mask(mask)) return -1;
+#else
+  (void)mask;
+#endif
+  vp8_rtcd();
+  vpx_dsp_rtcd();
+  vpx_scale_rtcd();
+
+#if VPX_ARCH_X86 || VPX_ARCH_X86_64
+  return x86_rtcd_simd_caps();
+#else
+  return 0;
+#endif
+}
+
+int vp8_get_rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots) {
+  int n = 0;
+  int used;
+
+  if (!slots) max_slots = 0;
+
+  n += vp8_rtcd_slots(slots, max_slots);
+  used = n < max_slots ? n : max_slots;
+  n += vpx_dsp_rtcd_slots(slots + used, max_slots - used);
+  used = n < max_slots ? n : max_slots;
+  n += vpx_scale_rtcd_slots(slots + used, max_slots - used);
+
+  return n;
+}
@@ -35,6 +35,11 @@ extern "C" {
 
 #define NUM_YV12_BUFFERS 4
 
+/* Frame buffer border with compact_buffers. Predictions that would read
+ * further out than it are built from a copy with the edges repeated.
+ */
+#define VP8_COMPACT_BORDER_IN_PIXELS 16
+
 #define MAX_PARTITIONS 9
 
 typedef struct frame_contexts {
@@ -79,6 +84,18 @@ typedef struct VP8Common {
   int fb_idx_ref_cnt[NUM_YV12_BUFFERS];
   int new_fb_idx, lst_fb_idx, gld_fb_idx, alt_fb_idx;
 
+  /* Decoder only. vp8_alloc_frame_buffers() then gives the buffers a
+   * narrow border and only the first one memory, the others get theirs
+   * when first decoded into. temp_scale_frame is not allocated.
+   */
+  int compact_buffers;
+
+  /* Decoder only. The frame buffers are backed by the application's frame
+   * buffer callbacks, so vp8_alloc_frame_buffers() only sets their geometry
+   * and temp_scale_frame is not allocated.
+   */
+  int external_buffers;
+
   YV12_BUFFER_CONFIG temp_scale_frame;
 
 #if CONFIG_POSTPROC
@@ -119,6 +136,11 @@ typedef struct VP8Common {
 
   MODE_INFO *mip; /* Base of allocated array */
   MODE_INFO *mi;  /* Corresponds to upper left visible macroblock */
+  /* Entries allocated in mip (and prev_mip), and in above_context. A size
+   * change that needs no more re-carves them in place.
+   */
+  int mip_alloc_size;
+  int above_context_alloc_cols;
 #if CONFIG_ERROR_CONCEALMENT
   MODE_INFO *prev_mip; /* MODE_INFO array 'mip' from last decoded frame */
   MODE_INFO *prev_mi;  /* 'mi' from last frame (points into prev_mip) */
@@ -19,7 +19,9 @@ extern "C" {
 #include "ppflags.h"
 #include "vpx_ports/mem.h"
 #include "vpx/vpx_codec.h"
+#include "vpx/vpx_frame_buffer.h"
 #include "vpx/vp8.h"
+#include "vpx/vp8dx.h"
 
 struct VP8D_COMP;
 struct VP8Common;
@@ -31,6 +33,7 @@ typedef struct {
   int postprocess;
   int max_threads;
   int error_concealment;
+  int compact_buffers;
 } VP8D_CONFIG;
 
 typedef enum { VP8D_OK = 0 } VP8D_SETTING;
@@ -42,6 +45,18 @@ void vp8dx_set_setting(struct VP8D_COMP *comp, VP8D_SETTING oxst, int x);
 int vp8dx_get_setting(struct VP8D_COMP *comp, VP8D_SETTING oxst);
 
 int vp8dx_receive_compressed_data(struct VP8D_COMP *pbi, int64_t time_stamp);
+/* Decodes a frame as its data arrives. data holds the frame so far and final
+ * is set once it is all there. MB rows are decoded as soon as their tokens
+ * have come, and the frame is kept and shown on the final call.
+ */
+int vp8dx_receive_partial_data(struct VP8D_COMP *pbi, const unsigned char *data,
+                               unsigned int data_sz, int final,
+                               int64_t time_stamp);
+/* Called when the data of a partial frame has been moved from one buffer to
+ * another.
+ */
+void vp8dx_move_partial_data(struct VP8D_COMP *pbi, const unsigned char *from,
+                             const unsigned char *to);
 int vp8dx_get_raw_frame(struct VP8D_COMP *pbi, YV12_BUFFER_CONFIG *sd,
                         int64_t *time_stamp, int64_t *time_end_stamp,
                         vp8_ppflags_t *flags);
@@ -55,6 +70,17 @@ vpx_codec_err_t vp8dx_set_reference(struct VP8D_COMP *pbi,
                                     YV12_BUFFER_CONFIG *sd);
 int vp8dx_get_quantizer(const struct VP8D_COMP *pbi);
 
+/* Adds the memory held by the decoder instance to usage, see
+ * VP8D_GET_MEMORY_USAGE.
+ */
+void vp8dx_get_memory_usage(const struct VP8D_COMP *pbi,
+                            vp8d_memory_usage *usage);
+
+/* Hands every external frame buffer the decoder holds back to the
+ * application. Called before the frame buffers are reallocated or freed.
+ */
+void vp8dx_release_frame_buffers(struct VP8D_COMP *pbi);
+
 #ifdef __cplusplus
 }
 #endif
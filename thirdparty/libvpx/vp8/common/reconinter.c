@@ -16,6 +16,7 @@
 #include "vpx/vpx_integer.h"
 #include "blockd.h"
 #include "reconinter.h"
+#include "vpx_dsp/vpx_dsp_common.h"
 #if CONFIG_RUNTIME_CPU_DETECT
 #include "onyxc_int.h"
 #endif
@@ -79,12 +80,87 @@ void vp8_build_inter_predictors_b(BLOCKD *d, int pitch, unsigned char *base_pre,
   }
 }
 
+/* Frame buffers allocated with a border narrower than VP8BORDERINPIXELS,
+ * see compact_buffers in VP8_COMMON, hold less than the MV clamping below
+ * lets a prediction read. A block that would read past the border is
+ * predicted from a copy of the pixels it reads, with the plane's edge
+ * pixels repeated outwards as the border would have held them.
+ */
+#define EDGE_BUF_STRIDE 32
+#define EDGE_BUF_SIZE (EDGE_BUF_STRIDE * 21)
+
+/* The SIMD filters load a few bytes past the last pixel they use, which
+ * must not run off the end of the V plane.
+ */
+#define EDGE_OVERREAD 8
+
+/* Returns where to predict the w x h block at (col, row) of the MB, in the
+ * plane's pixels, from: ptr, or the copy in buf with *stride changed to
+ * match.
+ */
+static unsigned char *edge_ptr(const MACROBLOCKD *x, int uv, int col,
+                               int row, const MV *mv, int w, int h,
+                               unsigned char *ptr, int *stride,
+                               unsigned char *buf) {
+  const int border = uv ? x->pre.border >> 1 : x->pre.border;
+  const int width = uv ? x->pre.uv_width : x->pre.y_width;
+  const int height = uv ? x->pre.uv_height : x->pre.y_height;
+  /* The 6-tap filters read 2 pixels before the block and 3 after it. */
+  const int taps = ((mv->col | mv->row) & 7) ? 1 : 0;
+  const unsigned char *origin;
+  int left, top, r, c;
+
+  if (x->pre.border >= VP8BORDERINPIXELS) return ptr;
+
+  col += (-x->mb_to_left_edge >> (uv ? 4 : 3)) + (mv->col >> 3);
+  row += (-x->mb_to_top_edge >> (uv ? 4 : 3)) + (mv->row >> 3);
+  left = col - 2 * taps;
+  top = row - 2 * taps;
+
+  if (left >= -border && top >= -border &&
+      col + w + 3 * taps + EDGE_OVERREAD <= width + border &&
+      row + h + 3 * taps <= height + border) {
+    return ptr;
+  }
+
+  origin = ptr - row * *stride - col;
+  for (r = 0; r < h + 5 * taps; ++r) {
+    const unsigned char *src =
+        origin + clamp(top + r, 0, height - 1) * *stride;
+    for (c = 0; c < w + 5 * taps; ++c) {
+      buf[r * EDGE_BUF_STRIDE + c] = src[clamp(left + c, 0, width - 1)];
+    }
+  }
+
+  *stride = EDGE_BUF_STRIDE;
+  return buf + 2 * taps * EDGE_BUF_STRIDE + 2 * taps;
+}
+
+/* The position of block b in its MB, in the pixels of its plane. */
+static void block_position(const MACROBLOCKD *x, const BLOCKD *d, int *col,
+                           int *row) {
+  const int b = (int)(d - x->block);
+
+  if (b < 16) {
+    *col = (b & 3) * 4;
+    *row = (b >> 2) * 4;
+  } else {
+    *col = (b & 1) * 4;
+    *row = ((b >> 1) & 1) * 4;
+  }
+}
+
 static void build_inter_predictors4b(MACROBLOCKD *x, BLOCKD *d,
                                      unsigned char *dst, int dst_stride,
                                      unsigned char *base_pre, int pre_stride) {
+  unsigned char buf[EDGE_BUF_SIZE];
   unsigned char *ptr;
+  int col, row;
   ptr = base_pre + d->offset + (d->bmi.mv.as_mv.row >> 3) * pre_stride +
         (d->bmi.mv.as_mv.col >> 3);
+  block_position(x, d, &col, &row);
+  ptr = edge_ptr(x, 0, col, row, &d->bmi.mv.as_mv, 8, 8, ptr, &pre_stride,
+                 buf);
 
   if (d->bmi.mv.as_mv.row & 7 || d->bmi.mv.as_mv.col & 7) {
     x->subpixel_predict8x8(ptr, pre_stride, d->bmi.mv.as_mv.col & 7,
@@ -97,9 +173,14 @@ static void build_inter_predictors4b(MACROBLOCKD *x, BLOCKD *d,
 static void build_inter_predictors2b(MACROBLOCKD *x, BLOCKD *d,
                                      unsigned char *dst, int dst_stride,
                                      unsigned char *base_pre, int pre_stride) {
+  unsigned char buf[EDGE_BUF_SIZE];
   unsigned char *ptr;
+  int col, row;
   ptr = base_pre + d->offset + (d->bmi.mv.as_mv.row >> 3) * pre_stride +
         (d->bmi.mv.as_mv.col >> 3);
+  block_position(x, d, &col, &row);
+  ptr = edge_ptr(x, d >= &x->block[16], col, row, &d->bmi.mv.as_mv, 8, 4, ptr,
+                 &pre_stride, buf);
 
   if (d->bmi.mv.as_mv.row & 7 || d->bmi.mv.as_mv.col & 7) {
     x->subpixel_predict8x4(ptr, pre_stride, d->bmi.mv.as_mv.col & 7,
@@ -109,13 +190,18 @@ static void build_inter_predictors2b(MACROBLOCKD *x, BLOCKD *d,
   }
 }
 
-static void build_inter_predictors_b(BLOCKD *d, unsigned char *dst,
-                                     int dst_stride, unsigned char *base_pre,
-                                     int pre_stride, vp8_subpix_fn_t sppf) {
-  int r;
+static void build_inter_predictors_b(MACROBLOCKD *x, BLOCKD *d,
+                                     unsigned char *dst, int dst_stride,
+                                     unsigned char *base_pre, int pre_stride,
+                                     vp8_subpix_fn_t sppf) {
+  unsigned char buf[EDGE_BUF_SIZE];
+  int r, col, row;
   unsigned char *ptr;
   ptr = base_pre + d->offset + (d->bmi.mv.as_mv.row >> 3) * pre_stride +
         (d->bmi.mv.as_mv.col >> 3);
+  block_position(x, d, &col, &row);
+  ptr = edge_ptr(x, d >= &x->block[16], col, row, &d->bmi.mv.as_mv, 4, 4, ptr,
+                 &pre_stride, buf);
 
   if (d->bmi.mv.as_mv.row & 7 || d->bmi.mv.as_mv.col & 7) {
     sppf(ptr, pre_stride, d->bmi.mv.as_mv.col & 7, d->bmi.mv.as_mv.row & 7, dst,
@@ -301,11 +387,13 @@ void vp8_build_inter16x16_predictors_mb(MACROBLOCKD *x, unsigned char *dst_y,
   int offset;
   unsigned char *ptr;
   unsigned char *uptr, *vptr;
+  unsigned char buf[EDGE_BUF_SIZE], vbuf[EDGE_BUF_SIZE];
 
   int_mv _16x16mv;
 
   unsigned char *ptr_base = x->pre.y_buffer;
   int pre_stride = x->pre.y_stride;
+  int stride = pre_stride;
 
   _16x16mv.as_int = x->mode_info_context->mbmi.mv.as_int;
 
@@ -315,12 +403,13 @@ void vp8_build_inter16x16_predictors_mb(MACROBLOCKD *x, unsigned char *dst_y,
 
   ptr = ptr_base + (_16x16mv.as_mv.row >> 3) * pre_stride +
         (_16x16mv.as_mv.col >> 3);
+  ptr = edge_ptr(x, 0, 0, 0, &_16x16mv.as_mv, 16, 16, ptr, &stride, buf);
 
   if (_16x16mv.as_int & 0x00070007) {
-    x->subpixel_predict16x16(ptr, pre_stride, _16x16mv.as_mv.col & 7,
+    x->subpixel_predict16x16(ptr, stride, _16x16mv.as_mv.col & 7,
                              _16x16mv.as_mv.row & 7, dst_y, dst_ystride);
   } else {
-    vp8_copy_mem16x16(ptr, pre_stride, dst_y, dst_ystride);
+    vp8_copy_mem16x16(ptr, stride, dst_y, dst_ystride);
   }
 
   /* calc uv motion vectors */
@@ -345,6 +434,11 @@ void vp8_build_inter16x16_predictors_mb(MACROBLOCKD *x, unsigned char *dst_y,
   uptr = x->pre.u_buffer + offset;
   vptr = x->pre.v_buffer + offset;
 
+  /* Both chroma planes read the same area, so both or neither are copied. */
+  stride = pre_stride;
+  uptr = edge_ptr(x, 1, 0, 0, &_16x16mv.as_mv, 8, 8, uptr, &stride, buf);
+  vptr = edge_ptr(x, 1, 0, 0, &_16x16mv.as_mv, 8, 8, vptr, &pre_stride, vbuf);
+
   if (_16x16mv.as_int & 0x00070007) {
     x->subpixel_predict8x8(uptr, pre_stride, _16x16mv.as_mv.col & 7,
                            _16x16mv.as_mv.row & 7, dst_u, dst_uvstride);
@@ -405,9 +499,9 @@ static void build_inter4x4_predictors_mb(MACROBLOCKD *x) {
         build_inter_predictors2b(x, d0, base_dst + d0->offset, dst_stride,
                                  base_pre, dst_stride);
       } else {
-        build_inter_predictors_b(d0, base_dst + d0->offset, dst_stride,
+        build_inter_predictors_b(x, d0, base_dst + d0->offset, dst_stride,
                                  base_pre, dst_stride, x->subpixel_predict);
-        build_inter_predictors_b(d1, base_dst + d1->offset, dst_stride,
+        build_inter_predictors_b(x, d1, base_dst + d1->offset, dst_stride,
                                  base_pre, dst_stride, x->subpixel_predict);
       }
     }
@@ -425,10 +519,10 @@ static void build_inter4x4_predictors_mb(MACROBLOCKD *x) {
       build_inter_predictors2b(x, d0, base_dst + d0->offset, dst_stride,
                                base_pre, dst_stride);
     } else {
-      build_inter_predictors_b(d0, base_dst + d0->offset, dst_stride, base_pre,
-                               dst_stride, x->subpixel_predict);
-      build_inter_predictors_b(d1, base_dst + d1->offset, dst_stride, base_pre,
-                               dst_stride, x->subpixel_predict);
+      build_inter_predictors_b(x, d0, base_dst + d0->offset, dst_stride,
+                               base_pre, dst_stride, x->subpixel_predict);
+      build_inter_predictors_b(x, d1, base_dst + d1->offset, dst_stride,
+                               base_pre, dst_stride, x->subpixel_predict);
     }
   }
 
@@ -445,10 +539,10 @@ static void build_inter4x4_predictors_mb(MACROBLOCKD *x) {
       build_inter_predictors2b(x, d0, base_dst + d0->offset, dst_stride,
                                base_pre, dst_stride);
     } else {
-      build_inter_predictors_b(d0, base_dst + d0->offset, dst_stride, base_pre,
-                               dst_stride, x->subpixel_predict);
-      build_inter_predictors_b(d1, base_dst + d1->offset, dst_stride, base_pre,
-                               dst_stride, x->subpixel_predict);
+      build_inter_predictors_b(x, d0, base_dst + d0->offset, dst_stride,
+                               base_pre, dst_stride, x->subpixel_predict);
+      build_inter_predictors_b(x, d1, base_dst + d1->offset, dst_stride,
+                               base_pre, dst_stride, x->subpixel_predict);
     }
   }
 }
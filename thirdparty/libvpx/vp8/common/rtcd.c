@@ -7,10 +7,14 @@
  *  in the file PATENTS.  All contributing project authors may
  *  be found in the AUTHORS file in the root of the source tree.
  */
-//#include "./vpx_config.h"
-//#define RTCD_C
-//#include "./vp8_rtcd.h"
-//#include "vpx_ports/vpx_once.h"
-//
-//void vp8_rtcd() { once(setup_rtcd_internal); }
-void vp8_rtcd() {}
+#include "./vpx_config.h"
+#define RTCD_C
+#include "./vp8_rtcd.h"
+#include "vpx_ports/vpx_once.h"
+
+void vp8_rtcd() { once(setup_rtcd_internal); }
+
+int vp8_rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots) {
+  vp8_rtcd();
+  return rtcd_slots(slots, max_slots);
+}
@@ -18,8 +18,14 @@ extern "C" {
 #endif
 
 struct VP8Common;
+struct vpx_rtcd_slot;
 void vp8_machine_specific_config(struct VP8Common *);
 
+/* Back vpx_codec_set_simd_caps_mask and vpx_codec_get_rtcd_slots, covering
+ * the vp8, vpx_dsp and vpx_scale RTCD tables. */
+int vp8_set_simd_caps_mask(unsigned int mask);
+int vp8_get_rtcd_slots(struct vpx_rtcd_slot *slots, int max_slots);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
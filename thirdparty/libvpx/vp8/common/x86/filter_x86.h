@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2011 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VP8_COMMON_X86_FILTER_X86_H_
+#define VPX_VP8_COMMON_X86_FILTER_X86_H_
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "vpx_ports/mem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The x86 sub-pixel predictors operate on groups of 16 pixels: one row of a
+ * 16 wide block, two rows of an 8 wide block or four rows of a 4 wide block.
+ * |rows| is the number of block rows still available in the group. Rows past
+ * it are never read or written, so the SIMD kernels touch exactly the same
+ * pixels as the C reference in vp8/common/filter.c.
+ */
+static INLINE __m128i vp8_load_group_x86(const unsigned char *src, int stride,
+                                         int width, int rows) {
+  if (width == 16) {
+    return _mm_loadu_si128((const __m128i *)src);
+  } else if (width == 8) {
+    const __m128i r0 = _mm_loadl_epi64((const __m128i *)src);
+    const __m128i r1 =
+        rows > 1 ? _mm_loadl_epi64((const __m128i *)(src + stride)) : r0;
+    return _mm_unpacklo_epi64(r0, r1);
+  } else {
+    int r[4];
+
+    memcpy(&r[0], src, 4);
+    memcpy(&r[1], src + (rows > 1 ? stride : 0), 4);
+    memcpy(&r[2], src + (rows > 2 ? 2 * stride : 0), 4);
+    memcpy(&r[3], src + (rows > 3 ? 3 * stride : 0), 4);
+    return _mm_setr_epi32(r[0], r[1], r[2], r[3]);
+  }
+}
+
+static INLINE void vp8_store_group_x86(unsigned char *dst, int stride,
+                                       int width, int rows, __m128i v) {
+  if (width == 16) {
+    _mm_storeu_si128((__m128i *)dst, v);
+  } else if (width == 8) {
+    _mm_storel_epi64((__m128i *)dst, v);
+    if (rows > 1) {
+      _mm_storel_epi64((__m128i *)(dst + stride), _mm_srli_si128(v, 8));
+    }
+  } else {
+    int i;
+
+    for (i = 0; i < 4 && i < rows; ++i) {
+      const int r = _mm_cvtsi128_si32(v);
+      memcpy(dst + i * stride, &r, 4);
+      v = _mm_srli_si128(v, 4);
+    }
+  }
+}
+
+/* Both sub-pixel offsets zero is a plain copy. The reconstruction code never
+ * calls the predictors that way but the C versions tolerate it, so do we.
+ */
+static INLINE void vp8_copy_block_x86(const unsigned char *src, int src_stride,
+                                      unsigned char *dst, int dst_stride,
+                                      int width, int height) {
+  int r;
+
+  for (r = 0; r < height; ++r) {
+    memcpy(dst, src, width);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VP8_COMMON_X86_FILTER_X86_H_
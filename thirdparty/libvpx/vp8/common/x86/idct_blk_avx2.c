@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/x86/idct_x86.h"
+#include "vpx_ports/mem.h"
+
+/* The AVX2 kernels reconstruct four blocks at a time, a pair in each 128-bit
+ * lane laid out as in idct_x86.h. The low lane's pair is written to dst_lo
+ * and the high lane's to dst_hi. Everything below stays within a lane.
+ */
+static INLINE __m256i load_block_avx2(const short *q, __m256i dq,
+                                      int dc_only) {
+  const __m256i v = _mm256_loadu_si256((const __m256i *)q);
+
+  if (dc_only) {
+    return _mm256_mullo_epi16(
+        _mm256_and_si256(v, _mm256_setr_epi16(-1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 0, 0, 0, 0, 0)),
+        dq);
+  }
+  return _mm256_mullo_epi16(v, dq);
+}
+
+static INLINE void transpose_4x4_quad_avx2(__m256i *x) {
+  const __m256i t0 = _mm256_unpacklo_epi16(x[0], x[1]);
+  const __m256i t1 = _mm256_unpackhi_epi16(x[0], x[1]);
+  const __m256i t2 = _mm256_unpacklo_epi16(x[2], x[3]);
+  const __m256i t3 = _mm256_unpackhi_epi16(x[2], x[3]);
+  const __m256i u0 = _mm256_unpacklo_epi32(t0, t2);
+  const __m256i u1 = _mm256_unpackhi_epi32(t0, t2);
+  const __m256i u2 = _mm256_unpacklo_epi32(t1, t3);
+  const __m256i u3 = _mm256_unpackhi_epi32(t1, t3);
+
+  x[0] = _mm256_unpacklo_epi64(u0, u2);
+  x[1] = _mm256_unpackhi_epi64(u0, u2);
+  x[2] = _mm256_unpacklo_epi64(u1, u3);
+  x[3] = _mm256_unpackhi_epi64(u1, u3);
+}
+
+static INLINE __m256i widen_lo_avx2(__m256i x) {
+  return _mm256_srai_epi32(_mm256_unpacklo_epi16(x, x), 16);
+}
+
+static INLINE __m256i widen_hi_avx2(__m256i x) {
+  return _mm256_srai_epi32(_mm256_unpackhi_epi16(x, x), 16);
+}
+
+static INLINE void idct_pass2_avx2(__m256i i0, __m256i i1, __m256i i2,
+                                   __m256i i3, __m256i c, __m256i d,
+                                   __m256i *o) {
+  const __m256i rounding = _mm256_set1_epi32(4);
+  const __m256i a1 = _mm256_add_epi32(_mm256_add_epi32(i0, i2), rounding);
+  const __m256i b1 = _mm256_add_epi32(_mm256_sub_epi32(i0, i2), rounding);
+  const __m256i c1 = _mm256_add_epi32(c, _mm256_sub_epi32(i1, i3));
+  const __m256i d1 = _mm256_add_epi32(d, _mm256_add_epi32(i1, i3));
+
+  o[0] = _mm256_srai_epi32(_mm256_add_epi32(a1, d1), 3);
+  o[1] = _mm256_srai_epi32(_mm256_add_epi32(b1, c1), 3);
+  o[2] = _mm256_srai_epi32(_mm256_sub_epi32(b1, c1), 3);
+  o[3] = _mm256_srai_epi32(_mm256_sub_epi32(a1, d1), 3);
+}
+
+/* vp8_idct4x4_pair_x86() on both lanes. */
+static INLINE void idct4x4_quad_avx2(__m256i *x) {
+  const __m256i sinpi8sqrt2 = _mm256_set1_epi16(VP8_IDCT_SINPI8SQRT2_X86);
+  const __m256i cospi8sqrt2minus1 =
+      _mm256_set1_epi16(VP8_IDCT_COSPI8SQRT2MINUS1_X86);
+  __m256i a1, b1, c1, d1, c, d, lo[4], hi[4];
+
+  a1 = _mm256_add_epi16(x[0], x[2]);
+  b1 = _mm256_sub_epi16(x[0], x[2]);
+  c1 = _mm256_sub_epi16(
+      _mm256_add_epi16(x[1], _mm256_mulhi_epi16(x[1], sinpi8sqrt2)),
+      _mm256_add_epi16(x[3], _mm256_mulhi_epi16(x[3], cospi8sqrt2minus1)));
+  d1 = _mm256_add_epi16(
+      _mm256_add_epi16(x[1], _mm256_mulhi_epi16(x[1], cospi8sqrt2minus1)),
+      _mm256_add_epi16(x[3], _mm256_mulhi_epi16(x[3], sinpi8sqrt2)));
+
+  x[0] = _mm256_add_epi16(a1, d1);
+  x[1] = _mm256_add_epi16(b1, c1);
+  x[2] = _mm256_sub_epi16(b1, c1);
+  x[3] = _mm256_sub_epi16(a1, d1);
+
+  transpose_4x4_quad_avx2(x);
+
+  c = _mm256_sub_epi16(_mm256_mulhi_epi16(x[1], sinpi8sqrt2),
+                       _mm256_mulhi_epi16(x[3], cospi8sqrt2minus1));
+  d = _mm256_add_epi16(_mm256_mulhi_epi16(x[1], cospi8sqrt2minus1),
+                       _mm256_mulhi_epi16(x[3], sinpi8sqrt2));
+
+  idct_pass2_avx2(widen_lo_avx2(x[0]), widen_lo_avx2(x[1]),
+                  widen_lo_avx2(x[2]), widen_lo_avx2(x[3]), widen_lo_avx2(c),
+                  widen_lo_avx2(d), lo);
+  idct_pass2_avx2(widen_hi_avx2(x[0]), widen_hi_avx2(x[1]),
+                  widen_hi_avx2(x[2]), widen_hi_avx2(x[3]), widen_hi_avx2(c),
+                  widen_hi_avx2(d), hi);
+
+  x[0] = _mm256_packs_epi32(lo[0], hi[0]);
+  x[1] = _mm256_packs_epi32(lo[1], hi[1]);
+  x[2] = _mm256_packs_epi32(lo[2], hi[2]);
+  x[3] = _mm256_packs_epi32(lo[3], hi[3]);
+
+  transpose_4x4_quad_avx2(x);
+}
+
+static INLINE void recon_quad_avx2(const __m256i *x, unsigned char *dst_lo,
+                                   unsigned char *dst_hi, int stride) {
+  int r;
+
+  for (r = 0; r < 4; ++r) {
+    const __m128i p = _mm_unpacklo_epi64(
+        _mm_loadl_epi64((const __m128i *)(dst_lo + r * stride)),
+        _mm_loadl_epi64((const __m128i *)(dst_hi + r * stride)));
+    const __m256i s = _mm256_adds_epi16(_mm256_cvtepu8_epi16(p), x[r]);
+    const __m256i v = _mm256_packus_epi16(s, s);
+
+    _mm_storel_epi64((__m128i *)(dst_lo + r * stride),
+                     _mm256_castsi256_si128(v));
+    _mm_storel_epi64((__m128i *)(dst_hi + r * stride),
+                     _mm256_extracti128_si256(v, 1));
+  }
+}
+
+/* Reconstructs the pairs at q_lo and q_hi. When all four blocks are DC only
+ * the rows just take the DC values, otherwise all four go through the full
+ * transform with DC only blocks reduced to their DC coefficient.
+ */
+static INLINE void dequant_idct_add_quad(short *q_lo, short *q_hi,
+                                         const short *dq, unsigned char *dst_lo,
+                                         unsigned char *dst_hi, int stride,
+                                         const char *eobs_lo,
+                                         const char *eobs_hi) {
+  const int dc_only0 = eobs_lo[0] <= 1;
+  const int dc_only1 = eobs_lo[1] <= 1;
+  const int dc_only2 = eobs_hi[0] <= 1;
+  const int dc_only3 = eobs_hi[1] <= 1;
+  __m256i x[4];
+
+  if (dc_only0 && dc_only1 && dc_only2 && dc_only3) {
+    const short a = (short)vp8_dc_only_x86(q_lo, dq);
+    const short b = (short)vp8_dc_only_x86(q_lo + 16, dq);
+    const short c = (short)vp8_dc_only_x86(q_hi, dq);
+    const short d = (short)vp8_dc_only_x86(q_hi + 16, dq);
+
+    x[0] = x[1] = x[2] = x[3] = _mm256_setr_epi16(a, a, a, a, b, b, b, b, c, c,
+                                                  c, c, d, d, d, d);
+  } else {
+    const __m256i dqv = _mm256_loadu_si256((const __m256i *)dq);
+    const __m256i a = load_block_avx2(q_lo, dqv, dc_only0);
+    const __m256i b = load_block_avx2(q_lo + 16, dqv, dc_only1);
+    const __m256i c = load_block_avx2(q_hi, dqv, dc_only2);
+    const __m256i d = load_block_avx2(q_hi + 16, dqv, dc_only3);
+    const __m256i ac01 = _mm256_permute2x128_si256(a, c, 0x20);
+    const __m256i ac23 = _mm256_permute2x128_si256(a, c, 0x31);
+    const __m256i bd01 = _mm256_permute2x128_si256(b, d, 0x20);
+    const __m256i bd23 = _mm256_permute2x128_si256(b, d, 0x31);
+
+    x[0] = _mm256_unpacklo_epi64(ac01, bd01);
+    x[1] = _mm256_unpackhi_epi64(ac01, bd01);
+    x[2] = _mm256_unpacklo_epi64(ac23, bd23);
+    x[3] = _mm256_unpackhi_epi64(ac23, bd23);
+    idct4x4_quad_avx2(x);
+  }
+
+  recon_quad_avx2(x, dst_lo, dst_hi, stride);
+  vp8_clear_idct_block_x86(q_lo, dc_only0);
+  vp8_clear_idct_block_x86(q_lo + 16, dc_only1);
+  vp8_clear_idct_block_x86(q_hi, dc_only2);
+  vp8_clear_idct_block_x86(q_hi + 16, dc_only3);
+}
+
+void vp8_dequant_idct_add_y_block_avx2(short *q, short *dq, unsigned char *dst,
+                                       int stride, char *eobs) {
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    dequant_idct_add_quad(q, q + 32, dq, dst, dst + 8, stride, eobs, eobs + 2);
+    q += 64;
+    dst += 4 * stride;
+    eobs += 4;
+  }
+}
+
+/* Each call does a row of U blocks in the low lane and the same row of V
+ * blocks in the high lane.
+ */
+void vp8_dequant_idct_add_uv_block_avx2(short *q, short *dq,
+                                        unsigned char *dst_u,
+                                        unsigned char *dst_v, int stride,
+                                        char *eobs) {
+  int i;
+
+  for (i = 0; i < 2; ++i) {
+    dequant_idct_add_quad(q, q + 64, dq, dst_u, dst_v, stride, eobs, eobs + 4);
+    q += 32;
+    dst_u += 4 * stride;
+    dst_v += 4 * stride;
+    eobs += 2;
+  }
+}
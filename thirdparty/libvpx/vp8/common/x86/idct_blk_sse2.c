@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/blockd.h"
+#include "vp8/common/x86/idct_x86.h"
+#include "vpx_ports/mem.h"
+
+void vp8_dequantize_b_sse2(BLOCKD *d, short *DQC) {
+  const __m128i q0 = _mm_loadu_si128((const __m128i *)d->qcoeff);
+  const __m128i q1 = _mm_loadu_si128((const __m128i *)(d->qcoeff + 8));
+  const __m128i dq0 = _mm_loadu_si128((const __m128i *)DQC);
+  const __m128i dq1 = _mm_loadu_si128((const __m128i *)(DQC + 8));
+
+  _mm_storeu_si128((__m128i *)d->dqcoeff, _mm_mullo_epi16(q0, dq0));
+  _mm_storeu_si128((__m128i *)(d->dqcoeff + 8), _mm_mullo_epi16(q1, dq1));
+}
+
+void vp8_dequant_idct_add_sse2(short *input, short *dq, unsigned char *dest,
+                               int stride) {
+  __m128i x[4], r01, r23;
+  int r;
+
+  vp8_load_idct_block_x86(input, dq, 0, &r01, &r23);
+  x[0] = r01;
+  x[1] = _mm_unpackhi_epi64(r01, r01);
+  x[2] = r23;
+  x[3] = _mm_unpackhi_epi64(r23, r23);
+  vp8_idct4x4_pair_x86(x);
+
+  for (r = 0; r < 4; ++r) {
+    vp8_add_residual4_x86(dest + r * stride, dest + r * stride, x[r]);
+  }
+
+  vp8_clear_idct_block_x86(input, 0);
+}
+
+/* Reconstructs two horizontally adjacent blocks. When both are DC only the
+ * 8 pixel rows just take the two DC values, otherwise both go through the
+ * full transform with a DC only block reduced to its DC coefficient.
+ */
+static INLINE void dequant_idct_add_pair(short *q, const short *dq,
+                                         unsigned char *dst, int stride,
+                                         const char *eobs) {
+  const int dc_only0 = eobs[0] <= 1;
+  const int dc_only1 = eobs[1] <= 1;
+  __m128i x[4];
+
+  if (dc_only0 && dc_only1) {
+    const __m128i dc = _mm_unpacklo_epi64(
+        _mm_set1_epi16((short)vp8_dc_only_x86(q, dq)),
+        _mm_set1_epi16((short)vp8_dc_only_x86(q + 16, dq)));
+
+    x[0] = x[1] = x[2] = x[3] = dc;
+  } else {
+    __m128i a01, a23, b01, b23;
+
+    vp8_load_idct_block_x86(q, dq, dc_only0, &a01, &a23);
+    vp8_load_idct_block_x86(q + 16, dq, dc_only1, &b01, &b23);
+    x[0] = _mm_unpacklo_epi64(a01, b01);
+    x[1] = _mm_unpackhi_epi64(a01, b01);
+    x[2] = _mm_unpacklo_epi64(a23, b23);
+    x[3] = _mm_unpackhi_epi64(a23, b23);
+    vp8_idct4x4_pair_x86(x);
+  }
+
+  vp8_recon_pair_x86(x, dst, stride);
+  vp8_clear_idct_block_x86(q, dc_only0);
+  vp8_clear_idct_block_x86(q + 16, dc_only1);
+}
+
+void vp8_dequant_idct_add_y_block_sse2(short *q, short *dq, unsigned char *dst,
+                                       int stride, char *eobs) {
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    dequant_idct_add_pair(q, dq, dst, stride, eobs);
+    dequant_idct_add_pair(q + 32, dq, dst + 8, stride, eobs + 2);
+    q += 64;
+    dst += 4 * stride;
+    eobs += 4;
+  }
+}
+
+void vp8_dequant_idct_add_uv_block_sse2(short *q, short *dq,
+                                        unsigned char *dst_u,
+                                        unsigned char *dst_v, int stride,
+                                        char *eobs) {
+  dequant_idct_add_pair(q, dq, dst_u, stride, eobs);
+  dequant_idct_add_pair(q + 32, dq, dst_u + 4 * stride, stride, eobs + 2);
+  dequant_idct_add_pair(q + 64, dq, dst_v, stride, eobs + 4);
+  dequant_idct_add_pair(q + 96, dq, dst_v + 4 * stride, stride, eobs + 6);
+}
@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VP8_COMMON_X86_IDCT_X86_H_
+#define VPX_VP8_COMMON_X86_IDCT_X86_H_
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "vpx_ports/mem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The x86 inverse transforms work on two 4x4 blocks side by side. Register r
+ * holds row r of the left block in its low four words and row r of the right
+ * block in its high four words, so a pair of horizontally adjacent blocks
+ * reads and writes 8 contiguous pixels per row.
+ *
+ * The results match vp8/common/idctllm.c bit for bit for any input. The first
+ * pass is done in 16 bits, where wrapping gives the same answer as the C
+ * storing its int results to short. The C does the second pass in int before
+ * shifting, so that pass is widened to 32 bits.
+ */
+
+/* x * 35468 >> 16 equals x + (x * (35468 - 65536) >> 16), whose product
+ * fits the signed 16 bit multiply.
+ */
+#define VP8_IDCT_SINPI8SQRT2_X86 (35468 - 65536)
+#define VP8_IDCT_COSPI8SQRT2MINUS1_X86 20091
+
+/* Returns the dequantised coefficients of one block as rows 0-1 and 2-3. A
+ * block with an eob of one or less is treated as DC only, as the C does.
+ */
+static INLINE void vp8_load_idct_block_x86(const short *q, const short *dq,
+                                           int dc_only, __m128i *r01,
+                                           __m128i *r23) {
+  if (dc_only) {
+    *r01 = _mm_cvtsi32_si128((unsigned short)(q[0] * dq[0]));
+    *r23 = _mm_setzero_si128();
+  } else {
+    *r01 = _mm_mullo_epi16(_mm_loadu_si128((const __m128i *)q),
+                           _mm_loadu_si128((const __m128i *)dq));
+    *r23 = _mm_mullo_epi16(_mm_loadu_si128((const __m128i *)(q + 8)),
+                           _mm_loadu_si128((const __m128i *)(dq + 8)));
+  }
+}
+
+/* Clears the coefficients the C clears after reconstructing a block. */
+static INLINE void vp8_clear_idct_block_x86(short *q, int dc_only) {
+  if (dc_only) {
+    memset(q, 0, 2 * sizeof(q[0]));
+  } else {
+    _mm_storeu_si128((__m128i *)q, _mm_setzero_si128());
+    _mm_storeu_si128((__m128i *)(q + 8), _mm_setzero_si128());
+  }
+}
+
+/* Transposes the pair of 4x4 blocks in x[0..3] in place. */
+static INLINE void vp8_transpose_4x4_pair_x86(__m128i *x) {
+  const __m128i t0 = _mm_unpacklo_epi16(x[0], x[1]);
+  const __m128i t1 = _mm_unpackhi_epi16(x[0], x[1]);
+  const __m128i t2 = _mm_unpacklo_epi16(x[2], x[3]);
+  const __m128i t3 = _mm_unpackhi_epi16(x[2], x[3]);
+  const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+  const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+  const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+  const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+
+  x[0] = _mm_unpacklo_epi64(u0, u2);
+  x[1] = _mm_unpackhi_epi64(u0, u2);
+  x[2] = _mm_unpacklo_epi64(u1, u3);
+  x[3] = _mm_unpackhi_epi64(u1, u3);
+}
+
+/* Sign extends the low or high four words to 32 bits. */
+static INLINE __m128i vp8_widen_lo_x86(__m128i x) {
+  return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+}
+
+static INLINE __m128i vp8_widen_hi_x86(__m128i x) {
+  return _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+}
+
+/* Second pass for four lanes. c and d are the products already combined in
+ * 16 bits, the remaining terms and the rounding are added in 32 bits.
+ */
+static INLINE void vp8_idct_pass2_x86(__m128i i0, __m128i i1, __m128i i2,
+                                      __m128i i3, __m128i c, __m128i d,
+                                      __m128i *o) {
+  const __m128i rounding = _mm_set1_epi32(4);
+  const __m128i a1 = _mm_add_epi32(_mm_add_epi32(i0, i2), rounding);
+  const __m128i b1 = _mm_add_epi32(_mm_sub_epi32(i0, i2), rounding);
+  const __m128i c1 = _mm_add_epi32(c, _mm_sub_epi32(i1, i3));
+  const __m128i d1 = _mm_add_epi32(d, _mm_add_epi32(i1, i3));
+
+  o[0] = _mm_srai_epi32(_mm_add_epi32(a1, d1), 3);
+  o[1] = _mm_srai_epi32(_mm_add_epi32(b1, c1), 3);
+  o[2] = _mm_srai_epi32(_mm_sub_epi32(b1, c1), 3);
+  o[3] = _mm_srai_epi32(_mm_sub_epi32(a1, d1), 3);
+}
+
+/* Inverse transforms the pair of dequantised blocks in x[0..3], leaving the
+ * residual rows in x[0..3].
+ */
+static INLINE void vp8_idct4x4_pair_x86(__m128i *x) {
+  const __m128i sinpi8sqrt2 = _mm_set1_epi16(VP8_IDCT_SINPI8SQRT2_X86);
+  const __m128i cospi8sqrt2minus1 =
+      _mm_set1_epi16(VP8_IDCT_COSPI8SQRT2MINUS1_X86);
+  __m128i a1, b1, c1, d1, c, d, lo[4], hi[4];
+
+  /* Vertical pass. */
+  a1 = _mm_add_epi16(x[0], x[2]);
+  b1 = _mm_sub_epi16(x[0], x[2]);
+  c1 = _mm_sub_epi16(
+      _mm_add_epi16(x[1], _mm_mulhi_epi16(x[1], sinpi8sqrt2)),
+      _mm_add_epi16(x[3], _mm_mulhi_epi16(x[3], cospi8sqrt2minus1)));
+  d1 = _mm_add_epi16(
+      _mm_add_epi16(x[1], _mm_mulhi_epi16(x[1], cospi8sqrt2minus1)),
+      _mm_add_epi16(x[3], _mm_mulhi_epi16(x[3], sinpi8sqrt2)));
+
+  x[0] = _mm_add_epi16(a1, d1);
+  x[1] = _mm_add_epi16(b1, c1);
+  x[2] = _mm_sub_epi16(b1, c1);
+  x[3] = _mm_sub_epi16(a1, d1);
+
+  /* Horizontal pass, on columns after the transpose. The two products in c
+   * and in d each stay within 16 bits together, the rest does not.
+   */
+  vp8_transpose_4x4_pair_x86(x);
+
+  c = _mm_sub_epi16(_mm_mulhi_epi16(x[1], sinpi8sqrt2),
+                    _mm_mulhi_epi16(x[3], cospi8sqrt2minus1));
+  d = _mm_add_epi16(_mm_mulhi_epi16(x[1], cospi8sqrt2minus1),
+                    _mm_mulhi_epi16(x[3], sinpi8sqrt2));
+
+  vp8_idct_pass2_x86(vp8_widen_lo_x86(x[0]), vp8_widen_lo_x86(x[1]),
+                     vp8_widen_lo_x86(x[2]), vp8_widen_lo_x86(x[3]),
+                     vp8_widen_lo_x86(c), vp8_widen_lo_x86(d), lo);
+  vp8_idct_pass2_x86(vp8_widen_hi_x86(x[0]), vp8_widen_hi_x86(x[1]),
+                     vp8_widen_hi_x86(x[2]), vp8_widen_hi_x86(x[3]),
+                     vp8_widen_hi_x86(c), vp8_widen_hi_x86(d), hi);
+
+  /* The shifted results always fit in 16 bits so the pack is exact. */
+  x[0] = _mm_packs_epi32(lo[0], hi[0]);
+  x[1] = _mm_packs_epi32(lo[1], hi[1]);
+  x[2] = _mm_packs_epi32(lo[2], hi[2]);
+  x[3] = _mm_packs_epi32(lo[3], hi[3]);
+
+  vp8_transpose_4x4_pair_x86(x);
+}
+
+/* Adds residual row r to 8 predicted pixels. A saturating add followed by the
+ * unsigned pack clamps to 0..255 exactly as the C does.
+ */
+static INLINE __m128i vp8_add_residual8_x86(const unsigned char *pred,
+                                            __m128i r) {
+  const __m128i p = _mm_unpacklo_epi8(
+      _mm_loadl_epi64((const __m128i *)pred), _mm_setzero_si128());
+  return _mm_packus_epi16(_mm_adds_epi16(p, r), r);
+}
+
+/* Adds residual row r to 4 predicted pixels without reading past them. */
+static INLINE void vp8_add_residual4_x86(const unsigned char *pred,
+                                         unsigned char *dst, __m128i r) {
+  int p;
+
+  memcpy(&p, pred, 4);
+  p = _mm_cvtsi128_si32(_mm_packus_epi16(
+      _mm_adds_epi16(
+          _mm_unpacklo_epi8(_mm_cvtsi32_si128(p), _mm_setzero_si128()), r),
+      r));
+  memcpy(dst, &p, 4);
+}
+
+/* Reconstructs a pair of adjacent 4x4 blocks from residual rows in x[0..3]. */
+static INLINE void vp8_recon_pair_x86(const __m128i *x, unsigned char *dst,
+                                      int stride) {
+  int r;
+
+  for (r = 0; r < 4; ++r) {
+    _mm_storel_epi64((__m128i *)(dst + r * stride),
+                     vp8_add_residual8_x86(dst + r * stride, x[r]));
+  }
+}
+
+/* The DC of a block with an eob of one or less, as the C computes it. */
+static INLINE int vp8_dc_only_x86(const short *q, const short *dq) {
+  return ((short)(q[0] * dq[0]) + 4) >> 3;
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VP8_COMMON_X86_IDCT_X86_H_
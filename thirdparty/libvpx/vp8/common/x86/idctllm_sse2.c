@@ -0,0 +1,102 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/x86/idct_x86.h"
+#include "vpx_ports/mem.h"
+
+void vp8_short_idct4x4llm_sse2(short *input, unsigned char *pred_ptr,
+                               int pred_stride, unsigned char *dst_ptr,
+                               int dst_stride) {
+  const __m128i r01 = _mm_loadu_si128((const __m128i *)input);
+  const __m128i r23 = _mm_loadu_si128((const __m128i *)(input + 8));
+  __m128i x[4];
+  int r;
+
+  /* Only the left block of the pair is used. */
+  x[0] = r01;
+  x[1] = _mm_unpackhi_epi64(r01, r01);
+  x[2] = r23;
+  x[3] = _mm_unpackhi_epi64(r23, r23);
+  vp8_idct4x4_pair_x86(x);
+
+  for (r = 0; r < 4; ++r) {
+    vp8_add_residual4_x86(pred_ptr + r * pred_stride, dst_ptr + r * dst_stride,
+                          x[r]);
+  }
+}
+
+void vp8_dc_only_idct_add_sse2(short input_dc, unsigned char *pred_ptr,
+                               int pred_stride, unsigned char *dst_ptr,
+                               int dst_stride) {
+  const __m128i dc = _mm_set1_epi16((short)((input_dc + 4) >> 3));
+  int r;
+
+  for (r = 0; r < 4; ++r) {
+    vp8_add_residual4_x86(pred_ptr + r * pred_stride, dst_ptr + r * dst_stride,
+                          dc);
+  }
+}
+
+/* The first pass sums stay in 16 bits as the C stores them to short. The
+ * second pass can reach 18 bits before its shift, so it is done in 32 bits.
+ */
+void vp8_short_inv_walsh4x4_sse2(short *input, short *mb_dqcoeff) {
+  const __m128i r01 = _mm_loadu_si128((const __m128i *)input);
+  const __m128i r23 = _mm_loadu_si128((const __m128i *)(input + 8));
+  const __m128i r32 = _mm_shuffle_epi32(r23, _MM_SHUFFLE(1, 0, 3, 2));
+  const __m128i rounding = _mm_set1_epi32(3);
+  /* a1 and b1 in the low and high halves, then d1 and c1. */
+  const __m128i ab = _mm_add_epi16(r01, r32);
+  const __m128i dc = _mm_sub_epi16(r01, r32);
+  const __m128i ba = _mm_unpackhi_epi64(ab, ab);
+  const __m128i cd = _mm_unpackhi_epi64(dc, dc);
+  __m128i x[4], i0, i1, i2, i3, a1, b1, c1, d1;
+  short output[16];
+  int i;
+
+  x[0] = _mm_add_epi16(ab, ba);
+  x[1] = _mm_add_epi16(cd, dc);
+  x[2] = _mm_sub_epi16(ab, ba);
+  x[3] = _mm_sub_epi16(dc, cd);
+  vp8_transpose_4x4_pair_x86(x);
+
+  i0 = vp8_widen_lo_x86(x[0]);
+  i1 = vp8_widen_lo_x86(x[1]);
+  i2 = vp8_widen_lo_x86(x[2]);
+  i3 = vp8_widen_lo_x86(x[3]);
+  a1 = _mm_add_epi32(_mm_add_epi32(i0, i3), rounding);
+  b1 = _mm_add_epi32(i1, i2);
+  c1 = _mm_sub_epi32(i1, i2);
+  d1 = _mm_add_epi32(_mm_sub_epi32(i0, i3), rounding);
+
+  /* Each register holds one output column, transpose back to rows. */
+  x[0] = _mm_srai_epi32(_mm_add_epi32(a1, b1), 3);
+  x[1] = _mm_srai_epi32(_mm_add_epi32(c1, d1), 3);
+  x[2] = _mm_srai_epi32(_mm_sub_epi32(a1, b1), 3);
+  x[3] = _mm_srai_epi32(_mm_sub_epi32(d1, c1), 3);
+  x[0] = _mm_packs_epi32(x[0], x[0]);
+  x[1] = _mm_packs_epi32(x[1], x[1]);
+  x[2] = _mm_packs_epi32(x[2], x[2]);
+  x[3] = _mm_packs_epi32(x[3], x[3]);
+  vp8_transpose_4x4_pair_x86(x);
+
+  _mm_storel_epi64((__m128i *)output, x[0]);
+  _mm_storel_epi64((__m128i *)(output + 4), x[1]);
+  _mm_storel_epi64((__m128i *)(output + 8), x[2]);
+  _mm_storel_epi64((__m128i *)(output + 12), x[3]);
+
+  for (i = 0; i < 16; ++i) {
+    mb_dqcoeff[i * 16] = output[i];
+  }
+}
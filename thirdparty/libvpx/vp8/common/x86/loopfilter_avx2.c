@@ -0,0 +1,292 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/loopfilter.h"
+#include "vp8/common/x86/loopfilter_x86.h"
+#include "vpx_ports/mem.h"
+
+/* The AVX2 filters do a luma edge in the low lane and the paired U and V
+ * edge in the high lane, 32 pixels at once. The arithmetic is that of the
+ * loopfilter_x86.h helpers, none of which cross a lane.
+ */
+static INLINE __m256i abs_diff_avx2(__m256i a, __m256i b) {
+  return _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+}
+
+static INLINE __m256i srai_epi8_avx2(__m256i x, int n) {
+  const __m256i lo = _mm256_srai_epi16(_mm256_unpacklo_epi8(x, x), 8 + n);
+  const __m256i hi = _mm256_srai_epi16(_mm256_unpackhi_epi8(x, x), 8 + n);
+  return _mm256_packs_epi16(lo, hi);
+}
+
+static INLINE __m256i filter_mask_avx2(__m256i limit, __m256i blimit,
+                                       const __m256i *x) {
+  const __m256i d0 = abs_diff_avx2(x[3], x[4]);
+  const __m256i d1 = _mm256_srli_epi16(
+      _mm256_and_si256(abs_diff_avx2(x[2], x[5]),
+                       _mm256_set1_epi8((char)0xfe)),
+      1);
+  __m256i m = abs_diff_avx2(x[0], x[1]);
+
+  m = _mm256_max_epu8(m, abs_diff_avx2(x[1], x[2]));
+  m = _mm256_max_epu8(m, abs_diff_avx2(x[2], x[3]));
+  m = _mm256_max_epu8(m, abs_diff_avx2(x[5], x[4]));
+  m = _mm256_max_epu8(m, abs_diff_avx2(x[6], x[5]));
+  m = _mm256_max_epu8(m, abs_diff_avx2(x[7], x[6]));
+  m = _mm256_or_si256(
+      _mm256_subs_epu8(m, limit),
+      _mm256_subs_epu8(_mm256_adds_epu8(_mm256_adds_epu8(d0, d0), d1),
+                       blimit));
+  return _mm256_cmpeq_epi8(m, _mm256_setzero_si256());
+}
+
+static INLINE __m256i hev_mask_avx2(__m256i thresh, const __m256i *x) {
+  const __m256i m =
+      _mm256_max_epu8(abs_diff_avx2(x[2], x[3]), abs_diff_avx2(x[5], x[4]));
+  return _mm256_xor_si256(
+      _mm256_cmpeq_epi8(_mm256_subs_epu8(m, thresh), _mm256_setzero_si256()),
+      _mm256_set1_epi8((char)0xff));
+}
+
+static INLINE __m256i filter_value_avx2(__m256i f, __m256i ps0, __m256i qs0) {
+  const __m256i w = _mm256_subs_epi8(qs0, ps0);
+  return _mm256_adds_epi8(_mm256_adds_epi8(_mm256_adds_epi8(f, w), w), w);
+}
+
+/* vp8_filter_x86() on x[2..5]. */
+static INLINE void filter_avx2(__m256i mask, __m256i hev, __m256i *x) {
+  const __m256i t80 = _mm256_set1_epi8((char)0x80);
+  const __m256i ps1 = _mm256_xor_si256(x[2], t80);
+  const __m256i ps0 = _mm256_xor_si256(x[3], t80);
+  const __m256i qs0 = _mm256_xor_si256(x[4], t80);
+  const __m256i qs1 = _mm256_xor_si256(x[5], t80);
+  __m256i f, filter1, filter2;
+
+  f = _mm256_and_si256(_mm256_subs_epi8(ps1, qs1), hev);
+  f = _mm256_and_si256(filter_value_avx2(f, ps0, qs0), mask);
+
+  filter1 = srai_epi8_avx2(_mm256_adds_epi8(f, _mm256_set1_epi8(4)), 3);
+  filter2 = srai_epi8_avx2(_mm256_adds_epi8(f, _mm256_set1_epi8(3)), 3);
+  x[4] = _mm256_xor_si256(_mm256_subs_epi8(qs0, filter1), t80);
+  x[3] = _mm256_xor_si256(_mm256_adds_epi8(ps0, filter2), t80);
+
+  f = srai_epi8_avx2(_mm256_adds_epi8(filter1, _mm256_set1_epi8(1)), 1);
+  f = _mm256_andnot_si256(hev, f);
+  x[5] = _mm256_xor_si256(_mm256_subs_epi8(qs1, f), t80);
+  x[2] = _mm256_xor_si256(_mm256_adds_epi8(ps1, f), t80);
+}
+
+static INLINE __m256i mbfilter_tap_avx2(__m256i f_lo, __m256i f_hi, int k) {
+  const __m256i kk = _mm256_set1_epi16(k);
+  const __m256i r = _mm256_set1_epi16(63);
+  const __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(f_lo, kk), r);
+  const __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(f_hi, kk), r);
+  return _mm256_packs_epi16(_mm256_srai_epi16(lo, 7),
+                            _mm256_srai_epi16(hi, 7));
+}
+
+/* vp8_mbfilter_x86() on x[1..6]. */
+static INLINE void mbfilter_avx2(__m256i mask, __m256i hev, __m256i *x) {
+  const __m256i t80 = _mm256_set1_epi8((char)0x80);
+  const __m256i ps2 = _mm256_xor_si256(x[1], t80);
+  const __m256i ps1 = _mm256_xor_si256(x[2], t80);
+  __m256i ps0 = _mm256_xor_si256(x[3], t80);
+  __m256i qs0 = _mm256_xor_si256(x[4], t80);
+  const __m256i qs1 = _mm256_xor_si256(x[5], t80);
+  const __m256i qs2 = _mm256_xor_si256(x[6], t80);
+  __m256i f, filter1, filter2, f_lo, f_hi, u;
+
+  f = filter_value_avx2(_mm256_subs_epi8(ps1, qs1), ps0, qs0);
+  f = _mm256_and_si256(f, mask);
+
+  filter2 = _mm256_and_si256(f, hev);
+  filter1 = srai_epi8_avx2(_mm256_adds_epi8(filter2, _mm256_set1_epi8(4)), 3);
+  filter2 = srai_epi8_avx2(_mm256_adds_epi8(filter2, _mm256_set1_epi8(3)), 3);
+  qs0 = _mm256_subs_epi8(qs0, filter1);
+  ps0 = _mm256_adds_epi8(ps0, filter2);
+
+  f = _mm256_andnot_si256(hev, f);
+  f_lo = _mm256_srai_epi16(_mm256_unpacklo_epi8(f, f), 8);
+  f_hi = _mm256_srai_epi16(_mm256_unpackhi_epi8(f, f), 8);
+
+  u = mbfilter_tap_avx2(f_lo, f_hi, 27);
+  x[4] = _mm256_xor_si256(_mm256_subs_epi8(qs0, u), t80);
+  x[3] = _mm256_xor_si256(_mm256_adds_epi8(ps0, u), t80);
+
+  u = mbfilter_tap_avx2(f_lo, f_hi, 18);
+  x[5] = _mm256_xor_si256(_mm256_subs_epi8(qs1, u), t80);
+  x[2] = _mm256_xor_si256(_mm256_adds_epi8(ps1, u), t80);
+
+  u = mbfilter_tap_avx2(f_lo, f_hi, 9);
+  x[6] = _mm256_xor_si256(_mm256_subs_epi8(qs2, u), t80);
+  x[1] = _mm256_xor_si256(_mm256_adds_epi8(ps2, u), t80);
+}
+
+static INLINE void join_avx2(const __m128i *y, const __m128i *uv, int n,
+                             __m256i *x) {
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    x[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(y[i]), uv[i], 1);
+  }
+}
+
+static INLINE void split_avx2(const __m256i *x, int n, __m128i *y,
+                              __m128i *uv) {
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    y[i] = _mm256_castsi256_si128(x[i]);
+    uv[i] = _mm256_extracti128_si256(x[i], 1);
+  }
+}
+
+static INLINE void mbfilter_joined(__m256i *x, const loop_filter_info *lfi) {
+  const __m256i mask = filter_mask_avx2(_mm256_set1_epi8((char)lfi->lim[0]),
+                                        _mm256_set1_epi8((char)lfi->mblim[0]),
+                                        x);
+  const __m256i hev =
+      hev_mask_avx2(_mm256_set1_epi8((char)lfi->hev_thr[0]), x);
+
+  mbfilter_avx2(mask, hev, x);
+}
+
+static INLINE void filter_joined(__m256i *x, const loop_filter_info *lfi) {
+  const __m256i mask = filter_mask_avx2(_mm256_set1_epi8((char)lfi->lim[0]),
+                                        _mm256_set1_epi8((char)lfi->blim[0]),
+                                        x);
+  const __m256i hev =
+      hev_mask_avx2(_mm256_set1_epi8((char)lfi->hev_thr[0]), x);
+
+  filter_avx2(mask, hev, x);
+}
+
+/* The SSE2 inner edge filter, for the luma edges with no chroma partner. */
+static INLINE void filter_luma(__m128i *x, const loop_filter_info *lfi) {
+  const __m128i mask = vp8_filter_mask_x86(
+      _mm_set1_epi8((char)lfi->lim[0]), _mm_set1_epi8((char)lfi->blim[0]), x);
+  const __m128i hev = vp8_hev_mask_x86(_mm_set1_epi8((char)lfi->hev_thr[0]), x);
+
+  vp8_filter_x86(mask, hev, x);
+}
+
+/* Without chroma there is nothing for the high lane, so these fall back to
+ * the SSE2 filters.
+ */
+void vp8_loop_filter_mbh_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                              unsigned char *v_ptr, int y_stride,
+                              int uv_stride, loop_filter_info *lfi) {
+  unsigned char *u, *v;
+  __m128i y[8], uv[8];
+  __m256i x[8];
+
+  if (!u_ptr && !v_ptr) {
+    vp8_loop_filter_mbh_sse2(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, lfi);
+    return;
+  }
+  u = u_ptr ? u_ptr : v_ptr;
+  v = v_ptr ? v_ptr : u_ptr;
+
+  vp8_load_rows_x86(y_ptr - 4 * y_stride, NULL, y_stride, 8, y);
+  vp8_load_rows_x86(u - 4 * uv_stride, v - 4 * uv_stride, uv_stride, 8, uv);
+  join_avx2(y, uv, 8, x);
+  mbfilter_joined(x, lfi);
+  split_avx2(x, 8, y, uv);
+  vp8_store_rows_x86(y_ptr - 3 * y_stride, NULL, y_stride, 6, y + 1);
+  vp8_store_rows_x86(u - 3 * uv_stride, v - 3 * uv_stride, uv_stride, 6,
+                     uv + 1);
+}
+
+void vp8_loop_filter_mbv_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                              unsigned char *v_ptr, int y_stride,
+                              int uv_stride, loop_filter_info *lfi) {
+  unsigned char *u, *v;
+  __m128i y[8], uv[8];
+  __m256i x[8];
+
+  if (!u_ptr && !v_ptr) {
+    vp8_loop_filter_mbv_sse2(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, lfi);
+    return;
+  }
+  u = u_ptr ? u_ptr : v_ptr;
+  v = v_ptr ? v_ptr : u_ptr;
+
+  vp8_load_vertical_x86(y_ptr, NULL, y_stride, y);
+  vp8_load_vertical_x86(u, v, uv_stride, uv);
+  join_avx2(y, uv, 8, x);
+  mbfilter_joined(x, lfi);
+  split_avx2(x, 8, y, uv);
+  vp8_store_vertical_x86(y_ptr, NULL, y_stride, y);
+  vp8_store_vertical_x86(u, v, uv_stride, uv);
+}
+
+/* The first luma edge is filtered alongside the chroma edge, the two after
+ * it, which depend on its output, with SSE2.
+ */
+void vp8_loop_filter_bh_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                             unsigned char *v_ptr, int y_stride, int uv_stride,
+                             loop_filter_info *lfi) {
+  unsigned char *u, *v;
+  __m128i y[16], uv[8];
+  __m256i x[8];
+
+  if (!u_ptr && !v_ptr) {
+    vp8_loop_filter_bh_sse2(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, lfi);
+    return;
+  }
+  u = u_ptr ? u_ptr : v_ptr;
+  v = v_ptr ? v_ptr : u_ptr;
+
+  vp8_load_rows_x86(y_ptr, NULL, y_stride, 16, y);
+  vp8_load_rows_x86(u, v, uv_stride, 8, uv);
+  join_avx2(y, uv, 8, x);
+  filter_joined(x, lfi);
+  split_avx2(x, 8, y, uv);
+  filter_luma(y + 4, lfi);
+  filter_luma(y + 8, lfi);
+  vp8_store_rows_x86(y_ptr + 2 * y_stride, NULL, y_stride, 12, y + 2);
+  vp8_store_rows_x86(u + 2 * uv_stride, v + 2 * uv_stride, uv_stride, 4,
+                     uv + 2);
+}
+
+void vp8_loop_filter_bv_avx2(unsigned char *y_ptr, unsigned char *u_ptr,
+                             unsigned char *v_ptr, int y_stride, int uv_stride,
+                             loop_filter_info *lfi) {
+  unsigned char *u, *v;
+  __m128i r[16], y[16], uv[8];
+  __m256i x[8];
+  int i;
+
+  if (!u_ptr && !v_ptr) {
+    vp8_loop_filter_bv_sse2(y_ptr, u_ptr, v_ptr, y_stride, uv_stride, lfi);
+    return;
+  }
+  u = u_ptr ? u_ptr : v_ptr;
+  v = v_ptr ? v_ptr : u_ptr;
+
+  vp8_load_rows_x86(y_ptr, NULL, y_stride, 16, r);
+  vp8_transpose_16x8_x86(r, 0, y);
+  vp8_transpose_16x8_x86(r, 1, y + 8);
+  vp8_load_vertical_x86(u + 4, v + 4, uv_stride, uv);
+  join_avx2(y, uv, 8, x);
+  filter_joined(x, lfi);
+  split_avx2(x, 8, y, uv);
+  filter_luma(y + 4, lfi);
+  filter_luma(y + 8, lfi);
+  vp8_transpose_8x16_x86(y, r);
+  vp8_transpose_8x16_x86(y + 8, y);
+  for (i = 0; i < 16; ++i) r[i] = _mm_unpacklo_epi64(r[i], y[i]);
+  vp8_store_rows_x86(y_ptr, NULL, y_stride, 16, r);
+  vp8_store_vertical_x86(u + 4, v + 4, uv_stride, uv);
+}
@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/loopfilter.h"
+#include "vp8/common/x86/loopfilter_x86.h"
+#include "vpx_ports/mem.h"
+
+/* U and V are filtered together, s0 being the U plane and s1 the V plane.
+ * Luma passes NULL for s1. The C allows either chroma pointer to be NULL, in
+ * which case the other plane is filtered in both halves.
+ */
+static INLINE void mbloop_filter_horizontal(unsigned char *s0,
+                                            unsigned char *s1, int p,
+                                            const loop_filter_info *lfi) {
+  __m128i x[8], mask, hev;
+
+  vp8_load_rows_x86(s0 - 4 * p, s1 ? s1 - 4 * p : NULL, p, 8, x);
+  mask = vp8_filter_mask_x86(_mm_set1_epi8((char)lfi->lim[0]),
+                             _mm_set1_epi8((char)lfi->mblim[0]), x);
+  hev = vp8_hev_mask_x86(_mm_set1_epi8((char)lfi->hev_thr[0]), x);
+  vp8_mbfilter_x86(mask, hev, x);
+  vp8_store_rows_x86(s0 - 3 * p, s1 ? s1 - 3 * p : NULL, p, 6, x + 1);
+}
+
+static INLINE void mbloop_filter_vertical(unsigned char *s0, unsigned char *s1,
+                                          int p, const loop_filter_info *lfi) {
+  __m128i x[8], mask, hev;
+
+  vp8_load_vertical_x86(s0, s1, p, x);
+  mask = vp8_filter_mask_x86(_mm_set1_epi8((char)lfi->lim[0]),
+                             _mm_set1_epi8((char)lfi->mblim[0]), x);
+  hev = vp8_hev_mask_x86(_mm_set1_epi8((char)lfi->hev_thr[0]), x);
+  vp8_mbfilter_x86(mask, hev, x);
+  vp8_store_vertical_x86(s0, s1, p, x);
+}
+
+/* Filters the inner edge 4 rows or columns into x[0..7]. */
+static INLINE void loop_filter_inner(__m128i *x, const loop_filter_info *lfi) {
+  const __m128i mask = vp8_filter_mask_x86(
+      _mm_set1_epi8((char)lfi->lim[0]), _mm_set1_epi8((char)lfi->blim[0]), x);
+  const __m128i hev = vp8_hev_mask_x86(_mm_set1_epi8((char)lfi->hev_thr[0]), x);
+
+  vp8_filter_x86(mask, hev, x);
+}
+
+void vp8_loop_filter_mbh_sse2(unsigned char *y_ptr, unsigned char *u_ptr,
+                              unsigned char *v_ptr, int y_stride,
+                              int uv_stride, loop_filter_info *lfi) {
+  mbloop_filter_horizontal(y_ptr, NULL, y_stride, lfi);
+
+  if (u_ptr || v_ptr) {
+    mbloop_filter_horizontal(u_ptr ? u_ptr : v_ptr, v_ptr ? v_ptr : u_ptr,
+                             uv_stride, lfi);
+  }
+}
+
+void vp8_loop_filter_mbv_sse2(unsigned char *y_ptr, unsigned char *u_ptr,
+                              unsigned char *v_ptr, int y_stride,
+                              int uv_stride, loop_filter_info *lfi) {
+  mbloop_filter_vertical(y_ptr, NULL, y_stride, lfi);
+
+  if (u_ptr || v_ptr) {
+    mbloop_filter_vertical(u_ptr ? u_ptr : v_ptr, v_ptr ? v_ptr : u_ptr,
+                           uv_stride, lfi);
+  }
+}
+
+/* The three luma edges depend on each other, so all 16 rows are loaded once
+ * and filtered in order.
+ */
+void vp8_loop_filter_bh_sse2(unsigned char *y_ptr, unsigned char *u_ptr,
+                             unsigned char *v_ptr, int y_stride, int uv_stride,
+                             loop_filter_info *lfi) {
+  __m128i x[16];
+
+  vp8_load_rows_x86(y_ptr, NULL, y_stride, 16, x);
+  loop_filter_inner(x, lfi);
+  loop_filter_inner(x + 4, lfi);
+  loop_filter_inner(x + 8, lfi);
+  vp8_store_rows_x86(y_ptr + 2 * y_stride, NULL, y_stride, 12, x + 2);
+
+  if (u_ptr || v_ptr) {
+    unsigned char *const u = u_ptr ? u_ptr : v_ptr;
+    unsigned char *const v = v_ptr ? v_ptr : u_ptr;
+
+    vp8_load_rows_x86(u, v, uv_stride, 8, x);
+    loop_filter_inner(x, lfi);
+    vp8_store_rows_x86(u + 2 * uv_stride, v + 2 * uv_stride, uv_stride, 4,
+                       x + 2);
+  }
+}
+
+/* As for the horizontal edges the luma block is transposed once, filtered
+ * column edge by column edge, and transposed back.
+ */
+void vp8_loop_filter_bv_sse2(unsigned char *y_ptr, unsigned char *u_ptr,
+                             unsigned char *v_ptr, int y_stride, int uv_stride,
+                             loop_filter_info *lfi) {
+  __m128i r[16], x[16];
+  int i;
+
+  vp8_load_rows_x86(y_ptr, NULL, y_stride, 16, r);
+  vp8_transpose_16x8_x86(r, 0, x);
+  vp8_transpose_16x8_x86(r, 1, x + 8);
+  loop_filter_inner(x, lfi);
+  loop_filter_inner(x + 4, lfi);
+  loop_filter_inner(x + 8, lfi);
+  vp8_transpose_8x16_x86(x, r);
+  vp8_transpose_8x16_x86(x + 8, x);
+  for (i = 0; i < 16; ++i) r[i] = _mm_unpacklo_epi64(r[i], x[i]);
+  vp8_store_rows_x86(y_ptr, NULL, y_stride, 16, r);
+
+  if (u_ptr || v_ptr) {
+    unsigned char *const u = u_ptr ? u_ptr : v_ptr;
+    unsigned char *const v = v_ptr ? v_ptr : u_ptr;
+
+    vp8_load_vertical_x86(u + 4, v + 4, uv_stride, x);
+    loop_filter_inner(x, lfi);
+    vp8_store_vertical_x86(u + 4, v + 4, uv_stride, x);
+  }
+}
+
+void vp8_loop_filter_simple_horizontal_edge_sse2(unsigned char *y_ptr,
+                                                 int y_stride,
+                                                 const unsigned char *blimit) {
+  __m128i x[4];
+
+  vp8_load_rows_x86(y_ptr - 2 * y_stride, NULL, y_stride, 4, x);
+  vp8_simple_filter_x86(_mm_set1_epi8((char)blimit[0]), x);
+  vp8_store_rows_x86(y_ptr - y_stride, NULL, y_stride, 2, x + 1);
+}
+
+/* The simple filter reads only p1 ... q1, so only the 4 columns around the
+ * edge are written back.
+ */
+static INLINE void store_simple_vertical(unsigned char *s, int p,
+                                         const __m128i *x) {
+  __m128i r[16];
+  int i;
+
+  vp8_transpose_8x16_x86(x, r);
+  for (i = 0; i < 16; ++i) {
+    const int v = _mm_cvtsi128_si32(_mm_srli_si128(r[i], 2));
+    memcpy(s - 2 + i * p, &v, 4);
+  }
+}
+
+void vp8_loop_filter_simple_vertical_edge_sse2(unsigned char *y_ptr,
+                                               int y_stride,
+                                               const unsigned char *blimit) {
+  __m128i x[8];
+
+  vp8_load_vertical_x86(y_ptr, NULL, y_stride, x);
+  vp8_simple_filter_x86(_mm_set1_epi8((char)blimit[0]), x + 2);
+  store_simple_vertical(y_ptr, y_stride, x);
+}
+
+/* The simple filter's inner edges do not overlap, each reads 2 rows either
+ * side and writes 1.
+ */
+void vp8_loop_filter_bhs_sse2(unsigned char *y_ptr, int y_stride,
+                              const unsigned char *blimit) {
+  const __m128i b = _mm_set1_epi8((char)blimit[0]);
+  __m128i x[12];
+
+  vp8_load_rows_x86(y_ptr + 2 * y_stride, NULL, y_stride, 12, x);
+  vp8_simple_filter_x86(b, x);
+  vp8_simple_filter_x86(b, x + 4);
+  vp8_simple_filter_x86(b, x + 8);
+  vp8_store_rows_x86(y_ptr + 3 * y_stride, NULL, y_stride, 2, x + 1);
+  vp8_store_rows_x86(y_ptr + 7 * y_stride, NULL, y_stride, 2, x + 5);
+  vp8_store_rows_x86(y_ptr + 11 * y_stride, NULL, y_stride, 2, x + 9);
+}
+
+void vp8_loop_filter_bvs_sse2(unsigned char *y_ptr, int y_stride,
+                              const unsigned char *blimit) {
+  const __m128i b = _mm_set1_epi8((char)blimit[0]);
+  __m128i r[16], x[16];
+  int i;
+
+  vp8_load_rows_x86(y_ptr, NULL, y_stride, 16, r);
+  vp8_transpose_16x8_x86(r, 0, x);
+  vp8_transpose_16x8_x86(r, 1, x + 8);
+  vp8_simple_filter_x86(b, x + 2);
+  vp8_simple_filter_x86(b, x + 6);
+  vp8_simple_filter_x86(b, x + 10);
+  vp8_transpose_8x16_x86(x, r);
+  vp8_transpose_8x16_x86(x + 8, x);
+
+  /* Only columns 2 to 13, the ones the C reads, are written back. */
+  for (i = 0; i < 16; ++i) {
+    unsigned char *const s = y_ptr + i * y_stride;
+    const __m128i row = _mm_unpacklo_epi64(r[i], x[i]);
+    const int v = _mm_cvtsi128_si32(_mm_srli_si128(row, 10));
+
+    _mm_storel_epi64((__m128i *)(s + 2), _mm_srli_si128(row, 2));
+    memcpy(s + 10, &v, 4);
+  }
+}
@@ -0,0 +1,299 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VP8_COMMON_X86_LOOPFILTER_X86_H_
+#define VPX_VP8_COMMON_X86_LOOPFILTER_X86_H_
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "vpx_ports/mem.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The x86 loop filters work on 16 pixels along an edge at a time, a whole
+ * luma edge or the matching 8 pixel U and V edges side by side. The filter
+ * arithmetic follows vp8/common/loopfilter_filters.c step for step in
+ * saturating 8 bit operations, which clamp exactly where the C does.
+ *
+ * The one approximation is in the edge limit, |p0 - q0| * 2 + |p1 - q1| / 2,
+ * which saturates at 255. The largest limit vp8_loop_filter_update_sharpness()
+ * produces is 193, so the comparison is unaffected.
+ */
+
+static INLINE __m128i vp8_abs_diff_x86(__m128i a, __m128i b) {
+  return _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+}
+
+/* Arithmetic right shift of signed bytes. */
+static INLINE __m128i vp8_srai_epi8_x86(__m128i x, int n) {
+  const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8 + n);
+  const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8 + n);
+  return _mm_packs_epi16(lo, hi);
+}
+
+static INLINE __m128i vp8_edge_diff_x86(__m128i p1, __m128i p0, __m128i q0,
+                                        __m128i q1) {
+  const __m128i d0 = vp8_abs_diff_x86(p0, q0);
+  const __m128i d1 = _mm_srli_epi16(
+      _mm_and_si128(vp8_abs_diff_x86(p1, q1), _mm_set1_epi8((char)0xfe)), 1);
+  return _mm_adds_epu8(_mm_adds_epu8(d0, d0), d1);
+}
+
+/* 0xff where vp8_filter_mask() is set, that is the edge gets filtered. */
+static INLINE __m128i vp8_filter_mask_x86(__m128i limit, __m128i blimit,
+                                          const __m128i *x) {
+  __m128i m = vp8_abs_diff_x86(x[0], x[1]);
+
+  m = _mm_max_epu8(m, vp8_abs_diff_x86(x[1], x[2]));
+  m = _mm_max_epu8(m, vp8_abs_diff_x86(x[2], x[3]));
+  m = _mm_max_epu8(m, vp8_abs_diff_x86(x[5], x[4]));
+  m = _mm_max_epu8(m, vp8_abs_diff_x86(x[6], x[5]));
+  m = _mm_max_epu8(m, vp8_abs_diff_x86(x[7], x[6]));
+  m = _mm_or_si128(
+      _mm_subs_epu8(m, limit),
+      _mm_subs_epu8(vp8_edge_diff_x86(x[2], x[3], x[4], x[5]), blimit));
+  return _mm_cmpeq_epi8(m, _mm_setzero_si128());
+}
+
+/* 0xff where vp8_hevmask() is set. */
+static INLINE __m128i vp8_hev_mask_x86(__m128i thresh, const __m128i *x) {
+  const __m128i m = _mm_max_epu8(vp8_abs_diff_x86(x[2], x[3]),
+                                 vp8_abs_diff_x86(x[5], x[4]));
+  return _mm_xor_si128(
+      _mm_cmpeq_epi8(_mm_subs_epu8(m, thresh), _mm_setzero_si128()),
+      _mm_set1_epi8((char)0xff));
+}
+
+/* clamp(f + 3 * (qs0 - ps0)). qs0 - ps0 is saturated before the adds, which
+ * can only change the result where the C clamps anyway.
+ */
+static INLINE __m128i vp8_filter_value_x86(__m128i f, __m128i ps0,
+                                           __m128i qs0) {
+  const __m128i w = _mm_subs_epi8(qs0, ps0);
+  return _mm_adds_epi8(_mm_adds_epi8(_mm_adds_epi8(f, w), w), w);
+}
+
+/* The normal filter, vp8_filter(), on x[2..5] = p1, p0, q0, q1. */
+static INLINE void vp8_filter_x86(__m128i mask, __m128i hev, __m128i *x) {
+  const __m128i t80 = _mm_set1_epi8((char)0x80);
+  const __m128i ps1 = _mm_xor_si128(x[2], t80);
+  const __m128i ps0 = _mm_xor_si128(x[3], t80);
+  const __m128i qs0 = _mm_xor_si128(x[4], t80);
+  const __m128i qs1 = _mm_xor_si128(x[5], t80);
+  __m128i f, filter1, filter2;
+
+  f = _mm_and_si128(_mm_subs_epi8(ps1, qs1), hev);
+  f = _mm_and_si128(vp8_filter_value_x86(f, ps0, qs0), mask);
+
+  filter1 = vp8_srai_epi8_x86(_mm_adds_epi8(f, _mm_set1_epi8(4)), 3);
+  filter2 = vp8_srai_epi8_x86(_mm_adds_epi8(f, _mm_set1_epi8(3)), 3);
+  x[4] = _mm_xor_si128(_mm_subs_epi8(qs0, filter1), t80);
+  x[3] = _mm_xor_si128(_mm_adds_epi8(ps0, filter2), t80);
+
+  f = vp8_srai_epi8_x86(_mm_adds_epi8(filter1, _mm_set1_epi8(1)), 1);
+  f = _mm_andnot_si128(hev, f);
+  x[5] = _mm_xor_si128(_mm_subs_epi8(qs1, f), t80);
+  x[2] = _mm_xor_si128(_mm_adds_epi8(ps1, f), t80);
+}
+
+/* clamp((63 + f * k) >> 7) for the wide filter taps. */
+static INLINE __m128i vp8_mbfilter_tap_x86(__m128i f_lo, __m128i f_hi, int k) {
+  const __m128i kk = _mm_set1_epi16(k);
+  const __m128i r = _mm_set1_epi16(63);
+  const __m128i lo = _mm_add_epi16(_mm_mullo_epi16(f_lo, kk), r);
+  const __m128i hi = _mm_add_epi16(_mm_mullo_epi16(f_hi, kk), r);
+  return _mm_packs_epi16(_mm_srai_epi16(lo, 7), _mm_srai_epi16(hi, 7));
+}
+
+/* The macroblock edge filter, vp8_mbfilter(), on x[1..6] = p2 ... q2. */
+static INLINE void vp8_mbfilter_x86(__m128i mask, __m128i hev, __m128i *x) {
+  const __m128i t80 = _mm_set1_epi8((char)0x80);
+  const __m128i ps2 = _mm_xor_si128(x[1], t80);
+  const __m128i ps1 = _mm_xor_si128(x[2], t80);
+  __m128i ps0 = _mm_xor_si128(x[3], t80);
+  __m128i qs0 = _mm_xor_si128(x[4], t80);
+  const __m128i qs1 = _mm_xor_si128(x[5], t80);
+  const __m128i qs2 = _mm_xor_si128(x[6], t80);
+  __m128i f, filter1, filter2, f_lo, f_hi, u;
+
+  f = vp8_filter_value_x86(_mm_subs_epi8(ps1, qs1), ps0, qs0);
+  f = _mm_and_si128(f, mask);
+
+  filter2 = _mm_and_si128(f, hev);
+  filter1 = vp8_srai_epi8_x86(_mm_adds_epi8(filter2, _mm_set1_epi8(4)), 3);
+  filter2 = vp8_srai_epi8_x86(_mm_adds_epi8(filter2, _mm_set1_epi8(3)), 3);
+  qs0 = _mm_subs_epi8(qs0, filter1);
+  ps0 = _mm_adds_epi8(ps0, filter2);
+
+  f = _mm_andnot_si128(hev, f);
+  f_lo = _mm_srai_epi16(_mm_unpacklo_epi8(f, f), 8);
+  f_hi = _mm_srai_epi16(_mm_unpackhi_epi8(f, f), 8);
+
+  u = vp8_mbfilter_tap_x86(f_lo, f_hi, 27);
+  x[4] = _mm_xor_si128(_mm_subs_epi8(qs0, u), t80);
+  x[3] = _mm_xor_si128(_mm_adds_epi8(ps0, u), t80);
+
+  u = vp8_mbfilter_tap_x86(f_lo, f_hi, 18);
+  x[5] = _mm_xor_si128(_mm_subs_epi8(qs1, u), t80);
+  x[2] = _mm_xor_si128(_mm_adds_epi8(ps1, u), t80);
+
+  u = vp8_mbfilter_tap_x86(f_lo, f_hi, 9);
+  x[6] = _mm_xor_si128(_mm_subs_epi8(qs2, u), t80);
+  x[1] = _mm_xor_si128(_mm_adds_epi8(ps2, u), t80);
+}
+
+/* The simple filter, vp8_simple_filter(), on x[0..3] = p1, p0, q0, q1. */
+static INLINE void vp8_simple_filter_x86(__m128i blimit, __m128i *x) {
+  const __m128i t80 = _mm_set1_epi8((char)0x80);
+  const __m128i mask = _mm_cmpeq_epi8(
+      _mm_subs_epu8(vp8_edge_diff_x86(x[0], x[1], x[2], x[3]), blimit),
+      _mm_setzero_si128());
+  const __m128i ps1 = _mm_xor_si128(x[0], t80);
+  const __m128i ps0 = _mm_xor_si128(x[1], t80);
+  const __m128i qs0 = _mm_xor_si128(x[2], t80);
+  const __m128i qs1 = _mm_xor_si128(x[3], t80);
+  __m128i f, filter1, filter2;
+
+  f = vp8_filter_value_x86(_mm_subs_epi8(ps1, qs1), ps0, qs0);
+  f = _mm_and_si128(f, mask);
+
+  filter1 = vp8_srai_epi8_x86(_mm_adds_epi8(f, _mm_set1_epi8(4)), 3);
+  filter2 = vp8_srai_epi8_x86(_mm_adds_epi8(f, _mm_set1_epi8(3)), 3);
+  x[2] = _mm_xor_si128(_mm_subs_epi8(qs0, filter1), t80);
+  x[1] = _mm_xor_si128(_mm_adds_epi8(ps0, filter2), t80);
+}
+
+/* Loads |n| rows of 16 pixels, or of 8 U and 8 V pixels when s1 is set. */
+static INLINE void vp8_load_rows_x86(const unsigned char *s0,
+                                     const unsigned char *s1, int p, int n,
+                                     __m128i *x) {
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    if (s1) {
+      x[i] = _mm_unpacklo_epi64(
+          _mm_loadl_epi64((const __m128i *)(s0 + i * p)),
+          _mm_loadl_epi64((const __m128i *)(s1 + i * p)));
+    } else {
+      x[i] = _mm_loadu_si128((const __m128i *)(s0 + i * p));
+    }
+  }
+}
+
+static INLINE void vp8_store_rows_x86(unsigned char *s0, unsigned char *s1,
+                                      int p, int n, const __m128i *x) {
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    if (s1) {
+      _mm_storel_epi64((__m128i *)(s0 + i * p), x[i]);
+      _mm_storel_epi64((__m128i *)(s1 + i * p), _mm_srli_si128(x[i], 8));
+    } else {
+      _mm_storeu_si128((__m128i *)(s0 + i * p), x[i]);
+    }
+  }
+}
+
+/* Transposes 16 rows of 8 pixels, the low or high half of r[0..15], into 8
+ * columns of 16.
+ */
+static INLINE void vp8_transpose_16x8_x86(const __m128i *r, int high,
+                                          __m128i *c) {
+  __m128i a[8], b[8], d[8];
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    a[i] = high ? _mm_unpackhi_epi8(r[2 * i], r[2 * i + 1])
+                : _mm_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+  }
+  for (i = 0; i < 4; ++i) {
+    b[2 * i] = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+    b[2 * i + 1] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+  }
+  for (i = 0; i < 2; ++i) {
+    d[4 * i + 0] = _mm_unpacklo_epi32(b[4 * i + 0], b[4 * i + 2]);
+    d[4 * i + 1] = _mm_unpackhi_epi32(b[4 * i + 0], b[4 * i + 2]);
+    d[4 * i + 2] = _mm_unpacklo_epi32(b[4 * i + 1], b[4 * i + 3]);
+    d[4 * i + 3] = _mm_unpackhi_epi32(b[4 * i + 1], b[4 * i + 3]);
+  }
+  for (i = 0; i < 4; ++i) {
+    c[2 * i] = _mm_unpacklo_epi64(d[i], d[i + 4]);
+    c[2 * i + 1] = _mm_unpackhi_epi64(d[i], d[i + 4]);
+  }
+}
+
+/* The inverse of vp8_transpose_16x8_x86(), 8 columns of 16 pixels back into
+ * 16 rows of 8, each in the low half of r[0..15].
+ */
+static INLINE void vp8_transpose_8x16_x86(const __m128i *c, __m128i *r) {
+  __m128i a[8], b[8];
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    a[2 * i] = _mm_unpacklo_epi8(c[2 * i], c[2 * i + 1]);
+    a[2 * i + 1] = _mm_unpackhi_epi8(c[2 * i], c[2 * i + 1]);
+  }
+  for (i = 0; i < 2; ++i) {
+    b[4 * i + 0] = _mm_unpacklo_epi16(a[i], a[i + 2]);
+    b[4 * i + 1] = _mm_unpackhi_epi16(a[i], a[i + 2]);
+    b[4 * i + 2] = _mm_unpacklo_epi16(a[i + 4], a[i + 6]);
+    b[4 * i + 3] = _mm_unpackhi_epi16(a[i + 4], a[i + 6]);
+  }
+  for (i = 0; i < 4; ++i) {
+    const __m128i lo = _mm_unpacklo_epi32(b[(i >> 1) * 4 + (i & 1)],
+                                          b[(i >> 1) * 4 + (i & 1) + 2]);
+    const __m128i hi = _mm_unpackhi_epi32(b[(i >> 1) * 4 + (i & 1)],
+                                          b[(i >> 1) * 4 + (i & 1) + 2]);
+    r[4 * i + 0] = lo;
+    r[4 * i + 1] = _mm_srli_si128(lo, 8);
+    r[4 * i + 2] = hi;
+    r[4 * i + 3] = _mm_srli_si128(hi, 8);
+  }
+}
+
+/* Loads the 8 pixels either side of a vertical edge for 16 rows, rows 8-15
+ * coming from s1 when it is set, as columns p3 ... q3.
+ */
+static INLINE void vp8_load_vertical_x86(const unsigned char *s0,
+                                         const unsigned char *s1, int p,
+                                         __m128i *c) {
+  __m128i r[16];
+  int i;
+
+  if (!s1) s1 = s0 + 8 * p;
+  for (i = 0; i < 8; ++i) {
+    r[i] = _mm_loadl_epi64((const __m128i *)(s0 - 4 + i * p));
+    r[i + 8] = _mm_loadl_epi64((const __m128i *)(s1 - 4 + i * p));
+  }
+  vp8_transpose_16x8_x86(r, 0, c);
+}
+
+static INLINE void vp8_store_vertical_x86(unsigned char *s0, unsigned char *s1,
+                                          int p, const __m128i *c) {
+  __m128i r[16];
+  int i;
+
+  if (!s1) s1 = s0 + 8 * p;
+  vp8_transpose_8x16_x86(c, r);
+  for (i = 0; i < 8; ++i) {
+    _mm_storel_epi64((__m128i *)(s0 - 4 + i * p), r[i]);
+    _mm_storel_epi64((__m128i *)(s1 - 4 + i * p), r[i + 8]);
+  }
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VP8_COMMON_X86_LOOPFILTER_X86_H_
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (c) 2010 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/filter.h"
+#include "vp8/common/x86/filter_x86.h"
+#include "vpx_ports/mem.h"
+
+/* The AVX2 kernels work on 32 pixel groups, two SSE groups stacked in the two
+ * 128-bit lanes. All of the arithmetic below stays within a lane so the lanes
+ * come out in the same order they went in.
+ */
+static INLINE __m256i load_group_avx2(const unsigned char *src, int stride,
+                                      int width, int rows) {
+  const int lane_rows = 16 / width;
+  const __m128i lo = vp8_load_group_x86(src, stride, width, rows);
+  const __m128i hi =
+      rows > lane_rows
+          ? vp8_load_group_x86(src + lane_rows * stride, stride, width,
+                               rows - lane_rows)
+          : lo;
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static INLINE void store_group_avx2(unsigned char *dst, int stride, int width,
+                                    int rows, __m256i v) {
+  const int lane_rows = 16 / width;
+
+  vp8_store_group_x86(dst, stride, width, rows, _mm256_castsi256_si128(v));
+  if (rows > lane_rows) {
+    vp8_store_group_x86(dst + lane_rows * stride, stride, width,
+                        rows - lane_rows, _mm256_extracti128_si256(v, 1));
+  }
+}
+
+static INLINE __m256i tap_pair(short a, short b) {
+  return _mm256_set1_epi16((short)(((unsigned int)b & 0xff) << 8 |
+                                   ((unsigned int)a & 0xff)));
+}
+
+static INLINE void bilinear_pass_avx2(const unsigned char *src, int src_stride,
+                                      int step, unsigned char *dst,
+                                      int dst_stride, int width, int height,
+                                      const short *filter) {
+  const int group_rows = 32 / width;
+  const __m256i rounding = _mm256_set1_epi16(VP8_FILTER_WEIGHT / 2);
+  const __m256i taps = tap_pair(filter[0], filter[1]);
+  int r;
+
+  for (r = 0; r < height; r += group_rows) {
+    const int rows = height - r;
+    const unsigned char *s = src + r * src_stride;
+    const __m256i a = load_group_avx2(s, src_stride, width, rows);
+    const __m256i b = load_group_avx2(s + step, src_stride, width, rows);
+    __m256i lo = _mm256_maddubs_epi16(_mm256_unpacklo_epi8(a, b), taps);
+    __m256i hi = _mm256_maddubs_epi16(_mm256_unpackhi_epi8(a, b), taps);
+
+    lo = _mm256_srli_epi16(_mm256_add_epi16(lo, rounding), VP8_FILTER_SHIFT);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(hi, rounding), VP8_FILTER_SHIFT);
+
+    store_group_avx2(dst + r * dst_stride, dst_stride, width, rows,
+                     _mm256_packus_epi16(lo, hi));
+  }
+}
+
+static INLINE void bilinear_predict_avx2(unsigned char *src_ptr,
+                                         int src_pixels_per_line, int xoffset,
+                                         int yoffset, unsigned char *dst_ptr,
+                                         int dst_pitch, int width, int height) {
+  DECLARE_ALIGNED(32, unsigned char, fdata[17 * 16]);
+  const short *HFilter = vp8_bilinear_filters[xoffset];
+  const short *VFilter = vp8_bilinear_filters[yoffset];
+
+  if (xoffset && yoffset) {
+    bilinear_pass_avx2(src_ptr, src_pixels_per_line, 1, fdata, width, width,
+                       height + 1, HFilter);
+    bilinear_pass_avx2(fdata, width, width, dst_ptr, dst_pitch, width, height,
+                       VFilter);
+  } else if (xoffset) {
+    bilinear_pass_avx2(src_ptr, src_pixels_per_line, 1, dst_ptr, dst_pitch,
+                       width, height, HFilter);
+  } else if (yoffset) {
+    bilinear_pass_avx2(src_ptr, src_pixels_per_line, src_pixels_per_line,
+                       dst_ptr, dst_pitch, width, height, VFilter);
+  } else {
+    vp8_copy_block_x86(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch, width,
+                       height);
+  }
+}
+
+void vp8_bilinear_predict16x16_avx2(unsigned char *src_ptr,
+                                    int src_pixels_per_line, int xoffset,
+                                    int yoffset, unsigned char *dst_ptr,
+                                    int dst_pitch) {
+  bilinear_predict_avx2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                        dst_ptr, dst_pitch, 16, 16);
+}
@@ -0,0 +1,219 @@
+/*
+ *  Copyright (c) 2010 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/filter.h"
+#include "vp8/common/x86/filter_x86.h"
+#include "vpx_ports/mem.h"
+
+/* Filters one 16 pixel group. |step| is 1 for the horizontal pass and the
+ * row stride for the vertical pass.
+ *
+ * The taps are applied in 16 bits. Every filter has non-negative outer and
+ * centre-left taps and non-positive taps either side of centre, so summing
+ * taps 0, 1, 2, 4 and 5 with the rounding term cannot leave the int16 range
+ * (the worst case is 123 * 255 + 64). Only the final add of tap 3 can exceed
+ * it and that add saturates, which still packs to 255 exactly as the C
+ * clamp does.
+ */
+static INLINE __m128i sixtap_group_sse2(const unsigned char *src, int stride,
+                                        int step, int width, int rows,
+                                        const __m128i *taps) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i rounding = _mm_set1_epi16(VP8_FILTER_WEIGHT >> 1);
+  __m128i lo = rounding;
+  __m128i hi = rounding;
+  const __m128i p3 = vp8_load_group_x86(src + step, stride, width, rows);
+  int t;
+
+  for (t = 0; t < 6; ++t) {
+    __m128i p;
+    if (t == 3) continue;
+    p = vp8_load_group_x86(src + (t - 2) * step, stride, width, rows);
+    lo = _mm_add_epi16(lo,
+                       _mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), taps[t]));
+    hi = _mm_add_epi16(hi,
+                       _mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), taps[t]));
+  }
+
+  lo = _mm_adds_epi16(lo,
+                      _mm_mullo_epi16(_mm_unpacklo_epi8(p3, zero), taps[3]));
+  hi = _mm_adds_epi16(hi,
+                      _mm_mullo_epi16(_mm_unpackhi_epi8(p3, zero), taps[3]));
+  lo = _mm_srai_epi16(lo, VP8_FILTER_SHIFT);
+  hi = _mm_srai_epi16(hi, VP8_FILTER_SHIFT);
+
+  return _mm_packus_epi16(lo, hi);
+}
+
+static INLINE void sixtap_pass_sse2(const unsigned char *src, int src_stride,
+                                    int step, unsigned char *dst,
+                                    int dst_stride, int width, int height,
+                                    const short *filter) {
+  const int group_rows = 16 / width;
+  __m128i taps[6];
+  int r;
+
+  for (r = 0; r < 6; ++r) taps[r] = _mm_set1_epi16(filter[r]);
+
+  for (r = 0; r < height; r += group_rows) {
+    const int rows = height - r;
+    const __m128i v = sixtap_group_sse2(src + r * src_stride, src_stride, step,
+                                        width, rows, taps);
+    vp8_store_group_x86(dst + r * dst_stride, dst_stride, width, rows, v);
+  }
+}
+
+/* The full-pel filter is an exact identity once clamped, so a zero offset
+ * skips its pass instead of running it like the C version does.
+ */
+static INLINE void sixtap_predict_sse2(unsigned char *src_ptr,
+                                       int src_pixels_per_line, int xoffset,
+                                       int yoffset, unsigned char *dst_ptr,
+                                       int dst_pitch, int width, int height) {
+  DECLARE_ALIGNED(16, unsigned char, fdata[21 * 16]);
+  const short *HFilter = vp8_sub_pel_filters[xoffset];
+  const short *VFilter = vp8_sub_pel_filters[yoffset];
+
+  if (xoffset && yoffset) {
+    sixtap_pass_sse2(src_ptr - 2 * src_pixels_per_line, src_pixels_per_line, 1,
+                     fdata, width, width, height + 5, HFilter);
+    sixtap_pass_sse2(fdata + 2 * width, width, width, dst_ptr, dst_pitch, width,
+                     height, VFilter);
+  } else if (xoffset) {
+    sixtap_pass_sse2(src_ptr, src_pixels_per_line, 1, dst_ptr, dst_pitch, width,
+                     height, HFilter);
+  } else if (yoffset) {
+    sixtap_pass_sse2(src_ptr, src_pixels_per_line, src_pixels_per_line, dst_ptr,
+                     dst_pitch, width, height, VFilter);
+  } else {
+    vp8_copy_block_x86(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch, width,
+                       height);
+  }
+}
+
+void vp8_sixtap_predict16x16_sse2(unsigned char *src_ptr,
+                                  int src_pixels_per_line, int xoffset,
+                                  int yoffset, unsigned char *dst_ptr,
+                                  int dst_pitch) {
+  sixtap_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                      dst_pitch, 16, 16);
+}
+
+void vp8_sixtap_predict8x8_sse2(unsigned char *src_ptr, int src_pixels_per_line,
+                                int xoffset, int yoffset,
+                                unsigned char *dst_ptr, int dst_pitch) {
+  sixtap_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                      dst_pitch, 8, 8);
+}
+
+void vp8_sixtap_predict8x4_sse2(unsigned char *src_ptr, int src_pixels_per_line,
+                                int xoffset, int yoffset,
+                                unsigned char *dst_ptr, int dst_pitch) {
+  sixtap_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                      dst_pitch, 8, 4);
+}
+
+void vp8_sixtap_predict4x4_sse2(unsigned char *src_ptr, int src_pixels_per_line,
+                                int xoffset, int yoffset,
+                                unsigned char *dst_ptr, int dst_pitch) {
+  sixtap_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                      dst_pitch, 4, 4);
+}
+
+/* Bilinear taps always sum to 128 so every intermediate fits in 16 bits. */
+static INLINE void bilinear_pass_sse2(const unsigned char *src, int src_stride,
+                                      int step, unsigned char *dst,
+                                      int dst_stride, int width, int height,
+                                      const short *filter) {
+  const int group_rows = 16 / width;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i rounding = _mm_set1_epi16(VP8_FILTER_WEIGHT / 2);
+  const __m128i f0 = _mm_set1_epi16(filter[0]);
+  const __m128i f1 = _mm_set1_epi16(filter[1]);
+  int r;
+
+  for (r = 0; r < height; r += group_rows) {
+    const int rows = height - r;
+    const unsigned char *s = src + r * src_stride;
+    const __m128i a = vp8_load_group_x86(s, src_stride, width, rows);
+    const __m128i b = vp8_load_group_x86(s + step, src_stride, width, rows);
+    __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), f0);
+    __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), f0);
+
+    lo = _mm_add_epi16(lo, _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), f1));
+    hi = _mm_add_epi16(hi, _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), f1));
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, rounding), VP8_FILTER_SHIFT);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, rounding), VP8_FILTER_SHIFT);
+
+    vp8_store_group_x86(dst + r * dst_stride, dst_stride, width, rows,
+                        _mm_packus_epi16(lo, hi));
+  }
+}
+
+static INLINE void bilinear_predict_sse2(unsigned char *src_ptr,
+                                         int src_pixels_per_line, int xoffset,
+                                         int yoffset, unsigned char *dst_ptr,
+                                         int dst_pitch, int width, int height) {
+  DECLARE_ALIGNED(16, unsigned char, fdata[17 * 16]);
+  const short *HFilter = vp8_bilinear_filters[xoffset];
+  const short *VFilter = vp8_bilinear_filters[yoffset];
+
+  if (xoffset && yoffset) {
+    bilinear_pass_sse2(src_ptr, src_pixels_per_line, 1, fdata, width, width,
+                       height + 1, HFilter);
+    bilinear_pass_sse2(fdata, width, width, dst_ptr, dst_pitch, width, height,
+                       VFilter);
+  } else if (xoffset) {
+    bilinear_pass_sse2(src_ptr, src_pixels_per_line, 1, dst_ptr, dst_pitch,
+                       width, height, HFilter);
+  } else if (yoffset) {
+    bilinear_pass_sse2(src_ptr, src_pixels_per_line, src_pixels_per_line,
+                       dst_ptr, dst_pitch, width, height, VFilter);
+  } else {
+    vp8_copy_block_x86(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch, width,
+                       height);
+  }
+}
+
+void vp8_bilinear_predict16x16_sse2(unsigned char *src_ptr,
+                                    int src_pixels_per_line, int xoffset,
+                                    int yoffset, unsigned char *dst_ptr,
+                                    int dst_pitch) {
+  bilinear_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                        dst_ptr, dst_pitch, 16, 16);
+}
+
+void vp8_bilinear_predict8x8_sse2(unsigned char *src_ptr,
+                                  int src_pixels_per_line, int xoffset,
+                                  int yoffset, unsigned char *dst_ptr,
+                                  int dst_pitch) {
+  bilinear_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                        dst_ptr, dst_pitch, 8, 8);
+}
+
+void vp8_bilinear_predict8x4_sse2(unsigned char *src_ptr,
+                                  int src_pixels_per_line, int xoffset,
+                                  int yoffset, unsigned char *dst_ptr,
+                                  int dst_pitch) {
+  bilinear_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                        dst_ptr, dst_pitch, 8, 4);
+}
+
+void vp8_bilinear_predict4x4_sse2(unsigned char *src_ptr,
+                                  int src_pixels_per_line, int xoffset,
+                                  int yoffset, unsigned char *dst_ptr,
+                                  int dst_pitch) {
+  bilinear_predict_sse2(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                        dst_ptr, dst_pitch, 4, 4);
+}
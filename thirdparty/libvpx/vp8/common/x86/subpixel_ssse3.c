@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c) 2010 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <tmmintrin.h>
+
+#include "./vp8_rtcd.h"
+#include "./vpx_config.h"
+#include "vp8/common/filter.h"
+#include "vp8/common/x86/filter_x86.h"
+#include "vpx_ports/mem.h"
+
+/* Packs two filter taps as the signed byte pair expected by pmaddubsw. */
+static INLINE __m128i tap_pair(short a, short b) {
+  return _mm_set1_epi16((short)(((unsigned int)b & 0xff) << 8 |
+                                ((unsigned int)a & 0xff)));
+}
+
+/* The six taps are paired as (0, 5), (2, 4) and (1, 3) so that no single
+ * pmaddubsw can saturate, and the (1, 3) pair is added last with signed
+ * saturation. See sixtap_group_sse2() for why that final saturation is still
+ * bit-exact. The full-pel filter (tap 2 of 128) does not fit a signed byte,
+ * which is fine as it is never run.
+ */
+static INLINE __m128i sixtap_group_ssse3(const unsigned char *src, int stride,
+                                         int step, int width, int rows,
+                                         const __m128i *taps) {
+  const __m128i rounding = _mm_set1_epi16(VP8_FILTER_WEIGHT >> 1);
+  const __m128i p0 = vp8_load_group_x86(src - 2 * step, stride, width, rows);
+  const __m128i p1 = vp8_load_group_x86(src - step, stride, width, rows);
+  const __m128i p2 = vp8_load_group_x86(src, stride, width, rows);
+  const __m128i p3 = vp8_load_group_x86(src + step, stride, width, rows);
+  const __m128i p4 = vp8_load_group_x86(src + 2 * step, stride, width, rows);
+  const __m128i p5 = vp8_load_group_x86(src + 3 * step, stride, width, rows);
+  __m128i lo, hi;
+
+  lo = _mm_add_epi16(_mm_maddubs_epi16(_mm_unpacklo_epi8(p0, p5), taps[0]),
+                     _mm_maddubs_epi16(_mm_unpacklo_epi8(p2, p4), taps[1]));
+  hi = _mm_add_epi16(_mm_maddubs_epi16(_mm_unpackhi_epi8(p0, p5), taps[0]),
+                     _mm_maddubs_epi16(_mm_unpackhi_epi8(p2, p4), taps[1]));
+  lo = _mm_add_epi16(lo, rounding);
+  hi = _mm_add_epi16(hi, rounding);
+  lo = _mm_adds_epi16(lo,
+                      _mm_maddubs_epi16(_mm_unpacklo_epi8(p1, p3), taps[2]));
+  hi = _mm_adds_epi16(hi,
+                      _mm_maddubs_epi16(_mm_unpackhi_epi8(p1, p3), taps[2]));
+  lo = _mm_srai_epi16(lo, VP8_FILTER_SHIFT);
+  hi = _mm_srai_epi16(hi, VP8_FILTER_SHIFT);
+
+  return _mm_packus_epi16(lo, hi);
+}
+
+static INLINE void sixtap_pass_ssse3(const unsigned char *src, int src_stride,
+                                     int step, unsigned char *dst,
+                                     int dst_stride, int width, int height,
+                                     const short *filter) {
+  const int group_rows = 16 / width;
+  __m128i taps[3];
+  int r;
+
+  taps[0] = tap_pair(filter[0], filter[5]);
+  taps[1] = tap_pair(filter[2], filter[4]);
+  taps[2] = tap_pair(filter[1], filter[3]);
+
+  for (r = 0; r < height; r += group_rows) {
+    const int rows = height - r;
+    const __m128i v = sixtap_group_ssse3(src + r * src_stride, src_stride,
+                                         step, width, rows, taps);
+    vp8_store_group_x86(dst + r * dst_stride, dst_stride, width, rows, v);
+  }
+}
+
+static INLINE void sixtap_predict_ssse3(unsigned char *src_ptr,
+                                        int src_pixels_per_line, int xoffset,
+                                        int yoffset, unsigned char *dst_ptr,
+                                        int dst_pitch, int width, int height) {
+  DECLARE_ALIGNED(16, unsigned char, fdata[21 * 16]);
+  const short *HFilter = vp8_sub_pel_filters[xoffset];
+  const short *VFilter = vp8_sub_pel_filters[yoffset];
+
+  if (xoffset && yoffset) {
+    sixtap_pass_ssse3(src_ptr - 2 * src_pixels_per_line, src_pixels_per_line,
+                      1, fdata, width, width, height + 5, HFilter);
+    sixtap_pass_ssse3(fdata + 2 * width, width, width, dst_ptr, dst_pitch,
+                      width, height, VFilter);
+  } else if (xoffset) {
+    sixtap_pass_ssse3(src_ptr, src_pixels_per_line, 1, dst_ptr, dst_pitch,
+                      width, height, HFilter);
+  } else if (yoffset) {
+    sixtap_pass_ssse3(src_ptr, src_pixels_per_line, src_pixels_per_line,
+                      dst_ptr, dst_pitch, width, height, VFilter);
+  } else {
+    vp8_copy_block_x86(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch, width,
+                       height);
+  }
+}
+
+void vp8_sixtap_predict16x16_ssse3(unsigned char *src_ptr,
+                                   int src_pixels_per_line, int xoffset,
+                                   int yoffset, unsigned char *dst_ptr,
+                                   int dst_pitch) {
+  sixtap_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                       dst_pitch, 16, 16);
+}
+
+void vp8_sixtap_predict8x8_ssse3(unsigned char *src_ptr,
+                                 int src_pixels_per_line, int xoffset,
+                                 int yoffset, unsigned char *dst_ptr,
+                                 int dst_pitch) {
+  sixtap_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                       dst_pitch, 8, 8);
+}
+
+void vp8_sixtap_predict8x4_ssse3(unsigned char *src_ptr,
+                                 int src_pixels_per_line, int xoffset,
+                                 int yoffset, unsigned char *dst_ptr,
+                                 int dst_pitch) {
+  sixtap_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                       dst_pitch, 8, 4);
+}
+
+void vp8_sixtap_predict4x4_ssse3(unsigned char *src_ptr,
+                                 int src_pixels_per_line, int xoffset,
+                                 int yoffset, unsigned char *dst_ptr,
+                                 int dst_pitch) {
+  sixtap_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset, dst_ptr,
+                       dst_pitch, 4, 4);
+}
+
+/* Only non-zero offsets reach the filter so both taps are at most 112 and fit
+ * in a signed byte.
+ */
+static INLINE void bilinear_pass_ssse3(const unsigned char *src, int src_stride,
+                                       int step, unsigned char *dst,
+                                       int dst_stride, int width, int height,
+                                       const short *filter) {
+  const int group_rows = 16 / width;
+  const __m128i rounding = _mm_set1_epi16(VP8_FILTER_WEIGHT / 2);
+  const __m128i taps = tap_pair(filter[0], filter[1]);
+  int r;
+
+  for (r = 0; r < height; r += group_rows) {
+    const int rows = height - r;
+    const unsigned char *s = src + r * src_stride;
+    const __m128i a = vp8_load_group_x86(s, src_stride, width, rows);
+    const __m128i b = vp8_load_group_x86(s + step, src_stride, width, rows);
+    __m128i lo = _mm_maddubs_epi16(_mm_unpacklo_epi8(a, b), taps);
+    __m128i hi = _mm_maddubs_epi16(_mm_unpackhi_epi8(a, b), taps);
+
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, rounding), VP8_FILTER_SHIFT);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, rounding), VP8_FILTER_SHIFT);
+
+    vp8_store_group_x86(dst + r * dst_stride, dst_stride, width, rows,
+                        _mm_packus_epi16(lo, hi));
+  }
+}
+
+static INLINE void bilinear_predict_ssse3(unsigned char *src_ptr,
+                                          int src_pixels_per_line, int xoffset,
+                                          int yoffset, unsigned char *dst_ptr,
+                                          int dst_pitch, int width,
+                                          int height) {
+  DECLARE_ALIGNED(16, unsigned char, fdata[17 * 16]);
+  const short *HFilter = vp8_bilinear_filters[xoffset];
+  const short *VFilter = vp8_bilinear_filters[yoffset];
+
+  if (xoffset && yoffset) {
+    bilinear_pass_ssse3(src_ptr, src_pixels_per_line, 1, fdata, width, width,
+                        height + 1, HFilter);
+    bilinear_pass_ssse3(fdata, width, width, dst_ptr, dst_pitch, width, height,
+                        VFilter);
+  } else if (xoffset) {
+    bilinear_pass_ssse3(src_ptr, src_pixels_per_line, 1, dst_ptr, dst_pitch,
+                        width, height, HFilter);
+  } else if (yoffset) {
+    bilinear_pass_ssse3(src_ptr, src_pixels_per_line, src_pixels_per_line,
+                        dst_ptr, dst_pitch, width, height, VFilter);
+  } else {
+    vp8_copy_block_x86(src_ptr, src_pixels_per_line, dst_ptr, dst_pitch, width,
+                       height);
+  }
+}
+
+void vp8_bilinear_predict16x16_ssse3(unsigned char *src_ptr,
+                                     int src_pixels_per_line, int xoffset,
+                                     int yoffset, unsigned char *dst_ptr,
+                                     int dst_pitch) {
+  bilinear_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                         dst_ptr, dst_pitch, 16, 16);
+}
+
+void vp8_bilinear_predict8x8_ssse3(unsigned char *src_ptr,
+                                   int src_pixels_per_line, int xoffset,
+                                   int yoffset, unsigned char *dst_ptr,
+                                   int dst_pitch) {
+  bilinear_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                         dst_ptr, dst_pitch, 8, 8);
+}
+
+void vp8_bilinear_predict8x4_ssse3(unsigned char *src_ptr,
+                                   int src_pixels_per_line, int xoffset,
+                                   int yoffset, unsigned char *dst_ptr,
+                                   int dst_pitch) {
+  bilinear_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                         dst_ptr, dst_pitch, 8, 4);
+}
+
+void vp8_bilinear_predict4x4_ssse3(unsigned char *src_ptr,
+                                   int src_pixels_per_line, int xoffset,
+                                   int yoffset, unsigned char *dst_ptr,
+                                   int dst_pitch) {
+  bilinear_predict_ssse3(src_ptr, src_pixels_per_line, xoffset, yoffset,
+                         dst_ptr, dst_pitch, 4, 4);
+}
@@ -11,6 +11,7 @@
 #include "dboolhuff.h"
 #include "vp8/common/common.h"
 #include "vpx_dsp/vpx_dsp_common.h"
+#include "vpx_util/endian_inl.h"
 
 int vp8dx_start_decode(BOOL_DECODER *br, const unsigned char *source,
                        unsigned int source_sz, vpx_decrypt_cb decrypt_cb,
@@ -46,6 +47,27 @@ void vp8dx_bool_decoder_fill(BOOL_DECODER *br) {
   int loop_end = 0;
   unsigned char decrypted[sizeof(VP8_BD_VALUE) + 1];
 
+  /* With the plain stream and more than a whole VP8_BD_VALUE left, every
+   * byte that fits is loaded at once as a big endian word. Near the end of
+   * the buffer, or through a decryptor, it goes byte by byte.
+   */
+  if (!br->decrypt_cb && bits_left > VP8_BD_VALUE_SIZE) {
+    const int bits = (shift & 0xfffffff8) + CHAR_BIT;
+    VP8_BD_VALUE big_endian_values;
+
+    memcpy(&big_endian_values, bufptr, sizeof(VP8_BD_VALUE));
+#if SIZE_MAX == 0xffffffffffffffffULL
+    big_endian_values = HToBE64(big_endian_values);
+#else
+    big_endian_values = HToBE32(big_endian_values);
+#endif
+    br->value = value | ((big_endian_values >> (VP8_BD_VALUE_SIZE - bits))
+                         << (shift & 0x7));
+    br->count = count + bits;
+    br->user_buffer += bits >> 3;
+    return;
+  }
+
   if (br->decrypt_cb) {
     size_t n = VPXMIN(sizeof(decrypted), bytes_left);
     br->decrypt_cb(br->decrypt_state, bufptr, decrypted, (int)n);
@@ -50,51 +50,106 @@ int vp8dx_start_decode(BOOL_DECODER *br, const unsigned char *source,
 
 void vp8dx_bool_decoder_fill(BOOL_DECODER *br);
 
-static int vp8dx_decode_bool(BOOL_DECODER *br, int probability) {
-  unsigned int bit = 0;
+/* Decodes one bool from decoder state the caller holds in locals, for
+ * loops that read several in a row. The caller refills once count goes
+ * negative.
+ */
+static INLINE int vp8dx_decode_bool_state(VP8_BD_VALUE *value,
+                                          unsigned int *range, int *count,
+                                          int probability) {
+  const unsigned int split = 1 + (((*range - 1) * probability) >> 8);
+  const VP8_BD_VALUE bigsplit = (VP8_BD_VALUE)split
+                                << (VP8_BD_VALUE_SIZE - 8);
+  unsigned int r = split;
+  unsigned char shift;
+  int bit = 0;
+
+  if (*value >= bigsplit) {
+    r = *range - split;
+    *value -= bigsplit;
+    bit = 1;
+  }
+
+  shift = vp8_norm[(unsigned char)r];
+  *value <<= shift;
+  *range = r << shift;
+  *count -= shift;
+  return bit;
+}
+
+/* As vp8dx_decode_bool_state, refilling through br when needed. Only value
+ * and count are synced with br around the refill, range is left to the
+ * caller to write back.
+ */
+static INLINE int vp8dx_decode_bool_local(BOOL_DECODER *br,
+                                          VP8_BD_VALUE *value,
+                                          unsigned int *range, int *count,
+                                          int probability) {
+  if (*count < 0) {
+    br->value = *value;
+    br->count = *count;
+    vp8dx_bool_decoder_fill(br);
+    *value = br->value;
+    *count = br->count;
+  }
+  return vp8dx_decode_bool_state(value, range, count, probability);
+}
+
+static INLINE int vp8dx_decode_bool(BOOL_DECODER *br, int probability) {
   VP8_BD_VALUE value;
-  unsigned int split;
-  VP8_BD_VALUE bigsplit;
-  int count;
   unsigned int range;
-
-  split = 1 + (((br->range - 1) * probability) >> 8);
+  int count;
+  int bit;
 
   if (br->count < 0) vp8dx_bool_decoder_fill(br);
 
   value = br->value;
+  range = br->range;
   count = br->count;
-
-  bigsplit = (VP8_BD_VALUE)split << (VP8_BD_VALUE_SIZE - 8);
-
-  range = split;
-
-  if (value >= bigsplit) {
-    range = br->range - split;
-    value = value - bigsplit;
-    bit = 1;
-  }
-
-  {
-    const unsigned char shift = vp8_norm[(unsigned char)range];
-    range <<= shift;
-    value <<= shift;
-    count -= shift;
-  }
+  bit = vp8dx_decode_bool_state(&value, &range, &count, probability);
   br->value = value;
-  br->count = count;
   br->range = range;
+  br->count = count;
 
   return bit;
 }
 
+/* Reads a literal of up to 16 bits. At even odds a bool costs at most one
+ * bit of count, so a single refill up front covers the whole literal even
+ * with a 32 bit VP8_BD_VALUE, and the bits are read with the state in
+ * locals and without the vp8_norm lookup.
+ */
 static INLINE int vp8_decode_value(BOOL_DECODER *br, int bits) {
+  VP8_BD_VALUE value;
+  unsigned int range;
+  int count;
   int z = 0;
   int bit;
 
+  if (br->count < bits) vp8dx_bool_decoder_fill(br);
+
+  value = br->value;
+  range = br->range;
+  count = br->count;
   for (bit = bits - 1; bit >= 0; bit--) {
-    z |= (vp8dx_decode_bool(br, 0x80) << bit);
+    /* The split at even odds, with a shift of 1 unless the range was 255
+     * and the bit 0, leaving it at 128.
+     */
+    const unsigned int split = (range + 1) >> 1;
+    const VP8_BD_VALUE bigsplit = (VP8_BD_VALUE)split
+                                  << (VP8_BD_VALUE_SIZE - 8);
+    const unsigned int b = value >= bigsplit;
+    const unsigned int r = split + ((range - 2 * split) & (0u - b));
+    const int shift = 1 - (int)(r >> 7);
+
+    value = (value - (bigsplit & ((VP8_BD_VALUE)0 - b))) << shift;
+    range = r << shift;
+    count -= shift;
+    z |= (int)b << bit;
   }
+  br->value = value;
+  br->range = range;
+  br->count = count;
 
   return z;
 }
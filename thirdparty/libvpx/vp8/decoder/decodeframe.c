@@ -106,8 +106,10 @@ static void decode_macroblock(VP8D_COMP *pbi, MACROBLOCKD *xd,
   if (xd->mode_info_context->mbmi.mb_skip_coeff) {
     vp8_reset_mb_tokens_context(xd);
   } else if (!vp8dx_bool_error(xd->current_bc)) {
+    int64_t mark = vpx_timer_ticks();
     int eobtotal;
     eobtotal = vp8_decode_mb_tokens(pbi, xd);
+    vpx_timer_ticks_add(&pbi->frame_times.tokens, &mark);
 
     /* Special case:  Force the loopfilter to skip when eobtotal is zero */
     xd->mode_info_context->mbmi.mb_skip_coeff = (eobtotal == 0);
@@ -445,18 +447,36 @@ static void yv12_extend_frame_left_right_c(YV12_BUFFER_CONFIG *ybf,
   }
 }
 
-static void decode_mb_rows(VP8D_COMP *pbi) {
+/* Hands the MB rows before end to put_rows_cb. */
+static void put_rows(VP8D_COMP *pbi, int end) {
+  if (pbi->put_rows_cb && pbi->common.show_frame && end > pbi->rows_put) {
+    pbi->put_rows_cb(pbi->put_rows_priv, pbi->rows_put, end - pbi->rows_put);
+    pbi->rows_put = end;
+  }
+}
+
+/* Decodes the MB rows from pbi->mb_row on. Unless final is set the frame
+ * is still arriving, and the first row to run out of data is undone and
+ * left for the next call.
+ */
+static void decode_mb_rows(VP8D_COMP *pbi, int final) {
   VP8_COMMON *const pc = &pbi->common;
   MACROBLOCKD *const xd = &pbi->mb;
 
-  MODE_INFO *lf_mic = xd->mode_info_context;
+  /* Loop filtering lags decoding by a row and border extension by one
+   * more, or by one row without the loop filter.
+   */
+  const int first_row = pbi->mb_row;
+  const int lf_row = VPXMAX(first_row - 1, 0);
+  const int eb_row = VPXMAX(first_row - (pc->filter_level ? 2 : 1), 0);
+  MODE_INFO *lf_mic = pc->mi + lf_row * pc->mode_info_stride;
 
-  int ibc = 0;
   int num_part = 1 << pc->multi_token_partition;
+  int ibc = first_row % num_part;
 
   int recon_yoffset, recon_uvoffset;
   int mb_row, mb_col;
-  int mb_idx = 0;
+  int mb_idx = first_row * pc->mb_cols;
 
   YV12_BUFFER_CONFIG *yv12_fb_new = pbi->dec_fb_ref[INTRA_FRAME];
 
@@ -469,6 +489,13 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
   unsigned char *eb_dst[3];
   int i;
   int ref_fb_corrupted[MAX_REF_FRAMES];
+  STAGE_TIMES *const times = &pbi->frame_times;
+  int64_t mark, row_token_ticks;
+  BOOL_DECODER saved_bc;
+  MB_COUNTS saved_counts;
+  int saved_corrupted = 0;
+
+  if (first_row == pc->mb_rows) return;
 
   ref_fb_corrupted[INTRA_FRAME] = 0;
 
@@ -483,19 +510,36 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
   }
 
   /* Set up the buffer pointers */
-  eb_dst[0] = lf_dst[0] = dst_buffer[0] = yv12_fb_new->y_buffer;
-  eb_dst[1] = lf_dst[1] = dst_buffer[1] = yv12_fb_new->u_buffer;
-  eb_dst[2] = lf_dst[2] = dst_buffer[2] = yv12_fb_new->v_buffer;
+  dst_buffer[0] = yv12_fb_new->y_buffer;
+  dst_buffer[1] = yv12_fb_new->u_buffer;
+  dst_buffer[2] = yv12_fb_new->v_buffer;
 
-  xd->up_available = 0;
+  lf_dst[0] = dst_buffer[0] + lf_row * recon_y_stride * 16;
+  lf_dst[1] = dst_buffer[1] + lf_row * recon_uv_stride * 8;
+  lf_dst[2] = dst_buffer[2] + lf_row * recon_uv_stride * 8;
 
-  /* Initialize the loop filter for this frame. */
-  if (pc->filter_level) vp8_loop_filter_frame_init(pc, xd, pc->filter_level);
+  eb_dst[0] = dst_buffer[0] + eb_row * recon_y_stride * 16;
+  eb_dst[1] = dst_buffer[1] + eb_row * recon_uv_stride * 8;
+  eb_dst[2] = dst_buffer[2] + eb_row * recon_uv_stride * 8;
 
-  vp8_setup_intra_recon_top_line(yv12_fb_new);
+  xd->mode_info_context = pc->mi + first_row * pc->mode_info_stride;
+  xd->up_available = first_row > 0;
+  xd->current_bc = &pbi->mbc[0];
+
+  if (first_row == 0) {
+    /* Initialize the loop filter for this frame. */
+    if (pc->filter_level) {
+      vp8_loop_filter_frame_init(pc, xd, pc->filter_level);
+    }
+
+    vp8_setup_intra_recon_top_line(yv12_fb_new);
+  }
 
   /* Decode the individual macro block */
-  for (mb_row = 0; mb_row < pc->mb_rows; ++mb_row) {
+  for (mb_row = first_row; mb_row < pc->mb_rows; ++mb_row) {
+    mark = vpx_timer_ticks();
+    row_token_ticks = times->tokens;
+
     if (num_part > 1) {
       xd->current_bc = &pbi->mbc[ibc];
       ibc++;
@@ -503,6 +547,18 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
       if (ibc == num_part) ibc = 0;
     }
 
+    if (!final) {
+      saved_bc = *(BOOL_DECODER *)xd->current_bc;
+      saved_counts = pbi->frame_counts;
+      saved_corrupted = xd->corrupted;
+      memcpy(pbi->saved_above_context, pc->above_context,
+             sizeof(ENTROPY_CONTEXT_PLANES) * pc->mb_cols);
+      for (mb_col = 0; mb_col < pc->mb_cols; ++mb_col) {
+        pbi->saved_skip[mb_col] =
+            xd->mode_info_context[mb_col].mbmi.mb_skip_coeff;
+      }
+    }
+
     recon_yoffset = mb_row * recon_y_stride * 16;
     recon_uvoffset = mb_row * recon_uv_stride * 8;
 
@@ -585,6 +641,7 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
       xd->corrupted |= ref_fb_corrupted[xd->mode_info_context->mbmi.ref_frame];
 
       decode_macroblock(pbi, xd, mb_idx);
+      vp8dx_count_mb(&pbi->frame_counts, xd);
 
       //dump_macro_block(xd, mb_idx);
 
@@ -609,9 +666,34 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
       xd->above_context++;
     }
 
+    /* The tokens were timed as they were read. */
+    vpx_timer_ticks_add(&times->recon, &mark);
+    times->recon -= times->tokens - row_token_ticks;
+
+    /* Having reached the end of the data so far, the row may have read
+     * padding in place of bytes still to come. Undo it. The pixels it wrote
+     * are all written again when it is decoded next.
+     */
+    if (!final &&
+        ((BOOL_DECODER *)xd->current_bc)->count > VP8_BD_VALUE_SIZE) {
+      xd->mode_info_context -= pc->mb_cols;
+      *(BOOL_DECODER *)xd->current_bc = saved_bc;
+      pbi->frame_counts = saved_counts;
+      xd->corrupted = saved_corrupted;
+      memcpy(pc->above_context, pbi->saved_above_context,
+             sizeof(ENTROPY_CONTEXT_PLANES) * pc->mb_cols);
+      for (mb_col = 0; mb_col < pc->mb_cols; ++mb_col) {
+        xd->mode_info_context[mb_col].mbmi.mb_skip_coeff =
+            pbi->saved_skip[mb_col];
+      }
+      pbi->mb_row = mb_row;
+      return;
+    }
+
     /* adjust to the next row of mbs */
     vp8_extend_mb_row(yv12_fb_new, xd->dst.y_buffer + 16, xd->dst.u_buffer + 8,
                       xd->dst.v_buffer + 8);
+    vpx_timer_ticks_add(&times->extend, &mark);
 
     ++xd->mode_info_context; /* skip prediction column */
     xd->up_available = 1;
@@ -626,9 +708,12 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
           vp8_loop_filter_row_simple(pc, lf_mic, mb_row - 1, recon_y_stride,
                                      lf_dst[0]);
         }
+        vpx_timer_ticks_add(&times->loop_filter, &mark);
         if (mb_row > 1) {
           yv12_extend_frame_left_right_c(yv12_fb_new, eb_dst[0], eb_dst[1],
                                          eb_dst[2]);
+          vpx_timer_ticks_add(&times->extend, &mark);
+          put_rows(pbi, mb_row - 1);
 
           eb_dst[0] += recon_y_stride * 16;
           eb_dst[1] += recon_uv_stride * 8;
@@ -646,6 +731,8 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
         /**/
         yv12_extend_frame_left_right_c(yv12_fb_new, eb_dst[0], eb_dst[1],
                                        eb_dst[2]);
+        vpx_timer_ticks_add(&times->extend, &mark);
+        put_rows(pbi, mb_row);
         eb_dst[0] += recon_y_stride * 16;
         eb_dst[1] += recon_uv_stride * 8;
         eb_dst[2] += recon_uv_stride * 8;
@@ -653,6 +740,7 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
     }
   }
 
+  mark = vpx_timer_ticks();
   if (pc->filter_level) {
     if (pc->filter_type == NORMAL_LOOPFILTER) {
       vp8_loop_filter_row_normal(pc, lf_mic, mb_row - 1, recon_y_stride,
@@ -662,6 +750,7 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
       vp8_loop_filter_row_simple(pc, lf_mic, mb_row - 1, recon_y_stride,
                                  lf_dst[0]);
     }
+    vpx_timer_ticks_add(&times->loop_filter, &mark);
 
     yv12_extend_frame_left_right_c(yv12_fb_new, eb_dst[0], eb_dst[1],
                                    eb_dst[2]);
@@ -672,6 +761,9 @@ static void decode_mb_rows(VP8D_COMP *pbi) {
   yv12_extend_frame_left_right_c(yv12_fb_new, eb_dst[0], eb_dst[1], eb_dst[2]);
   yv12_extend_frame_top_c(yv12_fb_new);
   yv12_extend_frame_bottom_c(yv12_fb_new);
+  vpx_timer_ticks_add(&times->extend, &mark);
+  pbi->mb_row = pc->mb_rows;
+  put_rows(pbi, pc->mb_rows);
 }
 
 static unsigned int read_partition_size(VP8D_COMP *pbi,
@@ -739,6 +831,43 @@ static unsigned int read_available_partition_size(
   return partition_size;
 }
 
+/* Points the token partition decoders of a partial frame at the data that
+ * has arrived. Rows are only undone to a decoder state that had not reached
+ * the end of its data, or to its start, so a decoder at the end has read
+ * nothing and starts again on the longer data.
+ */
+static void update_token_decoders(VP8D_COMP *pbi, int start, int final) {
+  const unsigned char *const data_end = pbi->partial_end;
+  const unsigned int num_part = pbi->fragments.count - 1;
+  unsigned int i;
+
+  for (i = 0; i < num_part; ++i) {
+    BOOL_DECODER *const bd = &pbi->mbc[i];
+    const unsigned char *const partition = pbi->fragments.ptrs[i + 1];
+    const int last = i == num_part - 1;
+    unsigned int size =
+        data_end > partition ? (unsigned int)(data_end - partition) : 0;
+
+    if (!last) size = VPXMIN(size, pbi->fragments.sizes[i + 1]);
+
+    if (final && (size == 0 || (!last && size < pbi->fragments.sizes[i + 1]))) {
+      vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
+                         "Truncated packet or corrupt partition %d length",
+                         i + 1);
+    }
+
+    if (start || bd->count > VP8_BD_VALUE_SIZE) {
+      if (vp8dx_start_decode(bd, partition, size, pbi->decrypt_cb,
+                             pbi->decrypt_state)) {
+        vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
+                           "Failed to allocate bool decoder %d", i + 1);
+      }
+    } else {
+      bd->user_buffer_end = partition + size;
+    }
+  }
+}
+
 static void setup_token_decoder(VP8D_COMP *pbi,
                                 const unsigned char *token_part_sizes) {
   vp8_reader *bool_decoder = &pbi->mbc[0];
@@ -755,71 +884,112 @@ static void setup_token_decoder(VP8D_COMP *pbi,
   }
   num_token_partitions = 1 << pbi->common.multi_token_partition;
 
-  /* Check for partitions within the fragments and unpack the fragments
-   * so that each fragment pointer points to its corresponding partition. */
-  for (fragment_idx = 0; fragment_idx < pbi->fragments.count; ++fragment_idx) {
-    unsigned int fragment_size = pbi->fragments.sizes[fragment_idx];
-    const unsigned char *fragment_end =
-        pbi->fragments.ptrs[fragment_idx] + fragment_size;
-    /* Special case for handling the first partition since we have already
-     * read its size. */
-    if (fragment_idx == 0) {
-      /* Size of first partition + token partition sizes element */
-      ptrdiff_t ext_first_part_size = token_part_sizes -
-                                      pbi->fragments.ptrs[0] +
-                                      3 * (num_token_partitions - 1);
-      if (fragment_size < (unsigned int)ext_first_part_size)
-        vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
-                           "Corrupted fragment size %d", fragment_size);
-      fragment_size -= (unsigned int)ext_first_part_size;
-      if (fragment_size > 0) {
-        pbi->fragments.sizes[0] = (unsigned int)ext_first_part_size;
-        /* The fragment contains an additional partition. Move to
-         * next. */
-        fragment_idx++;
-        pbi->fragments.ptrs[fragment_idx] =
-            pbi->fragments.ptrs[0] + pbi->fragments.sizes[0];
+  if (pbi->partial_frame != PARTIAL_NONE) {
+    /* The frame is still arriving. The partitions are laid out from their
+     * sizes, the last running to wherever the frame ends.
+     */
+    const unsigned char *partition =
+        token_part_sizes + 3 * (num_token_partitions - 1);
+
+    for (partition_idx = 1; partition_idx <= num_token_partitions;
+         ++partition_idx) {
+      unsigned int size = 0;
+      if (partition_idx < num_token_partitions) {
+        size = read_partition_size(pbi, token_part_sizes +
+                                            3 * (partition_idx - 1));
       }
+      pbi->fragments.ptrs[partition_idx] = partition;
+      pbi->fragments.sizes[partition_idx] = size;
+      partition += size;
     }
-    /* Split the chunk into partitions read from the bitstream */
-    while (fragment_size > 0) {
-      ptrdiff_t partition_size = read_available_partition_size(
-          pbi, token_part_sizes, pbi->fragments.ptrs[fragment_idx],
-          first_fragment_end, fragment_end, fragment_idx - 1,
-          num_token_partitions);
-      pbi->fragments.sizes[fragment_idx] = (unsigned int)partition_size;
-      if (fragment_size < (unsigned int)partition_size)
-        vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
-                           "Corrupted fragment size %d", fragment_size);
-      fragment_size -= (unsigned int)partition_size;
-      assert(fragment_idx <= num_token_partitions);
-      if (fragment_size > 0) {
-        /* The fragment contains an additional partition.
-         * Move to next. */
-        fragment_idx++;
-        pbi->fragments.ptrs[fragment_idx] =
-            pbi->fragments.ptrs[fragment_idx - 1] + partition_size;
+    pbi->fragments.count = num_token_partitions + 1;
+    update_token_decoders(pbi, 1, 0);
+  } else {
+    /* Check for partitions within the fragments and unpack the fragments
+     * so that each fragment pointer points to its corresponding partition. */
+    for (fragment_idx = 0; fragment_idx < pbi->fragments.count;
+         ++fragment_idx) {
+      unsigned int fragment_size = pbi->fragments.sizes[fragment_idx];
+      const unsigned char *fragment_end =
+          pbi->fragments.ptrs[fragment_idx] + fragment_size;
+      /* Special case for handling the first partition since we have already
+       * read its size. */
+      if (fragment_idx == 0) {
+        /* Size of first partition + token partition sizes element */
+        ptrdiff_t ext_first_part_size = token_part_sizes -
+                                        pbi->fragments.ptrs[0] +
+                                        3 * (num_token_partitions - 1);
+        if (fragment_size < (unsigned int)ext_first_part_size)
+          vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
+                             "Corrupted fragment size %d", fragment_size);
+        fragment_size -= (unsigned int)ext_first_part_size;
+        if (fragment_size > 0) {
+          pbi->fragments.sizes[0] = (unsigned int)ext_first_part_size;
+          /* The fragment contains an additional partition. Move to
+           * next. */
+          fragment_idx++;
+          pbi->fragments.ptrs[fragment_idx] =
+              pbi->fragments.ptrs[0] + pbi->fragments.sizes[0];
+        }
+      }
+      /* Split the chunk into partitions read from the bitstream */
+      while (fragment_size > 0) {
+        ptrdiff_t partition_size = read_available_partition_size(
+            pbi, token_part_sizes, pbi->fragments.ptrs[fragment_idx],
+            first_fragment_end, fragment_end, fragment_idx - 1,
+            num_token_partitions);
+        pbi->fragments.sizes[fragment_idx] = (unsigned int)partition_size;
+        if (fragment_size < (unsigned int)partition_size)
+          vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
+                             "Corrupted fragment size %d", fragment_size);
+        fragment_size -= (unsigned int)partition_size;
+        assert(fragment_idx <= num_token_partitions);
+        if (fragment_size > 0) {
+          /* The fragment contains an additional partition.
+           * Move to next. */
+          fragment_idx++;
+          pbi->fragments.ptrs[fragment_idx] =
+              pbi->fragments.ptrs[fragment_idx - 1] + partition_size;
+        }
       }
     }
-  }
 
-  pbi->fragments.count = num_token_partitions + 1;
+    pbi->fragments.count = num_token_partitions + 1;
 
-  for (partition_idx = 1; partition_idx < pbi->fragments.count;
-       ++partition_idx) {
-    if (vp8dx_start_decode(bool_decoder, pbi->fragments.ptrs[partition_idx],
-                           pbi->fragments.sizes[partition_idx], pbi->decrypt_cb,
-                           pbi->decrypt_state)) {
-      vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
-                         "Failed to allocate bool decoder %d", partition_idx);
-    }
+    for (partition_idx = 1; partition_idx < pbi->fragments.count;
+         ++partition_idx) {
+      if (vp8dx_start_decode(bool_decoder, pbi->fragments.ptrs[partition_idx],
+                             pbi->fragments.sizes[partition_idx],
+                             pbi->decrypt_cb, pbi->decrypt_state)) {
+        vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
+                           "Failed to allocate bool decoder %d",
+                           partition_idx);
+      }
 
-    bool_decoder++;
+      bool_decoder++;
+    }
   }
 
 #if CONFIG_MULTITHREAD
-  /* Clamp number of decoder threads */
-  if (pbi->decoding_thread_count > num_token_partitions - 1) {
+  /* Clamp number of decoder threads. The clamp is per frame, so start again
+   * from every thread that was created.
+   */
+  pbi->decoding_thread_count =
+      (unsigned int)pbi->allocated_decoding_thread_count;
+  pbi->parsing_thread_count = 0;
+  if (pbi->partition_mt && !pbi->ec_active && pbi->decoding_thread_count) {
+    /* Parsing is the cheaper stage so it gets about a third of the threads,
+     * as a power of two that divides the partition count. Reconstruction no
+     * longer reads the partitions and can use the remaining threads.
+     */
+    const unsigned int threads = pbi->decoding_thread_count + 1;
+    unsigned int parsers = 1;
+    while (parsers * 2 * 3 <= threads && parsers * 2 <= num_token_partitions) {
+      parsers *= 2;
+    }
+    pbi->parsing_thread_count = parsers;
+    pbi->decoding_thread_count = threads - parsers - 1;
+  } else if (pbi->decoding_thread_count > num_token_partitions - 1) {
     pbi->decoding_thread_count = num_token_partitions - 1;
   }
   if ((int)pbi->decoding_thread_count > pbi->common.mb_rows - 1) {
@@ -890,6 +1060,81 @@ static void init_frame(VP8D_COMP *pbi) {
   if (pc->full_pixel) xd->fullpixel_mask = 0xfffffff8;
 }
 
+/* Decodes the MB rows and, once the frame is complete, collects its
+ * corruption and restores the probabilities if they do not persist.
+ */
+static int decode_frame_rows(VP8D_COMP *pbi, int final) {
+  VP8_COMMON *const pc = &pbi->common;
+  MACROBLOCKD *const xd = &pbi->mb;
+  YV12_BUFFER_CONFIG *yv12_fb_new = pbi->dec_fb_ref[INTRA_FRAME];
+  int corrupt_tokens = 0;
+
+#if CONFIG_MULTITHREAD
+  if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd) &&
+      (pc->multi_token_partition != ONE_PARTITION ||
+       pbi->parsing_thread_count)) {
+    unsigned int thread;
+    /* The threads only start on a complete frame. */
+    if (!final) return 0;
+    if (vp8mt_decode_mb_rows(pbi, xd)) {
+      vp8_decoder_remove_threads(pbi);
+      pbi->restart_threads = 1;
+      vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME, NULL);
+    }
+    {
+      int64_t mark = vpx_timer_ticks();
+      vp8_yv12_extend_frame_borders(yv12_fb_new);
+      vpx_timer_ticks_add(&pbi->frame_times.extend, &mark);
+    }
+    put_rows(pbi, pc->mb_rows);
+    for (thread = 0; thread < pbi->decoding_thread_count; ++thread) {
+      corrupt_tokens |= pbi->mb_row_di[thread].mbd.corrupted;
+    }
+  } else
+#endif
+  {
+    decode_mb_rows(pbi, final);
+    corrupt_tokens |= xd->corrupted;
+  }
+
+  if (!final) return 0;
+
+  /* Collect information about decoder corruption. */
+  /* 1. Check first boolean decoder for errors. */
+  yv12_fb_new->corrupted = vp8dx_bool_error(&pbi->mbc[8]);
+  /* 2. Check the macroblock information */
+  yv12_fb_new->corrupted |= corrupt_tokens;
+
+  if (!pbi->decoded_key_frame) {
+    if (pc->frame_type == KEY_FRAME && !yv12_fb_new->corrupted) {
+      pbi->decoded_key_frame = 1;
+    } else {
+      vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
+                         "A stream must start with a complete key frame");
+    }
+  }
+
+  /* vpx_log("Decoder: Frame Decoded, Size Roughly:%d bytes
+   * \n",bc->pos+pbi->bc2.pos); */
+
+  if (pc->refresh_entropy_probs == 0) {
+    memcpy(&pc->fc, &pc->lfc, sizeof(pc->fc));
+    pbi->independent_partitions = pbi->prev_independent_partitions;
+  }
+
+#ifdef PACKET_TESTING
+  {
+    FILE *f = fopen("decompressor.VP8", "ab");
+    unsigned int size = pbi->bc2.pos + pbi->bc.pos + 8;
+    fwrite((void *)&size, 4, 1, f);
+    fwrite((void *)pbi->Source, size, 1, f);
+    fclose(f);
+  }
+#endif
+
+  return 0;
+}
+
 int vp8_decode_frame(VP8D_COMP *pbi) {
   vp8_reader *const bc = &pbi->mbc[8];
   VP8_COMMON *const pc = &pbi->common;
@@ -901,7 +1146,6 @@ int vp8_decode_frame(VP8D_COMP *pbi) {
 
   int i, j, k, l;
   const int *const mb_feature_data_bits = vp8_mb_feature_data_bits;
-  int corrupt_tokens = 0;
   int prev_independent_partitions = pbi->independent_partitions;
 
   YV12_BUFFER_CONFIG *yv12_fb_new = pbi->dec_fb_ref[INTRA_FRAME];
@@ -1181,6 +1425,12 @@ int vp8_decode_frame(VP8D_COMP *pbi) {
   if (pbi->ec_active && xd->corrupted) pc->refresh_last_frame = 1;
 #endif
 
+  pbi->frame_skipped =
+      pbi->decode_mode == DECODE_REFERENCE_FRAMES && pbi->decoded_key_frame &&
+      pc->frame_type != KEY_FRAME && !pc->refresh_last_frame &&
+      !pc->refresh_golden_frame && !pc->refresh_alt_ref_frame &&
+      !pc->copy_buffer_to_gf && !pc->copy_buffer_to_arf;
+
   if (0) {
     FILE *z = fopen("decodestats.stt", "a");
     fprintf(z, "%6d F:%d,G:%d,A:%d,L:%d,Q:%d\n", pc->current_video_frame,
@@ -1211,10 +1461,30 @@ int vp8_decode_frame(VP8D_COMP *pbi) {
     }
   }
 
+  if (pbi->frame_skipped) {
+    /* No later frame predicts from this one, so only the state it hands on
+     * is read: the probabilities when they persist and the segment map.
+     */
+    if (xd->update_mb_segmentation_map) {
+      vp8_decode_mode_mvs(pbi);
+    } else if (pc->refresh_entropy_probs) {
+      vp8_decode_mode_mv_probs(pbi);
+    }
+    if (pc->refresh_entropy_probs == 0) {
+      memcpy(&pc->fc, &pc->lfc, sizeof(pc->fc));
+      pbi->independent_partitions = prev_independent_partitions;
+    }
+    return 0;
+  }
+
   /* clear out the coeff buffer */
   memset(xd->qcoeff, 0, sizeof(xd->qcoeff));
 
-  vp8_decode_mode_mvs(pbi);
+  {
+    int64_t mark = vpx_timer_ticks();
+    vp8_decode_mode_mvs(pbi);
+    vpx_timer_ticks_add(&pbi->frame_times.mode_mvs, &mark);
+  }
 
   //dump_motion_vectors(pbi->common.mip, pbi->common.mb_cols, pbi->common.mb_rows);
 
@@ -1230,58 +1500,14 @@ int vp8_decode_frame(VP8D_COMP *pbi) {
   memset(pc->above_context, 0, sizeof(ENTROPY_CONTEXT_PLANES) * pc->mb_cols);
   pbi->frame_corrupt_residual = 0;
 
-#if CONFIG_MULTITHREAD
-  if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd) &&
-      pc->multi_token_partition != ONE_PARTITION) {
-    unsigned int thread;
-    if (vp8mt_decode_mb_rows(pbi, xd)) {
-      vp8_decoder_remove_threads(pbi);
-      pbi->restart_threads = 1;
-      vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME, NULL);
-    }
-    vp8_yv12_extend_frame_borders(yv12_fb_new);
-    for (thread = 0; thread < pbi->decoding_thread_count; ++thread) {
-      corrupt_tokens |= pbi->mb_row_di[thread].mbd.corrupted;
-    }
-  } else
-#endif
-  {
-    decode_mb_rows(pbi);
-    corrupt_tokens |= xd->corrupted;
-  }
-
-  /* Collect information about decoder corruption. */
-  /* 1. Check first boolean decoder for errors. */
-  yv12_fb_new->corrupted = vp8dx_bool_error(bc);
-  /* 2. Check the macroblock information */
-  yv12_fb_new->corrupted |= corrupt_tokens;
+  pbi->prev_independent_partitions = prev_independent_partitions;
+  pbi->mb_row = 0;
+  pbi->rows_put = 0;
 
-  if (!pbi->decoded_key_frame) {
-    if (pc->frame_type == KEY_FRAME && !yv12_fb_new->corrupted) {
-      pbi->decoded_key_frame = 1;
-    } else {
-      vpx_internal_error(&pbi->common.error, VPX_CODEC_CORRUPT_FRAME,
-                         "A stream must start with a complete key frame");
-    }
-  }
-
-  /* vpx_log("Decoder: Frame Decoded, Size Roughly:%d bytes
-   * \n",bc->pos+pbi->bc2.pos); */
-
-  if (pc->refresh_entropy_probs == 0) {
-    memcpy(&pc->fc, &pc->lfc, sizeof(pc->fc));
-    pbi->independent_partitions = prev_independent_partitions;
-  }
-
-#ifdef PACKET_TESTING
-  {
-    FILE *f = fopen("decompressor.VP8", "ab");
-    unsigned int size = pbi->bc2.pos + pbi->bc.pos + 8;
-    fwrite((void *)&size, 4, 1, f);
-    fwrite((void *)pbi->Source, size, 1, f);
-    fclose(f);
-  }
-#endif
+  return decode_frame_rows(pbi, pbi->partial_frame == PARTIAL_NONE);
+}
 
-  return 0;
+int vp8_decode_frame_rows(VP8D_COMP *pbi, int final) {
+  update_token_decoders(pbi, 0, final);
+  return decode_frame_rows(pbi, final);
 }
@@ -17,6 +17,10 @@
 extern "C" {
 #endif
 
+/* Reads the skip, reference and mode probabilities and the motion vector
+ * contexts that precede the modes. Called by vp8_decode_mode_mvs().
+ */
+void vp8_decode_mode_mv_probs(VP8D_COMP *);
 void vp8_decode_mode_mvs(VP8D_COMP *);
 
 #ifdef __cplusplus
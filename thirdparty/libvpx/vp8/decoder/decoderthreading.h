@@ -19,8 +19,10 @@ extern "C" {
 int vp8mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd);
 void vp8_decoder_remove_threads(VP8D_COMP *pbi);
 void vp8_decoder_create_threads(VP8D_COMP *pbi);
-void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width, int prev_mb_rows);
-void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi, int mb_rows);
+void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width);
+void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi);
+/* Returns the size of the thread data and buffers allocated above. */
+size_t vp8mt_get_memory_usage(const VP8D_COMP *pbi);
 #endif
 
 #ifdef __cplusplus
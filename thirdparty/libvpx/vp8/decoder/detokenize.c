@@ -46,34 +46,54 @@ static const uint8_t *const kCat3456[] = { kCat3, kCat4, kCat5, kCat6 };
 static const uint8_t kZigzag[16] = { 0, 1,  4,  8,  5, 2,  3,  6,
                                      9, 12, 13, 10, 7, 11, 14, 15 };
 
-#define VP8GetBit vp8dx_decode_bool
 #define NUM_PROBAS 11
 #define NUM_CTX 3
 
 /* for const-casting */
 typedef const uint8_t (*ProbaArray)[NUM_CTX][NUM_PROBAS];
 
+/* The bool decoder state is held in locals for the whole of a block's
+ * tokens and written back once on return.
+ */
+typedef struct {
+  BOOL_DECODER *br;
+  VP8_BD_VALUE value;
+  unsigned int range;
+  int count;
+} TokenReader;
+
+static INLINE int VP8GetBit(TokenReader *tr, int probability) {
+  return vp8dx_decode_bool_local(tr->br, &tr->value, &tr->range, &tr->count,
+                                 probability);
+}
+
 // With corrupt / fuzzed streams the calculation of br->value may overflow. See
 // b/148271109.
-static VPX_NO_UNSIGNED_OVERFLOW_CHECK int GetSigned(BOOL_DECODER *br,
+static VPX_NO_UNSIGNED_OVERFLOW_CHECK int GetSigned(TokenReader *tr,
                                                     int value_to_sign) {
-  int split = (br->range + 1) >> 1;
+  int split = (tr->range + 1) >> 1;
   VP8_BD_VALUE bigsplit = (VP8_BD_VALUE)split << (VP8_BD_VALUE_SIZE - 8);
   int v;
 
-  if (br->count < 0) vp8dx_bool_decoder_fill(br);
+  if (tr->count < 0) {
+    tr->br->value = tr->value;
+    tr->br->count = tr->count;
+    vp8dx_bool_decoder_fill(tr->br);
+    tr->value = tr->br->value;
+    tr->count = tr->br->count;
+  }
 
-  if (br->value < bigsplit) {
-    br->range = split;
+  if (tr->value < bigsplit) {
+    tr->range = split;
     v = value_to_sign;
   } else {
-    br->range = br->range - split;
-    br->value = br->value - bigsplit;
+    tr->range = tr->range - split;
+    tr->value = tr->value - bigsplit;
     v = -value_to_sign;
   }
-  br->range += br->range;
-  br->value += br->value;
-  br->count--;
+  tr->range += tr->range;
+  tr->value += tr->value;
+  tr->count--;
 
   return v;
 }
@@ -81,8 +101,8 @@ static VPX_NO_UNSIGNED_OVERFLOW_CHECK int GetSigned(BOOL_DECODER *br,
    Returns the position of the last non-zero coeff plus one
    (and 0 if there's no coeff at all)
 */
-static int GetCoeffs(BOOL_DECODER *br, ProbaArray prob, int ctx, int n,
-                     int16_t *out) {
+static int ReadCoeffs(TokenReader *br, ProbaArray prob, int ctx, int n,
+                      int16_t *out) {
   const uint8_t *p = prob[n][ctx];
   if (!VP8GetBit(br, p[0])) { /* first EOB is more a 'CBP' bit. */
     return 0;
@@ -139,6 +159,23 @@ static int GetCoeffs(BOOL_DECODER *br, ProbaArray prob, int ctx, int n,
   }
 }
 
+static int GetCoeffs(BOOL_DECODER *br, ProbaArray prob, int ctx, int n,
+                     int16_t *out) {
+  TokenReader tr;
+  int eob;
+
+  tr.br = br;
+  tr.value = br->value;
+  tr.range = br->range;
+  tr.count = br->count;
+  eob = ReadCoeffs(&tr, prob, ctx, n, out);
+  br->value = tr.value;
+  br->range = tr.range;
+  br->count = tr.count;
+
+  return eob;
+}
+
 int vp8_decode_mb_tokens(VP8D_COMP *dx, MACROBLOCKD *x) {
   BOOL_DECODER *bc = x->current_bc;
   const FRAME_CONTEXT *const fc = &dx->common.fc;
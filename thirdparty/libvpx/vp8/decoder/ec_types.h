@@ -15,20 +15,35 @@
 extern "C" {
 #endif
 
-#define MAX_OVERLAPS 16
+/* A block of the previous frame overlaps at most 2x2 blocks once it has
+ * been moved by its motion vector.
+ */
+#define MAX_BLOCK_OVERLAPS 4
 
 /* The area (pixel area in Q6) the block pointed to by bmi overlaps
- * another block with.
+ * another block with. next is the pool index of the block's next overlap,
+ * 0 ending the list.
  */
 typedef struct {
   int overlap;
+  int next;
   union b_mode_info *bmi;
 } OVERLAP_NODE;
 
-/* Structure to keep track of overlapping blocks on a block level. */
+/* The nodes the overlap lists of a frame are made from. Node 0 is unused so
+ * that index 0 can end a list.
+ */
+typedef struct {
+  OVERLAP_NODE *nodes;
+  int used;
+  int size;
+} OVERLAP_POOL;
+
+/* Structure to keep track of overlapping blocks on a block level: the pool
+ * index of the first overlap, 0 for none.
+ */
 typedef struct {
-  /* TODO(holmer): This array should be exchanged for a linked list */
-  OVERLAP_NODE overlaps[MAX_OVERLAPS];
+  int first;
 } B_OVERLAP;
 
 /* Structure used to hold all the overlaps of a macroblock. The overlaps of a
@@ -41,38 +41,48 @@ static const int weights_q7[5][5] = { { 0, 128, 64, 43, 32 },
                                       { 32, 31, 29, 26, 23 } };
 
 int vp8_alloc_overlap_lists(VP8D_COMP *pbi) {
-  if (pbi->overlaps != NULL) {
-    vpx_free(pbi->overlaps);
-    pbi->overlaps = NULL;
-  }
+  const int mbs = pbi->common.mb_rows * pbi->common.mb_cols;
+  /* Every block of every MB can overlap MAX_BLOCK_OVERLAPS blocks. */
+  const int nodes = 1 + 16 * MAX_BLOCK_OVERLAPS * mbs;
+
+  if (mbs <= pbi->overlap_mbs) return 0;
 
-  pbi->overlaps =
-      vpx_calloc(pbi->common.mb_rows * pbi->common.mb_cols, sizeof(MB_OVERLAP));
+  vp8_de_alloc_overlap_lists(pbi);
 
-  if (pbi->overlaps == NULL) return -1;
+  pbi->overlaps = vpx_calloc(mbs, sizeof(MB_OVERLAP));
+  pbi->overlap_pool.nodes = vpx_malloc(sizeof(OVERLAP_NODE) * nodes);
+
+  if (pbi->overlaps == NULL || pbi->overlap_pool.nodes == NULL) {
+    vp8_de_alloc_overlap_lists(pbi);
+    return -1;
+  }
 
+  pbi->overlap_pool.size = nodes;
+  pbi->overlap_mbs = mbs;
   return 0;
 }
 
 void vp8_de_alloc_overlap_lists(VP8D_COMP *pbi) {
   vpx_free(pbi->overlaps);
   pbi->overlaps = NULL;
+  vpx_free(pbi->overlap_pool.nodes);
+  pbi->overlap_pool.nodes = NULL;
+  pbi->overlap_pool.size = 0;
+  pbi->overlap_mbs = 0;
 }
 
 /* Inserts a new overlap area value to the list of overlaps of a block */
-static void assign_overlap(OVERLAP_NODE *overlaps, union b_mode_info *bmi,
-                           int overlap) {
-  int i;
+static void assign_overlap(OVERLAP_POOL *pool, B_OVERLAP *b_overlap,
+                           union b_mode_info *bmi, int overlap) {
+  OVERLAP_NODE *node;
   if (overlap <= 0) return;
-  /* Find and assign to the next empty overlap node in the list of overlaps.
-   * Empty is defined as bmi == NULL */
-  for (i = 0; i < MAX_OVERLAPS; ++i) {
-    if (overlaps[i].bmi == NULL) {
-      overlaps[i].bmi = bmi;
-      overlaps[i].overlap = overlap;
-      break;
-    }
-  }
+  assert(pool->used < pool->size);
+  if (pool->used == pool->size) return;
+  node = &pool->nodes[pool->used];
+  node->overlap = overlap;
+  node->bmi = bmi;
+  node->next = b_overlap->first;
+  b_overlap->first = pool->used++;
 }
 
 /* Calculates the overlap area between two 4x4 squares, where the first
@@ -98,10 +108,10 @@ static int block_overlap(int b1_row, int b1_col, int b2_row, int b2_col) {
  * first block being overlapped in the macroblock has position (first_blk_row,
  * first_blk_col) in blocks relative the upper-left corner of the image.
  */
-static void calculate_overlaps_mb(B_OVERLAP *b_overlaps, union b_mode_info *bmi,
-                                  int new_row, int new_col, int mb_row,
-                                  int mb_col, int first_blk_row,
-                                  int first_blk_col) {
+static void calculate_overlaps_mb(OVERLAP_POOL *pool, B_OVERLAP *b_overlaps,
+                                  union b_mode_info *bmi, int new_row,
+                                  int new_col, int mb_row, int mb_col,
+                                  int first_blk_row, int first_blk_col) {
   /* Find the blocks within this MB (defined by mb_row, mb_col) which are
    * overlapped by bmi and calculate and assign overlap for each of those
    * blocks. */
@@ -142,13 +152,14 @@ static void calculate_overlaps_mb(B_OVERLAP *b_overlaps, union b_mode_info *bmi,
       const int overlap =
           block_overlap(new_row, new_col, (((first_blk_row + row) * 4) << 3),
                         (((first_blk_col + col) * 4) << 3));
-      assign_overlap(b_ol_ul[row * 4 + col].overlaps, bmi, overlap);
+      assign_overlap(pool, &b_ol_ul[row * 4 + col], bmi, overlap);
     }
   }
 }
 
-static void calculate_overlaps(MB_OVERLAP *overlap_ul, int mb_rows, int mb_cols,
-                               union b_mode_info *bmi, int b_row, int b_col) {
+static void calculate_overlaps(OVERLAP_POOL *pool, MB_OVERLAP *overlap_ul,
+                               int mb_rows, int mb_cols, union b_mode_info *bmi,
+                               int b_row, int b_col) {
   MB_OVERLAP *mb_overlap;
   int row, col, rel_row, rel_col;
   int new_row, new_col;
@@ -200,7 +211,7 @@ static void calculate_overlaps(MB_OVERLAP *overlap_ul, int mb_rows, int mb_cols,
       mb_overlap = overlap_ul + (overlap_mb_row + rel_row) * mb_cols +
                    overlap_mb_col + rel_col;
 
-      calculate_overlaps_mb(mb_overlap->overlaps, bmi, new_row, new_col,
+      calculate_overlaps_mb(pool, mb_overlap->overlaps, bmi, new_row, new_col,
                             overlap_mb_row + rel_row, overlap_mb_col + rel_col,
                             overlap_b_row + rel_row, overlap_b_col + rel_col);
     }
@@ -211,18 +222,19 @@ static void calculate_overlaps(MB_OVERLAP *overlap_ul, int mb_rows, int mb_cols,
  * Filters out all overlapping blocks which do not refer to the correct
  * reference frame type.
  */
-static void estimate_mv(const OVERLAP_NODE *overlaps, union b_mode_info *bmi) {
+static void estimate_mv(const OVERLAP_POOL *pool, const B_OVERLAP *b_overlap,
+                        union b_mode_info *bmi) {
   int i;
   int overlap_sum = 0;
   int row_acc = 0;
   int col_acc = 0;
 
   bmi->mv.as_int = 0;
-  for (i = 0; i < MAX_OVERLAPS; ++i) {
-    if (overlaps[i].bmi == NULL) break;
-    col_acc += overlaps[i].overlap * overlaps[i].bmi->mv.as_mv.col;
-    row_acc += overlaps[i].overlap * overlaps[i].bmi->mv.as_mv.row;
-    overlap_sum += overlaps[i].overlap;
+  for (i = b_overlap->first; i != 0; i = pool->nodes[i].next) {
+    const OVERLAP_NODE *const node = &pool->nodes[i];
+    col_acc += node->overlap * node->bmi->mv.as_mv.col;
+    row_acc += node->overlap * node->bmi->mv.as_mv.row;
+    overlap_sum += node->overlap;
   }
   if (overlap_sum > 0) {
     /* Q9 / Q6 = Q3 */
@@ -237,7 +249,8 @@ static void estimate_mv(const OVERLAP_NODE *overlaps, union b_mode_info *bmi) {
 /* Estimates all motion vectors for a macroblock given the lists of
  * overlaps for each block. Decides whether or not the MVs must be clamped.
  */
-static void estimate_mb_mvs(const B_OVERLAP *block_overlaps, MODE_INFO *mi,
+static void estimate_mb_mvs(const OVERLAP_POOL *pool,
+                            const B_OVERLAP *block_overlaps, MODE_INFO *mi,
                             int mb_to_left_edge, int mb_to_right_edge,
                             int mb_to_top_edge, int mb_to_bottom_edge) {
   int row, col;
@@ -256,7 +269,7 @@ static void estimate_mb_mvs(const B_OVERLAP *block_overlaps, MODE_INFO *mi,
       int this_b_to_right_edge = mb_to_right_edge - ((col * 4) << 3);
       /* Estimate vectors for all blocks which are overlapped by this */
       /* type. Interpolate/extrapolate the rest of the block's MVs */
-      estimate_mv(block_overlaps[i].overlaps, &(bmi[i]));
+      estimate_mv(pool, &block_overlaps[i], &(bmi[i]));
       mi->mbmi.need_to_clamp_mvs |= vp8_check_mv_bounds(
           &bmi[i].mv, this_b_to_left_edge, this_b_to_right_edge,
           this_b_to_top_edge, this_b_to_bottom_edge);
@@ -273,14 +286,14 @@ static void estimate_mb_mvs(const B_OVERLAP *block_overlaps, MODE_INFO *mi,
   }
 }
 
-static void calc_prev_mb_overlaps(MB_OVERLAP *overlaps, MODE_INFO *prev_mi,
-                                  int mb_row, int mb_col, int mb_rows,
-                                  int mb_cols) {
+static void calc_prev_mb_overlaps(OVERLAP_POOL *pool, MB_OVERLAP *overlaps,
+                                  MODE_INFO *prev_mi, int mb_row, int mb_col,
+                                  int mb_rows, int mb_cols) {
   int sub_row;
   int sub_col;
   for (sub_row = 0; sub_row < 4; ++sub_row) {
     for (sub_col = 0; sub_col < 4; ++sub_col) {
-      calculate_overlaps(overlaps, mb_rows, mb_cols,
+      calculate_overlaps(pool, overlaps, mb_rows, mb_cols,
                          &(prev_mi->bmi[sub_row * 4 + sub_col]),
                          4 * mb_row + sub_row, 4 * mb_col + sub_col);
     }
@@ -289,11 +302,13 @@ static void calc_prev_mb_overlaps(MB_OVERLAP *overlaps, MODE_INFO *prev_mi,
 
 /* Estimate all missing motion vectors. This function does the same as the one
  * above, but has different input arguments. */
-static void estimate_missing_mvs(MB_OVERLAP *overlaps, MODE_INFO *mi,
-                                 MODE_INFO *prev_mi, int mb_rows, int mb_cols,
-                                 unsigned int first_corrupt) {
+static void estimate_missing_mvs(OVERLAP_POOL *pool, MB_OVERLAP *overlaps,
+                                 MODE_INFO *mi, MODE_INFO *prev_mi, int mb_rows,
+                                 int mb_cols, unsigned int first_corrupt) {
   int mb_row, mb_col;
+  /* Only the list heads need clearing, the nodes are reused. */
   memset(overlaps, 0, sizeof(MB_OVERLAP) * mb_rows * mb_cols);
+  pool->used = 1;
   /* First calculate the overlaps for all blocks */
   for (mb_row = 0; mb_row < mb_rows; ++mb_row) {
     for (mb_col = 0; mb_col < mb_cols; ++mb_col) {
@@ -301,8 +316,8 @@ static void estimate_missing_mvs(MB_OVERLAP *overlaps, MODE_INFO *mi,
        * when extrapolating new vectors.
        */
       if (prev_mi->mbmi.ref_frame == LAST_FRAME) {
-        calc_prev_mb_overlaps(overlaps, prev_mi, mb_row, mb_col, mb_rows,
-                              mb_cols);
+        calc_prev_mb_overlaps(pool, overlaps, prev_mi, mb_row, mb_col,
+                              mb_rows, mb_cols);
       }
       ++prev_mi;
     }
@@ -328,8 +343,8 @@ static void estimate_missing_mvs(MB_OVERLAP *overlaps, MODE_INFO *mi,
       mi->mbmi.uv_mode = DC_PRED;
       mi->mbmi.partitioning = 3;
       mi->mbmi.segment_id = 0;
-      estimate_mb_mvs(block_overlaps, mi, mb_to_left_edge, mb_to_right_edge,
-                      mb_to_top_edge, mb_to_bottom_edge);
+      estimate_mb_mvs(pool, block_overlaps, mi, mb_to_left_edge,
+                      mb_to_right_edge, mb_to_top_edge, mb_to_bottom_edge);
       ++mi;
     }
     mb_col = 0;
@@ -339,8 +354,8 @@ static void estimate_missing_mvs(MB_OVERLAP *overlaps, MODE_INFO *mi,
 
 void vp8_estimate_missing_mvs(VP8D_COMP *pbi) {
   VP8_COMMON *const pc = &pbi->common;
-  estimate_missing_mvs(pbi->overlaps, pc->mi, pc->prev_mi, pc->mb_rows,
-                       pc->mb_cols, pbi->mvs_corrupt_from_mb);
+  estimate_missing_mvs(&pbi->overlap_pool, pbi->overlaps, pc->mi, pc->prev_mi,
+                       pc->mb_rows, pc->mb_cols, pbi->mvs_corrupt_from_mb);
 }
 
 static void assign_neighbor(EC_BLOCK *neighbor, MODE_INFO *mi, int block_idx) {
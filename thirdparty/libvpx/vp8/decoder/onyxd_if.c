@@ -43,6 +43,7 @@
 
 extern void vp8_init_loop_filter(VP8_COMMON *cm);
 static int get_free_fb(VP8_COMMON *cm);
+static int attach_fb(VP8D_COMP *pbi, int idx);
 static void ref_cnt_fb(int *buf, int *idx, int new_idx);
 
 static void initialize_dec(void) {
@@ -56,6 +57,9 @@ static void initialize_dec(void) {
 }
 
 static void remove_decompressor(VP8D_COMP *pbi) {
+  vp8dx_release_frame_buffers(pbi);
+  vpx_free(pbi->saved_above_context);
+  vpx_free(pbi->saved_skip);
 #if CONFIG_ERROR_CONCEALMENT
   vp8_de_alloc_overlap_lists(pbi);
 #endif
@@ -79,6 +83,7 @@ static struct VP8D_COMP *create_decompressor(VP8D_CONFIG *oxcf) {
   pbi->common.error.setjmp = 1;
 
   vp8_create_common(&pbi->common);
+  pbi->common.compact_buffers = oxcf ? oxcf->compact_buffers : 0;
 
   pbi->common.current_video_frame = 0;
   pbi->ready_for_new_data = 1;
@@ -94,7 +99,7 @@ static struct VP8D_COMP *create_decompressor(VP8D_CONFIG *oxcf) {
   pbi->common.error.setjmp = 0;
 
 #if CONFIG_ERROR_CONCEALMENT
-  pbi->ec_enabled = oxcf->error_concealment;
+  pbi->ec_enabled = oxcf ? oxcf->error_concealment : 0;
   pbi->overlaps = NULL;
 #else
   (void)oxcf;
@@ -182,6 +187,8 @@ vpx_codec_err_t vp8dx_set_reference(VP8D_COMP *pbi,
      * ref_cnt_fb() below. */
     cm->fb_idx_ref_cnt[free_fb]--;
 
+    if (attach_fb(pbi, free_fb)) return pbi->common.error.error_code;
+
     /* Manage the reference counters and copy image. */
     ref_cnt_fb(cm->fb_idx_ref_cnt, ref_fb_ptr, free_fb);
     vp8_yv12_copy_frame(sd, &cm->yv12_fb[*ref_fb_ptr]);
@@ -209,6 +216,97 @@ static void ref_cnt_fb(int *buf, int *idx, int new_idx) {
   buf[new_idx]++;
 }
 
+/* Hands the external buffer behind slot idx back to the application. With
+ * callbacks in use vp8_alloc_frame_buffers() gives the slots no memory of
+ * their own, so this leaves the slot without any until it is next attached.
+ */
+static void release_ext_fb(VP8D_COMP *pbi, int idx) {
+  VP8_COMMON *cm = &pbi->common;
+  YV12_BUFFER_CONFIG *ybf = &cm->yv12_fb[idx];
+  vpx_codec_frame_buffer_t *fb = &pbi->ext_fb[idx];
+
+  if (fb->data) {
+    pbi->release_ext_fb_cb(pbi->ext_cb_priv, fb);
+    memset(fb, 0, sizeof(*fb));
+  }
+
+  ybf->buffer_alloc = NULL;
+  ybf->y_buffer = NULL;
+  ybf->u_buffer = NULL;
+  ybf->v_buffer = NULL;
+
+  if (cm->frame_to_show == ybf) cm->frame_to_show = NULL;
+}
+
+/* Returns the buffers of all unreferenced slots. The frame returned by the
+ * last vp8dx_get_raw_frame() is only valid until the next decode call, so
+ * this runs at the start of every frame.
+ */
+static void release_unused_ext_fbs(VP8D_COMP *pbi) {
+  int i;
+
+  for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
+    if (pbi->common.fb_idx_ref_cnt[i] == 0) release_ext_fb(pbi, i);
+  }
+}
+
+/* Backs the newly claimed slot idx with a fresh application buffer, or
+ * allocates its own memory if compact buffers left it without any. The slot
+ * keeps the geometry set by vp8_alloc_frame_buffers(), only the memory
+ * changes. The request is padded by 31 bytes so the planes can be 32 byte
+ * aligned. On failure the slot is returned to the free list before the error
+ * is raised.
+ */
+static int attach_fb(VP8D_COMP *pbi, int idx) {
+  YV12_BUFFER_CONFIG *ybf = &pbi->common.yv12_fb[idx];
+  vpx_codec_frame_buffer_t *fb = &pbi->ext_fb[idx];
+  const size_t size = ybf->frame_size + 31;
+  const int border = ybf->border;
+  const int yplane_size = (ybf->y_height + 2 * border) * ybf->y_stride;
+  const int uvplane_size = (ybf->uv_height + border) * ybf->uv_stride;
+  const int uv_offset = (border / 2 * ybf->uv_stride) + border / 2;
+  uint8_t *data;
+
+  if (!pbi->get_ext_fb_cb) {
+    if (ybf->buffer_alloc ||
+        vp8_yv12_realloc_frame_buffer(ybf, ybf->y_width, ybf->y_height,
+                                      border) == 0) {
+      return 0;
+    }
+    pbi->common.fb_idx_ref_cnt[idx] = 0;
+    vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
+                       "Failed to allocate a frame buffer");
+    return -1;
+  }
+
+  release_ext_fb(pbi, idx);
+
+  if (pbi->get_ext_fb_cb(pbi->ext_cb_priv, size, fb) < 0 || !fb->data ||
+      fb->size < size) {
+    if (fb->data) pbi->release_ext_fb_cb(pbi->ext_cb_priv, fb);
+    memset(fb, 0, sizeof(*fb));
+    pbi->common.fb_idx_ref_cnt[idx] = 0;
+    vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
+                       "Failed to get an external frame buffer");
+    return -1;
+  }
+
+  data = (uint8_t *)(((size_t)fb->data + 31) & ~(size_t)31);
+  ybf->buffer_alloc = data;
+  ybf->y_buffer = data + (border * ybf->y_stride) + border;
+  ybf->u_buffer = data + yplane_size + uv_offset;
+  ybf->v_buffer = data + yplane_size + uvplane_size + uv_offset;
+  return 0;
+}
+
+void vp8dx_release_frame_buffers(VP8D_COMP *pbi) {
+  int i;
+
+  if (!pbi->get_ext_fb_cb) return;
+
+  for (i = 0; i < NUM_YV12_BUFFERS; ++i) release_ext_fb(pbi, i);
+}
+
 /* If any buffer copy / swapping is signalled it should be done here. */
 static int swap_frame_buffers(VP8_COMMON *cm) {
   int err = 0;
@@ -281,8 +379,12 @@ static int check_fragments_for_errors(VP8D_COMP *pbi) {
        * corrupt, otherwise we will make multiple buffers corrupt.
        */
       const int prev_idx = cm->lst_fb_idx;
+      const int free_fb = get_free_fb(cm);
+
+      if (attach_fb(pbi, free_fb)) return -1;
+
       cm->fb_idx_ref_cnt[prev_idx]--;
-      cm->lst_fb_idx = get_free_fb(cm);
+      cm->lst_fb_idx = free_fb;
       vp8_yv12_copy_frame(&cm->yv12_fb[prev_idx], &cm->yv12_fb[cm->lst_fb_idx]);
     }
     /* This is used to signal that we are missing frames.
@@ -302,16 +404,14 @@ static int check_fragments_for_errors(VP8D_COMP *pbi) {
   return 1;
 }
 
-int vp8dx_receive_compressed_data(VP8D_COMP *pbi, int64_t time_stamp) {
+/* Takes a buffer for the new frame to be decoded into. */
+static int start_frame(VP8D_COMP *pbi) {
   VP8_COMMON *cm = &pbi->common;
-  int retcode = -1;
 
-  pbi->common.error.error_code = VPX_CODEC_OK;
-
-  retcode = check_fragments_for_errors(pbi);
-  if (retcode <= 0) return retcode;
+  if (pbi->get_ext_fb_cb) release_unused_ext_fbs(pbi);
 
   cm->new_fb_idx = get_free_fb(cm);
+  if (attach_fb(pbi, cm->new_fb_idx)) return -1;
 
   /* setup reference frames for vp8_decode_frame */
   pbi->dec_fb_ref[INTRA_FRAME] = &cm->yv12_fb[cm->new_fb_idx];
@@ -319,7 +419,18 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, int64_t time_stamp) {
   pbi->dec_fb_ref[GOLDEN_FRAME] = &cm->yv12_fb[cm->gld_fb_idx];
   pbi->dec_fb_ref[ALTREF_FRAME] = &cm->yv12_fb[cm->alt_fb_idx];
 
-  retcode = vp8_decode_frame(pbi);
+  memset(&pbi->frame_times, 0, sizeof(pbi->frame_times));
+  memset(&pbi->frame_counts, 0, sizeof(pbi->frame_counts));
+  pbi->frame_skipped = 0;
+  return 0;
+}
+
+/* Keeps and shows the frame vp8_decode_frame() returned retcode for and
+ * adds it to the perf stats, timed from start_ns and start_ticks.
+ */
+static int finish_frame(VP8D_COMP *pbi, int retcode, int64_t start_ns,
+                        int64_t start_ticks, int64_t time_stamp) {
+  VP8_COMMON *cm = &pbi->common;
 
   if (retcode < 0) {
     if (cm->fb_idx_ref_cnt[cm->new_fb_idx] > 0) {
@@ -336,6 +447,13 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, int64_t time_stamp) {
     goto decode_exit;
   }
 
+  /* A skipped frame is neither kept nor shown. */
+  if (pbi->frame_skipped) {
+    cm->fb_idx_ref_cnt[cm->new_fb_idx]--;
+    ++pbi->skipped_frames;
+    goto decode_exit;
+  }
+
   if (swap_frame_buffers(cm)) {
     pbi->common.error.error_code = VPX_CODEC_ERROR;
     goto decode_exit;
@@ -367,6 +485,40 @@ int vp8dx_receive_compressed_data(VP8D_COMP *pbi, int64_t time_stamp) {
   }
 #endif
 
+  /* Only frames decoded successfully count towards the perf stats. */
+  {
+    const int64_t ns = vpx_timer_ns() - start_ns;
+    const int64_t ticks = vpx_timer_ticks() - start_ticks;
+    const double scale = ticks > 0 ? (double)ns / ticks : 0.0;
+    STAGE_TIMES *const t = &pbi->frame_times;
+    STAGE_TIMES *const total = &pbi->total_times;
+    const MB_COUNTS *const c = &pbi->frame_counts;
+
+    t->decode = ns;
+    t->mode_mvs = (int64_t)(t->mode_mvs * scale);
+    t->tokens = (int64_t)(t->tokens * scale);
+    t->recon = (int64_t)(t->recon * scale);
+    t->loop_filter = (int64_t)(t->loop_filter * scale);
+    t->extend = (int64_t)(t->extend * scale);
+
+    total->decode += t->decode;
+    total->mode_mvs += t->mode_mvs;
+    total->tokens += t->tokens;
+    total->recon += t->recon;
+    total->loop_filter += t->loop_filter;
+    total->extend += t->extend;
+
+    pbi->total_counts.mbs += c->mbs;
+    pbi->total_counts.skipped += c->skipped;
+    pbi->total_counts.intra += c->intra;
+    pbi->total_counts.split_mv += c->split_mv;
+    pbi->total_counts.dc_only += c->dc_only;
+
+    pbi->last_frame_times = *t;
+    pbi->last_frame_counts = *c;
+    ++pbi->perf_frames;
+  }
+
   pbi->ready_for_new_data = 0;
   pbi->last_time_stamp = time_stamp;
 
@@ -374,6 +526,139 @@ decode_exit:
   vpx_clear_system_state();
   return retcode;
 }
+
+int vp8dx_receive_compressed_data(VP8D_COMP *pbi, int64_t time_stamp) {
+  int retcode = -1;
+  int64_t start_ns, start_ticks;
+
+  pbi->common.error.error_code = VPX_CODEC_OK;
+
+  retcode = check_fragments_for_errors(pbi);
+  if (retcode <= 0) return retcode;
+
+  if (start_frame(pbi)) return -1;
+
+  start_ns = vpx_timer_ns();
+  start_ticks = vpx_timer_ticks();
+
+  retcode = vp8_decode_frame(pbi);
+
+  return finish_frame(pbi, retcode, start_ns, start_ticks, time_stamp);
+}
+
+/* A partial frame is started once its first partition has arrived, along
+ * with the token partition sizes that follow it.
+ */
+static int first_partition_arrived(VP8D_COMP *pbi, const unsigned char *data,
+                                   unsigned int data_sz) {
+  unsigned char clear[3];
+  unsigned int header_sz, first_partition_sz;
+
+  if (data_sz < 3) return 0;
+
+  if (pbi->decrypt_cb) {
+    pbi->decrypt_cb(pbi->decrypt_state, data, clear, 3);
+  } else {
+    memcpy(clear, data, 3);
+  }
+
+  /* Key frames have the start code and frame size after the frame tag. */
+  header_sz = (clear[0] & 1) ? 3 : 10;
+  first_partition_sz = (clear[0] | (clear[1] << 8) | (clear[2] << 16)) >> 5;
+  return data_sz >= header_sz + first_partition_sz +
+                        3 * ((1 << EIGHT_PARTITION) - 1);
+}
+
+int vp8dx_receive_partial_data(VP8D_COMP *pbi, const unsigned char *data,
+                               unsigned int data_sz, int final,
+                               int64_t time_stamp) {
+  VP8_COMMON *cm = &pbi->common;
+  const int64_t start_ns = vpx_timer_ns();
+  const int64_t start_ticks = vpx_timer_ticks();
+  int retcode, done = final;
+
+  pbi->common.error.error_code = VPX_CODEC_OK;
+
+  if (pbi->partial_frame == PARTIAL_DONE) {
+    if (final) pbi->partial_frame = PARTIAL_NONE;
+    return 0;
+  }
+
+  if (pbi->partial_frame == PARTIAL_NONE) {
+    /* A frame that ends before it could be started is decoded whole, as
+     * is every frame with error concealment.
+     */
+    if (final) {
+      pbi->fragments.ptrs[0] = data;
+      pbi->fragments.sizes[0] = data_sz;
+      pbi->fragments.count = data_sz ? 1 : 0;
+      return vp8dx_receive_compressed_data(pbi, time_stamp);
+    }
+    if (pbi->ec_enabled || !first_partition_arrived(pbi, data, data_sz)) {
+      return 0;
+    }
+
+    if (pbi->saved_cols < cm->mb_cols) {
+      vpx_free(pbi->saved_above_context);
+      vpx_free(pbi->saved_skip);
+      pbi->saved_cols = 0;
+      CHECK_MEM_ERROR(
+          pbi->saved_above_context,
+          vpx_malloc(sizeof(ENTROPY_CONTEXT_PLANES) * cm->mb_cols));
+      CHECK_MEM_ERROR(pbi->saved_skip, vpx_malloc(cm->mb_cols));
+      pbi->saved_cols = cm->mb_cols;
+    }
+
+    if (start_frame(pbi)) return -1;
+
+    pbi->fragments.ptrs[0] = data;
+    pbi->fragments.sizes[0] = data_sz;
+    pbi->fragments.count = 1;
+    pbi->partial_frame = PARTIAL_DECODING;
+    pbi->partial_end = data + data_sz;
+    pbi->partial_ns = 0;
+    pbi->partial_ticks = 0;
+
+    /* Frames that fail or are skipped end here, ignoring the rest of
+     * their data.
+     */
+    retcode = vp8_decode_frame(pbi);
+    done = retcode < 0 || pbi->frame_skipped;
+  } else {
+    pbi->partial_end = data + data_sz;
+    retcode = vp8_decode_frame_rows(pbi, final);
+  }
+
+  if (!done) {
+    pbi->partial_ns += vpx_timer_ns() - start_ns;
+    pbi->partial_ticks += vpx_timer_ticks() - start_ticks;
+    return retcode;
+  }
+
+  pbi->partial_frame = final ? PARTIAL_NONE : PARTIAL_DONE;
+  return finish_frame(pbi, retcode, start_ns - pbi->partial_ns,
+                      start_ticks - pbi->partial_ticks, time_stamp);
+}
+
+void vp8dx_move_partial_data(VP8D_COMP *pbi, const unsigned char *from,
+                             const unsigned char *to) {
+  unsigned int i;
+
+  if (pbi->partial_frame != PARTIAL_DECODING) return;
+
+  for (i = 0; i < pbi->fragments.count; ++i) {
+    pbi->fragments.ptrs[i] = to + (pbi->fragments.ptrs[i] - from);
+  }
+  for (i = 0; i < MAX_PARTITIONS; ++i) {
+    BOOL_DECODER *const bd = &pbi->mbc[i];
+    if (i + 1 < pbi->fragments.count || i == MAX_PARTITIONS - 1) {
+      bd->user_buffer = to + (bd->user_buffer - from);
+      bd->user_buffer_end = to + (bd->user_buffer_end - from);
+    }
+  }
+  pbi->partial_end = to + (pbi->partial_end - from);
+}
+
 int vp8dx_get_raw_frame(VP8D_COMP *pbi, YV12_BUFFER_CONFIG *sd,
                         int64_t *time_stamp, int64_t *time_end_stamp,
                         vp8_ppflags_t *flags) {
@@ -439,7 +724,8 @@ int vp8_create_decoder_instances(struct frame_buffers *fb, VP8D_CONFIG *oxcf) {
   }
 
   fb->pbi[0]->common.error.setjmp = 1;
-  fb->pbi[0]->max_threads = oxcf->max_threads;
+  /* A NULL config gives a single threaded decoder. */
+  fb->pbi[0]->max_threads = oxcf ? oxcf->max_threads : 1;
   vp8_decoder_create_threads(fb->pbi[0]);
   fb->pbi[0]->common.error.setjmp = 0;
 #endif
@@ -462,3 +748,42 @@ int vp8_remove_decoder_instances(struct frame_buffers *fb) {
 int vp8dx_get_quantizer(const VP8D_COMP *pbi) {
   return pbi->common.base_qindex;
 }
+
+void vp8dx_get_memory_usage(const VP8D_COMP *pbi, vp8d_memory_usage *usage) {
+  const VP8_COMMON *const cm = &pbi->common;
+  const size_t mode_info = (size_t)cm->mip_alloc_size * sizeof(MODE_INFO);
+  int i;
+
+  /* buffer_alloc_sz is 0 for application buffers. */
+  for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
+    if (cm->yv12_fb[i].buffer_alloc) {
+      ++usage->frame_buffer_count;
+      usage->frame_buffers += cm->yv12_fb[i].buffer_alloc_sz;
+    }
+  }
+  if (cm->temp_scale_frame.buffer_alloc) {
+    usage->frame_buffers += cm->temp_scale_frame.buffer_alloc_sz;
+  }
+#if CONFIG_POSTPROC
+  usage->frame_buffers += cm->post_proc_buffer.buffer_alloc_sz;
+  usage->frame_buffers += cm->post_proc_buffer_int.buffer_alloc_sz;
+#endif
+
+  if (cm->mip) usage->mb_info += mode_info;
+  if (cm->above_context) {
+    usage->mb_info +=
+        sizeof(ENTROPY_CONTEXT_PLANES) * cm->above_context_alloc_cols;
+  }
+  usage->mb_info += (sizeof(ENTROPY_CONTEXT_PLANES) + 1) * pbi->saved_cols;
+#if CONFIG_ERROR_CONCEALMENT
+  if (cm->prev_mip) usage->mb_info += mode_info;
+  usage->mb_info += sizeof(MB_OVERLAP) * pbi->overlap_mbs +
+                    sizeof(OVERLAP_NODE) * pbi->overlap_pool.size;
+#endif
+
+#if CONFIG_MULTITHREAD
+  usage->threads += vp8mt_get_memory_usage(pbi);
+#endif
+
+  usage->other += sizeof(*pbi);
+}
@@ -16,6 +16,7 @@
 #include "treereader.h"
 #include "vp8/common/onyxc_int.h"
 #include "vp8/common/threading.h"
+#include "vpx_ports/vpx_timer.h"
 
 #if CONFIG_ERROR_CONCEALMENT
 #include "ec_types.h"
@@ -31,10 +32,45 @@ typedef struct {
   void *ptr2;
 } DECODETHREAD_DATA;
 
+/* Time spent in each stage of decoding a frame, in vpx_timer_ticks() while the
+ * frame is decoded and nanoseconds after. Every thread sums into its own
+ * copy, which are folded together once the frame is done. decode is the
+ * wall clock time of the whole frame and is only set once it is done.
+ */
+typedef struct {
+  int64_t decode;
+  int64_t mode_mvs;
+  int64_t tokens;
+  int64_t recon;
+  int64_t loop_filter;
+  int64_t extend;
+} STAGE_TIMES;
+
+/* The kinds of MB decoded, counted per thread like STAGE_TIMES. */
+typedef struct {
+  uint64_t mbs;
+  uint64_t skipped;
+  uint64_t intra;
+  uint64_t split_mv;
+  uint64_t dc_only;
+} MB_COUNTS;
+
 typedef struct {
   MACROBLOCKD mbd;
+  STAGE_TIMES times;
+  MB_COUNTS counts;
 } MB_ROW_DEC;
 
+/* The tokens of one MB, entropy decoded ahead of reconstruction. Only the
+ * blocks that have coefficients are written.
+ */
+typedef struct {
+  DECLARE_ALIGNED(16, short, qcoeff[400]);
+  char eobs[25];
+  /* Set once the MB's partition has run out of data. */
+  unsigned char bool_error;
+} MB_TOKENS;
+
 typedef struct {
   int enabled;
   unsigned int count;
@@ -44,6 +80,21 @@ typedef struct {
 
 #define MAX_FB_MT_DEC 32
 
+/* Progress through a frame decoded as its data arrives. */
+typedef enum {
+  PARTIAL_NONE,
+  PARTIAL_DECODING,
+  /* Finished or failed early, the rest of its data is ignored. */
+  PARTIAL_DONE
+} PARTIAL_STATE;
+
+/* The frames decoded, set with VP8D_SET_DECODE_MODE. */
+typedef enum {
+  DECODE_ALL_FRAMES,
+  DECODE_REFERENCE_FRAMES,
+  DECODE_KEY_FRAMES
+} DECODE_MODE;
+
 struct frame_buffers {
   /*
    * this struct will be populated with frame buffer management
@@ -87,26 +138,58 @@ typedef struct VP8D_COMP {
   unsigned char **mt_yleft_col; /* mb_rows x 16 */
   unsigned char **mt_uleft_col; /* mb_rows x 8 */
   unsigned char **mt_vleft_col; /* mb_rows x 8 */
+  /* Rows and width the row buffers above were allocated for. */
+  int mt_alloc_rows;
+  int mt_alloc_width;
 
   MB_ROW_DEC *mb_row_di;
   DECODETHREAD_DATA *de_thread_data;
 
-  pthread_t *h_decoding_thread;
-  sem_t *h_event_start_decoding;
-  sem_t h_event_end_decoding;
+  /* One worker per thread, excluding the calling thread. The first
+   * decoding_thread_count reconstruct MB rows and the next
+   * parsing_thread_count entropy decode the token partitions.
+   */
+  VPxWorker *decoding_workers;
+
+  /* Non-zero to entropy decode the token partitions on their own workers,
+   * see VP8D_SET_PARTITION_MT.
+   */
+  int partition_mt;
+  unsigned int parsing_thread_count;
+  MB_TOKENS *mt_mb_tokens; /* mb_rows x mb_cols */
+  int mt_mb_tokens_alloc;  /* MB_TOKENS allocated in mt_mb_tokens */
+  /* Each row remembers its last parsed column. */
+  vpx_atomic_int *mt_parsed_mb_col;
 /* end of threading data */
 #endif
 
   int64_t last_time_stamp;
   int ready_for_new_data;
 
+  /* Stage times and MB counts of the frame being decoded, and of the last
+   * frame and every frame decoded successfully for VP8D_GET_PERF_STATS.
+   */
+  STAGE_TIMES frame_times;
+  STAGE_TIMES last_frame_times;
+  STAGE_TIMES total_times;
+  MB_COUNTS frame_counts;
+  MB_COUNTS last_frame_counts;
+  MB_COUNTS total_counts;
+  unsigned int perf_frames;
+  unsigned int skipped_frames;
+
   vp8_prob prob_intra;
   vp8_prob prob_last;
   vp8_prob prob_gf;
   vp8_prob prob_skip_false;
 
 #if CONFIG_ERROR_CONCEALMENT
+  /* Overlap lists for the MBs of overlap_mbs, kept across resolution
+   * changes that need no more.
+   */
   MB_OVERLAP *overlaps;
+  OVERLAP_POOL overlap_pool;
+  int overlap_mbs;
   /* the mb num from which modes and mvs (first partition) are corrupt */
   unsigned int mvs_corrupt_from_mb;
 #endif
@@ -116,8 +199,49 @@ typedef struct VP8D_COMP {
   int independent_partitions;
   int frame_corrupt_residual;
 
+  DECODE_MODE decode_mode;
+  /* Set when the frame refreshes no reference buffer and decode_mode lets
+   * it stop after parsing its header.
+   */
+  int frame_skipped;
+
+  /* The next MB row to decode, the first not yet handed to put_rows_cb and
+   * independent_partitions as it was before the frame.
+   */
+  int mb_row;
+  int rows_put;
+  int prev_independent_partitions;
+
+  /* Called with each run of MB rows that is final: reconstructed, loop
+   * filtered and extended. Only for frames that are shown.
+   */
+  void (*put_rows_cb)(void *priv, int mb_row, int mb_rows);
+  void *put_rows_priv;
+
+  /* Decoding a frame while its data arrives, see
+   * vp8dx_receive_partial_data(). partial_end is the end of the data so
+   * far. Rows that run out of data are undone from the saved above
+   * contexts and skip flags and decoded again once more has come.
+   */
+  PARTIAL_STATE partial_frame;
+  const unsigned char *partial_end;
+  int64_t partial_ns;
+  int64_t partial_ticks;
+  ENTROPY_CONTEXT_PLANES *saved_above_context;
+  unsigned char *saved_skip;
+  int saved_cols;
+
   vpx_decrypt_cb decrypt_cb;
   void *decrypt_state;
+
+  /* Application frame buffer callbacks. When set, each frame is decoded into
+   * a buffer from get_ext_fb_cb, held in ext_fb[] against its yv12_fb slot,
+   * and handed back through release_ext_fb_cb once the slot is unreferenced.
+   */
+  vpx_get_frame_buffer_cb_fn_t get_ext_fb_cb;
+  vpx_release_frame_buffer_cb_fn_t release_ext_fb_cb;
+  void *ext_cb_priv;
+  vpx_codec_frame_buffer_t ext_fb[NUM_YV12_BUFFERS];
 #if CONFIG_MULTITHREAD
   // Restart threads on next frame if set to 1.
   // This is set when error happens in multithreaded decoding and all threads
@@ -126,9 +250,37 @@ typedef struct VP8D_COMP {
 #endif
 } VP8D_COMP;
 
+/* Counts the MB just reconstructed. Skipped MBs have no coefficients, either
+ * from the skip flag or because none were coded. DC only MBs have at most
+ * a DC coefficient in each block, so they only need DC only inverse
+ * transforms.
+ */
+static INLINE void vp8dx_count_mb(MB_COUNTS *counts, const MACROBLOCKD *xd) {
+  const MB_MODE_INFO *const mbmi = &xd->mode_info_context->mbmi;
+
+  ++counts->mbs;
+  counts->intra += mbmi->ref_frame == INTRA_FRAME;
+  counts->split_mv += mbmi->mode == SPLITMV;
+
+  if (mbmi->mb_skip_coeff) {
+    ++counts->skipped;
+  } else {
+    const int blocks = mbmi->is_4x4 ? 24 : 25;
+    int eobs = 0;
+    int i;
+
+    for (i = 0; i < blocks; ++i) eobs |= xd->eobs[i];
+    counts->dc_only += eobs <= 1;
+  }
+}
+
 void vp8cx_init_de_quantizer(VP8D_COMP *pbi);
 void vp8_mb_init_dequantizer(VP8D_COMP *pbi, MACROBLOCKD *xd);
 int vp8_decode_frame(VP8D_COMP *pbi);
+/* Decodes the rows of a partial frame that its new data allows, and the
+ * rest once final is set.
+ */
+int vp8_decode_frame_rows(VP8D_COMP *pbi, int final);
 
 int vp8_create_decoder_instances(struct frame_buffers *fb, VP8D_CONFIG *oxcf);
 int vp8_remove_decoder_instances(struct frame_buffers *fb);
@@ -14,6 +14,7 @@
 #include <unistd.h>
 #endif
 #include "onyxd_int.h"
+#include "vpx_dsp/vpx_dsp_common.h"
 #include "vpx_mem/vpx_mem.h"
 #include "vp8/common/common.h"
 #include "vp8/common/threading.h"
@@ -77,14 +78,115 @@ static void setup_decoding_thread_data(VP8D_COMP *pbi, MACROBLOCKD *xd,
     mbd->fullpixel_mask = 0xffffffff;
 
     if (pc->full_pixel) mbd->fullpixel_mask = 0xfffffff8;
+
+    mbd->corrupted = 0;
   }
 
-  for (i = 0; i < pc->mb_rows; ++i)
+  for (i = 0; i < pc->mb_rows; ++i) {
     vpx_atomic_store_release(&pbi->mt_current_mb_col[i], -1);
+    vpx_atomic_store_release(&pbi->mt_parsed_mb_col[i], -1);
+  }
+}
+
+/* Y blocks carry no DC when the MB has a Y2 block, so an eob of 1 means no
+ * coefficients were decoded.
+ */
+static INLINE int block_has_coeffs(const char *eobs, int i, int has_y2) {
+  return eobs[i] > (has_y2 && i < 16);
+}
+
+static void mt_parse_macroblock(VP8D_COMP *pbi, MACROBLOCKD *xd,
+                                MB_TOKENS *tokens) {
+  MB_MODE_INFO *const mbmi = &xd->mode_info_context->mbmi;
+  const int has_y2 = !mbmi->is_4x4;
+  int i;
+
+  memset(tokens->eobs, 0, sizeof(tokens->eobs));
+
+  if (mbmi->mb_skip_coeff) {
+    vp8_reset_mb_tokens_context(xd);
+  } else if (!vp8dx_bool_error(xd->current_bc)) {
+    /* Special case:  Force the loopfilter to skip when eobtotal is zero */
+    mbmi->mb_skip_coeff = (vp8_decode_mb_tokens(pbi, xd) == 0);
+
+    memcpy(tokens->eobs, xd->eobs, has_y2 ? 25 : 24);
+
+    /* Hand the coefficients over and leave xd->qcoeff zeroed for the next
+     * MB, as the dequantizers do after reconstruction.
+     */
+    for (i = 0; i < 25; ++i) {
+      if (block_has_coeffs(tokens->eobs, i, has_y2)) {
+        memcpy(tokens->qcoeff + i * 16, xd->qcoeff + i * 16,
+               16 * sizeof(xd->qcoeff[0]));
+        memset(xd->qcoeff + i * 16, 0, 16 * sizeof(xd->qcoeff[0]));
+      }
+    }
+  }
+
+  tokens->bool_error = (unsigned char)vp8dx_bool_error(xd->current_bc);
 }
 
+static void mt_load_mb_tokens(MACROBLOCKD *xd, const MB_TOKENS *tokens) {
+  const int has_y2 = !xd->mode_info_context->mbmi.is_4x4;
+  int i;
+
+  memcpy(xd->eobs, tokens->eobs, sizeof(xd->eobs));
+
+  for (i = 0; i < 25; ++i) {
+    if (block_has_coeffs(tokens->eobs, i, has_y2)) {
+      memcpy(xd->qcoeff + i * 16, tokens->qcoeff + i * 16,
+             16 * sizeof(xd->qcoeff[0]));
+    }
+  }
+}
+
+/* Entropy decodes every parsing_thread_count'th MB row into mt_mb_tokens.
+ * The count divides the number of partitions, so each partition is read by
+ * one worker only and in row order. Row progress is published per MB since
+ * both the row below and reconstruction of this row wait on it.
+ */
+static void mt_parse_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
+                             int start_mb_row, STAGE_TIMES *times) {
+  VP8_COMMON *const pc = &pbi->common;
+  const int num_part = 1 << pc->multi_token_partition;
+  int mb_row;
+
+  for (mb_row = start_mb_row; mb_row < pc->mb_rows;
+       mb_row += pbi->parsing_thread_count) {
+    MB_TOKENS *tokens = pbi->mt_mb_tokens + mb_row * pc->mb_cols;
+    vpx_atomic_int *parsed_mb_col = &pbi->mt_parsed_mb_col[mb_row];
+    int mb_col;
+    int64_t mark;
+
+    xd->current_bc = &pbi->mbc[mb_row % num_part];
+    xd->mode_info_context = pc->mi + pc->mode_info_stride * mb_row;
+    xd->above_context = pc->above_context;
+    memset(xd->left_context, 0, sizeof(ENTROPY_CONTEXT_PLANES));
+
+    for (mb_col = 0; mb_col < pc->mb_cols; ++mb_col) {
+      /* The above context is valid once the row above has parsed this MB. */
+      if (mb_row) {
+        vp8_atomic_spin_wait(mb_col, &pbi->mt_parsed_mb_col[mb_row - 1], 0);
+      }
+
+      mark = vpx_timer_ticks();
+      mt_parse_macroblock(pbi, xd, tokens++);
+      vpx_timer_ticks_add(&times->tokens, &mark);
+      vpx_atomic_store_release(parsed_mb_col, mb_col);
+
+      ++xd->mode_info_context;
+      ++xd->above_context;
+    }
+  }
+}
+
+/* tokens holds the MB's coefficients when a partition worker has already
+ * parsed them, otherwise they are read from xd->current_bc and the time
+ * taken is added to times->tokens.
+ */
 static void mt_decode_macroblock(VP8D_COMP *pbi, MACROBLOCKD *xd,
-                                 unsigned int mb_idx) {
+                                 unsigned int mb_idx, const MB_TOKENS *tokens,
+                                 STAGE_TIMES *times) {
   MB_PREDICTION_MODE mode;
   int i;
 #if CONFIG_ERROR_CONCEALMENT
@@ -93,11 +195,15 @@ static void mt_decode_macroblock(VP8D_COMP *pbi, MACROBLOCKD *xd,
   (void)mb_idx;
 #endif
 
-  if (xd->mode_info_context->mbmi.mb_skip_coeff) {
+  if (tokens) {
+    mt_load_mb_tokens(xd, tokens);
+  } else if (xd->mode_info_context->mbmi.mb_skip_coeff) {
     vp8_reset_mb_tokens_context(xd);
   } else if (!vp8dx_bool_error(xd->current_bc)) {
+    int64_t mark = vpx_timer_ticks();
     int eobtotal;
     eobtotal = vp8_decode_mb_tokens(pbi, xd);
+    vpx_timer_ticks_add(&times->tokens, &mark);
 
     /* Special case:  Force the loopfilter to skip when eobtotal is zero */
     xd->mode_info_context->mbmi.mb_skip_coeff = (eobtotal == 0);
@@ -246,8 +352,12 @@ static void mt_decode_macroblock(VP8D_COMP *pbi, MACROBLOCKD *xd,
   }
 }
 
+/* Stage times and MB counts are added to times and counts, which are private
+ * to the calling thread.
+ */
 static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
-                              int start_mb_row) {
+                              int start_mb_row, STAGE_TIMES *times,
+                              MB_COUNTS *counts) {
   const vpx_atomic_int *last_row_current_mb_col;
   vpx_atomic_int *current_mb_col;
   int mb_row;
@@ -256,7 +366,6 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
   const vpx_atomic_int first_row_no_sync_above =
       VPX_ATOMIC_INIT(pc->mb_cols + nsync);
   int num_part = 1 << pbi->common.multi_token_partition;
-  int last_mb_row = start_mb_row;
 
   YV12_BUFFER_CONFIG *yv12_fb_new = pbi->dec_fb_ref[INTRA_FRAME];
   YV12_BUFFER_CONFIG *yv12_fb_lst = pbi->dec_fb_ref[LAST_FRAME];
@@ -268,6 +377,7 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
   unsigned char *dst_buffer[3];
   int i;
   int ref_fb_corrupted[MAX_REF_FRAMES];
+  int64_t mark, mb_token_ticks;
 
   ref_fb_corrupted[INTRA_FRAME] = 0;
 
@@ -297,8 +407,6 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
     int filter_level;
     loop_filter_info_n *lfi_n = &pc->lf_info;
 
-    /* save last row processed by this thread */
-    last_mb_row = mb_row;
     /* select bool coder for current partition */
     xd->current_bc = &pbi->mbc[mb_row % num_part];
 
@@ -373,12 +481,12 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
       xd->mb_to_right_edge = ((pc->mb_cols - 1 - mb_col) * 16) << 3;
 
 #if CONFIG_ERROR_CONCEALMENT
-      {
+      /* Never active with partition workers, which own the bool decoders. */
+      if (pbi->ec_active) {
         int corrupt_residual =
             (!pbi->independent_partitions && pbi->frame_corrupt_residual) ||
             vp8dx_bool_error(xd->current_bc);
-        if (pbi->ec_active &&
-            (xd->mode_info_context->mbmi.ref_frame == INTRA_FRAME) &&
+        if ((xd->mode_info_context->mbmi.ref_frame == INTRA_FRAME) &&
             corrupt_residual) {
           /* We have an intra block with corrupt
            * coefficients, better to conceal with an inter
@@ -403,7 +511,8 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
       /* propagate errors from reference frames */
       xd->corrupted |= ref_fb_corrupted[xd->mode_info_context->mbmi.ref_frame];
 
-      if (xd->corrupted) {
+      /* Error concealment decodes through corruption, as on one thread. */
+      if (xd->corrupted && !pbi->ec_active) {
         // Move current decoding marcoblock to the end of row for all rows
         // assigned to this thread, such that other threads won't be waiting.
         for (; mb_row < pc->mb_rows;
@@ -426,12 +535,29 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
         xd->pre.u_buffer = 0;
         xd->pre.v_buffer = 0;
       }
-      mt_decode_macroblock(pbi, xd, 0);
 
-      xd->left_available = 1;
+      if (pbi->parsing_thread_count) {
+        const MB_TOKENS *tokens =
+            pbi->mt_mb_tokens + mb_row * pc->mb_cols + mb_col;
+
+        vp8_atomic_spin_wait(mb_col, &pbi->mt_parsed_mb_col[mb_row], 0);
+        mark = vpx_timer_ticks();
+        mt_decode_macroblock(pbi, xd, 0, tokens, times);
+
+        xd->corrupted |= tokens->bool_error;
+      } else {
+        mark = vpx_timer_ticks();
+        mb_token_ticks = times->tokens;
+        mt_decode_macroblock(pbi, xd, 0, NULL, times);
+        times->recon -= times->tokens - mb_token_ticks;
 
-      /* check if the boolean decoder has suffered an error */
-      xd->corrupted |= vp8dx_bool_error(xd->current_bc);
+        /* check if the boolean decoder has suffered an error */
+        xd->corrupted |= vp8dx_bool_error(xd->current_bc);
+      }
+
+      vpx_timer_ticks_add(&times->recon, &mark);
+      vp8dx_count_mb(counts, xd);
+      xd->left_available = 1;
 
       xd->recon_above[0] += 16;
       xd->recon_above[1] += 8;
@@ -533,6 +659,7 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
                                         lfi_n->blim[filter_level]);
           }
         }
+        vpx_timer_ticks_add(&times->loop_filter, &mark);
       }
 
       recon_yoffset += 16;
@@ -559,8 +686,10 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
         }
       }
     } else {
+      mark = vpx_timer_ticks();
       vp8_extend_mb_row(yv12_fb_new, xd->dst.y_buffer + 16,
                         xd->dst.u_buffer + 8, xd->dst.v_buffer + 8);
+      vpx_timer_ticks_add(&times->extend, &mark);
     }
 
     /* last MB of row is ready just after extension is done */
@@ -572,43 +701,52 @@ static void mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd,
     /* since we have multithread */
     xd->mode_info_context += xd->mode_info_stride * pbi->decoding_thread_count;
   }
-
-  /* signal end of decoding of current thread for current frame */
-  if (last_mb_row + (int)pbi->decoding_thread_count + 1 >= pc->mb_rows)
-    sem_post(&pbi->h_event_end_decoding);
 }
 
-static THREAD_FUNCTION thread_decoding_proc(void *p_data) {
-  int ithread = ((DECODETHREAD_DATA *)p_data)->ithread;
-  VP8D_COMP *pbi = (VP8D_COMP *)(((DECODETHREAD_DATA *)p_data)->ptr1);
-  MB_ROW_DEC *mbrd = (MB_ROW_DEC *)(((DECODETHREAD_DATA *)p_data)->ptr2);
+/* Worker hook decoding every (decoding_thread_count + 1)th MB row, starting
+ * at the row after the one the main thread decodes. An error is reported
+ * through mbd.corrupted, which the caller collects after syncing.
+ */
+static int thread_decoding_proc(void *arg1, void *arg2) {
+  VP8D_COMP *pbi = (VP8D_COMP *)arg1;
+  DECODETHREAD_DATA *thread_data = (DECODETHREAD_DATA *)arg2;
+  MB_ROW_DEC *mbrd = (MB_ROW_DEC *)thread_data->ptr2;
+  MACROBLOCKD *xd = &mbrd->mbd;
   ENTROPY_CONTEXT_PLANES mb_row_left_context;
 
-  while (1) {
-    if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd) == 0) break;
-
-    if (sem_wait(&pbi->h_event_start_decoding[ithread]) == 0) {
-      if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd) == 0) {
-        break;
-      } else {
-        MACROBLOCKD *xd = &mbrd->mbd;
-        xd->left_context = &mb_row_left_context;
-        if (setjmp(xd->error_info.jmp)) {
-          xd->error_info.setjmp = 0;
-          // Signal the end of decoding for current thread.
-          sem_post(&pbi->h_event_end_decoding);
-          continue;
-        }
-        xd->error_info.setjmp = 1;
-        mt_decode_mb_rows(pbi, xd, ithread + 1);
-      }
-    }
+  xd->left_context = &mb_row_left_context;
+  if (setjmp(xd->error_info.jmp)) {
+    xd->error_info.setjmp = 0;
+    xd->corrupted = 1;
+    return 0;
   }
+  xd->error_info.setjmp = 1;
+  mt_decode_mb_rows(pbi, xd, thread_data->ithread + 1, &mbrd->times,
+                    &mbrd->counts);
+  xd->error_info.setjmp = 0;
 
-  return 0;
+  return 1;
+}
+
+/* Worker hook entropy decoding for mt_decode_mb_rows(). It sits after the
+ * decoding workers in decoding_workers.
+ */
+static int thread_parsing_proc(void *arg1, void *arg2) {
+  VP8D_COMP *pbi = (VP8D_COMP *)arg1;
+  DECODETHREAD_DATA *thread_data = (DECODETHREAD_DATA *)arg2;
+  MB_ROW_DEC *mbrd = (MB_ROW_DEC *)thread_data->ptr2;
+  ENTROPY_CONTEXT_PLANES mb_row_left_context;
+
+  mbrd->mbd.left_context = &mb_row_left_context;
+  mt_parse_mb_rows(pbi, &mbrd->mbd,
+                   thread_data->ithread - (int)pbi->decoding_thread_count,
+                   &mbrd->times);
+
+  return 1;
 }
 
 void vp8_decoder_create_threads(VP8D_COMP *pbi) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
   int core_count = 0;
   unsigned int ithread;
 
@@ -627,18 +765,12 @@ void vp8_decoder_create_threads(VP8D_COMP *pbi) {
     vpx_atomic_init(&pbi->b_multithreaded_rd, 1);
     pbi->decoding_thread_count = core_count - 1;
 
-    CALLOC_ARRAY(pbi->h_decoding_thread, pbi->decoding_thread_count);
-    CALLOC_ARRAY(pbi->h_event_start_decoding, pbi->decoding_thread_count);
+    CALLOC_ARRAY(pbi->decoding_workers, pbi->decoding_thread_count);
     CALLOC_ARRAY_ALIGNED(pbi->mb_row_di, pbi->decoding_thread_count, 32);
     CALLOC_ARRAY(pbi->de_thread_data, pbi->decoding_thread_count);
 
-    if (sem_init(&pbi->h_event_end_decoding, 0, 0)) {
-      vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
-                         "Failed to initialize semaphore");
-    }
-
     for (ithread = 0; ithread < pbi->decoding_thread_count; ++ithread) {
-      if (sem_init(&pbi->h_event_start_decoding[ithread], 0, 0)) break;
+      VPxWorker *const worker = &pbi->decoding_workers[ithread];
 
       vp8_setup_block_dptrs(&pbi->mb_row_di[ithread].mbd);
 
@@ -646,11 +778,12 @@ void vp8_decoder_create_threads(VP8D_COMP *pbi) {
       pbi->de_thread_data[ithread].ptr1 = (void *)pbi;
       pbi->de_thread_data[ithread].ptr2 = (void *)&pbi->mb_row_di[ithread];
 
-      if (pthread_create(&pbi->h_decoding_thread[ithread], 0,
-                         thread_decoding_proc, &pbi->de_thread_data[ithread])) {
-        sem_destroy(&pbi->h_event_start_decoding[ithread]);
-        break;
-      }
+      winterface->init(worker);
+      worker->hook = thread_decoding_proc;
+      worker->data1 = pbi;
+      worker->data2 = &pbi->de_thread_data[ithread];
+
+      if (!winterface->reset(worker)) break;
     }
 
     pbi->allocated_decoding_thread_count = ithread;
@@ -658,21 +791,26 @@ void vp8_decoder_create_threads(VP8D_COMP *pbi) {
         (int)pbi->decoding_thread_count) {
       /* the remainder of cleanup cases will be handled in
        * vp8_decoder_remove_threads(). */
-      if (pbi->allocated_decoding_thread_count == 0) {
-        sem_destroy(&pbi->h_event_end_decoding);
-      }
       vpx_internal_error(&pbi->common.error, VPX_CODEC_MEM_ERROR,
                          "Failed to create threads");
     }
   }
 }
 
-void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi, int mb_rows) {
+void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi) {
+  const int mb_rows = pbi->mt_alloc_rows;
   int i;
 
   vpx_free(pbi->mt_current_mb_col);
   pbi->mt_current_mb_col = NULL;
 
+  vpx_free(pbi->mt_parsed_mb_col);
+  pbi->mt_parsed_mb_col = NULL;
+
+  vpx_free(pbi->mt_mb_tokens);
+  pbi->mt_mb_tokens = NULL;
+  pbi->mt_mb_tokens_alloc = 0;
+
   /* Free above_row buffers. */
   if (pbi->mt_yabove_row) {
     for (i = 0; i < mb_rows; ++i) {
@@ -728,15 +866,22 @@ void vp8mt_de_alloc_temp_buffers(VP8D_COMP *pbi, int mb_rows) {
     vpx_free(pbi->mt_vleft_col);
     pbi->mt_vleft_col = NULL;
   }
+
+  pbi->mt_alloc_rows = 0;
+  pbi->mt_alloc_width = 0;
 }
 
-void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width, int prev_mb_rows) {
+/* Sets the row buffers up for the current size. They are only allocated
+ * again when it has more rows or a wider width than they were allocated for,
+ * and then for the larger of the two sizes in each direction, so switching
+ * between sizes already seen does not touch the heap.
+ */
+void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width) {
   VP8_COMMON *const pc = &pbi->common;
   int i;
-  int uv_width;
 
   if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd)) {
-    vp8mt_de_alloc_temp_buffers(pbi, prev_mb_rows);
+    int rows, uv_width;
 
     /* our internal buffers are always multiples of 16 */
     if ((width & 0xf) != 0) width += 16 - (width & 0xf);
@@ -751,82 +896,112 @@ void vp8mt_alloc_temp_buffers(VP8D_COMP *pbi, int width, int prev_mb_rows) {
       pbi->sync_range = 32;
     }
 
-    uv_width = width >> 1;
+    if (pc->mb_rows > pbi->mt_alloc_rows || width > pbi->mt_alloc_width) {
+      rows = VPXMAX(pc->mb_rows, pbi->mt_alloc_rows);
+      width = VPXMAX(width, pbi->mt_alloc_width);
+
+      vp8mt_de_alloc_temp_buffers(pbi);
+
+      /* Set first so a failure part way frees what was allocated. The
+       * caller frees them on failure, which also clears the sizes. */
+      pbi->mt_alloc_rows = rows;
+      pbi->mt_alloc_width = width;
+      uv_width = width >> 1;
+
+      /* Allocate a vpx_atomic_int for each mb row. */
+      CHECK_MEM_ERROR(pbi->mt_current_mb_col,
+                      vpx_malloc(sizeof(*pbi->mt_current_mb_col) * rows));
+      CHECK_MEM_ERROR(pbi->mt_parsed_mb_col,
+                      vpx_malloc(sizeof(*pbi->mt_parsed_mb_col) * rows));
+
+      /* Allocate memory for above_row buffers. */
+      CALLOC_ARRAY(pbi->mt_yabove_row, rows);
+      for (i = 0; i < rows; ++i) {
+        CHECK_MEM_ERROR(
+            pbi->mt_yabove_row[i],
+            vpx_memalign(16, sizeof(unsigned char) *
+                                 (width + (VP8BORDERINPIXELS << 1))));
+      }
 
-    /* Allocate a vpx_atomic_int for each mb row. */
-    CHECK_MEM_ERROR(pbi->mt_current_mb_col,
-                    vpx_malloc(sizeof(*pbi->mt_current_mb_col) * pc->mb_rows));
-    for (i = 0; i < pc->mb_rows; ++i)
-      vpx_atomic_init(&pbi->mt_current_mb_col[i], 0);
+      CALLOC_ARRAY(pbi->mt_uabove_row, rows);
+      for (i = 0; i < rows; ++i) {
+        CHECK_MEM_ERROR(pbi->mt_uabove_row[i],
+                        vpx_memalign(16, sizeof(unsigned char) *
+                                             (uv_width + VP8BORDERINPIXELS)));
+      }
 
-    /* Allocate memory for above_row buffers. */
-    CALLOC_ARRAY(pbi->mt_yabove_row, pc->mb_rows);
-    for (i = 0; i < pc->mb_rows; ++i) {
-      CHECK_MEM_ERROR(pbi->mt_yabove_row[i],
-                      vpx_memalign(16, sizeof(unsigned char) *
-                                           (width + (VP8BORDERINPIXELS << 1))));
-      vp8_zero_array(pbi->mt_yabove_row[i], width + (VP8BORDERINPIXELS << 1));
-    }
+      CALLOC_ARRAY(pbi->mt_vabove_row, rows);
+      for (i = 0; i < rows; ++i) {
+        CHECK_MEM_ERROR(pbi->mt_vabove_row[i],
+                        vpx_memalign(16, sizeof(unsigned char) *
+                                             (uv_width + VP8BORDERINPIXELS)));
+      }
 
-    CALLOC_ARRAY(pbi->mt_uabove_row, pc->mb_rows);
-    for (i = 0; i < pc->mb_rows; ++i) {
-      CHECK_MEM_ERROR(pbi->mt_uabove_row[i],
-                      vpx_memalign(16, sizeof(unsigned char) *
-                                           (uv_width + VP8BORDERINPIXELS)));
-      vp8_zero_array(pbi->mt_uabove_row[i], uv_width + VP8BORDERINPIXELS);
+      /* Allocate memory for left_col buffers. */
+      CALLOC_ARRAY(pbi->mt_yleft_col, rows);
+      for (i = 0; i < rows; ++i)
+        CHECK_MEM_ERROR(pbi->mt_yleft_col[i],
+                        vpx_malloc(sizeof(unsigned char) * 16));
+
+      CALLOC_ARRAY(pbi->mt_uleft_col, rows);
+      for (i = 0; i < rows; ++i)
+        CHECK_MEM_ERROR(pbi->mt_uleft_col[i],
+                        vpx_malloc(sizeof(unsigned char) * 8));
+
+      CALLOC_ARRAY(pbi->mt_vleft_col, rows);
+      for (i = 0; i < rows; ++i)
+        CHECK_MEM_ERROR(pbi->mt_vleft_col[i],
+                        vpx_malloc(sizeof(unsigned char) * 8));
     }
 
-    CALLOC_ARRAY(pbi->mt_vabove_row, pc->mb_rows);
+    /* Start the rows in use from zero, as newly allocated ones would. */
+    width = pbi->mt_alloc_width;
+    uv_width = width >> 1;
     for (i = 0; i < pc->mb_rows; ++i) {
-      CHECK_MEM_ERROR(pbi->mt_vabove_row[i],
-                      vpx_memalign(16, sizeof(unsigned char) *
-                                           (uv_width + VP8BORDERINPIXELS)));
+      vpx_atomic_init(&pbi->mt_current_mb_col[i], 0);
+      vpx_atomic_init(&pbi->mt_parsed_mb_col[i], 0);
+      vp8_zero_array(pbi->mt_yabove_row[i], width + (VP8BORDERINPIXELS << 1));
+      vp8_zero_array(pbi->mt_uabove_row[i], uv_width + VP8BORDERINPIXELS);
       vp8_zero_array(pbi->mt_vabove_row[i], uv_width + VP8BORDERINPIXELS);
+      vp8_zero_array(pbi->mt_yleft_col[i], 16);
+      vp8_zero_array(pbi->mt_uleft_col[i], 8);
+      vp8_zero_array(pbi->mt_vleft_col[i], 8);
     }
-
-    /* Allocate memory for left_col buffers. */
-    CALLOC_ARRAY(pbi->mt_yleft_col, pc->mb_rows);
-    for (i = 0; i < pc->mb_rows; ++i)
-      CHECK_MEM_ERROR(pbi->mt_yleft_col[i],
-                      vpx_calloc(sizeof(unsigned char) * 16, 1));
-
-    CALLOC_ARRAY(pbi->mt_uleft_col, pc->mb_rows);
-    for (i = 0; i < pc->mb_rows; ++i)
-      CHECK_MEM_ERROR(pbi->mt_uleft_col[i],
-                      vpx_calloc(sizeof(unsigned char) * 8, 1));
-
-    CALLOC_ARRAY(pbi->mt_vleft_col, pc->mb_rows);
-    for (i = 0; i < pc->mb_rows; ++i)
-      CHECK_MEM_ERROR(pbi->mt_vleft_col[i],
-                      vpx_calloc(sizeof(unsigned char) * 8, 1));
   }
 }
 
+size_t vp8mt_get_memory_usage(const VP8D_COMP *pbi) {
+  const size_t width = pbi->mt_alloc_width;
+  size_t size;
+
+  if (!vpx_atomic_load_acquire(&pbi->b_multithreaded_rd)) return 0;
+
+  size = (sizeof(VPxWorker) + sizeof(MB_ROW_DEC) + sizeof(DECODETHREAD_DATA)) *
+         pbi->decoding_thread_count;
+  /* The column progress, row pointers, above rows and left columns. */
+  size += (2 * sizeof(vpx_atomic_int) + 6 * sizeof(unsigned char *) +
+           width + (VP8BORDERINPIXELS << 1) +
+           2 * ((width >> 1) + VP8BORDERINPIXELS) + 16 + 8 + 8) *
+          pbi->mt_alloc_rows;
+  size += sizeof(MB_TOKENS) * pbi->mt_mb_tokens_alloc;
+  return size;
+}
+
 void vp8_decoder_remove_threads(VP8D_COMP *pbi) {
   /* shutdown MB Decoding thread; */
   if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd)) {
+    const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
     int i;
     vpx_atomic_store_release(&pbi->b_multithreaded_rd, 0);
 
-    /* allow all threads to exit */
+    /* finish any outstanding work and join the threads */
     for (i = 0; i < pbi->allocated_decoding_thread_count; ++i) {
-      sem_post(&pbi->h_event_start_decoding[i]);
-      pthread_join(pbi->h_decoding_thread[i], NULL);
+      winterface->end(&pbi->decoding_workers[i]);
     }
+    pbi->allocated_decoding_thread_count = 0;
 
-    for (i = 0; i < pbi->allocated_decoding_thread_count; ++i) {
-      sem_destroy(&pbi->h_event_start_decoding[i]);
-    }
-
-    if (pbi->allocated_decoding_thread_count) {
-      sem_destroy(&pbi->h_event_end_decoding);
-    }
-
-    vpx_free(pbi->h_decoding_thread);
-    pbi->h_decoding_thread = NULL;
-
-    vpx_free(pbi->h_event_start_decoding);
-    pbi->h_event_start_decoding = NULL;
+    vpx_free(pbi->decoding_workers);
+    pbi->decoding_workers = NULL;
 
     vpx_free(pbi->mb_row_di);
     pbi->mb_row_di = NULL;
@@ -834,12 +1009,40 @@ void vp8_decoder_remove_threads(VP8D_COMP *pbi) {
     vpx_free(pbi->de_thread_data);
     pbi->de_thread_data = NULL;
 
-    vp8mt_de_alloc_temp_buffers(pbi, pbi->common.mb_rows);
+    vp8mt_de_alloc_temp_buffers(pbi);
+  }
+}
+
+/* Adds the workers' stage times and MB counts into the frame's once they
+ * have synced.
+ */
+static void collect_frame_stats(VP8D_COMP *pbi, unsigned int num_workers) {
+  unsigned int i;
+
+  for (i = 0; i < num_workers; ++i) {
+    STAGE_TIMES *const t = &pbi->mb_row_di[i].times;
+    MB_COUNTS *const c = &pbi->mb_row_di[i].counts;
+
+    pbi->frame_times.tokens += t->tokens;
+    pbi->frame_times.recon += t->recon;
+    pbi->frame_times.loop_filter += t->loop_filter;
+    pbi->frame_times.extend += t->extend;
+    memset(t, 0, sizeof(*t));
+
+    pbi->frame_counts.mbs += c->mbs;
+    pbi->frame_counts.skipped += c->skipped;
+    pbi->frame_counts.intra += c->intra;
+    pbi->frame_counts.split_mv += c->split_mv;
+    pbi->frame_counts.dc_only += c->dc_only;
+    memset(c, 0, sizeof(*c));
   }
 }
 
 int vp8mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
   VP8_COMMON *pc = &pbi->common;
+  const unsigned int num_workers =
+      pbi->decoding_thread_count + pbi->parsing_thread_count;
   unsigned int i;
   int j;
 
@@ -877,11 +1080,25 @@ int vp8mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd) {
     vp8_setup_intra_recon_top_line(yv12_fb_new);
   }
 
-  setup_decoding_thread_data(pbi, xd, pbi->mb_row_di,
-                             pbi->decoding_thread_count);
+  if (pbi->parsing_thread_count && pbi->mt_mb_tokens_alloc < pc->MBs) {
+    vpx_free(pbi->mt_mb_tokens);
+    pbi->mt_mb_tokens = NULL;
+    pbi->mt_mb_tokens_alloc = 0;
+    CALLOC_ARRAY_ALIGNED(pbi->mt_mb_tokens, pc->MBs, 16);
+    pbi->mt_mb_tokens_alloc = pc->MBs;
+  }
+
+  setup_decoding_thread_data(pbi, xd, pbi->mb_row_di, num_workers);
+
+  /* Parsing starts first so reconstruction finds tokens waiting. */
+  for (i = pbi->decoding_thread_count; i < num_workers; ++i) {
+    pbi->decoding_workers[i].hook = thread_parsing_proc;
+    winterface->launch(&pbi->decoding_workers[i]);
+  }
 
   for (i = 0; i < pbi->decoding_thread_count; ++i) {
-    sem_post(&pbi->h_event_start_decoding[i]);
+    pbi->decoding_workers[i].hook = thread_decoding_proc;
+    winterface->launch(&pbi->decoding_workers[i]);
   }
 
   if (setjmp(xd->error_info.jmp)) {
@@ -890,16 +1107,20 @@ int vp8mt_decode_mb_rows(VP8D_COMP *pbi, MACROBLOCKD *xd) {
     // Wait for other threads to finish. This prevents other threads decoding
     // the current frame while the main thread starts decoding the next frame,
     // which causes a data race.
-    for (i = 0; i < pbi->decoding_thread_count; ++i)
-      sem_wait(&pbi->h_event_end_decoding);
+    for (i = 0; i < num_workers; ++i)
+      winterface->sync(&pbi->decoding_workers[i]);
+    collect_frame_stats(pbi, num_workers);
     return -1;
   }
 
   xd->error_info.setjmp = 1;
-  mt_decode_mb_rows(pbi, xd, 0);
+  mt_decode_mb_rows(pbi, xd, 0, &pbi->frame_times, &pbi->frame_counts);
+
+  /* Worker errors are picked up from their mbd.corrupted by the caller. */
+  for (i = 0; i < num_workers; ++i)
+    winterface->sync(&pbi->decoding_workers[i]);
 
-  for (i = 0; i < pbi->decoding_thread_count + 1; ++i)
-    sem_wait(&pbi->h_event_end_decoding); /* add back for each frame */
+  collect_frame_stats(pbi, num_workers);
 
   return 0;
 }
@@ -25,16 +25,25 @@ typedef BOOL_DECODER vp8_reader;
 #define vp8_read_literal vp8_decode_value
 #define vp8_read_bit(R) vp8_read(R, vp8_prob_half)
 
-/* Intent of tree data structure is to make decoding trivial. */
-
-static INLINE int vp8_treed_read(
-    vp8_reader *const r, /* !!! must return a 0 or 1 !!! */
-    vp8_tree t, const vp8_prob *const p) {
+/* Intent of tree data structure is to make decoding trivial. The walk keeps
+ * the decoder state in locals, the decoded bit only ever indexing the tree,
+ * and writes it back once at the leaf.
+ */
+static INLINE int vp8_treed_read(vp8_reader *const r, vp8_tree t,
+                                 const vp8_prob *const p) {
+  VP8_BD_VALUE value = r->value;
+  unsigned int range = r->range;
+  int count = r->count;
   vp8_tree_index i = 0;
 
-  while ((i = t[i + vp8_read(r, p[i >> 1])]) > 0) {
+  while ((i = t[i + vp8dx_decode_bool_local(r, &value, &range, &count,
+                                             p[i >> 1])]) > 0) {
   }
 
+  r->value = value;
+  r->range = range;
+  r->count = count;
+
   return -i;
 }
 
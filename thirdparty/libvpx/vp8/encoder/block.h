@@ -139,6 +139,14 @@ typedef struct macroblock {
   int64_t prediction_error;
   int64_t intra_error;
   int count_mb_ref_frame_usage[MAX_REF_FRAMES];
+  unsigned int mb_mode_count[MB_MODE_COUNT]; /* MB mode cts this frame */
+
+  /* vpx_timer_ticks() spent in each stage of coding this thread's MBs of
+   * the frame, scaled to nanoseconds once all the rows are done.
+   */
+  int64_t motion_search_ticks;
+  int64_t transform_quant_ticks;
+  int64_t tokenize_ticks;
 
   int rd_thresh_mult[MAX_MODES];
   int rd_threshes[MAX_MODES];
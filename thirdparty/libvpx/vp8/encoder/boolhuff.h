@@ -50,8 +50,8 @@ static int validate_buffer(const unsigned char *start, size_t len,
   if (start + len > start && start + len < end) {
     return 1;
   } else {
-    vpx_internal_error(error, VPX_CODEC_CORRUPT_FRAME,
-                       "Truncated packet or corrupt partition ");
+    vpx_internal_error(error, VPX_CODEC_MEM_ERROR,
+                       "Compressed data buffer too small");
   }
 
   return 0;
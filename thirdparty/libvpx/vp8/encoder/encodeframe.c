@@ -639,6 +639,10 @@ static void init_encode_frame_mb_context(VP8_COMP *cpi) {
   vp8_zero(x->uv_mode_count) x->prediction_error = 0;
   x->intra_error = 0;
   vp8_zero(x->count_mb_ref_frame_usage);
+  vp8_zero(x->mb_mode_count);
+  x->motion_search_ticks = 0;
+  x->transform_quant_ticks = 0;
+  x->tokenize_ticks = 0;
 }
 
 #if CONFIG_MULTITHREAD
@@ -656,7 +660,7 @@ static void sum_coef_counts(MACROBLOCK *x, MACROBLOCK *x_thread) {
 
         do {
           x->coef_counts[i][j][k][t] += x_thread->coef_counts[i][j][k][t];
-        } while (++t < ENTROPY_NODES);
+        } while (++t < MAX_ENTROPY_TOKENS);
       } while (++k < PREV_COEF_CONTEXTS);
     } while (++j < COEF_BANDS);
   } while (++i < BLOCK_TYPES);
@@ -745,10 +749,13 @@ void vp8_encode_frame(VP8_COMP *cpi) {
 
   {
     struct vpx_usec_timer emr_timer;
+    const int64_t start_ns = vpx_timer_ns();
+    const int64_t start_ticks = vpx_timer_ticks();
     vpx_usec_timer_start(&emr_timer);
 
 #if CONFIG_MULTITHREAD
     if (vpx_atomic_load_acquire(&cpi->b_multi_threaded)) {
+      const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
       int i;
 
       vp8cx_init_mbrthread_data(cpi, x, cpi->mb_row_ei,
@@ -758,7 +765,7 @@ void vp8_encode_frame(VP8_COMP *cpi) {
         vpx_atomic_store_release(&cpi->mt_current_mb_col[i], -1);
 
       for (i = 0; i < cpi->encoding_thread_count; ++i) {
-        sem_post(&cpi->h_event_start_encoding[i]);
+        winterface->launch(&cpi->encoding_workers[i]);
       }
 
       for (mb_row = 0; mb_row < cm->mb_rows;
@@ -791,7 +798,7 @@ void vp8_encode_frame(VP8_COMP *cpi) {
       }
       /* Wait for all the threads to finish. */
       for (i = 0; i < cpi->encoding_thread_count; ++i) {
-        sem_wait(&cpi->h_event_end_encoding[i]);
+        winterface->sync(&cpi->encoding_workers[i]);
       }
 
       for (mb_row = 0; mb_row < cm->mb_rows; ++mb_row) {
@@ -845,6 +852,16 @@ void vp8_encode_frame(VP8_COMP *cpi) {
           cpi->mb.error_bins[c_idx] += cpi->mb_row_ei[i].mb.error_bins[c_idx];
         }
 
+        for (c_idx = 0; c_idx < MB_MODE_COUNT; ++c_idx) {
+          cpi->mb.mb_mode_count[c_idx] +=
+              cpi->mb_row_ei[i].mb.mb_mode_count[c_idx];
+        }
+
+        cpi->mb.motion_search_ticks += cpi->mb_row_ei[i].mb.motion_search_ticks;
+        cpi->mb.transform_quant_ticks +=
+            cpi->mb_row_ei[i].mb.transform_quant_ticks;
+        cpi->mb.tokenize_ticks += cpi->mb_row_ei[i].mb.tokenize_ticks;
+
         /* add up counts for each thread */
         sum_coef_counts(x, &cpi->mb_row_ei[i].mb);
       }
@@ -884,6 +901,23 @@ void vp8_encode_frame(VP8_COMP *cpi) {
 
     vpx_usec_timer_mark(&emr_timer);
     cpi->time_encode_mb_row += vpx_usec_timer_elapsed(&emr_timer);
+
+    /* A recoded frame adds up the time of every attempt but keeps the modes
+     * of the last one.
+     */
+    {
+      const int64_t ns = vpx_timer_ns() - start_ns;
+      const int64_t ticks = vpx_timer_ticks() - start_ticks;
+      const double scale = ticks > 0 ? (double)ns / ticks : 0.0;
+
+      cpi->frame_times.motion_search +=
+          (int64_t)(x->motion_search_ticks * scale);
+      cpi->frame_times.transform_quant +=
+          (int64_t)(x->transform_quant_ticks * scale);
+      cpi->frame_times.tokenize += (int64_t)(x->tokenize_ticks * scale);
+      memcpy(cpi->frame_mb_modes, x->mb_mode_count,
+             sizeof(cpi->frame_mb_modes));
+    }
   }
 
   // Work out the segment probabilities if segmentation is enabled
@@ -1079,6 +1113,7 @@ int vp8cx_encode_intra_macroblock(VP8_COMP *cpi, MACROBLOCK *x,
                                   TOKENEXTRA **t) {
   MACROBLOCKD *xd = &x->e_mbd;
   int rate;
+  int64_t mark = vpx_timer_ticks();
 
   if (cpi->sf.RD && cpi->compressor_speed != 2) {
     vp8_rd_pick_intra_mode(x, &rate);
@@ -1086,6 +1121,8 @@ int vp8cx_encode_intra_macroblock(VP8_COMP *cpi, MACROBLOCK *x,
     vp8_pick_intra_mode(x, &rate);
   }
 
+  vpx_timer_ticks_add(&x->motion_search_ticks, &mark);
+
   if (cpi->oxcf.tuning == VP8_TUNE_SSIM) {
     adjust_act_zbin(cpi, x);
     vp8_update_zbin_extra(cpi, x);
@@ -1100,14 +1137,18 @@ int vp8cx_encode_intra_macroblock(VP8_COMP *cpi, MACROBLOCK *x,
   vp8_encode_intra16x16mbuv(x);
 
   sum_intra_stats(cpi, x);
+  ++x->mb_mode_count[xd->mode_info_context->mbmi.mode];
+  vpx_timer_ticks_add(&x->transform_quant_ticks, &mark);
 
   vp8_tokenize_mb(cpi, x, t);
+  vpx_timer_ticks_add(&x->tokenize_ticks, &mark);
 
   if (xd->mode_info_context->mbmi.mode != B_PRED) vp8_inverse_transform_mby(xd);
 
   vp8_dequant_idct_add_uv_block(xd->qcoeff + 16 * 16, xd->dequant_uv,
                                 xd->dst.u_buffer, xd->dst.v_buffer,
                                 xd->dst.uv_stride, xd->eobs + 16);
+  vpx_timer_ticks_add(&x->transform_quant_ticks, &mark);
   return rate;
 }
 #ifdef SPEEDSTATS
@@ -1123,6 +1164,7 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
   int intra_error = 0;
   int rate;
   int distortion;
+  int64_t mark = vpx_timer_ticks();
 
   x->skip = 0;
 
@@ -1169,6 +1211,8 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
                         &distortion, &intra_error, mb_row, mb_col);
   }
 
+  vpx_timer_ticks_add(&x->motion_search_ticks, &mark);
+
   x->prediction_error += distortion;
   x->intra_error += intra_error;
 
@@ -1228,6 +1272,7 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
   }
 
   x->count_mb_ref_frame_usage[xd->mode_info_context->mbmi.ref_frame]++;
+  ++x->mb_mode_count[xd->mode_info_context->mbmi.mode];
 
   if (xd->mode_info_context->mbmi.ref_frame == INTRA_FRAME) {
     vp8_encode_intra16x16mbuv(x);
@@ -1265,8 +1310,11 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
     }
   }
 
+  vpx_timer_ticks_add(&x->transform_quant_ticks, &mark);
+
   if (!x->skip) {
     vp8_tokenize_mb(cpi, x, t);
+    vpx_timer_ticks_add(&x->tokenize_ticks, &mark);
 
     if (xd->mode_info_context->mbmi.mode != B_PRED) {
       vp8_inverse_transform_mby(xd);
@@ -1275,6 +1323,7 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
     vp8_dequant_idct_add_uv_block(xd->qcoeff + 16 * 16, xd->dequant_uv,
                                   xd->dst.u_buffer, xd->dst.v_buffer,
                                   xd->dst.uv_stride, xd->eobs + 16);
+    vpx_timer_ticks_add(&x->transform_quant_ticks, &mark);
   } else {
     /* always set mb_skip_coeff as it is needed by the loopfilter */
     xd->mode_info_context->mbmi.mb_skip_coeff = 1;
@@ -1285,6 +1334,7 @@ int vp8cx_encode_inter_macroblock(VP8_COMP *cpi, MACROBLOCK *x, TOKENEXTRA **t,
     } else {
       vp8_stuff_mb(cpi, x, t);
     }
+    vpx_timer_ticks_add(&x->tokenize_ticks, &mark);
   }
 
   return rate;
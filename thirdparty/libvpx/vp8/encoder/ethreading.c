@@ -21,297 +21,278 @@
 extern void vp8cx_mb_init_quantizer(VP8_COMP *cpi, MACROBLOCK *x,
                                     int ok_to_skip);
 
-static THREAD_FUNCTION thread_loopfilter(void *p_data) {
-  VP8_COMP *cpi = (VP8_COMP *)(((LPFTHREAD_DATA *)p_data)->ptr1);
-  VP8_COMMON *cm = &cpi->common;
-
-  while (1) {
-    if (vpx_atomic_load_acquire(&cpi->b_multi_threaded) == 0) break;
-
-    if (sem_wait(&cpi->h_event_start_lpf) == 0) {
-      /* we're shutting down */
-      if (vpx_atomic_load_acquire(&cpi->b_multi_threaded) == 0) break;
-
-      vp8_loopfilter_frame(cpi, cm);
+/* Applies the loop filter picked for the frame and extends its borders. Runs
+ * while the main thread packs the bitstream.
+ */
+static int thread_loopfilter(void *arg1, void *arg2) {
+  VP8_COMP *cpi = (VP8_COMP *)arg1;
+  (void)arg2;
 
-      sem_post(&cpi->h_event_end_lpf);
-    }
-  }
+  vp8_loopfilter_frame(cpi, &cpi->common);
 
-  return 0;
+  return 1;
 }
 
-static THREAD_FUNCTION thread_encoding_proc(void *p_data) {
-  int ithread = ((ENCODETHREAD_DATA *)p_data)->ithread;
-  VP8_COMP *cpi = (VP8_COMP *)(((ENCODETHREAD_DATA *)p_data)->ptr1);
-  MB_ROW_COMP *mbri = (MB_ROW_COMP *)(((ENCODETHREAD_DATA *)p_data)->ptr2);
+/* Encodes every (encoding_thread_count + 1)th MB row, starting at the row
+ * after the one the main thread encodes.
+ */
+static int thread_encoding_proc(void *arg1, void *arg2) {
+  VP8_COMP *cpi = (VP8_COMP *)arg1;
+  ENCODETHREAD_DATA *thread_data = (ENCODETHREAD_DATA *)arg2;
+  int ithread = thread_data->ithread;
+  MB_ROW_COMP *mbri = (MB_ROW_COMP *)thread_data->ptr2;
   ENTROPY_CONTEXT_PLANES mb_row_left_context;
-
-  while (1) {
-    if (vpx_atomic_load_acquire(&cpi->b_multi_threaded) == 0) break;
-
-    if (sem_wait(&cpi->h_event_start_encoding[ithread]) == 0) {
-      const int nsync = cpi->mt_sync_range;
-      VP8_COMMON *cm = &cpi->common;
-      int mb_row;
-      MACROBLOCK *x = &mbri->mb;
-      MACROBLOCKD *xd = &x->e_mbd;
-      TOKENEXTRA *tp;
+  const int nsync = cpi->mt_sync_range;
+  VP8_COMMON *cm = &cpi->common;
+  int mb_row;
+  MACROBLOCK *x = &mbri->mb;
+  MACROBLOCKD *xd = &x->e_mbd;
+  TOKENEXTRA *tp;
 #if CONFIG_REALTIME_ONLY & CONFIG_ONTHEFLY_BITPACKING
-      TOKENEXTRA *tp_start = cpi->tok + (1 + ithread) * (16 * 24);
-      const int num_part = (1 << cm->multi_token_partition);
+  TOKENEXTRA *tp_start = cpi->tok + (1 + ithread) * (16 * 24);
+  const int num_part = (1 << cm->multi_token_partition);
 #endif
 
-      int *segment_counts = mbri->segment_counts;
-      int *totalrate = &mbri->totalrate;
-
-      /* we're shutting down */
-      if (vpx_atomic_load_acquire(&cpi->b_multi_threaded) == 0) break;
+  int *segment_counts = mbri->segment_counts;
+  int *totalrate = &mbri->totalrate;
 
-      xd->mode_info_context = cm->mi + cm->mode_info_stride * (ithread + 1);
-      xd->mode_info_stride = cm->mode_info_stride;
+  xd->mode_info_context = cm->mi + cm->mode_info_stride * (ithread + 1);
+  xd->mode_info_stride = cm->mode_info_stride;
 
-      for (mb_row = ithread + 1; mb_row < cm->mb_rows;
-           mb_row += (cpi->encoding_thread_count + 1)) {
-        int recon_yoffset, recon_uvoffset;
-        int mb_col;
-        int ref_fb_idx = cm->lst_fb_idx;
-        int dst_fb_idx = cm->new_fb_idx;
-        int recon_y_stride = cm->yv12_fb[ref_fb_idx].y_stride;
-        int recon_uv_stride = cm->yv12_fb[ref_fb_idx].uv_stride;
-        int map_index = (mb_row * cm->mb_cols);
-        const vpx_atomic_int *last_row_current_mb_col;
-        vpx_atomic_int *current_mb_col = &cpi->mt_current_mb_col[mb_row];
+  for (mb_row = ithread + 1; mb_row < cm->mb_rows;
+       mb_row += (cpi->encoding_thread_count + 1)) {
+    int recon_yoffset, recon_uvoffset;
+    int mb_col;
+    int ref_fb_idx = cm->lst_fb_idx;
+    int dst_fb_idx = cm->new_fb_idx;
+    int recon_y_stride = cm->yv12_fb[ref_fb_idx].y_stride;
+    int recon_uv_stride = cm->yv12_fb[ref_fb_idx].uv_stride;
+    int map_index = (mb_row * cm->mb_cols);
+    const vpx_atomic_int *last_row_current_mb_col;
+    vpx_atomic_int *current_mb_col = &cpi->mt_current_mb_col[mb_row];
 
 #if (CONFIG_REALTIME_ONLY & CONFIG_ONTHEFLY_BITPACKING)
-        vp8_writer *w = &cpi->bc[1 + (mb_row % num_part)];
+    vp8_writer *w = &cpi->bc[1 + (mb_row % num_part)];
 #else
-        tp = cpi->tok + (mb_row * (cm->mb_cols * 16 * 24));
-        cpi->tplist[mb_row].start = tp;
+    tp = cpi->tok + (mb_row * (cm->mb_cols * 16 * 24));
+    cpi->tplist[mb_row].start = tp;
 #endif
 
-        last_row_current_mb_col = &cpi->mt_current_mb_col[mb_row - 1];
+    last_row_current_mb_col = &cpi->mt_current_mb_col[mb_row - 1];
 
-        /* reset above block coeffs */
-        xd->above_context = cm->above_context;
-        xd->left_context = &mb_row_left_context;
+    /* reset above block coeffs */
+    xd->above_context = cm->above_context;
+    xd->left_context = &mb_row_left_context;
 
-        vp8_zero(mb_row_left_context);
+    vp8_zero(mb_row_left_context);
 
-        xd->up_available = (mb_row != 0);
-        recon_yoffset = (mb_row * recon_y_stride * 16);
-        recon_uvoffset = (mb_row * recon_uv_stride * 8);
+    xd->up_available = (mb_row != 0);
+    recon_yoffset = (mb_row * recon_y_stride * 16);
+    recon_uvoffset = (mb_row * recon_uv_stride * 8);
 
-        /* Set the mb activity pointer to the start of the row. */
-        x->mb_activity_ptr = &cpi->mb_activity_map[map_index];
+    /* Set the mb activity pointer to the start of the row. */
+    x->mb_activity_ptr = &cpi->mb_activity_map[map_index];
 
-        /* for each macroblock col in image */
-        for (mb_col = 0; mb_col < cm->mb_cols; ++mb_col) {
-          if (((mb_col - 1) % nsync) == 0) {
-            vpx_atomic_store_release(current_mb_col, mb_col - 1);
-          }
+    /* for each macroblock col in image */
+    for (mb_col = 0; mb_col < cm->mb_cols; ++mb_col) {
+      if (((mb_col - 1) % nsync) == 0) {
+        vpx_atomic_store_release(current_mb_col, mb_col - 1);
+      }
 
-          if (mb_row && !(mb_col & (nsync - 1))) {
-            vp8_atomic_spin_wait(mb_col, last_row_current_mb_col, nsync);
-          }
+      if (mb_row && !(mb_col & (nsync - 1))) {
+        vp8_atomic_spin_wait(mb_col, last_row_current_mb_col, nsync);
+      }
 
 #if CONFIG_REALTIME_ONLY & CONFIG_ONTHEFLY_BITPACKING
-          tp = tp_start;
+      tp = tp_start;
 #endif
 
-          /* Distance of Mb to the various image edges.
-           * These specified to 8th pel as they are always compared
-           * to values that are in 1/8th pel units
-           */
-          xd->mb_to_left_edge = -((mb_col * 16) << 3);
-          xd->mb_to_right_edge = ((cm->mb_cols - 1 - mb_col) * 16) << 3;
-          xd->mb_to_top_edge = -((mb_row * 16) << 3);
-          xd->mb_to_bottom_edge = ((cm->mb_rows - 1 - mb_row) * 16) << 3;
-
-          /* Set up limit values for motion vectors used to prevent
-           * them extending outside the UMV borders
-           */
-          x->mv_col_min = -((mb_col * 16) + (VP8BORDERINPIXELS - 16));
-          x->mv_col_max =
-              ((cm->mb_cols - 1 - mb_col) * 16) + (VP8BORDERINPIXELS - 16);
-          x->mv_row_min = -((mb_row * 16) + (VP8BORDERINPIXELS - 16));
-          x->mv_row_max =
-              ((cm->mb_rows - 1 - mb_row) * 16) + (VP8BORDERINPIXELS - 16);
-
-          xd->dst.y_buffer = cm->yv12_fb[dst_fb_idx].y_buffer + recon_yoffset;
-          xd->dst.u_buffer = cm->yv12_fb[dst_fb_idx].u_buffer + recon_uvoffset;
-          xd->dst.v_buffer = cm->yv12_fb[dst_fb_idx].v_buffer + recon_uvoffset;
-          xd->left_available = (mb_col != 0);
-
-          x->rddiv = cpi->RDDIV;
-          x->rdmult = cpi->RDMULT;
-
-          /* Copy current mb to a buffer */
-          vp8_copy_mem16x16(x->src.y_buffer, x->src.y_stride, x->thismb, 16);
-
-          if (cpi->oxcf.tuning == VP8_TUNE_SSIM) vp8_activity_masking(cpi, x);
-
-          /* Is segmentation enabled */
-          /* MB level adjustment to quantizer */
-          if (xd->segmentation_enabled) {
-            /* Code to set segment id in xd->mbmi.segment_id for
-             * current MB (with range checking)
-             */
-            if (cpi->segmentation_map[map_index + mb_col] <= 3) {
-              xd->mode_info_context->mbmi.segment_id =
-                  cpi->segmentation_map[map_index + mb_col];
-            } else {
-              xd->mode_info_context->mbmi.segment_id = 0;
-            }
+      /* Distance of Mb to the various image edges.
+       * These specified to 8th pel as they are always compared
+       * to values that are in 1/8th pel units
+       */
+      xd->mb_to_left_edge = -((mb_col * 16) << 3);
+      xd->mb_to_right_edge = ((cm->mb_cols - 1 - mb_col) * 16) << 3;
+      xd->mb_to_top_edge = -((mb_row * 16) << 3);
+      xd->mb_to_bottom_edge = ((cm->mb_rows - 1 - mb_row) * 16) << 3;
+
+      /* Set up limit values for motion vectors used to prevent
+       * them extending outside the UMV borders
+       */
+      x->mv_col_min = -((mb_col * 16) + (VP8BORDERINPIXELS - 16));
+      x->mv_col_max =
+          ((cm->mb_cols - 1 - mb_col) * 16) + (VP8BORDERINPIXELS - 16);
+      x->mv_row_min = -((mb_row * 16) + (VP8BORDERINPIXELS - 16));
+      x->mv_row_max =
+          ((cm->mb_rows - 1 - mb_row) * 16) + (VP8BORDERINPIXELS - 16);
+
+      xd->dst.y_buffer = cm->yv12_fb[dst_fb_idx].y_buffer + recon_yoffset;
+      xd->dst.u_buffer = cm->yv12_fb[dst_fb_idx].u_buffer + recon_uvoffset;
+      xd->dst.v_buffer = cm->yv12_fb[dst_fb_idx].v_buffer + recon_uvoffset;
+      xd->left_available = (mb_col != 0);
+
+      x->rddiv = cpi->RDDIV;
+      x->rdmult = cpi->RDMULT;
+
+      /* Copy current mb to a buffer */
+      vp8_copy_mem16x16(x->src.y_buffer, x->src.y_stride, x->thismb, 16);
+
+      if (cpi->oxcf.tuning == VP8_TUNE_SSIM) vp8_activity_masking(cpi, x);
+
+      /* Is segmentation enabled */
+      /* MB level adjustment to quantizer */
+      if (xd->segmentation_enabled) {
+        /* Code to set segment id in xd->mbmi.segment_id for
+         * current MB (with range checking)
+         */
+        if (cpi->segmentation_map[map_index + mb_col] <= 3) {
+          xd->mode_info_context->mbmi.segment_id =
+              cpi->segmentation_map[map_index + mb_col];
+        } else {
+          xd->mode_info_context->mbmi.segment_id = 0;
+        }
 
-            vp8cx_mb_init_quantizer(cpi, x, 1);
-          } else {
-            /* Set to Segment 0 by default */
-            xd->mode_info_context->mbmi.segment_id = 0;
-          }
+        vp8cx_mb_init_quantizer(cpi, x, 1);
+      } else {
+        /* Set to Segment 0 by default */
+        xd->mode_info_context->mbmi.segment_id = 0;
+      }
 
-          x->active_ptr = cpi->active_map + map_index + mb_col;
+      x->active_ptr = cpi->active_map + map_index + mb_col;
 
-          if (cm->frame_type == KEY_FRAME) {
-            *totalrate += vp8cx_encode_intra_macroblock(cpi, x, &tp);
+      if (cm->frame_type == KEY_FRAME) {
+        *totalrate += vp8cx_encode_intra_macroblock(cpi, x, &tp);
 #ifdef MODE_STATS
-            y_modes[xd->mbmi.mode]++;
+        y_modes[xd->mbmi.mode]++;
 #endif
-          } else {
-            *totalrate += vp8cx_encode_inter_macroblock(
-                cpi, x, &tp, recon_yoffset, recon_uvoffset, mb_row, mb_col);
+      } else {
+        *totalrate += vp8cx_encode_inter_macroblock(
+            cpi, x, &tp, recon_yoffset, recon_uvoffset, mb_row, mb_col);
 
 #ifdef MODE_STATS
-            inter_y_modes[xd->mbmi.mode]++;
+        inter_y_modes[xd->mbmi.mode]++;
 
-            if (xd->mbmi.mode == SPLITMV) {
-              int b;
+        if (xd->mbmi.mode == SPLITMV) {
+          int b;
 
-              for (b = 0; b < xd->mbmi.partition_count; ++b) {
-                inter_b_modes[x->partition->bmi[b].mode]++;
-              }
-            }
+          for (b = 0; b < xd->mbmi.partition_count; ++b) {
+            inter_b_modes[x->partition->bmi[b].mode]++;
+          }
+        }
 
 #endif
-            // Keep track of how many (consecutive) times a  block
-            // is coded as ZEROMV_LASTREF, for base layer frames.
-            // Reset to 0 if its coded as anything else.
-            if (cpi->current_layer == 0) {
-              if (xd->mode_info_context->mbmi.mode == ZEROMV &&
-                  xd->mode_info_context->mbmi.ref_frame == LAST_FRAME) {
-                // Increment, check for wrap-around.
-                if (cpi->consec_zero_last[map_index + mb_col] < 255) {
-                  cpi->consec_zero_last[map_index + mb_col] += 1;
-                }
-                if (cpi->consec_zero_last_mvbias[map_index + mb_col] < 255) {
-                  cpi->consec_zero_last_mvbias[map_index + mb_col] += 1;
-                }
-              } else {
-                cpi->consec_zero_last[map_index + mb_col] = 0;
-                cpi->consec_zero_last_mvbias[map_index + mb_col] = 0;
-              }
-              if (x->zero_last_dot_suppress) {
-                cpi->consec_zero_last_mvbias[map_index + mb_col] = 0;
-              }
+        // Keep track of how many (consecutive) times a  block
+        // is coded as ZEROMV_LASTREF, for base layer frames.
+        // Reset to 0 if its coded as anything else.
+        if (cpi->current_layer == 0) {
+          if (xd->mode_info_context->mbmi.mode == ZEROMV &&
+              xd->mode_info_context->mbmi.ref_frame == LAST_FRAME) {
+            // Increment, check for wrap-around.
+            if (cpi->consec_zero_last[map_index + mb_col] < 255) {
+              cpi->consec_zero_last[map_index + mb_col] += 1;
+            }
+            if (cpi->consec_zero_last_mvbias[map_index + mb_col] < 255) {
+              cpi->consec_zero_last_mvbias[map_index + mb_col] += 1;
             }
+          } else {
+            cpi->consec_zero_last[map_index + mb_col] = 0;
+            cpi->consec_zero_last_mvbias[map_index + mb_col] = 0;
+          }
+          if (x->zero_last_dot_suppress) {
+            cpi->consec_zero_last_mvbias[map_index + mb_col] = 0;
+          }
+        }
 
-            /* Special case code for cyclic refresh
-             * If cyclic update enabled then copy
-             * xd->mbmi.segment_id; (which may have been updated
-             * based on mode during
-             * vp8cx_encode_inter_macroblock()) back into the
-             * global segmentation map
-             */
-            if ((cpi->current_layer == 0) &&
-                (cpi->cyclic_refresh_mode_enabled &&
-                 xd->segmentation_enabled)) {
-              const MB_MODE_INFO *mbmi = &xd->mode_info_context->mbmi;
-              cpi->segmentation_map[map_index + mb_col] = mbmi->segment_id;
-
-              /* If the block has been refreshed mark it as clean
-               * (the magnitude of the -ve influences how long it
-               * will be before we consider another refresh):
-               * Else if it was coded (last frame 0,0) and has
-               * not already been refreshed then mark it as a
-               * candidate for cleanup next time (marked 0) else
-               * mark it as dirty (1).
-               */
-              if (mbmi->segment_id) {
-                cpi->cyclic_refresh_map[map_index + mb_col] = -1;
-              } else if ((mbmi->mode == ZEROMV) &&
-                         (mbmi->ref_frame == LAST_FRAME)) {
-                if (cpi->cyclic_refresh_map[map_index + mb_col] == 1) {
-                  cpi->cyclic_refresh_map[map_index + mb_col] = 0;
-                }
-              } else {
-                cpi->cyclic_refresh_map[map_index + mb_col] = 1;
-              }
+        /* Special case code for cyclic refresh
+         * If cyclic update enabled then copy
+         * xd->mbmi.segment_id; (which may have been updated
+         * based on mode during
+         * vp8cx_encode_inter_macroblock()) back into the
+         * global segmentation map
+         */
+        if ((cpi->current_layer == 0) &&
+            (cpi->cyclic_refresh_mode_enabled && xd->segmentation_enabled)) {
+          const MB_MODE_INFO *mbmi = &xd->mode_info_context->mbmi;
+          cpi->segmentation_map[map_index + mb_col] = mbmi->segment_id;
+
+          /* If the block has been refreshed mark it as clean
+           * (the magnitude of the -ve influences how long it
+           * will be before we consider another refresh):
+           * Else if it was coded (last frame 0,0) and has
+           * not already been refreshed then mark it as a
+           * candidate for cleanup next time (marked 0) else
+           * mark it as dirty (1).
+           */
+          if (mbmi->segment_id) {
+            cpi->cyclic_refresh_map[map_index + mb_col] = -1;
+          } else if ((mbmi->mode == ZEROMV) &&
+                     (mbmi->ref_frame == LAST_FRAME)) {
+            if (cpi->cyclic_refresh_map[map_index + mb_col] == 1) {
+              cpi->cyclic_refresh_map[map_index + mb_col] = 0;
             }
+          } else {
+            cpi->cyclic_refresh_map[map_index + mb_col] = 1;
           }
+        }
+      }
 
 #if CONFIG_REALTIME_ONLY & CONFIG_ONTHEFLY_BITPACKING
-          /* pack tokens for this MB */
-          {
-            int tok_count = tp - tp_start;
-            vp8_pack_tokens(w, tp_start, tok_count);
-          }
+      /* pack tokens for this MB */
+      {
+        int tok_count = tp - tp_start;
+        vp8_pack_tokens(w, tp_start, tok_count);
+      }
 #else
-          cpi->tplist[mb_row].stop = tp;
+      cpi->tplist[mb_row].stop = tp;
 #endif
-          /* Increment pointer into gf usage flags structure. */
-          x->gf_active_ptr++;
+      /* Increment pointer into gf usage flags structure. */
+      x->gf_active_ptr++;
 
-          /* Increment the activity mask pointers. */
-          x->mb_activity_ptr++;
+      /* Increment the activity mask pointers. */
+      x->mb_activity_ptr++;
 
-          /* adjust to the next column of macroblocks */
-          x->src.y_buffer += 16;
-          x->src.u_buffer += 8;
-          x->src.v_buffer += 8;
+      /* adjust to the next column of macroblocks */
+      x->src.y_buffer += 16;
+      x->src.u_buffer += 8;
+      x->src.v_buffer += 8;
 
-          recon_yoffset += 16;
-          recon_uvoffset += 8;
+      recon_yoffset += 16;
+      recon_uvoffset += 8;
 
-          /* Keep track of segment usage */
-          segment_counts[xd->mode_info_context->mbmi.segment_id]++;
-
-          /* skip to next mb */
-          xd->mode_info_context++;
-          x->partition_info++;
-          xd->above_context++;
-        }
+      /* Keep track of segment usage */
+      segment_counts[xd->mode_info_context->mbmi.segment_id]++;
 
-        vp8_extend_mb_row(&cm->yv12_fb[dst_fb_idx], xd->dst.y_buffer + 16,
-                          xd->dst.u_buffer + 8, xd->dst.v_buffer + 8);
-
-        vpx_atomic_store_release(current_mb_col, mb_col + nsync);
-
-        /* this is to account for the border */
-        xd->mode_info_context++;
-        x->partition_info++;
-
-        x->src.y_buffer +=
-            16 * x->src.y_stride * (cpi->encoding_thread_count + 1) -
-            16 * cm->mb_cols;
-        x->src.u_buffer +=
-            8 * x->src.uv_stride * (cpi->encoding_thread_count + 1) -
-            8 * cm->mb_cols;
-        x->src.v_buffer +=
-            8 * x->src.uv_stride * (cpi->encoding_thread_count + 1) -
-            8 * cm->mb_cols;
-
-        xd->mode_info_context +=
-            xd->mode_info_stride * cpi->encoding_thread_count;
-        x->partition_info += xd->mode_info_stride * cpi->encoding_thread_count;
-        x->gf_active_ptr += cm->mb_cols * cpi->encoding_thread_count;
-      }
-      /* Signal that this thread has completed processing its rows. */
-      sem_post(&cpi->h_event_end_encoding[ithread]);
+      /* skip to next mb */
+      xd->mode_info_context++;
+      x->partition_info++;
+      xd->above_context++;
     }
+
+    vp8_extend_mb_row(&cm->yv12_fb[dst_fb_idx], xd->dst.y_buffer + 16,
+                      xd->dst.u_buffer + 8, xd->dst.v_buffer + 8);
+
+    vpx_atomic_store_release(current_mb_col, mb_col + nsync);
+
+    /* this is to account for the border */
+    xd->mode_info_context++;
+    x->partition_info++;
+
+    x->src.y_buffer +=
+        16 * x->src.y_stride * (cpi->encoding_thread_count + 1) -
+        16 * cm->mb_cols;
+    x->src.u_buffer +=
+        8 * x->src.uv_stride * (cpi->encoding_thread_count + 1) -
+        8 * cm->mb_cols;
+    x->src.v_buffer +=
+        8 * x->src.uv_stride * (cpi->encoding_thread_count + 1) -
+        8 * cm->mb_cols;
+
+    xd->mode_info_context += xd->mode_info_stride * cpi->encoding_thread_count;
+    x->partition_info += xd->mode_info_stride * cpi->encoding_thread_count;
+    x->gf_active_ptr += cm->mb_cols * cpi->encoding_thread_count;
   }
 
-  /* printf("exit thread %d\n", ithread); */
-  return 0;
+  return 1;
 }
 
 static void setup_mbby_copy(MACROBLOCK *mbdst, MACROBLOCK *mbsrc) {
@@ -423,6 +404,11 @@ static void setup_mbby_copy(MACROBLOCK *mbdst, MACROBLOCK *mbsrc) {
 
     memcpy(z->rd_threshes, x->rd_threshes, sizeof(x->rd_threshes));
     memcpy(z->rd_thresh_mult, x->rd_thresh_mult, sizeof(x->rd_thresh_mult));
+    /* vp8_initialize_rd_consts() only resets the calling thread's counts.
+     * Stale counts here would leave modes skipped for the rest of the clip.
+     */
+    memcpy(z->mode_test_hit_counts, x->mode_test_hit_counts,
+           sizeof(x->mode_test_hit_counts));
 
     z->zbin_over_quant = x->zbin_over_quant;
     z->zbin_mode_boost_enabled = x->zbin_mode_boost_enabled;
@@ -474,12 +460,17 @@ void vp8cx_init_mbrthread_data(VP8_COMP *cpi, MACROBLOCK *x,
     if (cm->full_pixel) mbd->fullpixel_mask = 0xfffffff8;
 
     vp8_zero(mb->coef_counts);
-    vp8_zero(x->ymode_count);
+    vp8_zero(mb->ymode_count);
+    vp8_zero(mb->uv_mode_count);
     mb->skip_true_count = 0;
     vp8_zero(mb->MVcount);
     mb->prediction_error = 0;
     mb->intra_error = 0;
     vp8_zero(mb->count_mb_ref_frame_usage);
+    vp8_zero(mb->mb_mode_count);
+    mb->motion_search_ticks = 0;
+    mb->transform_quant_ticks = 0;
+    mb->tokenize_ticks = 0;
     mb->mbs_tested_so_far = 0;
     mb->mbs_zero_last_dot_suppress = 0;
   }
@@ -487,6 +478,7 @@ void vp8cx_init_mbrthread_data(VP8_COMP *cpi, MACROBLOCK *x,
 
 int vp8cx_create_encoder_threads(VP8_COMP *cpi) {
   const VP8_COMMON *cm = &cpi->common;
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
 
   vpx_atomic_init(&cpi->b_multi_threaded, 0);
   cpi->encoding_thread_count = 0;
@@ -495,7 +487,6 @@ int vp8cx_create_encoder_threads(VP8_COMP *cpi) {
   if (cm->processor_core_count > 1 && cpi->oxcf.multi_threaded > 1) {
     int ithread;
     int th_count = cpi->oxcf.multi_threaded - 1;
-    int rc = 0;
 
     /* don't allocate more threads than cores available */
     if (cpi->oxcf.multi_threaded > cm->processor_core_count) {
@@ -510,130 +501,83 @@ int vp8cx_create_encoder_threads(VP8_COMP *cpi) {
 
     if (th_count == 0) return 0;
 
-    CHECK_MEM_ERROR(cpi->h_encoding_thread,
-                    vpx_malloc(sizeof(pthread_t) * th_count));
-    CHECK_MEM_ERROR(cpi->h_event_start_encoding,
-                    vpx_malloc(sizeof(sem_t) * th_count));
-    CHECK_MEM_ERROR(cpi->h_event_end_encoding,
-                    vpx_malloc(sizeof(sem_t) * th_count));
+    CHECK_MEM_ERROR(cpi->encoding_workers,
+                    vpx_calloc(th_count, sizeof(*cpi->encoding_workers)));
     CHECK_MEM_ERROR(cpi->mb_row_ei,
                     vpx_memalign(32, sizeof(MB_ROW_COMP) * th_count));
     memset(cpi->mb_row_ei, 0, sizeof(MB_ROW_COMP) * th_count);
     CHECK_MEM_ERROR(cpi->en_thread_data,
                     vpx_malloc(sizeof(ENCODETHREAD_DATA) * th_count));
 
-    vpx_atomic_store_release(&cpi->b_multi_threaded, 1);
-    cpi->encoding_thread_count = th_count;
-
-    /*
-    printf("[VP8:] multi_threaded encoding is enabled with %d threads\n\n",
-           (cpi->encoding_thread_count +1));
-    */
-
     for (ithread = 0; ithread < th_count; ++ithread) {
       ENCODETHREAD_DATA *ethd = &cpi->en_thread_data[ithread];
+      VPxWorker *const worker = &cpi->encoding_workers[ithread];
 
       /* Setup block ptrs and offsets */
       vp8_setup_block_ptrs(&cpi->mb_row_ei[ithread].mb);
       vp8_setup_block_dptrs(&cpi->mb_row_ei[ithread].mb.e_mbd);
 
-      sem_init(&cpi->h_event_start_encoding[ithread], 0, 0);
-      sem_init(&cpi->h_event_end_encoding[ithread], 0, 0);
-
       ethd->ithread = ithread;
       ethd->ptr1 = (void *)cpi;
       ethd->ptr2 = (void *)&cpi->mb_row_ei[ithread];
 
-      rc = pthread_create(&cpi->h_encoding_thread[ithread], 0,
-                          thread_encoding_proc, ethd);
-      if (rc) break;
+      winterface->init(worker);
+      worker->hook = thread_encoding_proc;
+      worker->data1 = cpi;
+      worker->data2 = ethd;
+
+      if (!winterface->reset(worker)) break;
     }
 
-    if (rc) {
-      /* shutdown other threads */
-      vpx_atomic_store_release(&cpi->b_multi_threaded, 0);
+    winterface->init(&cpi->lpf_worker);
+    cpi->lpf_worker.hook = thread_loopfilter;
+    cpi->lpf_worker.data1 = cpi;
+
+    if (ithread < th_count || !winterface->reset(&cpi->lpf_worker)) {
+      /* shutdown the threads that were started */
       for (--ithread; ithread >= 0; ithread--) {
-        pthread_join(cpi->h_encoding_thread[ithread], 0);
-        sem_destroy(&cpi->h_event_start_encoding[ithread]);
-        sem_destroy(&cpi->h_event_end_encoding[ithread]);
+        winterface->end(&cpi->encoding_workers[ithread]);
       }
+      winterface->end(&cpi->lpf_worker);
 
       /* free thread related resources */
-      vpx_free(cpi->h_event_start_encoding);
-      vpx_free(cpi->h_event_end_encoding);
-      vpx_free(cpi->h_encoding_thread);
+      vpx_free(cpi->encoding_workers);
+      cpi->encoding_workers = NULL;
       vpx_free(cpi->mb_row_ei);
+      cpi->mb_row_ei = NULL;
       vpx_free(cpi->en_thread_data);
+      cpi->en_thread_data = NULL;
 
       return -1;
     }
 
-    {
-      LPFTHREAD_DATA *lpfthd = &cpi->lpf_thread_data;
-
-      sem_init(&cpi->h_event_start_lpf, 0, 0);
-      sem_init(&cpi->h_event_end_lpf, 0, 0);
-
-      lpfthd->ptr1 = (void *)cpi;
-      rc = pthread_create(&cpi->h_filter_thread, 0, thread_loopfilter, lpfthd);
-
-      if (rc) {
-        /* shutdown other threads */
-        vpx_atomic_store_release(&cpi->b_multi_threaded, 0);
-        for (--ithread; ithread >= 0; ithread--) {
-          sem_post(&cpi->h_event_start_encoding[ithread]);
-          sem_post(&cpi->h_event_end_encoding[ithread]);
-          pthread_join(cpi->h_encoding_thread[ithread], 0);
-          sem_destroy(&cpi->h_event_start_encoding[ithread]);
-          sem_destroy(&cpi->h_event_end_encoding[ithread]);
-        }
-        sem_destroy(&cpi->h_event_end_lpf);
-        sem_destroy(&cpi->h_event_start_lpf);
-
-        /* free thread related resources */
-        vpx_free(cpi->h_event_start_encoding);
-        vpx_free(cpi->h_event_end_encoding);
-        vpx_free(cpi->h_encoding_thread);
-        vpx_free(cpi->mb_row_ei);
-        vpx_free(cpi->en_thread_data);
-
-        return -2;
-      }
-    }
+    vpx_atomic_store_release(&cpi->b_multi_threaded, 1);
+    cpi->encoding_thread_count = th_count;
   }
   return 0;
 }
 
 void vp8cx_remove_encoder_threads(VP8_COMP *cpi) {
   if (vpx_atomic_load_acquire(&cpi->b_multi_threaded)) {
+    const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+    int i;
+
     /* shutdown other threads */
     vpx_atomic_store_release(&cpi->b_multi_threaded, 0);
-    {
-      int i;
-
-      for (i = 0; i < cpi->encoding_thread_count; ++i) {
-        sem_post(&cpi->h_event_start_encoding[i]);
-        sem_post(&cpi->h_event_end_encoding[i]);
 
-        pthread_join(cpi->h_encoding_thread[i], 0);
-
-        sem_destroy(&cpi->h_event_start_encoding[i]);
-        sem_destroy(&cpi->h_event_end_encoding[i]);
-      }
-
-      sem_post(&cpi->h_event_start_lpf);
-      pthread_join(cpi->h_filter_thread, 0);
+    for (i = 0; i < cpi->encoding_thread_count; ++i) {
+      winterface->end(&cpi->encoding_workers[i]);
     }
-
-    sem_destroy(&cpi->h_event_end_lpf);
-    sem_destroy(&cpi->h_event_start_lpf);
+    winterface->end(&cpi->lpf_worker);
+    cpi->b_lpf_running = 0;
 
     /* free thread related resources */
-    vpx_free(cpi->h_event_start_encoding);
-    vpx_free(cpi->h_event_end_encoding);
-    vpx_free(cpi->h_encoding_thread);
+    vpx_free(cpi->encoding_workers);
+    cpi->encoding_workers = NULL;
     vpx_free(cpi->mb_row_ei);
+    cpi->mb_row_ei = NULL;
     vpx_free(cpi->en_thread_data);
+    cpi->en_thread_data = NULL;
   }
 }
 #endif
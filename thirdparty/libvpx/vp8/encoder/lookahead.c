@@ -21,6 +21,7 @@ struct lookahead_ctx {
   unsigned int read_idx;       /* Read index */
   unsigned int write_idx;      /* Write index */
   struct lookahead_entry *buf; /* Buffer list */
+  YV12_BUFFER_CONFIG *own;     /* Frame buffers owned by each entry */
 };
 
 /* Return the buffer at the given absolute index and increment the index */
@@ -35,16 +36,27 @@ static struct lookahead_entry *pop(struct lookahead_ctx *ctx,
   return buf;
 }
 
+void vp8_lookahead_release(struct lookahead_ctx *ctx,
+                           struct lookahead_entry *entry) {
+  if (entry->release) {
+    entry->release(entry->release_priv, &entry->img, entry->user_priv);
+    entry->release = NULL;
+    entry->img = ctx->own[entry - ctx->buf];
+  }
+}
+
 void vp8_lookahead_destroy(struct lookahead_ctx *ctx) {
   if (ctx) {
-    if (ctx->buf) {
+    if (ctx->buf && ctx->own) {
       unsigned int i;
 
       for (i = 0; i < ctx->max_sz; ++i) {
-        vp8_yv12_de_alloc_frame_buffer(&ctx->buf[i].img);
+        vp8_lookahead_release(ctx, &ctx->buf[i]);
+        vp8_yv12_de_alloc_frame_buffer(&ctx->own[i]);
       }
-      free(ctx->buf);
     }
+    free(ctx->buf);
+    free(ctx->own);
     free(ctx);
   }
 }
@@ -74,12 +86,14 @@ struct lookahead_ctx *vp8_lookahead_init(unsigned int width,
   if (ctx) {
     ctx->max_sz = depth;
     ctx->buf = calloc(depth, sizeof(*ctx->buf));
-    if (!ctx->buf) goto bail;
+    ctx->own = calloc(depth, sizeof(*ctx->own));
+    if (!ctx->buf || !ctx->own) goto bail;
     for (i = 0; i < depth; ++i) {
-      if (vp8_yv12_alloc_frame_buffer(&ctx->buf[i].img, width, height,
+      if (vp8_yv12_alloc_frame_buffer(&ctx->own[i], width, height,
                                       VP8BORDERINPIXELS)) {
         goto bail;
       }
+      ctx->buf[i].img = ctx->own[i];
     }
   }
   return ctx;
@@ -99,6 +113,7 @@ int vp8_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
   if (ctx->sz + 2 > ctx->max_sz) return 1;
   ctx->sz++;
   buf = pop(ctx, &ctx->write_idx);
+  vp8_lookahead_release(ctx, buf);
 
   /* Only do this partial copy if the following conditions are all met:
    * 1. Lookahead queue has has size of 1.
@@ -144,6 +159,44 @@ int vp8_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
   return 0;
 }
 
+int vp8_lookahead_push_ref(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
+                           int64_t ts_start, int64_t ts_end, unsigned int flags,
+                           vp8_lookahead_release_fn_t release,
+                           void *release_priv, void *user_priv) {
+  const YV12_BUFFER_CONFIG *own = &ctx->own[ctx->write_idx];
+  struct lookahead_entry *buf;
+
+  /* The encoder reads whole macroblocks of the source and nothing beyond, so
+   * a source covering the aligned frame needs no border. Anything else takes
+   * the copy, which also extends the partial macroblocks.
+   */
+  if (src->y_width != own->y_width || src->y_height != own->y_height ||
+      src->y_stride <= 0 || src->uv_stride != src->y_stride / 2 ||
+      ctx->sz + 2 > ctx->max_sz) {
+    const int res =
+        vp8_lookahead_push(ctx, src, ts_start, ts_end, flags, NULL);
+    release(release_priv, src, user_priv);
+    return res;
+  }
+
+  ctx->sz++;
+  buf = pop(ctx, &ctx->write_idx);
+  vp8_lookahead_release(ctx, buf);
+
+  buf->img.y_buffer = src->y_buffer;
+  buf->img.u_buffer = src->u_buffer;
+  buf->img.v_buffer = src->v_buffer;
+  buf->img.y_stride = src->y_stride;
+  buf->img.uv_stride = src->uv_stride;
+  buf->ts_start = ts_start;
+  buf->ts_end = ts_end;
+  buf->flags = flags;
+  buf->release = release;
+  buf->release_priv = release_priv;
+  buf->user_priv = user_priv;
+  return 0;
+}
+
 struct lookahead_entry *vp8_lookahead_pop(struct lookahead_ctx *ctx,
                                           int drain) {
   struct lookahead_entry *buf = NULL;
@@ -16,11 +16,25 @@
 extern "C" {
 #endif
 
+/* Called once the encoder no longer reads the caller's planes behind an entry
+ * pushed with vp8_lookahead_push_ref().
+ */
+typedef void (*vp8_lookahead_release_fn_t)(void *release_priv,
+                                           const YV12_BUFFER_CONFIG *img,
+                                           void *user_priv);
+
 struct lookahead_entry {
   YV12_BUFFER_CONFIG img;
   int64_t ts_start;
   int64_t ts_end;
   unsigned int flags;
+
+  /* Set while img refers to the caller's planes instead of the entry's own
+   * buffer.
+   */
+  vp8_lookahead_release_fn_t release;
+  void *release_priv;
+  void *user_priv;
 };
 
 struct lookahead_ctx;
@@ -71,6 +85,39 @@ int vp8_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
  * \retval NULL, if drain not set and queue not of the configured depth
  *
  */
+/**\brief Enqueue a source buffer without copying it
+ *
+ * The entry refers to the planes of src, which must stay untouched until
+ * release is called. Only a source that exactly fills the 16 aligned frame
+ * and has uv_stride == y_stride / 2 can be referenced, the encoder never
+ * reads outside the aligned frame so no border is needed. Any other source
+ * is copied as vp8_lookahead_push() would and released straight away.
+ *
+ * \param[in] ctx           Pointer to the lookahead context
+ * \param[in] src           Pointer to the image to enqueue
+ * \param[in] ts_start      Timestamp for the start of this frame
+ * \param[in] ts_end        Timestamp for the end of this frame
+ * \param[in] flags         Flags set on this frame
+ * \param[in] release       Called when the planes of src are no longer read
+ * \param[in] release_priv  Passed back to release
+ * \param[in] user_priv     Passed back to release
+ */
+int vp8_lookahead_push_ref(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
+                           int64_t ts_start, int64_t ts_end, unsigned int flags,
+                           vp8_lookahead_release_fn_t release,
+                           void *release_priv, void *user_priv);
+
+/**\brief Hand a referenced source back to its owner
+ *
+ * Points the entry at its own buffer again. Does nothing for an entry that
+ * holds a copy.
+ *
+ * \param[in] ctx       Pointer to the lookahead context
+ * \param[in] entry     Entry the encoder has finished with
+ */
+void vp8_lookahead_release(struct lookahead_ctx *ctx,
+                           struct lookahead_entry *entry);
+
 struct lookahead_entry *vp8_lookahead_pop(struct lookahead_ctx *ctx, int drain);
 
 #define PEEK_FORWARD 1
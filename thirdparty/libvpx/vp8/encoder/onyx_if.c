@@ -3133,16 +3133,7 @@ static void process_denoiser_mode_change(VP8_COMP *cpi) {
 }
 #endif
 
-void vp8_loopfilter_frame(VP8_COMP *cpi, VP8_COMMON *cm) {
-  const FRAME_TYPE frame_type = cm->frame_type;
-
-  int update_any_ref_buffers = 1;
-  if (cpi->common.refresh_last_frame == 0 &&
-      cpi->common.refresh_golden_frame == 0 &&
-      cpi->common.refresh_alt_ref_frame == 0) {
-    update_any_ref_buffers = 0;
-  }
-
+static void pick_loop_filter_level(VP8_COMP *cpi, VP8_COMMON *cm) {
   if (cm->no_lpf) {
     cm->filter_level = 0;
   } else {
@@ -3187,18 +3178,27 @@ void vp8_loopfilter_frame(VP8_COMP *cpi, VP8_COMMON *cm) {
 
     vpx_usec_timer_mark(&timer);
     cpi->time_pick_lpf += vpx_usec_timer_elapsed(&timer);
+    cpi->frame_times.lf_pick += (int64_t)vpx_usec_timer_elapsed(&timer) * 1000;
   }
+}
 
-#if CONFIG_MULTITHREAD
-  if (vpx_atomic_load_acquire(&cpi->b_multi_threaded)) {
-    sem_post(&cpi->h_event_end_lpf); /* signal that we have set filter_level */
+/* Applies the level chosen by pick_loop_filter_level(). */
+void vp8_loopfilter_frame(VP8_COMP *cpi, VP8_COMMON *cm) {
+  const FRAME_TYPE frame_type = cm->frame_type;
+
+  int update_any_ref_buffers = 1;
+  if (cpi->common.refresh_last_frame == 0 &&
+      cpi->common.refresh_golden_frame == 0 &&
+      cpi->common.refresh_alt_ref_frame == 0) {
+    update_any_ref_buffers = 0;
   }
-#endif
 
   // No need to apply loop-filter if the encoded frame does not update
   // any reference buffers.
   if (cm->filter_level > 0 && update_any_ref_buffers) {
+    const int64_t start_ns = vpx_timer_ns();
     vp8_loop_filter_frame(cm, &cpi->mb.e_mbd, frame_type);
+    cpi->frame_times.lf_filter += vpx_timer_ns() - start_ns;
   }
 
   vp8_yv12_extend_frame_borders(cm->frame_to_show);
@@ -4400,14 +4400,16 @@ static void encode_frame_to_data_rate(VP8_COMP *cpi, size_t *size,
   }
 #endif
 
+  /* The filter level is needed to pack the stream so it is always picked
+   * here, the filtering itself can overlap the packing.
+   */
+  pick_loop_filter_level(cpi, cm);
+
 #if CONFIG_MULTITHREAD
   if (vpx_atomic_load_acquire(&cpi->b_multi_threaded)) {
     /* start loopfilter in separate thread */
-    sem_post(&cpi->h_event_start_lpf);
+    vpx_get_worker_interface()->launch(&cpi->lpf_worker);
     cpi->b_lpf_running = 1;
-    /* wait for the filter_level to be picked so that we can continue with
-     * stream packing */
-    sem_wait(&cpi->h_event_end_lpf);
   } else
 #endif
   {
@@ -4428,7 +4430,11 @@ static void encode_frame_to_data_rate(VP8_COMP *cpi, size_t *size,
 #endif
 
   /* build the bitstream */
-  vp8_pack_bitstream(cpi, dest, dest_end, size);
+  {
+    const int64_t start_ns = vpx_timer_ns();
+    vp8_pack_bitstream(cpi, dest, dest_end, size);
+    cpi->frame_times.pack_bitstream += vpx_timer_ns() - start_ns;
+  }
 
   /* Move storing frame_type out of the above loop since it is also
    * needed in motion search besides loopfilter */
@@ -4781,9 +4787,25 @@ static void Pass2Encode(VP8_COMP *cpi, size_t *size, unsigned char *dest,
 }
 #endif
 
-int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags,
-                          YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time) {
+/* A raw frame can be encoded straight from the caller's planes when it is
+ * consumed by the same encode call and only read within the aligned frame.
+ * Lagged frames are read around their edges by the temporal filter, the
+ * spatial blur of the noise sensitivity modes runs in place and resampling
+ * reads past the edges while scaling. The first pass keeps the previous
+ * source for its zero motion search.
+ */
+static int can_reference_source(const VP8_COMP *cpi) {
+  return cpi->pass != 1 && cpi->oxcf.lag_in_frames == 0 &&
+         cpi->oxcf.noise_sensitivity == 0 &&
+         !cpi->oxcf.allow_spatial_resampling &&
+         cpi->common.horiz_scale == NORMAL && cpi->common.vert_scale == NORMAL;
+}
+
+int vp8_receive_raw_frame_ref(VP8_COMP *cpi, unsigned int frame_flags,
+                              YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                              int64_t end_time,
+                              vp8_lookahead_release_fn_t release,
+                              void *release_priv, void *user_priv) {
   struct vpx_usec_timer timer;
   int res = 0;
 
@@ -4796,16 +4818,73 @@ int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags,
     alloc_raw_frame_buffers(cpi);
   }
 
-  if (vp8_lookahead_push(cpi->lookahead, sd, time_stamp, end_time, frame_flags,
-                         cpi->active_map_enabled ? cpi->active_map : NULL)) {
-    res = -1;
+  if (release && can_reference_source(cpi)) {
+    res = vp8_lookahead_push_ref(cpi->lookahead, sd, time_stamp, end_time,
+                                 frame_flags, release, release_priv,
+                                 user_priv);
+  } else {
+    res = vp8_lookahead_push(cpi->lookahead, sd, time_stamp, end_time,
+                             frame_flags,
+                             cpi->active_map_enabled ? cpi->active_map : NULL);
+    if (release) release(release_priv, sd, user_priv);
   }
+  if (res) res = -1;
+
   vpx_usec_timer_mark(&timer);
   cpi->time_receive_data += vpx_usec_timer_elapsed(&timer);
+  cpi->frame_times.lookahead += (int64_t)vpx_usec_timer_elapsed(&timer) * 1000;
 
   return res;
 }
 
+int vp8_receive_raw_frame(VP8_COMP *cpi, unsigned int frame_flags,
+                          YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                          int64_t end_time) {
+  return vp8_receive_raw_frame_ref(cpi, frame_flags, sd, time_stamp, end_time,
+                                   NULL, NULL, NULL);
+}
+
+void vp8_abandon_frame(VP8_COMP *cpi) {
+#if CONFIG_MULTITHREAD
+  if (cpi->b_lpf_running) {
+    vpx_get_worker_interface()->sync(&cpi->lpf_worker);
+    cpi->b_lpf_running = 0;
+  }
+#endif
+
+  if (cpi->source) vp8_lookahead_release(cpi->lookahead, cpi->source);
+  cpi->force_next_frame_intra = 1;
+}
+
+/* Moves the stage times and MB modes of the frame just encoded to the last
+ * frame and running totals.
+ */
+static void fold_frame_perf_stats(VP8_COMP *cpi) {
+  STAGE_TIMES *const t = &cpi->frame_times;
+  STAGE_TIMES *const total = &cpi->total_times;
+  int i;
+
+  total->encode += t->encode;
+  total->lookahead += t->lookahead;
+  total->motion_search += t->motion_search;
+  total->transform_quant += t->transform_quant;
+  total->tokenize += t->tokenize;
+  total->pack_bitstream += t->pack_bitstream;
+  total->lf_pick += t->lf_pick;
+  total->lf_filter += t->lf_filter;
+
+  for (i = 0; i < MB_MODE_COUNT; ++i) {
+    cpi->total_mb_modes[i] += cpi->frame_mb_modes[i];
+  }
+
+  cpi->last_frame_times = *t;
+  memcpy(cpi->last_frame_mb_modes, cpi->frame_mb_modes,
+         sizeof(cpi->last_frame_mb_modes));
+  memset(t, 0, sizeof(*t));
+  memset(cpi->frame_mb_modes, 0, sizeof(cpi->frame_mb_modes));
+  ++cpi->perf_frames;
+}
+
 static int frame_is_reference(const VP8_COMP *cpi) {
   const VP8_COMMON *cm = &cpi->common;
   const MACROBLOCKD *xd = &cpi->mb.e_mbd;
@@ -4826,6 +4905,7 @@ int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags,
   struct vpx_usec_timer ticktimer;
   struct vpx_usec_timer cmptimer;
   YV12_BUFFER_CONFIG *force_src_buffer = NULL;
+  const int64_t start_ns = vpx_timer_ns();
 
   if (!cpi) return -1;
 
@@ -5266,11 +5346,17 @@ int vp8_get_compressed_data(VP8_COMP *cpi, unsigned int *frame_flags,
 #if CONFIG_MULTITHREAD
   /* wait for the lpf thread done */
   if (vpx_atomic_load_acquire(&cpi->b_multi_threaded) && cpi->b_lpf_running) {
-    sem_wait(&cpi->h_event_end_lpf);
+    vpx_get_worker_interface()->sync(&cpi->lpf_worker);
     cpi->b_lpf_running = 0;
   }
 #endif
 
+  cpi->frame_times.encode = vpx_timer_ns() - start_ns;
+  fold_frame_perf_stats(cpi);
+
+  /* A referenced source goes back to the caller once it has been encoded. */
+  vp8_lookahead_release(cpi->lookahead, cpi->source);
+
   return 0;
 }
 
@@ -191,15 +191,25 @@ typedef struct {
   TOKENEXTRA *stop;
 } TOKENLIST;
 
+/* Time spent in each stage of encoding a frame, in nanoseconds. The MB
+ * stages are summed over the encoding threads.
+ */
+typedef struct {
+  int64_t encode;
+  int64_t lookahead;
+  int64_t motion_search;
+  int64_t transform_quant;
+  int64_t tokenize;
+  int64_t pack_bitstream;
+  int64_t lf_pick;
+  int64_t lf_filter;
+} STAGE_TIMES;
+
 typedef struct {
   int ithread;
   void *ptr1;
   void *ptr2;
 } ENCODETHREAD_DATA;
-typedef struct {
-  int ithread;
-  void *ptr1;
-} LPFTHREAD_DATA;
 
 enum {
   BLOCK_16X8,
@@ -529,18 +539,13 @@ typedef struct VP8_COMP {
   int encoding_thread_count;
   int b_lpf_running;
 
-  pthread_t *h_encoding_thread;
-  pthread_t h_filter_thread;
+  /* One worker per encoding thread, excluding the calling thread. */
+  VPxWorker *encoding_workers;
+  /* Filters frame N while the calling thread packs its bitstream. */
+  VPxWorker lpf_worker;
 
   MB_ROW_COMP *mb_row_ei;
   ENCODETHREAD_DATA *en_thread_data;
-  LPFTHREAD_DATA lpf_thread_data;
-
-  /* events */
-  sem_t *h_event_start_encoding;
-  sem_t *h_event_end_encoding;
-  sem_t h_event_start_lpf;
-  sem_t h_event_end_lpf;
 #endif
 
   TOKENLIST *tplist;
@@ -558,6 +563,18 @@ typedef struct VP8_COMP {
   uint64_t time_pick_lpf;
   uint64_t time_encode_mb_row;
 
+  /* The frame being encoded collects into frame_times and frame_mb_modes,
+   * which are moved to the last and total counts once it is done. Frames
+   * taken in by vp8_receive_raw_frame() count towards the next frame out.
+   */
+  STAGE_TIMES frame_times;
+  STAGE_TIMES last_frame_times;
+  STAGE_TIMES total_times;
+  unsigned int frame_mb_modes[MB_MODE_COUNT];
+  unsigned int last_frame_mb_modes[MB_MODE_COUNT];
+  uint64_t total_mb_modes[MB_MODE_COUNT];
+  unsigned int perf_frames;
+
   int base_skip_false_prob[128];
 
   FRAME_CONTEXT lfc_n; /* last frame entropy */
@@ -718,6 +735,22 @@ void vp8_tokenize_mb(VP8_COMP *, MACROBLOCK *, TOKENEXTRA **);
 
 void vp8_set_speed_features(VP8_COMP *cpi);
 
+/* As vp8_receive_raw_frame() but, when release is set and the configuration
+ * allows it, the lookahead refers to the planes of sd instead of copying
+ * them. release is called once per frame when the planes are no longer read.
+ */
+int vp8_receive_raw_frame_ref(VP8_COMP *cpi, unsigned int frame_flags,
+                              YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                              int64_t end_time,
+                              vp8_lookahead_release_fn_t release,
+                              void *release_priv, void *user_priv);
+
+/* Brings the encoder back to a consistent state after an error left the
+ * current frame part way through. The frame is lost and the next one is coded
+ * intra since the references may already hold it.
+ */
+void vp8_abandon_frame(VP8_COMP *cpi);
+
 #if CONFIG_DEBUG
 #define CHECK_MEM_ERROR(lval, expr)                                         \
   do {                                                                      \
@@ -0,0 +1,197 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "./vpx_config.h"
+#include "./vp8_rtcd.h"
+#include "vpx_ports/mem.h"
+
+/* The forward transforms of vp8/encoder/dct.c. As with the inverse
+ * transforms, two 4x4 blocks are worked on side by side, register r holding
+ * row r of the left block in its low words and of the right block in its
+ * high words.
+ *
+ * The results match the C for the 9 bit residuals the encoder transforms.
+ * Sums the C stores to short are kept in 16 bits, where wrapping gives the
+ * same answer, and the products and rounding it does in int are widened.
+ */
+
+/* Swaps rows and columns of both blocks at once. */
+static INLINE void transpose_8x4(__m128i *r) {
+  const __m128i u0 = _mm_unpacklo_epi16(r[0], r[1]);
+  const __m128i u1 = _mm_unpacklo_epi16(r[2], r[3]);
+  const __m128i u2 = _mm_unpackhi_epi16(r[0], r[1]);
+  const __m128i u3 = _mm_unpackhi_epi16(r[2], r[3]);
+  const __m128i v0 = _mm_unpacklo_epi32(u0, u1);
+  const __m128i v1 = _mm_unpackhi_epi32(u0, u1);
+  const __m128i v2 = _mm_unpacklo_epi32(u2, u3);
+  const __m128i v3 = _mm_unpackhi_epi32(u2, u3);
+
+  r[0] = _mm_unpacklo_epi64(v0, v2);
+  r[1] = _mm_unpackhi_epi64(v0, v2);
+  r[2] = _mm_unpacklo_epi64(v1, v3);
+  r[3] = _mm_unpackhi_epi64(v1, v3);
+}
+
+/* (c * c_tap + d * d_tap + round) >> shift for each of the 8 words. */
+static INLINE __m128i rotate(__m128i c, __m128i d, __m128i taps, int round,
+                             int shift) {
+  const __m128i r = _mm_set1_epi32(round);
+  const __m128i lo =
+      _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(c, d), taps), r);
+  const __m128i hi =
+      _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(c, d), taps), r);
+
+  return _mm_packs_epi32(_mm_srai_epi32(lo, shift), _mm_srai_epi32(hi, shift));
+}
+
+/* (a + b + 7) >> 4 with the sum in 32 bits. */
+static INLINE __m128i round_sum(__m128i a, __m128i b, __m128i taps) {
+  const __m128i seven = _mm_set1_epi32(7);
+  const __m128i lo =
+      _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), taps), seven);
+  const __m128i hi =
+      _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), taps), seven);
+
+  return _mm_packs_epi32(_mm_srai_epi32(lo, 4), _mm_srai_epi32(hi, 4));
+}
+
+static INLINE void fdct_8x4(__m128i *r) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i a1, b1, c1, d1, t[4];
+
+  /* Rows. */
+  transpose_8x4(r);
+  a1 = _mm_slli_epi16(_mm_add_epi16(r[0], r[3]), 3);
+  b1 = _mm_slli_epi16(_mm_add_epi16(r[1], r[2]), 3);
+  c1 = _mm_slli_epi16(_mm_sub_epi16(r[1], r[2]), 3);
+  d1 = _mm_slli_epi16(_mm_sub_epi16(r[0], r[3]), 3);
+  t[0] = _mm_add_epi16(a1, b1);
+  t[1] = rotate(c1, d1, _mm_setr_epi16(2217, 5352, 2217, 5352, 2217, 5352,
+                                       2217, 5352),
+                14500, 12);
+  t[2] = _mm_sub_epi16(a1, b1);
+  t[3] = rotate(c1, d1, _mm_setr_epi16(-5352, 2217, -5352, 2217, -5352, 2217,
+                                       -5352, 2217),
+                7500, 12);
+
+  /* Columns. */
+  transpose_8x4(t);
+  a1 = _mm_add_epi16(t[0], t[3]);
+  b1 = _mm_add_epi16(t[1], t[2]);
+  c1 = _mm_sub_epi16(t[1], t[2]);
+  d1 = _mm_sub_epi16(t[0], t[3]);
+  r[0] = round_sum(a1, b1, _mm_set1_epi16(1));
+  r[1] = _mm_sub_epi16(
+      rotate(c1, d1, _mm_setr_epi16(2217, 5352, 2217, 5352, 2217, 5352, 2217,
+                                    5352),
+             12000, 16),
+      _mm_cmpeq_epi16(_mm_cmpeq_epi16(d1, zero), zero));
+  r[2] = round_sum(a1, b1, _mm_setr_epi16(1, -1, 1, -1, 1, -1, 1, -1));
+  r[3] = rotate(c1, d1, _mm_setr_epi16(-5352, 2217, -5352, 2217, -5352, 2217,
+                                       -5352, 2217),
+                51000, 16);
+}
+
+void vp8_short_fdct4x4_sse2(short *input, short *output, int pitch) {
+  const int stride = pitch / 2;
+  __m128i r[4];
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    r[i] = _mm_loadl_epi64((const __m128i *)(input + i * stride));
+  }
+  fdct_8x4(r);
+  _mm_storeu_si128((__m128i *)output, _mm_unpacklo_epi64(r[0], r[1]));
+  _mm_storeu_si128((__m128i *)(output + 8), _mm_unpacklo_epi64(r[2], r[3]));
+}
+
+void vp8_short_fdct8x4_sse2(short *input, short *output, int pitch) {
+  const int stride = pitch / 2;
+  __m128i r[4];
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    r[i] = _mm_loadu_si128((const __m128i *)(input + i * stride));
+  }
+  fdct_8x4(r);
+  _mm_storeu_si128((__m128i *)output, _mm_unpacklo_epi64(r[0], r[1]));
+  _mm_storeu_si128((__m128i *)(output + 8), _mm_unpacklo_epi64(r[2], r[3]));
+  _mm_storeu_si128((__m128i *)(output + 16), _mm_unpackhi_epi64(r[0], r[1]));
+  _mm_storeu_si128((__m128i *)(output + 24), _mm_unpackhi_epi64(r[2], r[3]));
+}
+
+/* The Walsh-Hadamard transform of the 16 luma DC values. Its second pass
+ * sums grow past 16 bits, so the whole transform is done in 32 bits with
+ * the first pass results wrapped to 16 as the C stores them.
+ */
+static INLINE __m128i load_row_epi32(const short *p) {
+  const __m128i v = _mm_loadl_epi64((const __m128i *)p);
+  return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+}
+
+static INLINE __m128i wrap_epi16(__m128i x) {
+  return _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+}
+
+static INLINE void transpose_4x4_epi32(__m128i *r) {
+  const __m128i u0 = _mm_unpacklo_epi32(r[0], r[1]);
+  const __m128i u1 = _mm_unpacklo_epi32(r[2], r[3]);
+  const __m128i u2 = _mm_unpackhi_epi32(r[0], r[1]);
+  const __m128i u3 = _mm_unpackhi_epi32(r[2], r[3]);
+
+  r[0] = _mm_unpacklo_epi64(u0, u1);
+  r[1] = _mm_unpackhi_epi64(u0, u1);
+  r[2] = _mm_unpacklo_epi64(u2, u3);
+  r[3] = _mm_unpackhi_epi64(u2, u3);
+}
+
+/* (x + (x < 0) + 3) >> 3 */
+static INLINE __m128i walsh_round(__m128i x) {
+  x = _mm_sub_epi32(x, _mm_cmplt_epi32(x, _mm_setzero_si128()));
+  return _mm_srai_epi32(_mm_add_epi32(x, _mm_set1_epi32(3)), 3);
+}
+
+void vp8_short_walsh4x4_sse2(short *input, short *output, int pitch) {
+  const int stride = pitch / 2;
+  const __m128i zero = _mm_setzero_si128();
+  __m128i r[4], a1, b1, c1, d1;
+  int i;
+
+  for (i = 0; i < 4; ++i) r[i] = load_row_epi32(input + i * stride);
+
+  /* Rows. */
+  transpose_4x4_epi32(r);
+  a1 = _mm_slli_epi32(_mm_add_epi32(r[0], r[2]), 2);
+  d1 = _mm_slli_epi32(_mm_add_epi32(r[1], r[3]), 2);
+  c1 = _mm_slli_epi32(_mm_sub_epi32(r[1], r[3]), 2);
+  b1 = _mm_slli_epi32(_mm_sub_epi32(r[0], r[2]), 2);
+  r[0] = _mm_add_epi32(_mm_add_epi32(a1, d1), _mm_set1_epi32(1));
+  r[0] = wrap_epi16(_mm_add_epi32(r[0], _mm_cmpeq_epi32(a1, zero)));
+  r[1] = wrap_epi16(_mm_add_epi32(b1, c1));
+  r[2] = wrap_epi16(_mm_sub_epi32(b1, c1));
+  r[3] = wrap_epi16(_mm_sub_epi32(a1, d1));
+
+  /* Columns. */
+  transpose_4x4_epi32(r);
+  a1 = _mm_add_epi32(r[0], r[2]);
+  d1 = _mm_add_epi32(r[1], r[3]);
+  c1 = _mm_sub_epi32(r[1], r[3]);
+  b1 = _mm_sub_epi32(r[0], r[2]);
+  _mm_storeu_si128(
+      (__m128i *)output,
+      _mm_packs_epi32(walsh_round(_mm_add_epi32(a1, d1)),
+                      walsh_round(_mm_add_epi32(b1, c1))));
+  _mm_storeu_si128(
+      (__m128i *)(output + 8),
+      _mm_packs_epi32(walsh_round(_mm_sub_epi32(b1, c1)),
+                      walsh_round(_mm_sub_epi32(a1, d1))));
+}
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "./vpx_config.h"
+#include "./vp8_rtcd.h"
+#include "vp8/common/entropy.h"
+#include "vp8/encoder/block.h"
+#include "vpx_ports/mem.h"
+
+/* The quantizers of vp8/encoder/vp8_quantize.c, with the products done as
+ * 16 bit high multiplies. The tables vp8cx_init_quantizer() builds keep
+ * every intermediate within 16 bits for the coefficients the forward
+ * transforms produce, so the results match the C.
+ */
+
+/* One more than the zig-zag position of each raster position, so a block's
+ * eob is the largest entry among its nonzero coefficients.
+ */
+DECLARE_ALIGNED(16, static const short, inv_zig_zag_plus1[16]) = {
+  1, 2, 6, 7, 3, 5, 8, 13, 4, 9, 12, 14, 10, 11, 15, 16,
+};
+
+static INLINE __m128i load(const short *p) {
+  return _mm_load_si128((const __m128i *)p);
+}
+
+static INLINE void store(short *p, __m128i v) {
+  _mm_store_si128((__m128i *)p, v);
+}
+
+/* Returns |z| and sets *sz to the sign mask of z. */
+static INLINE __m128i abs_epi16(__m128i z, __m128i *sz) {
+  *sz = _mm_srai_epi16(z, 15);
+  return _mm_sub_epi16(_mm_xor_si128(z, *sz), *sz);
+}
+
+static INLINE __m128i apply_sign(__m128i x, __m128i sz) {
+  return _mm_sub_epi16(_mm_xor_si128(x, sz), sz);
+}
+
+/* The eob from the nonzero coefficients of both halves, found with a max
+ * over the zig-zag positions rather than a scan.
+ */
+static INLINE int find_eob(__m128i y0, __m128i y1) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i nz0 = _mm_cmpeq_epi16(_mm_cmpeq_epi16(y0, zero), zero);
+  const __m128i nz1 = _mm_cmpeq_epi16(_mm_cmpeq_epi16(y1, zero), zero);
+  __m128i eob = _mm_max_epi16(_mm_and_si128(nz0, load(inv_zig_zag_plus1)),
+                              _mm_and_si128(nz1, load(inv_zig_zag_plus1 + 8)));
+
+  eob = _mm_max_epi16(eob, _mm_srli_si128(eob, 8));
+  eob = _mm_max_epi16(eob, _mm_srli_si128(eob, 4));
+  eob = _mm_max_epi16(eob, _mm_srli_si128(eob, 2));
+  return _mm_extract_epi16(eob, 0);
+}
+
+void vp8_fast_quantize_b_sse2(BLOCK *b, BLOCKD *d) {
+  __m128i sz0, sz1;
+  const __m128i x0 = abs_epi16(load(b->coeff), &sz0);
+  const __m128i x1 = abs_epi16(load(b->coeff + 8), &sz1);
+  const __m128i y0 = _mm_mulhi_epi16(_mm_add_epi16(x0, load(b->round)),
+                                     load(b->quant_fast));
+  const __m128i y1 = _mm_mulhi_epi16(_mm_add_epi16(x1, load(b->round + 8)),
+                                     load(b->quant_fast + 8));
+  const __m128i q0 = apply_sign(y0, sz0);
+  const __m128i q1 = apply_sign(y1, sz1);
+
+  store(d->qcoeff, q0);
+  store(d->qcoeff + 8, q1);
+  store(d->dqcoeff, _mm_mullo_epi16(q0, load(d->dequant)));
+  store(d->dqcoeff + 8, _mm_mullo_epi16(q1, load(d->dequant + 8)));
+  *d->eob = (char)find_eob(y0, y1);
+}
+
+/* The zero bin of each coefficient depends on the run of zeros before it in
+ * zig-zag order, so that test is made serially. Everything else, including
+ * the quantized value of every coefficient that might pass it, is vector
+ * work, and the eob falls out of the serial loop.
+ */
+void vp8_regular_quantize_b_sse2(BLOCK *b, BLOCKD *d) {
+  DECLARE_ALIGNED(16, short, x_minus_zbin[16]);
+  DECLARE_ALIGNED(16, short, y[16]);
+  DECLARE_ALIGNED(16, short, qy[16]) = { 0 };
+  const short *zbin_boost_ptr = b->zrun_zbin_boost;
+  const __m128i zbin_extra = _mm_set1_epi16(b->zbin_extra);
+  __m128i sz0, sz1, x0, x1, q0, q1;
+  int i, eob = -1;
+
+  x0 = abs_epi16(load(b->coeff), &sz0);
+  x1 = abs_epi16(load(b->coeff + 8), &sz1);
+  store(x_minus_zbin,
+        _mm_sub_epi16(x0, _mm_add_epi16(load(b->zbin), zbin_extra)));
+  store(x_minus_zbin + 8,
+        _mm_sub_epi16(x1, _mm_add_epi16(load(b->zbin + 8), zbin_extra)));
+
+  /* ((((x * quant) >> 16) + x) * quant_shift) >> 16 with x = |z| + round */
+  x0 = _mm_add_epi16(x0, load(b->round));
+  x1 = _mm_add_epi16(x1, load(b->round + 8));
+  store(y, _mm_mulhi_epi16(
+               _mm_add_epi16(_mm_mulhi_epi16(x0, load(b->quant)), x0),
+               load(b->quant_shift)));
+  store(y + 8, _mm_mulhi_epi16(
+                   _mm_add_epi16(_mm_mulhi_epi16(x1, load(b->quant + 8)), x1),
+                   load(b->quant_shift + 8)));
+
+  for (i = 0; i < 16; ++i) {
+    const int rc = vp8_default_zig_zag1d[i];
+    const short boost = *zbin_boost_ptr++;
+
+    if (x_minus_zbin[rc] >= boost) {
+      qy[rc] = y[rc];
+      if (y[rc]) {
+        eob = i;
+        zbin_boost_ptr = b->zrun_zbin_boost;
+      }
+    }
+  }
+
+  q0 = apply_sign(load(qy), sz0);
+  q1 = apply_sign(load(qy + 8), sz1);
+  store(d->qcoeff, q0);
+  store(d->qcoeff + 8, q1);
+  store(d->dqcoeff, _mm_mullo_epi16(q0, load(d->dequant)));
+  store(d->dqcoeff + 8, _mm_mullo_epi16(q1, load(d->dequant + 8)));
+  *d->eob = (char)(eob + 1);
+}
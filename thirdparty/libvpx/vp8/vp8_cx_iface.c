@@ -91,6 +91,7 @@ struct vpx_codec_alg_priv {
   vpx_codec_pkt_list_decl(64) pkt_list;
   unsigned int fixed_kf_cntr;
   vpx_enc_frame_flags_t control_frame_flags;
+  vpx_raw_frame_release_t raw_release;
 };
 
 static vpx_codec_err_t update_error_state(
@@ -726,6 +727,32 @@ static vpx_codec_err_t image2yuvconfig(const vpx_image_t *img,
   return res;
 }
 
+/* Describes a referenced raw frame to the application as it goes back. */
+static void release_raw_frame(void *release_priv, const YV12_BUFFER_CONFIG *sd,
+                              void *user_priv) {
+  vpx_codec_alg_priv_t *ctx = (vpx_codec_alg_priv_t *)release_priv;
+  vpx_image_t img;
+
+  if (!ctx->raw_release.release_cb) return;
+
+  memset(&img, 0, sizeof(img));
+  img.fmt = VPX_IMG_FMT_I420;
+  img.w = img.d_w = sd->y_width;
+  img.h = img.d_h = sd->y_height;
+  img.x_chroma_shift = 1;
+  img.y_chroma_shift = 1;
+  img.planes[VPX_PLANE_Y] = sd->y_buffer;
+  img.planes[VPX_PLANE_U] = sd->u_buffer;
+  img.planes[VPX_PLANE_V] = sd->v_buffer;
+  img.stride[VPX_PLANE_Y] = sd->y_stride;
+  img.stride[VPX_PLANE_U] = sd->uv_stride;
+  img.stride[VPX_PLANE_V] = sd->uv_stride;
+  img.bit_depth = 8;
+  img.bps = 12;
+  img.user_priv = user_priv;
+  ctx->raw_release.release_cb(ctx->raw_release.cb_priv, &img);
+}
+
 static void pick_quickcompress_mode(vpx_codec_alg_priv_t *ctx,
                                     unsigned long duration,
                                     unsigned long deadline) {
@@ -873,7 +900,8 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
   if (setjmp(ctx->cpi->common.error.jmp)) {
     ctx->cpi->common.error.setjmp = 0;
     vpx_clear_system_state();
-    return VPX_CODEC_CORRUPT_FRAME;
+    vp8_abandon_frame(ctx->cpi);
+    return update_error_state(ctx, &ctx->cpi->common.error);
   }
 
   /* Initialize the encoder instance on the first frame*/
@@ -881,7 +909,8 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
     unsigned int lib_flags;
     YV12_BUFFER_CONFIG sd;
     int64_t dst_time_stamp, dst_end_time_stamp;
-    size_t size, cx_data_sz;
+    size_t size, cx_data_sz, cx_data_min;
+    size_t pad_before = 0, pad_after = 0;
     unsigned char *cx_data;
     unsigned char *cx_data_end;
     int comp_data_state = 0;
@@ -903,11 +932,34 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
     dst_end_time_stamp = (pts_val + (int64_t)duration) *
                          ctx->timestamp_ratio.num / ctx->timestamp_ratio.den;
 
+    if (ctx->base.enc.cx_data_dst_buf.buf) {
+      /* Pack straight into the application's buffer, leaving the requested
+       * room before and after every frame.
+       */
+      const vpx_fixed_buf_t *dst_buf = &ctx->base.enc.cx_data_dst_buf;
+
+      pad_before = ctx->base.enc.cx_data_pad_before;
+      pad_after = ctx->base.enc.cx_data_pad_after;
+      if (dst_buf->sz <= pad_before + pad_after) {
+        ctx->base.err_detail = "Compressed data buffer too small";
+        return VPX_CODEC_MEM_ERROR;
+      }
+
+      cx_data = (unsigned char *)dst_buf->buf + pad_before;
+      cx_data_sz = dst_buf->sz - pad_before - pad_after;
+    } else {
+      cx_data = ctx->cx_data;
+      cx_data_sz = ctx->cx_data_sz;
+    }
+
     if (img != NULL) {
       res = image2yuvconfig(img, &sd);
 
-      if (vp8_receive_raw_frame(ctx->cpi, ctx->next_frame_flag | lib_flags, &sd,
-                                dst_time_stamp, dst_end_time_stamp)) {
+      if (vp8_receive_raw_frame_ref(
+              ctx->cpi, ctx->next_frame_flag | lib_flags, &sd, dst_time_stamp,
+              dst_end_time_stamp,
+              ctx->raw_release.release_cb ? release_raw_frame : NULL, ctx,
+              img->user_priv)) {
         VP8_COMP *cpi = (VP8_COMP *)ctx->cpi;
         res = update_error_state(ctx, &cpi->common.error);
       }
@@ -916,14 +968,13 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
       ctx->next_frame_flag = 0;
     }
 
-    cx_data = ctx->cx_data;
-    cx_data_sz = ctx->cx_data_sz;
-    cx_data_end = ctx->cx_data + cx_data_sz;
+    cx_data_end = cx_data + cx_data_sz;
+    cx_data_min = cx_data_sz / 2;
     lib_flags = 0;
 
     ctx->cpi->common.error.setjmp = 1;
 
-    while (cx_data_sz >= ctx->cx_data_sz / 2) {
+    while (cx_data_sz >= cx_data_min) {
       comp_data_state = vp8_get_compressed_data(
           ctx->cpi, &lib_flags, &size, cx_data, cx_data_end, &dst_time_stamp,
           &dst_end_time_stamp, !img);
@@ -990,13 +1041,21 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
 #else
             pkt.data.frame.buf = cx_data;
             cx_data += cpi->partition_sz[i];
-            cx_data_sz -= cpi->partition_sz[i];
 #endif
             pkt.data.frame.sz = cpi->partition_sz[i];
             pkt.data.frame.partition_id = i;
+            /* The padding goes before the first and after the last
+             * partition so the packets stay contiguous.
+             */
+            if (i == 0) {
+              pkt.data.frame.buf = (unsigned char *)pkt.data.frame.buf -
+                                   pad_before;
+              pkt.data.frame.sz += pad_before;
+            }
             /* don't set the fragment bit for the last partition */
             if (i == (num_partitions - 1)) {
               pkt.data.frame.flags &= ~VPX_FRAME_IS_FRAGMENT;
+              pkt.data.frame.sz += pad_after;
             }
             vpx_codec_pkt_list_add(&ctx->pkt_list.head, &pkt);
           }
@@ -1006,16 +1065,19 @@ static vpx_codec_err_t vp8e_encode(vpx_codec_alg_priv_t *ctx,
            * partitions are spread all over the output buffer.
            * So, force an exit!
            */
-          cx_data_sz -= ctx->cx_data_sz / 2;
+          cx_data = cx_data_end;
 #endif
         } else {
-          pkt.data.frame.buf = cx_data;
-          pkt.data.frame.sz = size;
+          pkt.data.frame.buf = cx_data - pad_before;
+          pkt.data.frame.sz = pad_before + size + pad_after;
           pkt.data.frame.partition_id = -1;
           vpx_codec_pkt_list_add(&ctx->pkt_list.head, &pkt);
           cx_data += size;
-          cx_data_sz -= size;
         }
+
+        /* The next frame starts after this one's padding. */
+        cx_data += pad_after + pad_before;
+        cx_data_sz = cx_data < cx_data_end ? (size_t)(cx_data_end - cx_data) : 0;
       }
     }
   }
@@ -1198,6 +1260,47 @@ static vpx_codec_err_t vp8e_set_scalemode(vpx_codec_alg_priv_t *ctx,
   }
 }
 
+static vpx_codec_err_t vp8e_set_raw_frame_release(vpx_codec_alg_priv_t *ctx,
+                                                  va_list args) {
+  vpx_raw_frame_release_t *data = va_arg(args, vpx_raw_frame_release_t *);
+
+  if (data) {
+    ctx->raw_release = *data;
+    return VPX_CODEC_OK;
+  } else {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+}
+
+static void get_stage_times(const STAGE_TIMES *t, vp8e_stage_times *us) {
+  us->encode_us = t->encode / 1000;
+  us->lookahead_us = t->lookahead / 1000;
+  us->motion_search_us = t->motion_search / 1000;
+  us->transform_quant_us = t->transform_quant / 1000;
+  us->tokenize_us = t->tokenize / 1000;
+  us->pack_bitstream_us = t->pack_bitstream / 1000;
+  us->lf_pick_us = t->lf_pick / 1000;
+  us->lf_filter_us = t->lf_filter / 1000;
+}
+
+static vpx_codec_err_t vp8e_get_perf_stats(vpx_codec_alg_priv_t *ctx,
+                                           va_list args) {
+  vp8e_perf_stats *stats = va_arg(args, vp8e_perf_stats *);
+  const VP8_COMP *cpi = ctx->cpi;
+  int i;
+
+  if (stats == NULL) return VPX_CODEC_INVALID_PARAM;
+
+  stats->frames = cpi->perf_frames;
+  get_stage_times(&cpi->last_frame_times, &stats->last_frame);
+  get_stage_times(&cpi->total_times, &stats->total);
+  for (i = 0; i < VP8E_MB_MODES; ++i) {
+    stats->last_frame_mb_modes[i] = cpi->last_frame_mb_modes[i];
+    stats->total_mb_modes[i] = cpi->total_mb_modes[i];
+  }
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_ctrl_fn_map_t vp8e_ctf_maps[] = {
   { VP8_SET_REFERENCE, vp8e_set_reference },
   { VP8_COPY_REFERENCE, vp8e_get_reference },
@@ -1223,6 +1326,8 @@ static vpx_codec_ctrl_fn_map_t vp8e_ctf_maps[] = {
   { VP8E_SET_MAX_INTRA_BITRATE_PCT, set_rc_max_intra_bitrate_pct },
   { VP8E_SET_SCREEN_CONTENT_MODE, set_screen_content_mode },
   { VP8E_SET_GF_CBR_BOOST_PCT, ctrl_set_rc_gf_cbr_boost_pct },
+  { VP8E_SET_RAW_FRAME_RELEASE, vp8e_set_raw_frame_release },
+  { VP8E_GET_PERF_STATS, vp8e_get_perf_stats },
   { -1, NULL },
 };
 
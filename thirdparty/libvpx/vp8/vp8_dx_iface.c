@@ -55,11 +55,25 @@ struct vpx_codec_alg_priv {
   vp8_postproc_cfg_t postproc_cfg;
   vpx_decrypt_cb decrypt_cb;
   void *decrypt_state;
+  int partition_mt;
+  int decode_mode;
+  /* Set once key frame mode drops an inter frame, until the next key frame. */
+  int wait_for_key_frame;
+  int compact_buffers;
+  vpx_get_frame_buffer_cb_fn_t get_ext_fb_cb;
+  vpx_release_frame_buffer_cb_fn_t release_ext_fb_cb;
+  void *ext_priv;
   vpx_image_t img;
   int img_setup;
   struct frame_buffers yv12_frame_buffers;
   void *user_priv;
   FRAGMENT_DATA fragments;
+  /* VP8D_SET_STREAMING: the frame's bytes so far and whether it has ended. */
+  int streaming;
+  uint8_t *stream_buf;
+  unsigned int stream_buf_sz;
+  unsigned int stream_sz;
+  int stream_complete;
 };
 
 static int vp8_init_ctx(vpx_codec_ctx_t *ctx) {
@@ -118,6 +132,7 @@ static vpx_codec_err_t vp8_init(vpx_codec_ctx_t *ctx,
 static vpx_codec_err_t vp8_destroy(vpx_codec_alg_priv_t *ctx) {
   vp8_remove_decoder_instances(&ctx->yv12_frame_buffers);
 
+  vpx_free(ctx->stream_buf);
   vpx_free(ctx);
 
   return VPX_CODEC_OK;
@@ -211,7 +226,7 @@ static void yuvconfig2image(vpx_image_t *img, const YV12_BUFFER_CONFIG *yv12,
    * initialize all the fields.*/
   img->fmt = VPX_IMG_FMT_I420;
   img->w = yv12->y_stride;
-  img->h = (yv12->y_height + 2 * VP8BORDERINPIXELS + 15) & ~15;
+  img->h = (yv12->y_height + 2 * yv12->border + 15) & ~15;
   img->d_w = img->r_w = yv12->y_width;
   img->d_h = img->r_h = yv12->y_height;
   img->x_chroma_shift = 1;
@@ -270,6 +285,79 @@ static int update_fragments(vpx_codec_alg_priv_t *ctx, const uint8_t *data,
   return 1;
 }
 
+/* In streaming mode each fragment holds the next bytes of the frame, which
+ * are gathered in stream_buf, and a NULL fragment ends it. Returns 1 once
+ * there is enough of the frame to look at.
+ */
+static int update_stream(vpx_codec_alg_priv_t *ctx, const uint8_t *data,
+                         unsigned int data_sz, volatile vpx_codec_err_t *res) {
+  *res = VPX_CODEC_OK;
+
+  if (ctx->stream_complete) {
+    ctx->stream_sz = 0;
+    ctx->stream_complete = 0;
+  }
+
+  if (data == NULL && data_sz == 0) {
+    ctx->stream_complete = 1;
+    return ctx->stream_sz > 0;
+  }
+
+  if (data == NULL || data + data_sz <= data) {
+    *res = VPX_CODEC_INVALID_PARAM;
+    return -1;
+  }
+
+  if (data_sz > ctx->stream_buf_sz - ctx->stream_sz) {
+    const unsigned int buf_sz =
+        VPXMAX(2 * ctx->stream_buf_sz, ctx->stream_sz + data_sz);
+    uint8_t *const buf = (uint8_t *)vpx_malloc(buf_sz);
+    VP8D_COMP *const pbi = ctx->yv12_frame_buffers.pbi[0];
+
+    if (!buf) {
+      *res = VPX_CODEC_MEM_ERROR;
+      return -1;
+    }
+    if (ctx->stream_sz) memcpy(buf, ctx->stream_buf, ctx->stream_sz);
+    if (pbi) vp8dx_move_partial_data(pbi, ctx->stream_buf, buf);
+    vpx_free(ctx->stream_buf);
+    ctx->stream_buf = buf;
+    ctx->stream_buf_sz = buf_sz;
+  }
+
+  memcpy(ctx->stream_buf + ctx->stream_sz, data, data_sz);
+  ctx->stream_sz += data_sz;
+
+  /* Enough for the key frame header. */
+  return ctx->stream_sz >= 10;
+}
+
+/* Passes MB rows of the frame being decoded to the put_slice callback. */
+static void put_slice(void *priv, int mb_row, int mb_rows) {
+  vpx_codec_alg_priv_t *const ctx = (vpx_codec_alg_priv_t *)priv;
+  const VP8D_COMP *const pbi = ctx->yv12_frame_buffers.pbi[0];
+  const VP8_COMMON *const pc = &pbi->common;
+  const unsigned int top = 16 * mb_row;
+  const unsigned int bottom = VPXMIN(16 * (mb_row + mb_rows), pc->Height);
+  vpx_image_t img;
+  vpx_image_rect_t valid, update;
+
+  yuvconfig2image(&img, pbi->dec_fb_ref[INTRA_FRAME], ctx->user_priv);
+  img.d_w = pc->Width;
+  img.d_h = pc->Height;
+
+  valid.x = 0;
+  valid.y = 0;
+  valid.w = pc->Width;
+  valid.h = bottom;
+  update = valid;
+  update.y = top;
+  update.h = bottom - top;
+
+  ctx->base.dec.put_slice_cb.u.put_slice(
+      ctx->base.dec.put_slice_cb.user_priv, &img, &valid, &update);
+}
+
 static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
                                   const uint8_t *data, unsigned int data_sz,
                                   void *user_priv, long deadline) {
@@ -281,8 +369,16 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
     return 0;
   }
 
-  /* Update the input fragment data */
-  if (update_fragments(ctx, data, data_sz, &res) <= 0) return res;
+  if (ctx->streaming) {
+    if (update_stream(ctx, data, data_sz, &res) <= 0) return res;
+
+    ctx->fragments.ptrs[0] = ctx->stream_buf;
+    ctx->fragments.sizes[0] = ctx->stream_sz;
+    ctx->fragments.count = 1;
+  } else if (update_fragments(ctx, data, data_sz, &res) <= 0) {
+    /* Update the input fragment data */
+    return res;
+  }
 
   /* Determine the stream parameters. Note that we rely on peek_si to
    * validate that we have a buffer that does not wrap around the top
@@ -319,7 +415,7 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
     pbi->max_threads = ctx->cfg.threads;
     vp8_decoder_create_threads(pbi);
     if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd)) {
-      vp8mt_alloc_temp_buffers(pbi, pc->Width, pc->mb_rows);
+      vp8mt_alloc_temp_buffers(pbi, pc->Width);
     }
     ctx->restart_threads = 0;
     pbi->common.error.setjmp = 0;
@@ -336,6 +432,7 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
     oxcf.max_threads = ctx->cfg.threads;
     oxcf.error_concealment =
         (ctx->base.init_flags & VPX_CODEC_USE_ERROR_CONCEALMENT);
+    oxcf.compact_buffers = ctx->compact_buffers;
 
     /* If postprocessing was enabled by the application and a
      * configuration has not been provided, default it.
@@ -349,7 +446,18 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
     }
 
     res = vp8_create_decoder_instances(&ctx->yv12_frame_buffers, &oxcf);
-    if (res == VPX_CODEC_OK) ctx->decoder_init = 1;
+    if (res == VPX_CODEC_OK) {
+      VP8D_COMP *pbi = ctx->yv12_frame_buffers.pbi[0];
+      pbi->get_ext_fb_cb = ctx->get_ext_fb_cb;
+      pbi->release_ext_fb_cb = ctx->release_ext_fb_cb;
+      pbi->ext_cb_priv = ctx->ext_priv;
+      pbi->common.external_buffers = ctx->get_ext_fb_cb != NULL;
+      ctx->decoder_init = 1;
+    } else {
+      /* Forget the resolution so the retry allocates the frame buffers. */
+      ctx->si.w = 0;
+      ctx->si.h = 0;
+    }
   }
 
   /* Set these even if already initialized.  The caller may have changed the
@@ -358,6 +466,26 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
   if (ctx->decoder_init) {
     ctx->yv12_frame_buffers.pbi[0]->decrypt_cb = ctx->decrypt_cb;
     ctx->yv12_frame_buffers.pbi[0]->decrypt_state = ctx->decrypt_state;
+#if CONFIG_MULTITHREAD
+    ctx->yv12_frame_buffers.pbi[0]->partition_mt = ctx->partition_mt;
+#endif
+    ctx->yv12_frame_buffers.pbi[0]->decode_mode =
+        (DECODE_MODE)ctx->decode_mode;
+  }
+
+  if (!res && ctx->si.is_kf) {
+    ctx->wait_for_key_frame = 0;
+  } else if (!res && ctx->decode_mode == DECODE_KEY_FRAMES) {
+    ctx->wait_for_key_frame = 1;
+  }
+
+  /* Drop the inter frame before anything but the frame tag is parsed. */
+  if (!res && ctx->wait_for_key_frame) {
+    if (!ctx->streaming || ctx->stream_complete) {
+      ++ctx->yv12_frame_buffers.pbi[0]->skipped_frames;
+    }
+    ctx->fragments.count = 0;
+    return res;
   }
 
   if (!res) {
@@ -371,14 +499,17 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
       pc->Width = ctx->si.w;
       pc->Height = ctx->si.h;
       {
-        int prev_mb_rows = pc->mb_rows;
-
         if (setjmp(pbi->common.error.jmp)) {
           pbi->common.error.setjmp = 0;
           /* on failure clear the cached resolution to ensure a full
            * reallocation is attempted on resync. */
           ctx->si.w = 0;
           ctx->si.h = 0;
+#if CONFIG_MULTITHREAD
+          /* The row buffers may be part allocated but already carry the new
+           * size, which would stop the resync allocating them again. */
+          vp8mt_de_alloc_temp_buffers(pbi);
+#endif
           vpx_clear_system_state();
           /* same return value as used in vp8dx_receive_compressed_data */
           return -1;
@@ -398,7 +529,9 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
                              "Invalid frame height");
         }
 
-        if (vp8_alloc_frame_buffers(pc, pc->Width, pc->Height)) {
+        vp8dx_release_frame_buffers(pbi);
+
+        if (vp8_resize_frame_buffers(pc, pc->Width, pc->Height)) {
           vpx_internal_error(&pc->error, VPX_CODEC_MEM_ERROR,
                              "Failed to allocate frame buffers");
         }
@@ -418,10 +551,14 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
 #if CONFIG_ERROR_CONCEALMENT
 
         if (pbi->ec_enabled) {
-          /* old prev_mip was released by vp8_de_alloc_frame_buffers()
-           * called in vp8_alloc_frame_buffers() */
-          pc->prev_mip = vpx_calloc((pc->mb_cols + 1) * (pc->mb_rows + 1),
-                                    sizeof(MODE_INFO));
+          /* vp8_resize_frame_buffers() released prev_mip if it had to
+           * allocate mip again, otherwise prev_mip is as large as mip. */
+          if (pc->prev_mip) {
+            memset(pc->prev_mip, 0,
+                   sizeof(MODE_INFO) * (pc->mb_cols + 1) * (pc->mb_rows + 1));
+          } else {
+            pc->prev_mip = vpx_calloc(pc->mip_alloc_size, sizeof(MODE_INFO));
+          }
 
           if (!pc->prev_mip) {
             vp8_de_alloc_frame_buffers(pc);
@@ -442,10 +579,8 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
 
 #if CONFIG_MULTITHREAD
         if (vpx_atomic_load_acquire(&pbi->b_multithreaded_rd)) {
-          vp8mt_alloc_temp_buffers(pbi, pc->Width, prev_mb_rows);
+          vp8mt_alloc_temp_buffers(pbi, pc->Width);
         }
-#else
-        (void)prev_mb_rows;
 #endif
       }
 
@@ -467,6 +602,10 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
         pc->fb_idx_ref_cnt[pc->new_fb_idx]--;
       }
       pc->error.setjmp = 0;
+      /* The rest of a streamed frame is of no use. */
+      if (ctx->streaming) {
+        pbi->partial_frame = ctx->stream_complete ? PARTIAL_NONE : PARTIAL_DONE;
+      }
 #if CONFIG_MULTITHREAD
       if (pbi->restart_threads) {
         ctx->si.w = 0;
@@ -480,14 +619,24 @@ static vpx_codec_err_t vp8_decode(vpx_codec_alg_priv_t *ctx,
 
     pbi->common.error.setjmp = 1;
 
-    /* update the pbi fragment data */
-    pbi->fragments = ctx->fragments;
 #if CONFIG_MULTITHREAD
     pbi->restart_threads = 0;
 #endif
     ctx->user_priv = user_priv;
-    if (vp8dx_receive_compressed_data(pbi, deadline)) {
-      res = update_error_state(ctx, &pbi->common.error);
+    pbi->put_rows_cb =
+        ctx->base.dec.put_slice_cb.u.put_slice ? put_slice : NULL;
+    pbi->put_rows_priv = ctx;
+    if (ctx->streaming) {
+      if (vp8dx_receive_partial_data(pbi, ctx->stream_buf, ctx->stream_sz,
+                                     ctx->stream_complete, deadline)) {
+        res = update_error_state(ctx, &pbi->common.error);
+      }
+    } else {
+      /* update the pbi fragment data */
+      pbi->fragments = ctx->fragments;
+      if (vp8dx_receive_compressed_data(pbi, deadline)) {
+        res = update_error_state(ctx, &pbi->common.error);
+      }
     }
 
     /* get ready for the next series of fragments */
@@ -518,8 +667,22 @@ static vpx_image_t *vp8_get_frame(vpx_codec_alg_priv_t *ctx,
 
     if (0 == vp8dx_get_raw_frame(ctx->yv12_frame_buffers.pbi[0], &sd,
                                  &time_stamp, &time_end_stamp, &flags)) {
+      VP8D_COMP *pbi = ctx->yv12_frame_buffers.pbi[0];
+      int i;
+
       yuvconfig2image(&ctx->img, &sd, ctx->user_priv);
 
+      /* Tag the image with the application buffer it was decoded into. A
+       * postprocessed frame lives in an internal buffer and has none.
+       */
+      ctx->img.fb_priv = NULL;
+      for (i = 0; i < NUM_YV12_BUFFERS; ++i) {
+        if (pbi->ext_fb[i].data &&
+            sd.buffer_alloc == pbi->common.yv12_fb[i].buffer_alloc) {
+          ctx->img.fb_priv = pbi->ext_fb[i].priv;
+        }
+      }
+
       img = &ctx->img;
       *iter = img;
     }
@@ -687,6 +850,111 @@ static vpx_codec_err_t vp8_set_decryptor(vpx_codec_alg_priv_t *ctx,
   return VPX_CODEC_OK;
 }
 
+static vpx_codec_err_t vp8_set_fb_fn(
+    vpx_codec_alg_priv_t *ctx, vpx_get_frame_buffer_cb_fn_t cb_get,
+    vpx_release_frame_buffer_cb_fn_t cb_release, void *cb_priv) {
+  if (cb_get == NULL || cb_release == NULL) {
+    return VPX_CODEC_INVALID_PARAM;
+  } else if (ctx->decoder_init) {
+    /* The callbacks can only be set before the first frame is decoded. */
+    return VPX_CODEC_ERROR;
+  }
+
+  ctx->get_ext_fb_cb = cb_get;
+  ctx->release_ext_fb_cb = cb_release;
+  ctx->ext_priv = cb_priv;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_partition_mt(vpx_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  ctx->partition_mt = va_arg(args, int);
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_decode_mode(vpx_codec_alg_priv_t *ctx,
+                                           va_list args) {
+  const int mode = va_arg(args, int);
+
+  if (mode < DECODE_ALL_FRAMES || mode > DECODE_KEY_FRAMES) {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+  ctx->decode_mode = mode;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_streaming(vpx_codec_alg_priv_t *ctx,
+                                         va_list args) {
+  const int streaming = va_arg(args, int);
+
+  if (!ctx->fragments.enabled) return VPX_CODEC_INCAPABLE;
+  ctx->streaming = streaming != 0;
+  ctx->stream_sz = 0;
+  ctx->stream_complete = 0;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_set_compact_buffers(vpx_codec_alg_priv_t *ctx,
+                                               va_list args) {
+  const int compact = va_arg(args, int);
+
+  /* The frame buffers are laid out when the first frame is decoded. */
+  if (ctx->decoder_init) return VPX_CODEC_ERROR;
+  ctx->compact_buffers = compact != 0;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t vp8_get_memory_usage(vpx_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  vp8d_memory_usage *usage = va_arg(args, vp8d_memory_usage *);
+  const VP8D_COMP *pbi = ctx->yv12_frame_buffers.pbi[0];
+
+  if (usage == NULL) return VPX_CODEC_INVALID_PARAM;
+
+  memset(usage, 0, sizeof(*usage));
+  usage->other = sizeof(*ctx) + ctx->stream_buf_sz;
+  if (pbi) vp8dx_get_memory_usage(pbi, usage);
+  usage->total =
+      usage->frame_buffers + usage->mb_info + usage->threads + usage->other;
+  return VPX_CODEC_OK;
+}
+
+static void get_stage_times(const STAGE_TIMES *t, vp8d_stage_times *us) {
+  us->decode_us = t->decode / 1000;
+  us->mode_mvs_us = t->mode_mvs / 1000;
+  us->tokens_us = t->tokens / 1000;
+  us->recon_us = t->recon / 1000;
+  us->loop_filter_us = t->loop_filter / 1000;
+  us->extend_us = t->extend / 1000;
+}
+
+static void get_mb_counts(const MB_COUNTS *c, vp8d_mb_counts *counts) {
+  counts->mbs = c->mbs;
+  counts->skipped = c->skipped;
+  counts->intra = c->intra;
+  counts->split_mv = c->split_mv;
+  counts->dc_only = c->dc_only;
+}
+
+static vpx_codec_err_t vp8_get_perf_stats(vpx_codec_alg_priv_t *ctx,
+                                          va_list args) {
+  vp8d_perf_stats *stats = va_arg(args, vp8d_perf_stats *);
+  const VP8D_COMP *pbi = ctx->yv12_frame_buffers.pbi[0];
+
+  if (stats == NULL) return VPX_CODEC_INVALID_PARAM;
+
+  memset(stats, 0, sizeof(*stats));
+  if (pbi) {
+    stats->frames = pbi->perf_frames;
+    stats->skipped_frames = pbi->skipped_frames;
+    get_stage_times(&pbi->last_frame_times, &stats->last_frame);
+    get_stage_times(&pbi->total_times, &stats->total);
+    get_mb_counts(&pbi->last_frame_counts, &stats->last_frame_mbs);
+    get_mb_counts(&pbi->total_counts, &stats->total_mbs);
+  }
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_ctrl_fn_map_t vp8_ctf_maps[] = {
   { VP8_SET_REFERENCE, vp8_set_reference },
   { VP8_COPY_REFERENCE, vp8_get_reference },
@@ -696,6 +964,12 @@ static vpx_codec_ctrl_fn_map_t vp8_ctf_maps[] = {
   { VP8D_GET_LAST_REF_USED, vp8_get_last_ref_frame },
   { VPXD_GET_LAST_QUANTIZER, vp8_get_quantizer },
   { VPXD_SET_DECRYPTOR, vp8_set_decryptor },
+  { VP8D_SET_PARTITION_MT, vp8_set_partition_mt },
+  { VP8D_GET_PERF_STATS, vp8_get_perf_stats },
+  { VP8D_SET_DECODE_MODE, vp8_set_decode_mode },
+  { VP8D_SET_STREAMING, vp8_set_streaming },
+  { VP8D_SET_COMPACT_BUFFERS, vp8_set_compact_buffers },
+  { VP8D_GET_MEMORY_USAGE, vp8_get_memory_usage },
   { -1, NULL },
 };
 
@@ -708,7 +982,8 @@ vpx_codec_iface_t vpx_codec_vp8_dx_algo = {
   "WebM Project VP8 Decoder" VERSION_STRING,
   VPX_CODEC_INTERNAL_ABI_VERSION,
   VPX_CODEC_CAP_DECODER | VP8_CAP_POSTPROC | VP8_CAP_ERROR_CONCEALMENT |
-      VPX_CODEC_CAP_INPUT_FRAGMENTS,
+      VPX_CODEC_CAP_INPUT_FRAGMENTS | VPX_CODEC_CAP_EXTERNAL_FRAME_BUFFER |
+      VPX_CODEC_CAP_PUT_SLICE,
   /* vpx_codec_caps_t          caps; */
   vp8_init,     /* vpx_codec_init_fn_t       init; */
   vp8_destroy,  /* vpx_codec_destroy_fn_t    destroy; */
@@ -718,7 +993,7 @@ vpx_codec_iface_t vpx_codec_vp8_dx_algo = {
       vp8_get_si,    /* vpx_codec_get_si_fn_t     get_si; */
       vp8_decode,    /* vpx_codec_decode_fn_t     decode; */
       vp8_get_frame, /* vpx_codec_frame_get_fn_t  frame_get; */
-      NULL,
+      vp8_set_fb_fn, /* vpx_codec_set_fb_fn_t     set_fb_fn; */
   },
   {
       /* encoder functions */
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+
+#include "vpx/vp8rtp.h"
+
+/* First octet of the payload descriptor, RFC 7741 section 4.2. */
+#define DESC_X 0x80
+#define DESC_N 0x20
+#define DESC_S 0x10
+#define DESC_MAX_PID 7
+
+/* Extension octet. */
+#define DESC_I 0x80
+#define DESC_L 0x40
+#define DESC_T 0x20
+
+static unsigned int descriptor_size(unsigned int flags) {
+  unsigned int sz = 1;
+
+  if (flags) ++sz;
+  if (flags & VPX_VP8_RTP_PICTURE_ID) sz += 2;
+  if (flags & VPX_VP8_RTP_TL0PICIDX) sz += 2;
+  return sz;
+}
+
+vpx_codec_err_t vpx_vp8_rtp_init(vpx_vp8_rtp_packetizer_t *packetizer,
+                                 unsigned int mtu, unsigned int flags) {
+  if (!packetizer) return VPX_CODEC_INVALID_PARAM;
+  if (flags & ~(VPX_VP8_RTP_PICTURE_ID | VPX_VP8_RTP_TL0PICIDX)) {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+  if (mtu <= descriptor_size(flags)) return VPX_CODEC_INVALID_PARAM;
+
+  memset(packetizer, 0, sizeof(*packetizer));
+  packetizer->mtu = mtu;
+  packetizer->flags = flags;
+  return VPX_CODEC_OK;
+}
+
+/* Everything in the descriptor except S and PID is the same for every
+ * payload of a frame, so it is built once when the frame is complete and the
+ * per frame counters move on.
+ */
+static void start_frame(vpx_vp8_rtp_packetizer_t *p) {
+  unsigned char *d = p->descriptor;
+  unsigned int sz = 1;
+
+  d[0] = p->non_reference ? DESC_N : 0;
+
+  if (p->flags) {
+    d[0] |= DESC_X;
+    d[1] = 0;
+    sz = 2;
+
+    if (p->flags & VPX_VP8_RTP_PICTURE_ID) {
+      const unsigned int picture_id = p->picture_id & 0x7fff;
+
+      d[1] |= DESC_I;
+      d[sz++] = 0x80 | (picture_id >> 8);
+      d[sz++] = picture_id & 0xff;
+      p->picture_id = (picture_id + 1) & 0x7fff;
+    }
+
+    if (p->flags & VPX_VP8_RTP_TL0PICIDX) {
+      const int base = p->temporal_id == 0;
+
+      d[1] |= DESC_L | DESC_T;
+      d[sz++] = (p->tl0picidx - (base ? 0 : 1)) & 0xff;
+      d[sz++] = ((p->temporal_id & 3) << 6) | (p->layer_sync ? 0x20 : 0);
+      if (base) p->tl0picidx = (p->tl0picidx + 1) & 0xff;
+    }
+  }
+
+  p->descriptor_sz = sz;
+  p->frame_complete = 1;
+  p->part = 0;
+  p->offset = 0;
+  p->fragment_sz = 0;
+}
+
+vpx_codec_err_t vpx_vp8_rtp_add_packet(vpx_vp8_rtp_packetizer_t *packetizer,
+                                       const vpx_codec_cx_pkt_t *pkt) {
+  vpx_vp8_rtp_packetizer_t *const p = packetizer;
+  int partition_id;
+
+  if (!p || !pkt || pkt->kind != VPX_CODEC_CX_FRAME_PKT) {
+    return VPX_CODEC_INVALID_PARAM;
+  }
+
+  if (p->frame_complete) {
+    p->frame_complete = 0;
+    p->num_parts = 0;
+  }
+
+  /* A whole frame is a single partition. */
+  partition_id =
+      pkt->data.frame.partition_id < 0 ? 0 : pkt->data.frame.partition_id;
+  if (partition_id != p->num_parts ||
+      partition_id >= VPX_VP8_RTP_MAX_PARTITIONS) {
+    p->num_parts = 0;
+    return VPX_CODEC_INVALID_PARAM;
+  }
+
+  p->part_buf[partition_id] = (const unsigned char *)pkt->data.frame.buf;
+  p->part_sz[partition_id] = pkt->data.frame.sz;
+  p->num_parts++;
+
+  if (!(pkt->data.frame.flags & VPX_FRAME_IS_FRAGMENT)) {
+    p->non_reference = !!(pkt->data.frame.flags & VPX_FRAME_IS_DROPPABLE);
+    start_frame(p);
+  }
+
+  return VPX_CODEC_OK;
+}
+
+const vpx_vp8_rtp_payload_t *vpx_vp8_rtp_get_payload(
+    vpx_vp8_rtp_packetizer_t *packetizer) {
+  vpx_vp8_rtp_packetizer_t *const p = packetizer;
+  vpx_vp8_rtp_payload_t *const payload = &p->payload;
+  const size_t capacity = p->mtu - p->descriptor_sz;
+  const int first = p->part;
+  size_t remaining;
+
+  if (!p->frame_complete || p->part >= p->num_parts) return NULL;
+
+  remaining = p->part_sz[first] - p->offset;
+
+  /* A partition too big for one payload is cut into equal fragments, the
+   * same number a greedy split would need.
+   */
+  if (p->offset == 0 && remaining > capacity) {
+    const size_t fragments = (remaining + capacity - 1) / capacity;
+    p->fragment_sz = (remaining + fragments - 1) / fragments;
+  }
+
+  payload->data = p->part_buf[first] + p->offset;
+
+  if (remaining > capacity || (p->offset && remaining > p->fragment_sz)) {
+    payload->data_sz = p->fragment_sz;
+    p->offset += p->fragment_sz;
+  } else {
+    /* The rest of the partition fits, followed by any whole partitions that
+     * fit behind it and follow on in memory.
+     */
+    payload->data_sz = remaining;
+    p->part++;
+    p->offset = 0;
+
+    while (p->part < p->num_parts &&
+           p->part_buf[p->part] == payload->data + payload->data_sz &&
+           p->part_sz[p->part] <= capacity - payload->data_sz) {
+      payload->data_sz += p->part_sz[p->part];
+      p->part++;
+    }
+  }
+
+  memcpy(payload->descriptor, p->descriptor, p->descriptor_sz);
+  payload->descriptor_sz = p->descriptor_sz;
+
+  /* PID is capped at 7, only the first payload with a PID may set S. */
+  payload->descriptor[0] |= first < DESC_MAX_PID ? first : DESC_MAX_PID;
+  if (payload->data == p->part_buf[first] && first <= DESC_MAX_PID) {
+    payload->descriptor[0] |= DESC_S;
+  }
+
+  payload->marker = p->part >= p->num_parts;
+  return payload;
+}
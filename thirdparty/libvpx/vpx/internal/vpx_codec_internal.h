@@ -351,6 +351,8 @@ struct vpx_codec_priv {
     vpx_codec_cx_pkt_t cx_data_pkt;
     unsigned int total_encoders;
   } enc;
+  /* Set with vpx_codec_set_mem_allocator(), NULL for the process default. */
+  const vpx_mem_allocator_t *allocator;
 };
 
 /*
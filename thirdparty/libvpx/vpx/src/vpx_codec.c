@@ -14,9 +14,15 @@
  */
 #include <stdarg.h>
 #include <stdlib.h>
+#include "./vpx_config.h"
+#include "vpx/vp8.h"
 #include "vpx/vpx_integer.h"
 #include "vpx/internal/vpx_codec_internal.h"
+#include "vpx_mem/vpx_mem.h"
 #include "vpx_version.h"
+#if CONFIG_VP8
+#include "vp8/common/systemdependent.h"
+#endif
 
 #define SAVE_STATUS(ctx, var) (ctx ? (ctx->err = var) : var)
 
@@ -81,6 +87,39 @@ vpx_codec_err_t vpx_codec_destroy(vpx_codec_ctx_t *ctx) {
   return SAVE_STATUS(ctx, res);
 }
 
+vpx_codec_err_t vpx_codec_set_mem_allocator(
+    vpx_codec_ctx_t *ctx, const vpx_mem_allocator_t *allocator) {
+  vpx_codec_err_t res = VPX_CODEC_OK;
+
+  if (!ctx)
+    vpx_mem_set_default_allocator(allocator);
+  else if (!ctx->iface || !ctx->priv)
+    res = VPX_CODEC_ERROR;
+  else
+    ctx->priv->allocator = allocator;
+
+  return SAVE_STATUS(ctx, res);
+}
+
+int vpx_codec_set_simd_caps_mask(unsigned int mask) {
+#if CONFIG_VP8
+  return vp8_set_simd_caps_mask(mask);
+#else
+  (void)mask;
+  return 0;
+#endif
+}
+
+int vpx_codec_get_rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots) {
+#if CONFIG_VP8
+  return vp8_get_rtcd_slots(slots, max_slots);
+#else
+  (void)slots;
+  (void)max_slots;
+  return 0;
+#endif
+}
+
 vpx_codec_caps_t vpx_codec_get_caps(vpx_codec_iface_t *iface) {
   return (iface) ? iface->caps : 0;
 }
@@ -99,11 +138,14 @@ vpx_codec_err_t vpx_codec_control_(vpx_codec_ctx_t *ctx, int ctrl_id, ...) {
 
     for (entry = ctx->iface->ctrl_maps; entry->fn; entry++) {
       if (!entry->ctrl_id || entry->ctrl_id == ctrl_id) {
+        const vpx_mem_allocator_t *const allocator =
+            vpx_mem_set_thread_allocator(ctx->priv->allocator);
         va_list ap;
 
         va_start(ap, ctrl_id);
         res = entry->fn((vpx_codec_alg_priv_t *)ctx->priv, ap);
         va_end(ap);
+        vpx_mem_set_thread_allocator(allocator);
         break;
       }
     }
@@ -14,6 +14,7 @@
  */
 #include <string.h>
 #include "vpx/internal/vpx_codec_internal.h"
+#include "vpx_mem/vpx_mem.h"
 
 #define SAVE_STATUS(ctx, var) (ctx ? (ctx->err = var) : var)
 
@@ -113,8 +114,12 @@ vpx_codec_err_t vpx_codec_decode(vpx_codec_ctx_t *ctx, const uint8_t *data,
   else if (!ctx->iface || !ctx->priv)
     res = VPX_CODEC_ERROR;
   else {
+    const vpx_mem_allocator_t *const allocator =
+        vpx_mem_set_thread_allocator(ctx->priv->allocator);
+
     res = ctx->iface->dec.decode(get_alg_priv(ctx), data, data_sz, user_priv,
                                  deadline);
+    vpx_mem_set_thread_allocator(allocator);
   }
 
   return SAVE_STATUS(ctx, res);
@@ -19,6 +19,7 @@
 #include "vp8/common/blockd.h"
 #include "vpx_config.h"
 #include "vpx/internal/vpx_codec_internal.h"
+#include "vpx_mem/vpx_mem.h"
 
 #define SAVE_STATUS(ctx, var) ((ctx) ? ((ctx)->err = (var)) : (var))
 
@@ -198,6 +199,8 @@ vpx_codec_err_t vpx_codec_encode(vpx_codec_ctx_t *ctx, const vpx_image_t *img,
     res = VPX_CODEC_INCAPABLE;
   else {
     unsigned int num_enc = ctx->priv->enc.total_encoders;
+    const vpx_mem_allocator_t *const allocator =
+        vpx_mem_set_thread_allocator(ctx->priv->allocator);
 
     /* Execute in a normalized floating point environment, if the platform
      * requires it.
@@ -219,6 +222,7 @@ vpx_codec_err_t vpx_codec_encode(vpx_codec_ctx_t *ctx, const vpx_image_t *img,
       if (img) img += num_enc - 1;
 
       for (i = num_enc - 1; i >= 0; i--) {
+        vpx_mem_set_thread_allocator(ctx->priv->allocator);
         if ((res = ctx->iface->enc.encode(get_alg_priv(ctx), img, pts, duration,
                                           flags, deadline)))
           break;
@@ -230,6 +234,7 @@ vpx_codec_err_t vpx_codec_encode(vpx_codec_ctx_t *ctx, const vpx_image_t *img,
     }
 
     FLOATING_POINT_RESTORE();
+    vpx_mem_set_thread_allocator(allocator);
   }
 
   return SAVE_STATUS(ctx, res);
@@ -343,8 +348,13 @@ vpx_codec_err_t vpx_codec_enc_config_set(vpx_codec_ctx_t *ctx,
     res = VPX_CODEC_INVALID_PARAM;
   else if (!(ctx->iface->caps & VPX_CODEC_CAP_ENCODER))
     res = VPX_CODEC_INCAPABLE;
-  else
+  else {
+    const vpx_mem_allocator_t *const allocator =
+        vpx_mem_set_thread_allocator(ctx->priv->allocator);
+
     res = ctx->iface->enc.cfg_set(get_alg_priv(ctx), cfg);
+    vpx_mem_set_thread_allocator(allocator);
+  }
 
   return SAVE_STATUS(ctx, res);
 }
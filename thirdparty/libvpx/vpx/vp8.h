@@ -112,6 +112,56 @@ typedef struct vp9_ref_frame {
   vpx_image_t img; /**< img structure to populate (output) */
 } vp9_ref_frame_t;
 
+/*!\brief SIMD instruction set flags
+ * The values match the VPX_SIMD_CAPS and VPX_SIMD_CAPS_MASK environment
+ * variables.
+ */
+enum vpx_simd_caps {
+  VPX_SIMD_MMX = 0x001,
+  VPX_SIMD_SSE = 0x002,
+  VPX_SIMD_SSE2 = 0x004,
+  VPX_SIMD_SSE3 = 0x008,
+  VPX_SIMD_SSSE3 = 0x010,
+  VPX_SIMD_SSE4_1 = 0x020,
+  VPX_SIMD_AVX = 0x040,
+  VPX_SIMD_AVX2 = 0x080,
+  VPX_SIMD_AVX512 = 0x100
+};
+
+/*!\brief Run time dispatch slot
+ * Describes one kernel in the run time CPU dispatch (RTCD) tables and the
+ * variant it resolved to on this machine.
+ */
+typedef struct vpx_rtcd_slot {
+  const char *name;    /**< slot name, e.g. "vp8_sixtap_predict16x16" */
+  const char *variant; /**< resolved variant, e.g. "c", "sse2" or "ssse3" */
+} vpx_rtcd_slot_t;
+
+/*!\brief Caps the SIMD instruction sets used by the codec kernels.
+ *
+ * The RTCD tables are shared by every encoder and decoder in the process and
+ * are filled in once, so this must be called before the first codec is
+ * created. The tables are filled in straight away; later calls, and calls
+ * made after a codec has been created, fail and leave the tables unchanged.
+ * The mask is applied on top of the detected CPU features and the
+ * VPX_SIMD_CAPS_MASK environment variable. Pass 0 to run the C kernels only.
+ *
+ * \param[in] mask    Combination of #vpx_simd_caps flags.
+ *
+ * \return The instruction sets in use, or -1 if the tables were already
+ *         filled in.
+ */
+int vpx_codec_set_simd_caps_mask(unsigned int mask);
+
+/*!\brief Reports which variant each RTCD slot resolved to.
+ *
+ * \param[out] slots     Receives up to max_slots entries, may be NULL.
+ * \param[in]  max_slots Size of the slots array.
+ *
+ * \return The total number of slots, which may exceed max_slots.
+ */
+int vpx_codec_get_rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots);
+
 /*!\cond */
 /*!\brief vp8 decoder control function parameter type
  *
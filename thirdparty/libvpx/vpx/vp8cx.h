@@ -684,6 +684,34 @@ enum vp8e_enc_control_id {
    * Supported in codecs: VP9
    */
   VP9E_SET_DELTA_Q_UV,
+
+  /*!\brief Codec control function to encode from the caller's image planes
+   * without copying them, vpx_raw_frame_release_t* parameter.
+   *
+   * While a release callback is set, vpx_codec_encode() keeps a reference to
+   * the planes of each image instead of copying the frame into the
+   * lookahead. The planes must stay valid and unmodified until the callback
+   * is called for that image. Every image accepted by vpx_codec_encode() is
+   * released exactly once. Images that cannot be referenced are copied and
+   * released before vpx_codec_encode() returns, this covers sizes that are
+   * not a multiple of 16, uv stride other than half the y stride, lag in
+   * frames, the first pass, noise sensitivity and spatial resampling. A
+   * referenced image is released once it has been encoded or the encode has
+   * failed, before vpx_codec_encode() returns.
+   *
+   * Set it before the first frame is encoded. A NULL release_cb turns the
+   * mode off.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8E_SET_RAW_FRAME_RELEASE,
+
+  /*!\brief Codec control function to get the time spent in each stage of
+   * encoding and the modes the MBs were coded with, see vp8e_perf_stats.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8E_GET_PERF_STATS,
 };
 
 /*!\brief vpx 1-D scaling mode
@@ -771,6 +799,88 @@ typedef struct vpx_scaling_mode {
   VPX_SCALING_MODE v_scaling_mode; /**< vertical scaling mode   */
 } vpx_scaling_mode_t;
 
+/*!\brief Raw frame release callback prototype
+ *
+ * Called when the encoder has finished reading the planes of an image passed
+ * to vpx_codec_encode() with VP8E_SET_RAW_FRAME_RELEASE set. img describes
+ * that image: format, size, planes, strides and user_priv. It is only valid
+ * for the duration of the call.
+ */
+typedef void (*vpx_raw_frame_release_cb_fn_t)(void *cb_priv,
+                                              const vpx_image_t *img);
+
+/*!\brief Zero copy raw frame input
+ *
+ * This defines the data structure for VP8E_SET_RAW_FRAME_RELEASE.
+ */
+typedef struct vpx_raw_frame_release {
+  vpx_raw_frame_release_cb_fn_t release_cb; /**< NULL copies every frame */
+  void *cb_priv; /**< passed back to release_cb */
+} vpx_raw_frame_release_t;
+
+/*!\brief Number of MB modes counted by vp8e_perf_stats
+ *
+ * In the order DC_PRED, V_PRED, H_PRED, TM_PRED, B_PRED, NEARESTMV, NEARMV,
+ * ZEROMV, NEWMV and SPLITMV.
+ */
+#define VP8E_MB_MODES 10
+
+/*!\brief Time spent in each stage of encoding, in microseconds
+ *
+ * With multiple threads the motion search, transform/quant and tokenize
+ * times are summed over the threads, so together they can exceed
+ * encode_us. The loop filter runs alongside the bitstream packing when
+ * threads are used.
+ */
+typedef struct vp8e_stage_times {
+  /*! Wall clock time spent in the encoder for the frame. */
+  int64_t encode_us;
+
+  /*! Copying the input frames into the lookahead. Frames passed to
+   * vpx_codec_encode() count towards the next frame that comes out. */
+  int64_t lookahead_us;
+
+  /*! Mode decision and motion search, including the intra mode search. */
+  int64_t motion_search_us;
+
+  /*! Prediction, forward and inverse transform and quantization. */
+  int64_t transform_quant_us;
+
+  /*! Tokenizing the coefficients. */
+  int64_t tokenize_us;
+
+  /*! Writing the modes and tokens to the bitstream. */
+  int64_t pack_bitstream_us;
+
+  /*! Picking the loop filter level. */
+  int64_t lf_pick_us;
+
+  /*! Loop filtering the reconstructed frame. */
+  int64_t lf_filter_us;
+} vp8e_stage_times;
+
+/*!\brief Encoder stage timing and MB mode counts, for VP8E_GET_PERF_STATS
+ *
+ * The totals cover every frame since the encoder was created. A frame that
+ * is recoded counts the time of every attempt and the modes of the last.
+ */
+typedef struct vp8e_perf_stats {
+  /*! Number of frames encoded, including dropped frames. */
+  unsigned int frames;
+
+  /*! Stage times of the last frame encoded. */
+  vp8e_stage_times last_frame;
+
+  /*! Stage times summed over every frame. */
+  vp8e_stage_times total;
+
+  /*! MBs coded with each mode in the last frame, see VP8E_MB_MODES. */
+  unsigned int last_frame_mb_modes[VP8E_MB_MODES];
+
+  /*! MBs coded with each mode over every frame. */
+  uint64_t total_mb_modes[VP8E_MB_MODES];
+} vp8e_perf_stats;
+
 /*!\brief VP8 token partition mode
  *
  * This defines VP8 partitioning mode for compressed data, i.e., the number of
@@ -1034,6 +1144,12 @@ VPX_CTRL_USE_TYPE(VP9E_SET_POSTENCODE_DROP, unsigned int)
 VPX_CTRL_USE_TYPE(VP9E_SET_DELTA_Q_UV, int)
 #define VPX_CTRL_VP9E_SET_DELTA_Q_UV
 
+VPX_CTRL_USE_TYPE(VP8E_SET_RAW_FRAME_RELEASE, vpx_raw_frame_release_t *)
+#define VPX_CTRL_VP8E_SET_RAW_FRAME_RELEASE
+
+VPX_CTRL_USE_TYPE(VP8E_GET_PERF_STATS, vp8e_perf_stats *)
+#define VPX_CTRL_VP8E_GET_PERF_STATS
+
 /*!\endcond */
 /*! @} - end defgroup vp8_encoder */
 #ifdef __cplusplus
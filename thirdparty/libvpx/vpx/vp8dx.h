@@ -142,6 +142,84 @@ enum vp8_dec_control_id {
    */
   VP9D_SET_LOOP_FILTER_OPT,
 
+  /*!\brief Codec control function to set token partition multi-threading.
+   *
+   * 0 : off, each thread parses the partitions of the MB rows it
+   *     reconstructs
+   * 1 : on, some of the threads entropy decode the token partitions ahead
+   *     of the rest, which only reconstruct. Also applies to streams with
+   *     a single partition. Not used while error concealment is active.
+   *
+   * Takes effect from the next frame and needs at least 2 threads.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_SET_PARTITION_MT,
+
+  /*!\brief Codec control function to get the time spent in each stage of
+   * decoding and the kinds of MB decoded, see vp8d_perf_stats.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_GET_PERF_STATS,
+
+  /*!\brief Codec control function to choose which frames are decoded, for
+   * previews and monitoring where most of the stream is not needed.
+   *
+   * 0 : every frame
+   * 1 : skip frames that update no reference buffer. Only their headers and,
+   *     when they carry probability or segment map updates, their modes are
+   *     parsed
+   * 2 : key frames only. Inter frames are dropped without being parsed
+   *
+   * Skipped frames give no output image. After mode 2 inter frames are still
+   * dropped until the next key frame, as their references are missing.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_SET_DECODE_MODE,
+
+  /*!\brief Codec control function to decode frames as their data arrives,
+   * for the lowest latency over a network. Set to 1 to enable, 0 to
+   * disable. Needs VPX_CODEC_USE_INPUT_FRAGMENTS.
+   *
+   * Each vpx_codec_decode() call then passes the next bytes of the frame,
+   * in any sized runs such as RTP payloads, and a call with NULL data and
+   * 0 size ends the frame. MB rows are decoded as soon as the first
+   * partition and the rows' tokens have come, and each row that is final
+   * is passed to the put_slice callback, if one is registered. The frame
+   * is output as usual once it ends.
+   *
+   * With more than one thread, or error concealment, the frame is decoded
+   * once it ends and the put_slice callback gets all of it at once. Slices
+   * are not postprocessed. Only change it between frames.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_SET_STREAMING,
+
+  /*!\brief Codec control function to lower the memory each decoder holds,
+   * for hosts running many decoders at once. Set to 1 to enable, before the
+   * first frame is decoded.
+   *
+   * Frame buffers then have a 16 pixel border instead of 32. Blocks whose
+   * prediction would read past it are predicted from a copy with the edge
+   * pixels repeated, so the output is unchanged. Frame buffers are also only
+   * allocated once a frame is decoded into them, so golden and altref
+   * frames that share a buffer with the last frame take no memory of their
+   * own, as after a key frame.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_SET_COMPACT_BUFFERS,
+
+  /*!\brief Codec control function to get the memory held by the decoder,
+   * see vp8d_memory_usage.
+   *
+   * Supported in codecs: VP8
+   */
+  VP8D_GET_MEMORY_USAGE,
+
   VP8_DECODER_CTRL_ID_MAX
 };
 
@@ -163,6 +241,105 @@ typedef struct vpx_decrypt_init {
   void *decrypt_state;
 } vpx_decrypt_init;
 
+/*!\brief Time spent in each stage of decoding, in microseconds
+ *
+ * With multiple threads the token, reconstruction, loop filter and border
+ * extension times are summed over the threads, so together they can exceed
+ * decode_us.
+ */
+typedef struct vp8d_stage_times {
+  /*! Wall clock time spent decoding. */
+  int64_t decode_us;
+
+  /*! Decoding the modes and motion vectors, vp8_decode_mode_mvs(). */
+  int64_t mode_mvs_us;
+
+  /*! Decoding the coefficient tokens, vp8_decode_mb_tokens(). */
+  int64_t tokens_us;
+
+  /*! Prediction, inverse transform and reconstruction. */
+  int64_t recon_us;
+
+  /*! Loop filtering. */
+  int64_t loop_filter_us;
+
+  /*! Extension of the frame borders for motion compensation. */
+  int64_t extend_us;
+} vp8d_stage_times;
+
+/*!\brief Counts of the kinds of MB decoded
+ *
+ * An MB can be counted in more than one of skipped, intra and split_mv.
+ */
+typedef struct vp8d_mb_counts {
+  /*! MBs decoded. */
+  uint64_t mbs;
+
+  /*! MBs with no coefficients, flagged as skipped or with none coded. */
+  uint64_t skipped;
+
+  /*! Intra coded MBs. */
+  uint64_t intra;
+
+  /*! Inter MBs split into partitions with their own motion vectors. */
+  uint64_t split_mv;
+
+  /*! MBs with coefficients but no more than the DC of each block. */
+  uint64_t dc_only;
+} vp8d_mb_counts;
+
+/*!\brief Decoder stage timing and MB counts, for VP8D_GET_PERF_STATS
+ *
+ * Only frames decoded without error are counted.
+ */
+typedef struct vp8d_perf_stats {
+  /*! Number of frames decoded. */
+  unsigned int frames;
+
+  /*! Number of frames skipped under VP8D_SET_DECODE_MODE. */
+  unsigned int skipped_frames;
+
+  /*! Stage times of the last frame decoded. */
+  vp8d_stage_times last_frame;
+
+  /*! Stage times summed over every frame since the decoder was created. */
+  vp8d_stage_times total;
+
+  /*! MB counts of the last frame decoded. */
+  vp8d_mb_counts last_frame_mbs;
+
+  /*! MB counts summed over every frame. */
+  vp8d_mb_counts total_mbs;
+} vp8d_perf_stats;
+
+/*!\brief Memory held by a decoder, for VP8D_GET_MEMORY_USAGE
+ *
+ * Sizes are those of the main allocations, without allocator overheads.
+ */
+typedef struct vp8d_memory_usage {
+  /*! Frame buffers, with their borders. Buffers from the application's
+   * frame buffer callbacks are not included.
+   */
+  size_t frame_buffers;
+
+  /*! Number of frame buffers holding memory, including application
+   * buffers.
+   */
+  unsigned int frame_buffer_count;
+
+  /*! Per MB state: mode info, entropy contexts and error concealment. */
+  size_t mb_info;
+
+  /*! Thread data, per MB row buffers and tokens parsed ahead. */
+  size_t threads;
+
+  /*! The decoder instance and the data of a frame being streamed in. */
+  size_t other;
+
+  /*! Sum of the sizes above. */
+  size_t total;
+} vp8d_memory_usage;
+
 /*!\cond */
 /*!\brief VP8 decoder control function parameter type
  *
@@ -199,6 +376,18 @@ VPX_CTRL_USE_TYPE(VP9_SET_SKIP_LOOP_FILTER, int)
 VPX_CTRL_USE_TYPE(VP9D_SET_ROW_MT, int)
 #define VPX_CTRL_VP9_SET_LOOP_FILTER_OPT
 VPX_CTRL_USE_TYPE(VP9D_SET_LOOP_FILTER_OPT, int)
+#define VPX_CTRL_VP8D_SET_PARTITION_MT
+VPX_CTRL_USE_TYPE(VP8D_SET_PARTITION_MT, int)
+#define VPX_CTRL_VP8D_GET_PERF_STATS
+VPX_CTRL_USE_TYPE(VP8D_GET_PERF_STATS, vp8d_perf_stats *)
+#define VPX_CTRL_VP8D_SET_DECODE_MODE
+VPX_CTRL_USE_TYPE(VP8D_SET_DECODE_MODE, int)
+#define VPX_CTRL_VP8D_SET_STREAMING
+VPX_CTRL_USE_TYPE(VP8D_SET_STREAMING, int)
+#define VPX_CTRL_VP8D_SET_COMPACT_BUFFERS
+VPX_CTRL_USE_TYPE(VP8D_SET_COMPACT_BUFFERS, int)
+#define VPX_CTRL_VP8D_GET_MEMORY_USAGE
+VPX_CTRL_USE_TYPE(VP8D_GET_MEMORY_USAGE, vp8d_memory_usage *)
 
 /*!\endcond */
 /*! @} - end defgroup vp8_decoder */
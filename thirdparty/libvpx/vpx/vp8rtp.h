@@ -0,0 +1,163 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef VPX_VPX_VP8RTP_H_
+#define VPX_VPX_VP8RTP_H_
+
+/*!\defgroup vp8_rtp VP8 RTP Packetizer
+ * \ingroup vp8
+ *
+ * @{
+ */
+#include "./vpx_encoder.h"
+
+/*!\file
+ * \brief Splits VP8 encoder output into RTP payloads as described in
+ *        RFC 7741.
+ *
+ * Frame packets from vpx_codec_get_cx_data() are added to the packetizer,
+ * preferably one per partition by initialising the encoder with
+ * #VPX_CODEC_USE_OUTPUT_PARTITION, and the payloads for the frame are then
+ * read back one at a time. Each payload is a VP8 payload descriptor plus a
+ * range of the encoder's output, nothing is copied. The range stays valid
+ * until the next call to vpx_codec_encode(), so the application would
+ * typically gather the RTP header, descriptor and data straight into its
+ * socket send.
+ *
+ * Payloads start at partition boundaries where they can. A partition that
+ * fits in the space left in a payload is never split, and one larger than a
+ * payload is split into equal sized fragments so its last fragment ends at
+ * the next partition boundary.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!\brief Largest VP8 payload descriptor, in bytes */
+#define VPX_VP8_RTP_MAX_DESCRIPTOR_SIZE 6
+
+/*!\brief Most partitions in a VP8 frame, the first plus eight token
+ * partitions
+ */
+#define VPX_VP8_RTP_MAX_PARTITIONS 9
+
+/*!\brief Optional payload descriptor fields
+ *
+ * Combined into the flags passed to vpx_vp8_rtp_init().
+ */
+enum vpx_vp8_rtp_flags {
+  /*!\brief Carry a 15 bit PictureID, incremented for every frame */
+  VPX_VP8_RTP_PICTURE_ID = 1 << 0,
+  /*!\brief Carry TL0PICIDX and the TID/Y fields for temporal layering */
+  VPX_VP8_RTP_TL0PICIDX = 1 << 1,
+};
+
+/*!\brief One RTP payload
+ *
+ * The payload is the descriptor followed by data_sz bytes at data.
+ */
+typedef struct vpx_vp8_rtp_payload {
+  unsigned char descriptor[VPX_VP8_RTP_MAX_DESCRIPTOR_SIZE]; /**< descriptor */
+  unsigned int descriptor_sz; /**< bytes used in descriptor */
+  const unsigned char *data;  /**< points into the encoder output */
+  size_t data_sz;             /**< bytes of VP8 data */
+  int marker; /**< last payload of the frame, set the RTP marker bit */
+} vpx_vp8_rtp_payload_t;
+
+/*!\brief Packetizer state
+ *
+ * Set up with vpx_vp8_rtp_init(). The descriptor fields below apply to the
+ * next frame added and may be changed between frames.
+ */
+typedef struct vpx_vp8_rtp_packetizer {
+  unsigned int mtu;   /**< maximum payload size, descriptor included */
+  unsigned int flags; /**< combination of #vpx_vp8_rtp_flags */
+
+  /*!\brief PictureID of the next frame, wraps at 15 bits */
+  unsigned int picture_id;
+
+  /*!\brief TL0PICIDX of the next base layer frame
+   *
+   * Frames in higher layers carry the index of the last base layer frame.
+   */
+  unsigned int tl0picidx;
+
+  int temporal_id; /**< TID of the next frame, 0 to 3 */
+  int layer_sync;  /**< Y bit of the next frame */
+
+  /*!\cond */
+  const unsigned char *part_buf[VPX_VP8_RTP_MAX_PARTITIONS];
+  size_t part_sz[VPX_VP8_RTP_MAX_PARTITIONS];
+  int num_parts;
+  int frame_complete;
+  int non_reference;
+  unsigned char descriptor[VPX_VP8_RTP_MAX_DESCRIPTOR_SIZE];
+  unsigned int descriptor_sz;
+  int part;
+  size_t offset;
+  size_t fragment_sz;
+  vpx_vp8_rtp_payload_t payload;
+  /*!\endcond */
+} vpx_vp8_rtp_packetizer_t;
+
+/*!\brief Initialises a packetizer
+ *
+ * \param[in]    packetizer  Packetizer to initialise
+ * \param[in]    mtu         Maximum RTP payload size in bytes, descriptor
+ *                           included
+ * \param[in]    flags       Combination of #vpx_vp8_rtp_flags
+ *
+ * \retval #VPX_CODEC_OK
+ *     The packetizer is ready.
+ * \retval #VPX_CODEC_INVALID_PARAM
+ *     The mtu leaves no room for data after the descriptor.
+ */
+vpx_codec_err_t vpx_vp8_rtp_init(vpx_vp8_rtp_packetizer_t *packetizer,
+                                 unsigned int mtu, unsigned int flags);
+
+/*!\brief Adds a frame packet from vpx_codec_get_cx_data()
+ *
+ * With #VPX_CODEC_USE_OUTPUT_PARTITION every partition of the frame is
+ * added in order, the frame is complete once the partition without
+ * #VPX_FRAME_IS_FRAGMENT has been added. Otherwise the whole frame is added
+ * as one packet and treated as a single partition. Adding a packet after a
+ * complete frame starts the next frame.
+ *
+ * Packets written to a buffer set with vpx_codec_set_cx_data_buf() must not
+ * carry padding.
+ *
+ * \param[in]    packetizer  Packetizer state
+ * \param[in]    pkt         Frame packet
+ *
+ * \retval #VPX_CODEC_OK
+ *     The packet was added.
+ * \retval #VPX_CODEC_INVALID_PARAM
+ *     pkt is not a frame packet or its partition is out of order.
+ */
+vpx_codec_err_t vpx_vp8_rtp_add_packet(vpx_vp8_rtp_packetizer_t *packetizer,
+                                       const vpx_codec_cx_pkt_t *pkt);
+
+/*!\brief Returns the next payload of the complete frame
+ *
+ * \param[in]    packetizer  Packetizer state
+ *
+ * \return The next payload, valid until the next call, or NULL once the
+ *         frame has been fully returned or is not yet complete.
+ */
+const vpx_vp8_rtp_payload_t *vpx_vp8_rtp_get_payload(
+    vpx_vp8_rtp_packetizer_t *packetizer);
+
+/*!@} - end defgroup vp8_rtp */
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VPX_VP8RTP_H_
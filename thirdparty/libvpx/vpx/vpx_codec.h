@@ -47,6 +47,7 @@ extern "C" {
 
 #include "./vpx_image.h"
 #include "./vpx_integer.h"
+#include "./vpx_mem_allocator.h"
 
 /*!\brief Decorator indicating a function is deprecated */
 #ifndef VPX_DEPRECATED
@@ -351,6 +352,26 @@ const char *vpx_codec_error_detail(vpx_codec_ctx_t *ctx);
  */
 vpx_codec_err_t vpx_codec_destroy(vpx_codec_ctx_t *ctx);
 
+/*!\brief Set the memory allocator
+ *
+ * With a ctx, the memory the instance allocates from then on comes from
+ * allocator. A decoder allocates its frame buffers and context arrays on
+ * the first frame, so setting it straight after init covers them, while an
+ * encoder has already allocated them at init. Without a ctx, allocator
+ * becomes the process default, used by instances that have none of their
+ * own and by the codecs' worker threads. NULL restores malloc().
+ *
+ * \param[in] ctx         Pointer to this instance's context, or NULL
+ * \param[in] allocator   Allocator to use, see #vpx_mem_allocator_t
+ *
+ * \retval #VPX_CODEC_OK
+ *     The allocator was set.
+ * \retval #VPX_CODEC_ERROR
+ *     The ctx is not an initialized instance.
+ */
+vpx_codec_err_t vpx_codec_set_mem_allocator(
+    vpx_codec_ctx_t *ctx, const vpx_mem_allocator_t *allocator);
+
 /*!\brief Get the capabilities of an algorithm.
  *
  * Retrieves the capabilities bitfield from the algorithm's interface.
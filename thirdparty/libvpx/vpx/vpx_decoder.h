@@ -321,7 +321,10 @@ vpx_codec_err_t vpx_codec_register_put_slice_cb(vpx_codec_ctx_t *ctx,
  * will result in an error code being returned, usually VPX_CODEC_INCAPABLE.
  *
  * \note
- * Currently this only works with VP9.
+ * Supported by VP8 and VP9. The VP8 decoder holds at most four buffers and
+ * returns a buffer at the start of the first decode call after it stops
+ * being referenced, so the image from vpx_codec_get_frame() stays valid
+ * until the next call to vpx_codec_decode().
  * @{
  */
 
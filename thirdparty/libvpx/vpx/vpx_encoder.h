@@ -899,6 +899,11 @@ vpx_codec_err_t vpx_codec_encode(vpx_codec_ctx_t *ctx, const vpx_image_t *img,
  * that may output multiple packets for a single encoded frame (e.g., lagged
  * encoding) or if the application does not reset the buffer periodically.
  *
+ * VP8 packs each frame straight into the buffer rather than copying it
+ * there. A frame that does not fit fails vpx_codec_encode() with
+ * #VPX_CODEC_MEM_ERROR and is dropped, the next frame is then coded as a key
+ * frame.
+ *
  * Applications may restore the default behavior of the codec providing
  * the compressed data buffer by calling this function with a NULL
  * buffer.
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VPX_VPX_MEM_ALLOCATOR_H_
+#define VPX_VPX_VPX_MEM_ALLOCATOR_H_
+
+/*!\file
+ * \brief Describes the interface for replacing the memory allocator used by
+ * the codecs, the built-in pool allocator and the allocation counters.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "./vpx_integer.h"
+
+/*!\brief Allocates size bytes, returning NULL on failure.
+ *
+ * The memory need not be aligned beyond what malloc() gives, the codec
+ * aligns its blocks within it.
+ *
+ * \param[in] priv    The allocator's priv
+ * \param[in] size    Number of bytes
+ */
+typedef void *(*vpx_mem_alloc_fn_t)(void *priv, size_t size);
+
+/*!\brief Frees memory from the alloc function, with the size asked for.
+ *
+ * \param[in] priv    The allocator's priv
+ * \param[in] mem     Memory returned by alloc
+ * \param[in] size    The size passed to alloc
+ */
+typedef void (*vpx_mem_free_fn_t)(void *priv, void *mem, size_t size);
+
+/*!\brief Memory allocator
+ *
+ * Every block remembers the allocator it came from and is freed back to it,
+ * so an allocator must outlive all of its blocks, including those held by
+ * codec instances it is no longer set on. Both functions may be called from
+ * several threads at once.
+ */
+typedef struct vpx_mem_allocator {
+  vpx_mem_alloc_fn_t alloc; /**< Allocates a block */
+  vpx_mem_free_fn_t free;   /**< Frees a block */
+  void *priv;               /**< Passed to both functions */
+} vpx_mem_allocator_t;
+
+/*!\brief Allocation counters
+ *
+ * Counts every allocation made by the codecs since the process started,
+ * whichever allocator served it. Sizes include the few bytes the codec adds
+ * to align each block.
+ */
+typedef struct vpx_mem_stats {
+  uint64_t allocs;          /**< Successful allocations */
+  uint64_t frees;           /**< Blocks freed */
+  uint64_t failed_allocs;   /**< Allocations that returned NULL */
+  uint64_t bytes_allocated; /**< Total bytes of all allocations */
+  size_t bytes_in_use;      /**< Bytes allocated and not yet freed */
+  size_t peak_bytes_in_use; /**< Highest bytes_in_use so far */
+  uint64_t pool_hits;       /**< Pool allocations served by a free block */
+  uint64_t pool_misses;     /**< Pool allocations that went to malloc() */
+  size_t pool_cached_bytes; /**< Free blocks the pool keeps for reuse */
+} vpx_mem_stats_t;
+
+/*!\brief Returns the built-in pool allocator.
+ *
+ * The pool rounds each block up to one of eight size classes per power of
+ * two, wasting at most 12.5%, and keeps freed blocks on a list per class
+ * for the next allocation of that class. It is shared by every instance it
+ * is set on, so the frame buffers and context arrays of a codec that is
+ * destroyed, or that changes resolution, are reused by the next one of a
+ * similar size instead of going back to the heap. Blocks over 1 GB are not
+ * pooled.
+ */
+const vpx_mem_allocator_t *vpx_mem_pool_allocator(void);
+
+/*!\brief Limits the free blocks kept by the pool.
+ *
+ * Blocks freed once the limit is reached go back to the heap. Lowering the
+ * limit frees cached blocks until it is met, so a limit of 0 empties the
+ * pool. The default is 128 MB.
+ *
+ * \param[in] max_cached_bytes    Most bytes of free blocks to keep
+ */
+void vpx_mem_pool_set_limit(size_t max_cached_bytes);
+
+/*!\brief Gets the allocation counters.
+ *
+ * Each counter is read on its own, so while other threads allocate the
+ * values may be from slightly different moments.
+ *
+ * \param[out] stats    Receives the counters
+ */
+void vpx_mem_get_stats(vpx_mem_stats_t *stats);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VPX_VPX_MEM_ALLOCATOR_H_
@@ -7,10 +7,14 @@
  *  in the file PATENTS.  All contributing project authors may
  *  be found in the AUTHORS file in the root of the source tree.
  */
-//#include "./vpx_config.h"
-//#define RTCD_C
-//#include "./vpx_dsp_rtcd.h"
-//#include "vpx_ports/vpx_once.h"
-//
-//void vpx_dsp_rtcd() { once(setup_rtcd_internal); }
-void vpx_dsp_rtcd() {}
+#include "./vpx_config.h"
+#define RTCD_C
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_ports/vpx_once.h"
+
+void vpx_dsp_rtcd() { once(setup_rtcd_internal); }
+
+int vpx_dsp_rtcd_slots(vpx_rtcd_slot_t *slots, int max_slots) {
+  vpx_dsp_rtcd();
+  return rtcd_slots(slots, max_slots);
+}
@@ -0,0 +1,319 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* The intra predictors VP8 uses: DC, V, H and TM at 16x16 and 8x8, and the
+ * ten B_PRED modes at 4x4. The directional 4x4 modes build their edge in
+ * one register and take every row from the same two filtered vectors.
+ */
+
+static INLINE __m128i load4(const uint8_t *p) {
+  uint32_t v;
+
+  memcpy(&v, p, 4);
+  return _mm_cvtsi32_si128((int)v);
+}
+
+static INLINE void store4(uint8_t *p, uint32_t v) { memcpy(p, &v, 4); }
+
+/* Byte n onwards of x, as the four pixels of a 4 wide row. */
+#define ROW4(x, n) ((uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x, n)))
+
+/* (a + 2 * b + c + 2) >> 2 without widening. avg(a, c) rounds up when a + c
+ * is odd, taking the low bit back off gives the floor the C then rounds.
+ */
+static INLINE __m128i avg3(__m128i a, __m128i b, __m128i c) {
+  const __m128i ac = _mm_sub_epi8(
+      _mm_avg_epu8(a, c), _mm_and_si128(_mm_xor_si128(a, c), _mm_set1_epi8(1)));
+  return _mm_avg_epu8(ac, b);
+}
+
+/* AVG3 and AVG2 of each byte of e with the ones after it. */
+static INLINE __m128i avg3_next(__m128i e) {
+  return avg3(e, _mm_srli_si128(e, 1), _mm_srli_si128(e, 2));
+}
+
+static INLINE __m128i avg2_next(__m128i e) {
+  return _mm_avg_epu8(e, _mm_srli_si128(e, 1));
+}
+
+/* L K J I X A B C D E F G: the left column bottom up, the top left pixel and
+ * the row above, so the diagonal modes read neighbours along one line.
+ */
+static INLINE __m128i load_edge(const uint8_t *above, const uint8_t *left) {
+  const uint32_t l = (uint32_t)left[3] | (uint32_t)left[2] << 8 |
+                     (uint32_t)left[1] << 16 | (uint32_t)left[0] << 24;
+  return _mm_or_si128(
+      _mm_cvtsi32_si128((int)l),
+      _mm_slli_si128(_mm_loadl_epi64((const __m128i *)(above - 1)), 4));
+}
+
+static INLINE int sum_bytes(__m128i x) {
+  const __m128i s = _mm_sad_epu8(x, _mm_setzero_si128());
+  return _mm_cvtsi128_si32(_mm_add_epi32(s, _mm_srli_si128(s, 8)));
+}
+
+static INLINE void store_row(uint8_t *dst, int bs, __m128i v) {
+  if (bs == 16) {
+    _mm_storeu_si128((__m128i *)dst, v);
+  } else {
+    _mm_storel_epi64((__m128i *)dst, v);
+  }
+}
+
+static INLINE void fill_rows(uint8_t *dst, ptrdiff_t stride, int bs,
+                             __m128i v) {
+  int r;
+
+  for (r = 0; r < bs; ++r) store_row(dst + r * stride, bs, v);
+}
+
+static INLINE __m128i load_row(const uint8_t *p, int bs) {
+  return bs == 16 ? _mm_loadu_si128((const __m128i *)p)
+                  : _mm_loadl_epi64((const __m128i *)p);
+}
+
+static INLINE void dc_fill(uint8_t *dst, ptrdiff_t stride, int bs, int sum,
+                           int shift) {
+  fill_rows(dst, stride, bs,
+            _mm_set1_epi8((char)((sum + (1 << (shift - 1))) >> shift)));
+}
+
+/* 16x16 and 8x8. */
+
+static INLINE void tm_predictor(uint8_t *dst, ptrdiff_t stride, int bs,
+                                const uint8_t *above, const uint8_t *left) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i a = load_row(above, bs);
+  const __m128i top_left = _mm_set1_epi16(above[-1]);
+  const __m128i a_lo = _mm_sub_epi16(_mm_unpacklo_epi8(a, zero), top_left);
+  const __m128i a_hi = _mm_sub_epi16(_mm_unpackhi_epi8(a, zero), top_left);
+  int r;
+
+  for (r = 0; r < bs; ++r) {
+    const __m128i l = _mm_set1_epi16(left[r]);
+    store_row(dst, bs,
+              _mm_packus_epi16(_mm_add_epi16(a_lo, l), _mm_add_epi16(a_hi, l)));
+    dst += stride;
+  }
+}
+
+static INLINE void h_predictor(uint8_t *dst, ptrdiff_t stride, int bs,
+                               const uint8_t *left) {
+  int r;
+
+  for (r = 0; r < bs; ++r) {
+    store_row(dst + r * stride, bs, _mm_set1_epi8((char)left[r]));
+  }
+}
+
+#define PREDICTORS_SSE2(bs, shift)                                             \
+  void vpx_dc_predictor_##bs##x##bs##_sse2(uint8_t *dst, ptrdiff_t stride,     \
+                                           const uint8_t *above,               \
+                                           const uint8_t *left) {              \
+    dc_fill(dst, stride, bs,                                                   \
+            sum_bytes(load_row(above, bs)) + sum_bytes(load_row(left, bs)),    \
+            shift + 1);                                                        \
+  }                                                                            \
+                                                                               \
+  void vpx_dc_top_predictor_##bs##x##bs##_sse2(                                \
+      uint8_t *dst, ptrdiff_t stride, const uint8_t *above,                    \
+      const uint8_t *left) {                                                   \
+    (void)left;                                                                \
+    dc_fill(dst, stride, bs, sum_bytes(load_row(above, bs)), shift);           \
+  }                                                                            \
+                                                                               \
+  void vpx_dc_left_predictor_##bs##x##bs##_sse2(                               \
+      uint8_t *dst, ptrdiff_t stride, const uint8_t *above,                    \
+      const uint8_t *left) {                                                   \
+    (void)above;                                                               \
+    dc_fill(dst, stride, bs, sum_bytes(load_row(left, bs)), shift);            \
+  }                                                                            \
+                                                                               \
+  void vpx_dc_128_predictor_##bs##x##bs##_sse2(                                \
+      uint8_t *dst, ptrdiff_t stride, const uint8_t *above,                    \
+      const uint8_t *left) {                                                   \
+    (void)above;                                                               \
+    (void)left;                                                                \
+    fill_rows(dst, stride, bs, _mm_set1_epi8((char)128));                      \
+  }                                                                            \
+                                                                               \
+  void vpx_v_predictor_##bs##x##bs##_sse2(uint8_t *dst, ptrdiff_t stride,      \
+                                          const uint8_t *above,                \
+                                          const uint8_t *left) {               \
+    (void)left;                                                                \
+    fill_rows(dst, stride, bs, load_row(above, bs));                           \
+  }                                                                            \
+                                                                               \
+  void vpx_h_predictor_##bs##x##bs##_sse2(uint8_t *dst, ptrdiff_t stride,      \
+                                          const uint8_t *above,                \
+                                          const uint8_t *left) {               \
+    (void)above;                                                               \
+    h_predictor(dst, stride, bs, left);                                        \
+  }                                                                            \
+                                                                               \
+  void vpx_tm_predictor_##bs##x##bs##_sse2(uint8_t *dst, ptrdiff_t stride,     \
+                                           const uint8_t *above,               \
+                                           const uint8_t *left) {              \
+    tm_predictor(dst, stride, bs, above, left);                                \
+  }
+
+PREDICTORS_SSE2(16, 4)
+PREDICTORS_SSE2(8, 3)
+
+/* 4x4. */
+
+void vpx_dc_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                               const uint8_t *above, const uint8_t *left) {
+  const int sum = sum_bytes(_mm_unpacklo_epi32(load4(above), load4(left)));
+  const uint32_t row = 0x01010101u * (uint32_t)((sum + 4) >> 3);
+
+  store4(dst, row);
+  store4(dst + stride, row);
+  store4(dst + 2 * stride, row);
+  store4(dst + 3 * stride, row);
+}
+
+void vpx_tm_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                               const uint8_t *above, const uint8_t *left) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i a = _mm_sub_epi16(_mm_unpacklo_epi8(load4(above), zero),
+                                  _mm_set1_epi16(above[-1]));
+  /* Rows 0-1 and 2-3 in one register each. */
+  const __m128i a2 = _mm_unpacklo_epi64(a, a);
+  const __m128i l01 = _mm_unpacklo_epi64(_mm_set1_epi16(left[0]),
+                                         _mm_set1_epi16(left[1]));
+  const __m128i l23 = _mm_unpacklo_epi64(_mm_set1_epi16(left[2]),
+                                         _mm_set1_epi16(left[3]));
+  const __m128i rows = _mm_packus_epi16(_mm_add_epi16(a2, l01),
+                                        _mm_add_epi16(a2, l23));
+
+  store4(dst, ROW4(rows, 0));
+  store4(dst + stride, ROW4(rows, 4));
+  store4(dst + 2 * stride, ROW4(rows, 8));
+  store4(dst + 3 * stride, ROW4(rows, 12));
+}
+
+void vpx_ve_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                               const uint8_t *above, const uint8_t *left) {
+  const uint32_t row = ROW4(
+      avg3_next(_mm_loadl_epi64((const __m128i *)(above - 1))), 0);
+  (void)left;
+
+  store4(dst, row);
+  store4(dst + stride, row);
+  store4(dst + 2 * stride, row);
+  store4(dst + 3 * stride, row);
+}
+
+void vpx_he_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                               const uint8_t *above, const uint8_t *left) {
+  /* H I J K L L */
+  const __m128i l = _mm_or_si128(
+      load4(left), _mm_slli_si128(_mm_set1_epi8((char)left[3]), 4));
+  const __m128i e =
+      _mm_or_si128(_mm_cvtsi32_si128(above[-1]), _mm_slli_si128(l, 1));
+  __m128i v = avg3_next(e);
+
+  v = _mm_unpacklo_epi8(v, v);
+  v = _mm_unpacklo_epi16(v, v);
+  store4(dst, ROW4(v, 0));
+  store4(dst + stride, ROW4(v, 4));
+  store4(dst + 2 * stride, ROW4(v, 8));
+  store4(dst + 3 * stride, ROW4(v, 12));
+}
+
+void vpx_d45e_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  /* A B C D E F G H H H ... */
+  const __m128i e =
+      _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)above),
+                         _mm_set1_epi8((char)above[7]));
+  const __m128i v = avg3_next(e);
+  (void)left;
+
+  store4(dst, ROW4(v, 0));
+  store4(dst + stride, ROW4(v, 1));
+  store4(dst + 2 * stride, ROW4(v, 2));
+  store4(dst + 3 * stride, ROW4(v, 3));
+}
+
+void vpx_d63e_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  const __m128i e = _mm_loadl_epi64((const __m128i *)above);
+  const __m128i v = avg3_next(e);
+  const __m128i w = avg2_next(e);
+  (void)left;
+
+  /* The last pixel of rows 2 and 3 steps one further along the edge. */
+  store4(dst, ROW4(w, 0));
+  store4(dst + stride, ROW4(v, 0));
+  store4(dst + 2 * stride, (ROW4(w, 1) & 0xffffff) | ROW4(v, 4) << 24);
+  store4(dst + 3 * stride, (ROW4(v, 1) & 0xffffff) | ROW4(v, 5) << 24);
+}
+
+void vpx_d135_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  const __m128i v = avg3_next(load_edge(above, left));
+
+  store4(dst, ROW4(v, 3));
+  store4(dst + stride, ROW4(v, 2));
+  store4(dst + 2 * stride, ROW4(v, 1));
+  store4(dst + 3 * stride, ROW4(v, 0));
+}
+
+void vpx_d117_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  const __m128i e = load_edge(above, left);
+  const __m128i v = avg3_next(e);
+  const uint32_t row0 = ROW4(avg2_next(e), 4);
+  const uint32_t row1 = ROW4(v, 3);
+
+  store4(dst, row0);
+  store4(dst + stride, row1);
+  store4(dst + 2 * stride, row0 << 8 | (ROW4(v, 2) & 0xff));
+  store4(dst + 3 * stride, row1 << 8 | (ROW4(v, 1) & 0xff));
+}
+
+void vpx_d153_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  const __m128i e = load_edge(above, left);
+  const __m128i v = avg3_next(e);
+  /* Each row starts with an AVG2 and an AVG3 down the left edge, then
+   * repeats the row above.
+   */
+  const __m128i wv = _mm_unpacklo_epi8(avg2_next(e), v);
+
+  store4(dst, (ROW4(wv, 6) & 0xffff) | ROW4(v, 4) << 16);
+  store4(dst + stride, ROW4(wv, 4));
+  store4(dst + 2 * stride, ROW4(wv, 2));
+  store4(dst + 3 * stride, ROW4(wv, 0));
+}
+
+void vpx_d207_predictor_4x4_sse2(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *above, const uint8_t *left) {
+  /* I J K L L L ... */
+  const __m128i e = _mm_or_si128(
+      load4(left), _mm_slli_si128(_mm_set1_epi8((char)left[3]), 4));
+  const __m128i wv = _mm_unpacklo_epi8(avg2_next(e), avg3_next(e));
+  (void)above;
+
+  store4(dst, ROW4(wv, 0));
+  store4(dst + stride, ROW4(wv, 2));
+  store4(dst + 2 * stride, ROW4(wv, 4));
+  store4(dst + 3 * stride, ROW4(wv, 6));
+}
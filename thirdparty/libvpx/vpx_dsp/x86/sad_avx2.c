@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* The 16 wide SAD kernels with two rows in each register. The narrower
+ * blocks gain nothing over SSE2.
+ */
+static INLINE __m256i load16x2(const uint8_t *p, int stride) {
+  return _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)),
+      _mm_loadu_si128((const __m128i *)(p + stride)), 1);
+}
+
+static INLINE void load_block(const uint8_t *p, int stride, int h,
+                              __m256i *x) {
+  int i;
+
+  for (i = 0; i < h / 2; ++i) x[i] = load16x2(p + 2 * i * stride, stride);
+}
+
+static INLINE unsigned int sad_block(const __m256i *src, const uint8_t *ref,
+                                     int ref_stride, int h) {
+  __m256i s = _mm256_setzero_si256();
+  __m128i t;
+  int i;
+
+  for (i = 0; i < h / 2; ++i) {
+    s = _mm256_add_epi64(
+        s, _mm256_sad_epu8(src[i], load16x2(ref + 2 * i * ref_stride,
+                                            ref_stride)));
+  }
+  t = _mm_add_epi64(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+  t = _mm_add_epi64(t, _mm_srli_si128(t, 8));
+  return (unsigned int)_mm_cvtsi128_si32(t);
+}
+
+#define SAD_AVX2(h)                                                          \
+  unsigned int vpx_sad16x##h##_avx2(const uint8_t *src_ptr, int src_stride,  \
+                                    const uint8_t *ref_ptr, int ref_stride) { \
+    __m256i src[8];                                                          \
+    load_block(src_ptr, src_stride, h, src);                                 \
+    return sad_block(src, ref_ptr, ref_stride, h);                           \
+  }                                                                          \
+                                                                             \
+  void vpx_sad16x##h##x3_avx2(const uint8_t *src_ptr, int src_stride,        \
+                              const uint8_t *ref_ptr, int ref_stride,        \
+                              uint32_t *sad_array) {                         \
+    __m256i src[8];                                                          \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, h, src);                                 \
+    for (i = 0; i < 3; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_ptr + i, ref_stride, h);             \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void vpx_sad16x##h##x8_avx2(const uint8_t *src_ptr, int src_stride,        \
+                              const uint8_t *ref_ptr, int ref_stride,        \
+                              uint32_t *sad_array) {                         \
+    __m256i src[8];                                                          \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, h, src);                                 \
+    for (i = 0; i < 8; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_ptr + i, ref_stride, h);             \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void vpx_sad16x##h##x4d_avx2(const uint8_t *src_ptr, int src_stride,       \
+                               const uint8_t *const ref_array[],             \
+                               int ref_stride, uint32_t *sad_array) {        \
+    __m256i src[8];                                                          \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, h, src);                                 \
+    for (i = 0; i < 4; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_array[i], ref_stride, h);            \
+    }                                                                        \
+  }
+
+SAD_AVX2(16)
+SAD_AVX2(8)
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* The SAD kernels for the VP8 block sizes. Every size is reduced to 16 byte
+ * row groups for _mm_sad_epu8(): a 16 wide row, two 8 wide rows or four 4
+ * wide rows. The multi-candidate forms keep the source rows in registers
+ * and run them against each reference in turn.
+ */
+static INLINE __m128i load4x4(const uint8_t *p, int stride) {
+  uint32_t r[4];
+
+  memcpy(&r[0], p, 4);
+  memcpy(&r[1], p + stride, 4);
+  memcpy(&r[2], p + 2 * stride, 4);
+  memcpy(&r[3], p + 3 * stride, 4);
+  return _mm_setr_epi32((int)r[0], (int)r[1], (int)r[2], (int)r[3]);
+}
+
+static INLINE __m128i load8x2(const uint8_t *p, int stride) {
+  return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p),
+                            _mm_loadl_epi64((const __m128i *)(p + stride)));
+}
+
+static INLINE unsigned int sum_sad(__m128i s) {
+  return (unsigned int)_mm_cvtsi128_si32(
+      _mm_add_epi32(s, _mm_srli_si128(s, 8)));
+}
+
+/* Loads a w x h block as w * h / 16 groups of 16 bytes. */
+static INLINE void load_block(const uint8_t *p, int stride, int w, int h,
+                              __m128i *x) {
+  int i;
+
+  if (w == 16) {
+    for (i = 0; i < h; ++i) {
+      x[i] = _mm_loadu_si128((const __m128i *)(p + i * stride));
+    }
+  } else if (w == 8) {
+    for (i = 0; i < h / 2; ++i) x[i] = load8x2(p + 2 * i * stride, stride);
+  } else {
+    x[0] = load4x4(p, stride);
+  }
+}
+
+/* The reference rows are read as they are used rather than gathered first,
+ * so each 16 byte group is a load and a _mm_sad_epu8().
+ */
+static INLINE unsigned int sad_block(const __m128i *src, const uint8_t *ref,
+                                     int ref_stride, int w, int h) {
+  __m128i s = _mm_setzero_si128();
+  int i;
+
+  if (w == 16) {
+    for (i = 0; i < h; ++i) {
+      s = _mm_add_epi64(
+          s, _mm_sad_epu8(src[i], _mm_loadu_si128((const __m128i *)ref)));
+      ref += ref_stride;
+    }
+  } else if (w == 8) {
+    for (i = 0; i < h / 2; ++i) {
+      s = _mm_add_epi64(s, _mm_sad_epu8(src[i], load8x2(ref, ref_stride)));
+      ref += 2 * ref_stride;
+    }
+  } else {
+    s = _mm_sad_epu8(src[0], load4x4(ref, ref_stride));
+  }
+  return sum_sad(s);
+}
+
+#define SAD_SSE2(w, h)                                                       \
+  unsigned int vpx_sad##w##x##h##_sse2(const uint8_t *src_ptr,               \
+                                       int src_stride,                       \
+                                       const uint8_t *ref_ptr,               \
+                                       int ref_stride) {                     \
+    __m128i src[16];                                                         \
+    load_block(src_ptr, src_stride, w, h, src);                              \
+    return sad_block(src, ref_ptr, ref_stride, w, h);                        \
+  }                                                                          \
+                                                                             \
+  void vpx_sad##w##x##h##x3_sse2(const uint8_t *src_ptr, int src_stride,     \
+                                 const uint8_t *ref_ptr, int ref_stride,     \
+                                 uint32_t *sad_array) {                      \
+    __m128i src[16];                                                         \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, w, h, src);                              \
+    for (i = 0; i < 3; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_ptr + i, ref_stride, w, h);          \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void vpx_sad##w##x##h##x8_sse2(const uint8_t *src_ptr, int src_stride,     \
+                                 const uint8_t *ref_ptr, int ref_stride,     \
+                                 uint32_t *sad_array) {                      \
+    __m128i src[16];                                                         \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, w, h, src);                              \
+    for (i = 0; i < 8; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_ptr + i, ref_stride, w, h);          \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  void vpx_sad##w##x##h##x4d_sse2(const uint8_t *src_ptr, int src_stride,    \
+                                  const uint8_t *const ref_array[],          \
+                                  int ref_stride, uint32_t *sad_array) {     \
+    __m128i src[16];                                                         \
+    int i;                                                                   \
+    load_block(src_ptr, src_stride, w, h, src);                              \
+    for (i = 0; i < 4; ++i) {                                                \
+      sad_array[i] = sad_block(src, ref_array[i], ref_stride, w, h);         \
+    }                                                                        \
+  }
+
+SAD_SSE2(16, 16)
+SAD_SSE2(16, 8)
+SAD_SSE2(8, 16)
+SAD_SSE2(8, 8)
+SAD_SSE2(4, 4)
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* src - pred for 8 pixels, widened to 16 bits. */
+static INLINE __m128i subtract8(__m128i s, __m128i p) {
+  const __m128i zero = _mm_setzero_si128();
+  return _mm_sub_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(p, zero));
+}
+
+static INLINE __m128i load4(const uint8_t *p) {
+  uint32_t v;
+
+  memcpy(&v, p, 4);
+  return _mm_cvtsi32_si128((int)v);
+}
+
+/* Widths that are a multiple of 16 are done 16 pixels at a time, the 8 and 4
+ * wide VP8 blocks a row at a time. Any other width falls back to the C.
+ */
+void vpx_subtract_block_sse2(int rows, int cols, int16_t *diff_ptr,
+                             ptrdiff_t diff_stride, const uint8_t *src_ptr,
+                             ptrdiff_t src_stride, const uint8_t *pred_ptr,
+                             ptrdiff_t pred_stride) {
+  const __m128i zero = _mm_setzero_si128();
+  int r, c;
+
+  if (cols & 15 && cols != 8 && cols != 4) {
+    vpx_subtract_block_c(rows, cols, diff_ptr, diff_stride, src_ptr,
+                         src_stride, pred_ptr, pred_stride);
+    return;
+  }
+
+  for (r = 0; r < rows; ++r) {
+    if (cols == 4) {
+      _mm_storel_epi64((__m128i *)diff_ptr,
+                       subtract8(load4(src_ptr), load4(pred_ptr)));
+    } else if (cols == 8) {
+      _mm_storeu_si128(
+          (__m128i *)diff_ptr,
+          subtract8(_mm_loadl_epi64((const __m128i *)src_ptr),
+                    _mm_loadl_epi64((const __m128i *)pred_ptr)));
+    } else {
+      for (c = 0; c < cols; c += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src_ptr + c));
+        const __m128i p = _mm_loadu_si128((const __m128i *)(pred_ptr + c));
+
+        _mm_storeu_si128((__m128i *)(diff_ptr + c), subtract8(s, p));
+        _mm_storeu_si128(
+            (__m128i *)(diff_ptr + c + 8),
+            _mm_sub_epi16(_mm_unpackhi_epi8(s, zero),
+                          _mm_unpackhi_epi8(p, zero)));
+      }
+    }
+    diff_ptr += diff_stride;
+    src_ptr += src_stride;
+    pred_ptr += pred_stride;
+  }
+}
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* The 16 wide variance kernels with a whole row of 16 bit differences in
+ * each register. As in variance_sse2.c a lane's sum stays within 16 bits.
+ */
+static INLINE __m256i load_row(const uint8_t *p) {
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)p));
+}
+
+static INLINE void accumulate(__m256i d, __m256i *sum, __m256i *sse) {
+  *sum = _mm256_add_epi16(*sum, d);
+  *sse = _mm256_add_epi32(*sse, _mm256_madd_epi16(d, d));
+}
+
+static INLINE int hsum_epi32(__m256i x) {
+  __m128i t =
+      _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+
+  t = _mm_add_epi32(t, _mm_srli_si128(t, 8));
+  t = _mm_add_epi32(t, _mm_srli_si128(t, 4));
+  return _mm_cvtsi128_si32(t);
+}
+
+static INLINE void finish(__m256i sum, __m256i sse, uint32_t *sse_out,
+                          int *sum_out) {
+  *sum_out = hsum_epi32(_mm256_madd_epi16(sum, _mm256_set1_epi16(1)));
+  *sse_out = (uint32_t)hsum_epi32(sse);
+}
+
+static INLINE void variance16(const uint8_t *src_ptr, int src_stride,
+                              const uint8_t *ref_ptr, int ref_stride, int h,
+                              uint32_t *sse, int *sum) {
+  __m256i vsum = _mm256_setzero_si256();
+  __m256i vsse = _mm256_setzero_si256();
+  int i;
+
+  for (i = 0; i < h; ++i) {
+    accumulate(_mm256_sub_epi16(load_row(src_ptr), load_row(ref_ptr)), &vsum,
+               &vsse);
+    src_ptr += src_stride;
+    ref_ptr += ref_stride;
+  }
+  finish(vsum, vsse, sse, sum);
+}
+
+#define VAR_AVX2(h)                                                          \
+  uint32_t vpx_variance16x##h##_avx2(const uint8_t *src_ptr, int src_stride, \
+                                     const uint8_t *ref_ptr, int ref_stride, \
+                                     uint32_t *sse) {                        \
+    int sum;                                                                 \
+    variance16(src_ptr, src_stride, ref_ptr, ref_stride, h, sse, &sum);      \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (16 * h));               \
+  }
+
+VAR_AVX2(16)
+VAR_AVX2(8)
+
+uint32_t vpx_mse16x16_avx2(const uint8_t *src_ptr, int src_stride,
+                           const uint8_t *ref_ptr, int ref_stride,
+                           uint32_t *sse) {
+  int sum;
+
+  variance16(src_ptr, src_stride, ref_ptr, ref_stride, 16, sse, &sum);
+  return *sse;
+}
+
+static const uint8_t bilinear_filters[8][2] = {
+  { 128, 0 }, { 112, 16 }, { 96, 32 }, { 80, 48 },
+  { 64, 64 }, { 48, 80 },  { 32, 96 }, { 16, 112 },
+};
+
+static INLINE __m256i bilinear(__m256i a, __m256i b, const uint8_t *f) {
+  const __m256i t =
+      _mm256_add_epi16(_mm256_mullo_epi16(a, _mm256_set1_epi16(f[0])),
+                       _mm256_mullo_epi16(b, _mm256_set1_epi16(f[1])));
+  return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(64)), 7);
+}
+
+static INLINE __m256i first_pass(const uint8_t *p, const uint8_t *f) {
+  const __m256i a = load_row(p);
+  return f[0] == 128 ? a : bilinear(a, load_row(p + 1), f);
+}
+
+static INLINE void sub_pixel_variance16(const uint8_t *src_ptr, int src_stride,
+                                        int x_offset, int y_offset,
+                                        const uint8_t *ref_ptr, int ref_stride,
+                                        int h, uint32_t *sse, int *sum) {
+  const uint8_t *const hf = bilinear_filters[x_offset];
+  const uint8_t *const vf = bilinear_filters[y_offset];
+  __m256i vsum = _mm256_setzero_si256();
+  __m256i vsse = _mm256_setzero_si256();
+  __m256i prev =
+      vf[0] == 128 ? _mm256_setzero_si256() : first_pass(src_ptr, hf);
+  int i;
+
+  for (i = 0; i < h; ++i) {
+    __m256i out;
+
+    if (vf[0] == 128) {
+      out = first_pass(src_ptr, hf);
+    } else {
+      const __m256i cur = first_pass(src_ptr + src_stride, hf);
+      out = bilinear(prev, cur, vf);
+      prev = cur;
+    }
+    accumulate(_mm256_sub_epi16(out, load_row(ref_ptr)), &vsum, &vsse);
+    src_ptr += src_stride;
+    ref_ptr += ref_stride;
+  }
+  finish(vsum, vsse, sse, sum);
+}
+
+#define SUBPIX_VAR_AVX2(h)                                                   \
+  uint32_t vpx_sub_pixel_variance16x##h##_avx2(                              \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse) {               \
+    int sum;                                                                 \
+    sub_pixel_variance16(src_ptr, src_stride, x_offset, y_offset, ref_ptr,   \
+                         ref_stride, h, sse, &sum);                          \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (16 * h));               \
+  }
+
+SUBPIX_VAR_AVX2(16)
+SUBPIX_VAR_AVX2(8)
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+/* Variance, MSE and sub-pixel variance for the VP8 block sizes. Blocks are
+ * worked on 8 pixels at a time as 16 bit differences. The sums stay within
+ * 16 bits for every size here, a lane sees at most 32 differences.
+ */
+static INLINE __m128i load4(const uint8_t *p) {
+  uint32_t v;
+
+  memcpy(&v, p, 4);
+  return _mm_cvtsi32_si128((int)v);
+}
+
+/* Eight pixels as 16 bit values, or four with the rest zero for 4 wide
+ * blocks.
+ */
+static INLINE __m128i load_pixels(const uint8_t *p, int w) {
+  const __m128i v = w == 4 ? load4(p) : _mm_loadl_epi64((const __m128i *)p);
+  return _mm_unpacklo_epi8(v, _mm_setzero_si128());
+}
+
+static INLINE void accumulate(__m128i d, __m128i *sum, __m128i *sse) {
+  *sum = _mm_add_epi16(*sum, d);
+  *sse = _mm_add_epi32(*sse, _mm_madd_epi16(d, d));
+}
+
+static INLINE int hsum_epi32(__m128i x) {
+  x = _mm_add_epi32(x, _mm_srli_si128(x, 8));
+  x = _mm_add_epi32(x, _mm_srli_si128(x, 4));
+  return _mm_cvtsi128_si32(x);
+}
+
+static INLINE void finish(__m128i sum, __m128i sse, uint32_t *sse_out,
+                          int *sum_out) {
+  *sum_out = hsum_epi32(_mm_madd_epi16(sum, _mm_set1_epi16(1)));
+  *sse_out = (uint32_t)hsum_epi32(sse);
+}
+
+static INLINE void variance(const uint8_t *src_ptr, int src_stride,
+                            const uint8_t *ref_ptr, int ref_stride, int w,
+                            int h, uint32_t *sse, int *sum) {
+  __m128i vsum = _mm_setzero_si128();
+  __m128i vsse = _mm_setzero_si128();
+  int i, c;
+
+  for (i = 0; i < h; ++i) {
+    for (c = 0; c < w; c += 8) {
+      accumulate(_mm_sub_epi16(load_pixels(src_ptr + c, w),
+                               load_pixels(ref_ptr + c, w)),
+                 &vsum, &vsse);
+    }
+    src_ptr += src_stride;
+    ref_ptr += ref_stride;
+  }
+  finish(vsum, vsse, sse, sum);
+}
+
+uint32_t vpx_get4x4sse_cs_sse2(const uint8_t *src_ptr, int src_stride,
+                               const uint8_t *ref_ptr, int ref_stride) {
+  uint32_t sse;
+  int sum;
+
+  variance(src_ptr, src_stride, ref_ptr, ref_stride, 4, 4, &sse, &sum);
+  return sse;
+}
+
+#define VAR_SSE2(w, h)                                                       \
+  uint32_t vpx_variance##w##x##h##_sse2(const uint8_t *src_ptr,              \
+                                        int src_stride,                      \
+                                        const uint8_t *ref_ptr,              \
+                                        int ref_stride, uint32_t *sse) {     \
+    int sum;                                                                 \
+    variance(src_ptr, src_stride, ref_ptr, ref_stride, w, h, sse, &sum);     \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (w * h));                \
+  }
+
+#define MSE_SSE2(w, h)                                                       \
+  uint32_t vpx_mse##w##x##h##_sse2(const uint8_t *src_ptr, int src_stride,   \
+                                   const uint8_t *ref_ptr, int ref_stride,   \
+                                   uint32_t *sse) {                          \
+    int sum;                                                                 \
+    variance(src_ptr, src_stride, ref_ptr, ref_stride, w, h, sse, &sum);     \
+    return *sse;                                                             \
+  }
+
+VAR_SSE2(16, 16)
+VAR_SSE2(16, 8)
+VAR_SSE2(8, 16)
+VAR_SSE2(8, 8)
+VAR_SSE2(4, 4)
+
+MSE_SSE2(16, 16)
+MSE_SSE2(16, 8)
+MSE_SSE2(8, 16)
+MSE_SSE2(8, 8)
+
+/* The bilinear taps of variance.c, the two summing to 128. */
+static const uint8_t bilinear_filters[8][2] = {
+  { 128, 0 }, { 112, 16 }, { 96, 32 }, { 80, 48 },
+  { 64, 64 }, { 48, 80 },  { 32, 96 }, { 16, 112 },
+};
+
+/* ROUND_POWER_OF_TWO(a * f0 + b * f1, 7). With f0 of 128 this is a, which
+ * saves the multiply and the read of b.
+ */
+static INLINE __m128i bilinear(__m128i a, __m128i b, const uint8_t *f) {
+  const __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(f[0])),
+                                  _mm_mullo_epi16(b, _mm_set1_epi16(f[1])));
+  return _mm_srli_epi16(_mm_add_epi16(t, _mm_set1_epi16(64)), 7);
+}
+
+static INLINE __m128i first_pass(const uint8_t *p, int w, const uint8_t *f) {
+  const __m128i a = load_pixels(p, w);
+  return f[0] == 128 ? a : bilinear(a, load_pixels(p + 1, w), f);
+}
+
+/* The two pass filter of variance.c, fed straight into the variance sums
+ * rather than through an intermediate block. Both passes round to 8 bits
+ * as the C does.
+ */
+static INLINE void sub_pixel_variance(const uint8_t *src_ptr, int src_stride,
+                                      int x_offset, int y_offset,
+                                      const uint8_t *ref_ptr, int ref_stride,
+                                      int w, int h, uint32_t *sse, int *sum) {
+  const uint8_t *const hf = bilinear_filters[x_offset];
+  const uint8_t *const vf = bilinear_filters[y_offset];
+  __m128i vsum = _mm_setzero_si128();
+  __m128i vsse = _mm_setzero_si128();
+  int i, c;
+
+  for (c = 0; c < w; c += 8) {
+    const uint8_t *s = src_ptr + c;
+    const uint8_t *r = ref_ptr + c;
+    __m128i prev = vf[0] == 128 ? _mm_setzero_si128() : first_pass(s, w, hf);
+
+    for (i = 0; i < h; ++i) {
+      __m128i out;
+
+      if (vf[0] == 128) {
+        out = first_pass(s, w, hf);
+      } else {
+        const __m128i cur = first_pass(s + src_stride, w, hf);
+        out = bilinear(prev, cur, vf);
+        prev = cur;
+      }
+      accumulate(_mm_sub_epi16(out, load_pixels(r, w)), &vsum, &vsse);
+      s += src_stride;
+      r += ref_stride;
+    }
+  }
+  finish(vsum, vsse, sse, sum);
+}
+
+#define SUBPIX_VAR_SSE2(w, h)                                                \
+  uint32_t vpx_sub_pixel_variance##w##x##h##_sse2(                           \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse) {               \
+    int sum;                                                                 \
+    sub_pixel_variance(src_ptr, src_stride, x_offset, y_offset, ref_ptr,     \
+                       ref_stride, w, h, sse, &sum);                         \
+    return *sse - (uint32_t)(((int64_t)sum * sum) / (w * h));                \
+  }
+
+SUBPIX_VAR_SSE2(16, 16)
+SUBPIX_VAR_SSE2(16, 8)
+SUBPIX_VAR_SSE2(8, 16)
+SUBPIX_VAR_SSE2(8, 8)
+SUBPIX_VAR_SSE2(4, 4)
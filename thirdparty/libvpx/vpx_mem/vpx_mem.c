@@ -15,6 +15,13 @@
 #include <string.h>
 #include "include/vpx_mem_intrnl.h"
 #include "vpx/vpx_integer.h"
+#if CONFIG_MULTITHREAD
+#include "vpx_ports/vpx_once.h"
+#include "vpx_util/vpx_thread.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
 
 #if !defined(VPX_MAX_ALLOCABLE_MEMORY)
 #if SIZE_MAX > (1ULL << 40)
@@ -35,34 +42,316 @@ static int check_size_argument_overflow(uint64_t nmemb, uint64_t size) {
   return 1;
 }
 
-static size_t *get_malloc_address_location(void *const mem) {
-  return ((size_t *)mem) - 1;
+#if !CONFIG_MULTITHREAD
+#define VPX_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define VPX_THREAD_LOCAL __declspec(thread)
+#else
+#define VPX_THREAD_LOCAL __thread
+#endif
+
+// Stored just below each block, so it can be freed to where it came from.
+typedef struct {
+  void *addr;
+  const vpx_mem_allocator_t *allocator;  // NULL for malloc().
+  size_t size;
+} mem_header;
+
+// The pool's size classes, eight per power of two from 64 bytes to 1 GB.
+#define POOL_MIN_SIZE_LOG2 6
+#define POOL_MAX_SIZE_LOG2 30
+#define POOL_CLASS_STEPS_LOG2 3
+#define POOL_CLASSES \
+  (((POOL_MAX_SIZE_LOG2 - POOL_MIN_SIZE_LOG2) << POOL_CLASS_STEPS_LOG2) + 1)
+#define POOL_DEFAULT_LIMIT ((size_t)128 << 20)
+
+typedef struct pool_block {
+  struct pool_block *next;
+} pool_block;
+
+// The pool's free lists, guarded by mem_mutex.
+static pool_block *pool_free_blocks[POOL_CLASSES];
+static size_t pool_cached_bytes;
+static size_t pool_limit = POOL_DEFAULT_LIMIT;
+
+// The counters and the default allocator are atomics rather than under
+// mem_mutex so codec instances on different threads do not serialise on
+// every allocation and free.
+typedef struct {
+  volatile uint64_t allocs;
+  volatile uint64_t frees;
+  volatile uint64_t failed_allocs;
+  volatile uint64_t bytes_allocated;
+  volatile uint64_t bytes_in_use;
+  volatile uint64_t peak_bytes_in_use;
+  volatile uint64_t pool_hits;
+  volatile uint64_t pool_misses;
+} mem_counters;
+
+static mem_counters mem_stats;
+
+static const vpx_mem_allocator_t *volatile default_allocator;
+static VPX_THREAD_LOCAL const vpx_mem_allocator_t *thread_allocator;
+
+#if !CONFIG_MULTITHREAD
+static uint64_t counter_add(volatile uint64_t *counter, uint64_t value) {
+  return *counter += value;
+}
+
+static uint64_t counter_load(volatile uint64_t *counter) { return *counter; }
+
+static int counter_replace(volatile uint64_t *counter, uint64_t expected,
+                           uint64_t value) {
+  if (*counter != expected) return 0;
+  *counter = value;
+  return 1;
+}
+
+static const vpx_mem_allocator_t *load_default_allocator(void) {
+  return default_allocator;
+}
+
+static void store_default_allocator(const vpx_mem_allocator_t *allocator) {
+  default_allocator = allocator;
+}
+#elif defined(_MSC_VER)
+// With the default /volatile:ms, volatile pointer reads and writes are
+// acquire and release.
+static uint64_t counter_add(volatile uint64_t *counter, uint64_t value) {
+  return (uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)counter,
+                                             (__int64)value) +
+         value;
+}
+
+static uint64_t counter_load(volatile uint64_t *counter) {
+  return (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)counter,
+                                                 0, 0);
+}
+
+static int counter_replace(volatile uint64_t *counter, uint64_t expected,
+                           uint64_t value) {
+  return _InterlockedCompareExchange64((volatile __int64 *)counter,
+                                       (__int64)value,
+                                       (__int64)expected) == (__int64)expected;
+}
+
+static const vpx_mem_allocator_t *load_default_allocator(void) {
+  return default_allocator;
+}
+
+static void store_default_allocator(const vpx_mem_allocator_t *allocator) {
+  default_allocator = allocator;
+}
+#else
+static uint64_t counter_add(volatile uint64_t *counter, uint64_t value) {
+  return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+}
+
+static uint64_t counter_load(volatile uint64_t *counter) {
+  return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static int counter_replace(volatile uint64_t *counter, uint64_t expected,
+                           uint64_t value) {
+  return __atomic_compare_exchange_n(counter, &expected, value, 0,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+static const vpx_mem_allocator_t *load_default_allocator(void) {
+  return __atomic_load_n(&default_allocator, __ATOMIC_ACQUIRE);
+}
+
+static void store_default_allocator(const vpx_mem_allocator_t *allocator) {
+  __atomic_store_n(&default_allocator, allocator, __ATOMIC_RELEASE);
+}
+#endif  // !CONFIG_MULTITHREAD
+
+#if CONFIG_MULTITHREAD
+static pthread_mutex_t mem_mutex;
+
+static void init_mem_mutex(void) { pthread_mutex_init(&mem_mutex, NULL); }
+
+static void lock_mem(void) {
+  once(init_mem_mutex);
+  pthread_mutex_lock(&mem_mutex);
+}
+
+static void unlock_mem(void) { pthread_mutex_unlock(&mem_mutex); }
+#else
+static void lock_mem(void) {}
+static void unlock_mem(void) {}
+#endif
+
+static mem_header *get_header(void *const mem) {
+  return ((mem_header *)mem) - 1;
 }
 
 static uint64_t get_aligned_malloc_size(size_t size, size_t align) {
-  return (uint64_t)size + align - 1 + ADDRESS_STORAGE_SIZE;
+  return (uint64_t)size + align - 1 + sizeof(mem_header);
 }
 
-static void set_actual_malloc_address(void *const mem,
-                                      const void *const malloc_addr) {
-  size_t *const malloc_addr_location = get_malloc_address_location(mem);
-  *malloc_addr_location = (size_t)malloc_addr;
+// Returns the class of a block of size bytes, or -1 if it is too large.
+static int get_pool_class(size_t size) {
+  int log2 = POOL_MIN_SIZE_LOG2;
+  size_t step;
+
+  if (size <= ((size_t)1 << POOL_MIN_SIZE_LOG2)) return 0;
+  if (size > ((size_t)1 << POOL_MAX_SIZE_LOG2)) return -1;
+
+  // Find the power of two below size, then the step above it within.
+  while (((size_t)2 << log2) < size) ++log2;
+  step = (size_t)1 << (log2 - POOL_CLASS_STEPS_LOG2);
+  return ((log2 - POOL_MIN_SIZE_LOG2) << POOL_CLASS_STEPS_LOG2) +
+         (int)((size - ((size_t)1 << log2) + step - 1) / step);
 }
 
-static void *get_actual_malloc_address(void *const mem) {
-  size_t *const malloc_addr_location = get_malloc_address_location(mem);
-  return (void *)(*malloc_addr_location);
+static size_t get_pool_class_size(int pool_class) {
+  const int log2 =
+      POOL_MIN_SIZE_LOG2 + ((pool_class - 1) >> POOL_CLASS_STEPS_LOG2);
+  const int steps = ((pool_class - 1) & ((1 << POOL_CLASS_STEPS_LOG2) - 1)) + 1;
+
+  if (pool_class == 0) return (size_t)1 << POOL_MIN_SIZE_LOG2;
+  return ((size_t)1 << log2) +
+         ((size_t)steps << (log2 - POOL_CLASS_STEPS_LOG2));
+}
+
+static void *pool_alloc(void *priv, size_t size) {
+  const int pool_class = get_pool_class(size);
+  pool_block *block = NULL;
+  (void)priv;
+
+  if (pool_class < 0) return malloc(size);
+
+  lock_mem();
+  block = pool_free_blocks[pool_class];
+  if (block) {
+    pool_free_blocks[pool_class] = block->next;
+    pool_cached_bytes -= get_pool_class_size(pool_class);
+  }
+  unlock_mem();
+
+  counter_add(block ? &mem_stats.pool_hits : &mem_stats.pool_misses, 1);
+
+  return block ? (void *)block : malloc(get_pool_class_size(pool_class));
+}
+
+static void pool_free(void *priv, void *mem, size_t size) {
+  const int pool_class = get_pool_class(size);
+  (void)priv;
+
+  if (pool_class >= 0) {
+    const size_t class_size = get_pool_class_size(pool_class);
+
+    lock_mem();
+    if (pool_cached_bytes + class_size <= pool_limit) {
+      pool_block *const block = (pool_block *)mem;
+
+      block->next = pool_free_blocks[pool_class];
+      pool_free_blocks[pool_class] = block;
+      pool_cached_bytes += class_size;
+      mem = NULL;
+    }
+    unlock_mem();
+  }
+  free(mem);
+}
+
+static const vpx_mem_allocator_t pool_allocator = { pool_alloc, pool_free,
+                                                    NULL };
+
+const vpx_mem_allocator_t *vpx_mem_pool_allocator(void) {
+  return &pool_allocator;
+}
+
+void vpx_mem_pool_set_limit(size_t max_cached_bytes) {
+  pool_block *freed = NULL;
+  int i;
+
+  lock_mem();
+  pool_limit = max_cached_bytes;
+  // Empty the largest classes first, they are the least likely to be reused.
+  for (i = POOL_CLASSES - 1;
+       i >= 0 && pool_cached_bytes > pool_limit; --i) {
+    while (pool_free_blocks[i] && pool_cached_bytes > pool_limit) {
+      pool_block *const block = pool_free_blocks[i];
+
+      pool_free_blocks[i] = block->next;
+      pool_cached_bytes -= get_pool_class_size(i);
+      block->next = freed;
+      freed = block;
+    }
+  }
+  unlock_mem();
+
+  while (freed) {
+    pool_block *const block = freed;
+
+    freed = block->next;
+    free(block);
+  }
+}
+
+void vpx_mem_get_stats(vpx_mem_stats_t *stats) {
+  stats->allocs = counter_load(&mem_stats.allocs);
+  stats->frees = counter_load(&mem_stats.frees);
+  stats->failed_allocs = counter_load(&mem_stats.failed_allocs);
+  stats->bytes_allocated = counter_load(&mem_stats.bytes_allocated);
+  stats->bytes_in_use = (size_t)counter_load(&mem_stats.bytes_in_use);
+  stats->peak_bytes_in_use = (size_t)counter_load(&mem_stats.peak_bytes_in_use);
+  stats->pool_hits = counter_load(&mem_stats.pool_hits);
+  stats->pool_misses = counter_load(&mem_stats.pool_misses);
+
+  lock_mem();
+  stats->pool_cached_bytes = pool_cached_bytes;
+  unlock_mem();
+}
+
+void vpx_mem_set_default_allocator(const vpx_mem_allocator_t *allocator) {
+  store_default_allocator(allocator);
+}
+
+const vpx_mem_allocator_t *vpx_mem_set_thread_allocator(
+    const vpx_mem_allocator_t *allocator) {
+  const vpx_mem_allocator_t *const previous = thread_allocator;
+
+  thread_allocator = allocator;
+  return previous;
 }
 
 void *vpx_memalign(size_t align, size_t size) {
+  const vpx_mem_allocator_t *allocator = thread_allocator;
   void *x = NULL, *addr;
-  const uint64_t aligned_size = get_aligned_malloc_size(size, align);
+  uint64_t aligned_size;
+
+  // The header below the block must itself be aligned.
+  if (align < sizeof(void *)) align = sizeof(void *);
+  aligned_size = get_aligned_malloc_size(size, align);
   if (!check_size_argument_overflow(1, aligned_size)) return NULL;
 
-  addr = malloc((size_t)aligned_size);
+  if (!allocator) allocator = load_default_allocator();
+
+  addr = allocator ? allocator->alloc(allocator->priv, (size_t)aligned_size)
+                   : malloc((size_t)aligned_size);
+
   if (addr) {
-    x = align_addr((unsigned char *)addr + ADDRESS_STORAGE_SIZE, align);
-    set_actual_malloc_address(x, addr);
+    const uint64_t in_use = counter_add(&mem_stats.bytes_in_use, aligned_size);
+    uint64_t peak = counter_load(&mem_stats.peak_bytes_in_use);
+    mem_header *header;
+
+    counter_add(&mem_stats.allocs, 1);
+    counter_add(&mem_stats.bytes_allocated, aligned_size);
+    while (in_use > peak &&
+           !counter_replace(&mem_stats.peak_bytes_in_use, peak, in_use)) {
+      peak = counter_load(&mem_stats.peak_bytes_in_use);
+    }
+
+    x = align_addr((unsigned char *)addr + sizeof(mem_header), align);
+    header = get_header(x);
+    header->addr = addr;
+    header->allocator = allocator;
+    header->size = (size_t)aligned_size;
+  } else {
+    counter_add(&mem_stats.failed_allocs, 1);
   }
   return x;
 }
@@ -80,7 +369,15 @@ void *vpx_calloc(size_t num, size_t size) {
 
 void vpx_free(void *memblk) {
   if (memblk) {
-    void *addr = get_actual_malloc_address(memblk);
-    free(addr);
+    const mem_header header = *get_header(memblk);
+
+    counter_add(&mem_stats.frees, 1);
+    counter_add(&mem_stats.bytes_in_use, (uint64_t)0 - header.size);
+
+    if (header.allocator) {
+      header.allocator->free(header.allocator->priv, header.addr, header.size);
+    } else {
+      free(header.addr);
+    }
   }
 }
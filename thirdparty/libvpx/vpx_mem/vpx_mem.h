@@ -20,6 +20,7 @@
 #include <stddef.h>
 
 #include "vpx/vpx_integer.h"
+#include "vpx/vpx_mem_allocator.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -30,6 +31,18 @@ void *vpx_malloc(size_t size);
 void *vpx_calloc(size_t num, size_t size);
 void vpx_free(void *memblk);
 
+/* Makes allocator the default for threads without their own, NULL for
+ * malloc().
+ */
+void vpx_mem_set_default_allocator(const vpx_mem_allocator_t *allocator);
+
+/* Makes allocator the one used by the calling thread, NULL for the default,
+ * and returns the one it replaces. The codec wrappers set an instance's
+ * allocator around each call into it.
+ */
+const vpx_mem_allocator_t *vpx_mem_set_thread_allocator(
+    const vpx_mem_allocator_t *allocator);
+
 #if CONFIG_VP9_HIGHBITDEPTH
 static INLINE void *vpx_memset16(void *dest, int val, size_t length) {
   size_t i;
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VPX_PORTS_RTCD_SLOTS_H_
+#define VPX_VPX_PORTS_RTCD_SLOTS_H_
+
+#include <stddef.h>
+
+#include "vpx/vp8.h"
+
+/* Helpers for the rtcd_slots() tables in the generated *_rtcd.h headers.
+ * Each slot is listed with RTCD_SLOT(). Slots bound at compile time name
+ * their variant directly, dispatched slots pass NULL and follow with one
+ * RTCD_VARIANT() per candidate so the resolved pointer can be matched.
+ */
+#define RTCD_SLOT(slot, variant_name)    \
+  do {                                   \
+    if (n < max_slots) {                 \
+      slots[n].name = #slot;             \
+      slots[n].variant = (variant_name); \
+    }                                    \
+    ++n;                                 \
+  } while (0)
+
+#define RTCD_VARIANT(slot, fn, variant_name)     \
+  do {                                           \
+    if (n <= max_slots && (slot) == (fn)) {      \
+      slots[n - 1].variant = (variant_name);     \
+    }                                            \
+  } while (0)
+
+#endif  // VPX_VPX_PORTS_RTCD_SLOTS_H_
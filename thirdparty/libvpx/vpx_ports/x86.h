@@ -226,6 +226,13 @@ static INLINE int x86_simd_caps(void) {
   return flags & mask;
 }
 
+// x86_simd_caps() further limited by x86_set_simd_caps_mask(). This is what
+// the RTCD setup functions dispatch on, and the first call freezes the mask.
+// x86_set_simd_caps_mask() returns -1 once the mask is frozen. Defined in
+// x86_cpudetect.c.
+int x86_rtcd_simd_caps(void);
+int x86_set_simd_caps_mask(unsigned int mask);
+
 // Fine-Grain Measurement Functions
 //
 // If you are timing a small region of code, access the timestamp counter
@@ -348,11 +355,12 @@ static unsigned short x87_get_control_word(void) {
   return mode;
 }
 #elif VPX_ARCH_X86_64
-/* No fldcw intrinsics on Windows x64, punt to external asm */
-extern void vpx_winx64_fldcw(unsigned short mode);
-extern unsigned short vpx_winx64_fstcw(void);
-#define x87_set_control_word vpx_winx64_fldcw
-#define x87_get_control_word vpx_winx64_fstcw
+/* No fldcw intrinsics on Windows x64. The Visual Studio project does not
+ * assemble float_control_word.asm, and MSVC never emits x87 code for x64
+ * targets anyway, so there is no precision control to change.
+ */
+static void x87_set_control_word(unsigned short mode) { (void)mode; }
+static unsigned short x87_get_control_word(void) { return 0x27f; }
 #else
 static void x87_set_control_word(unsigned short mode) {
   __asm { fldcw mode }
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "./vpx_config.h"
+#include "vpx_ports/vpx_once.h"
+#include "vpx_ports/x86.h"
+#include "vpx_util/vpx_thread.h"
+
+/* Set by vpx_codec_set_simd_caps_mask(). The RTCD tables are shared by every
+ * codec in the process, so the mask is frozen the first time it is read and
+ * later changes are refused. Both fields are guarded by mask_mutex.
+ */
+static unsigned int simd_caps_mask = ~0u;
+static int simd_caps_mask_frozen;
+
+#if CONFIG_MULTITHREAD
+static pthread_mutex_t mask_mutex;
+
+static void init_mask_mutex(void) { pthread_mutex_init(&mask_mutex, NULL); }
+
+static void lock_mask(void) {
+  once(init_mask_mutex);
+  pthread_mutex_lock(&mask_mutex);
+}
+
+static void unlock_mask(void) { pthread_mutex_unlock(&mask_mutex); }
+#else
+static void lock_mask(void) {}
+static void unlock_mask(void) {}
+#endif
+
+int x86_rtcd_simd_caps(void) {
+  unsigned int mask;
+
+  lock_mask();
+  simd_caps_mask_frozen = 1;
+  mask = simd_caps_mask;
+  unlock_mask();
+
+  return (int)((unsigned int)x86_simd_caps() & mask);
+}
+
+int x86_set_simd_caps_mask(unsigned int mask) {
+  int ret = -1;
+
+  lock_mask();
+  if (!simd_caps_mask_frozen) {
+    simd_caps_mask = mask;
+    ret = 0;
+  }
+  unlock_mask();
+
+  return ret;
+}
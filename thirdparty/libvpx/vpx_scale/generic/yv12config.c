@@ -47,8 +47,8 @@ int vp8_yv12_de_alloc_frame_buffer(YV12_BUFFER_CONFIG *ybf) {
   return 0;
 }
 
-int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
-                                  int height, int border) {
+int vp8_yv12_set_frame_geometry(YV12_BUFFER_CONFIG *ybf, int width,
+                                int height, int border) {
   if (ybf) {
     int aligned_width = (width + 15) & ~15;
     int aligned_height = (height + 15) & ~15;
@@ -60,29 +60,15 @@ int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
      *  uv_stride == y_stride/2, so enforce this here. */
     int uv_stride = y_stride >> 1;
     int uvplane_size = (uv_height + border) * uv_stride;
-    const size_t frame_size = yplane_size + 2 * uvplane_size;
-
-    if (!ybf->buffer_alloc) {
-      ybf->buffer_alloc = (uint8_t *)vpx_memalign(32, frame_size);
-#if defined(__has_feature)
-#if __has_feature(memory_sanitizer)
-      // This memset is needed for fixing the issue of using uninitialized
-      // value in msan test. It will cause a perf loss, so only do this for
-      // msan test.
-      memset(ybf->buffer_alloc, 0, frame_size);
-#endif
-#endif
-      ybf->buffer_alloc_sz = frame_size;
-    }
-
-    if (!ybf->buffer_alloc || ybf->buffer_alloc_sz < frame_size) return -1;
 
     /* Only support allocating buffers that have a border that's a multiple
-     * of 32. The border restriction is required to get 16-byte alignment of
-     * the start of the chroma rows without introducing an arbitrary gap
+     * of 16. The border restriction is required to get 16-byte alignment of
+     * the start of the luma rows without introducing an arbitrary gap
      * between planes, which would break the semantics of things like
-     * vpx_img_set_rect(). */
-    if (border & 0x1f) return -3;
+     * vpx_img_set_rect(). The chroma rows are 16-byte aligned too when the
+     * border is a multiple of 32, as VP8BORDERINPIXELS is. The compact VP8
+     * decoder buffers use 16 and only need 8-byte aligned chroma rows. */
+    if (border & 0xf) return -3;
 
     ybf->y_crop_width = width;
     ybf->y_crop_height = height;
@@ -101,13 +87,11 @@ int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
     ybf->alpha_stride = 0;
 
     ybf->border = border;
-    ybf->frame_size = frame_size;
+    ybf->frame_size = yplane_size + 2 * uvplane_size;
 
-    ybf->y_buffer = ybf->buffer_alloc + (border * y_stride) + border;
-    ybf->u_buffer =
-        ybf->buffer_alloc + yplane_size + (border / 2 * uv_stride) + border / 2;
-    ybf->v_buffer = ybf->buffer_alloc + yplane_size + uvplane_size +
-                    (border / 2 * uv_stride) + border / 2;
+    ybf->y_buffer = NULL;
+    ybf->u_buffer = NULL;
+    ybf->v_buffer = NULL;
     ybf->alpha_buffer = NULL;
 
     ybf->corrupted = 0; /* assume not currupted by errors */
@@ -116,6 +100,44 @@ int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
   return -2;
 }
 
+int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
+                                  int height, int border) {
+  if (ybf) {
+    const int ret = vp8_yv12_set_frame_geometry(ybf, width, height, border);
+    int yplane_size;
+    int uvplane_size;
+
+    if (ret < 0) return ret;
+
+    if (!ybf->buffer_alloc) {
+      ybf->buffer_alloc = (uint8_t *)vpx_memalign(32, ybf->frame_size);
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+      // This memset is needed for fixing the issue of using uninitialized
+      // value in msan test. It will cause a perf loss, so only do this for
+      // msan test.
+      memset(ybf->buffer_alloc, 0, ybf->frame_size);
+#endif
+#endif
+      ybf->buffer_alloc_sz = ybf->frame_size;
+    }
+
+    if (!ybf->buffer_alloc || ybf->buffer_alloc_sz < ybf->frame_size) {
+      return -1;
+    }
+
+    yplane_size = (ybf->y_height + 2 * border) * ybf->y_stride;
+    uvplane_size = (ybf->uv_height + border) * ybf->uv_stride;
+    ybf->y_buffer = ybf->buffer_alloc + (border * ybf->y_stride) + border;
+    ybf->u_buffer = ybf->buffer_alloc + yplane_size +
+                    (border / 2 * ybf->uv_stride) + border / 2;
+    ybf->v_buffer = ybf->buffer_alloc + yplane_size + uvplane_size +
+                    (border / 2 * ybf->uv_stride) + border / 2;
+    return 0;
+  }
+  return -2;
+}
+
 int vp8_yv12_alloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width, int height,
                                 int border) {
   if (ybf) {
@@ -70,6 +70,11 @@ int vp8_yv12_alloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width, int height,
                                 int border);
 int vp8_yv12_realloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width,
                                   int height, int border);
+/* Sets the sizes, strides and frame_size of a frame buffer without giving it
+ * memory. The plane pointers are cleared.
+ */
+int vp8_yv12_set_frame_geometry(YV12_BUFFER_CONFIG *ybf, int width,
+                                int height, int border);
 int vp8_yv12_de_alloc_frame_buffer(YV12_BUFFER_CONFIG *ybf);
 
 int vpx_alloc_frame_buffer(YV12_BUFFER_CONFIG *ybf, int width, int height,